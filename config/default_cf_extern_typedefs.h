@@ -71,7 +71,7 @@ typedef enum
  */
 typedef enum
 {
-    CF_QueueIdx_PEND      = 0, /**< \brief first one on this list is active */
+    CF_QueueIdx_PEND      = 0, /**< \brief files waiting for a transaction */
     CF_QueueIdx_TXA       = 1,
     CF_QueueIdx_TXW       = 2,
     CF_QueueIdx_RX        = 3,
@@ -108,7 +108,7 @@ typedef struct CF_TxnFilenames
  *        CF_ConfigTable_t, configuration table - will change size of file
  *        CF_ConfigPacket_t, set config params command
  *        CF_TxFileCmd_t, transmit file command
- *        CF_PlaybackDirCmd_t, equivalent to above
+ *        CF_PlaybackDirCmd_t, playback directory command
  *        CF_Transaction_Payload_t, any command that selects a transaction based on EID
  *
  * @par Limits
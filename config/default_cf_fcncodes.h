@@ -127,7 +127,7 @@ typedef enum
      *  \par Criticality
      *       None
      *
-     *  \sa #CF_PLAYBACK_DIR_CC
+     *  \sa #CF_PLAYBACK_DIR_CC, #CF_TX_FILE_MULTI_CC
      */
     CF_TX_FILE_CC = 2,
 
@@ -138,8 +138,9 @@ typedef enum
      *       Transmits all the files in a directory
      *
      *  \par Command Structure
-     *       #CF_PlaybackDirCmd_t - note it's currently a typedef of CF_TxFileCmd_t, where
-     *       the source filename and destination filename are directories
+     *       #CF_PlaybackDirCmd_t - the same fields as CF_TxFileCmd_t, where the source
+     *       filename and destination filename are directories, plus the number of files
+     *       that may be in transfer at once and the number read ahead of the transfers
      *
      *  \par Command Verification
      *       Successful execution of this command may be verified with
@@ -159,7 +160,7 @@ typedef enum
      *  \par Criticality
      *       None
      *
-     *  \sa #CF_TX_FILE_CC
+     *  \sa #CF_TX_FILE_CC, #CF_TX_MANIFEST_CC
      */
     CF_PLAYBACK_DIR_CC = 3,
 
@@ -439,7 +440,13 @@ typedef enum
      * \brief Write queue
      *
      *  \par Description
-     *       Writes requested queue(s) to a file
+     *       Writes requested queue(s) to a file.  The text format is written
+     *       completely within the command.  The binary format, a
+     *       #CF_QueueFileHeader_t followed by #CF_QueueFileEntry_t records, is
+     *       written #CF_QUEUE_DUMP_RECORDS_PER_WAKEUP entries per wakeup, and
+     *       only one binary file can be in progress at a time.  Entries that
+     *       move between queues while a binary file is written may appear
+     *       twice or not at all.
      *
      *  \par Command Structure
      *       #CF_WriteQueueCmd_t
@@ -449,12 +456,14 @@ typedef enum
      *       the following telemetry:
      *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.cmd will increment
      *       - #CF_EID_INF_CMD_WQ
+     *       - #CF_EID_INF_CMD_WQ_DONE when a binary file is complete
      *
      *  \par Error Conditions
      *       This command may fail for the following reason(s):
      *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
-     *       - Invalid parameter combination, #CF_EID_ERR_CMD_WQ_ARGS
+     *       - Invalid parameter combination or format, #CF_EID_ERR_CMD_WQ_ARGS
      *       - Invalid channel number, #CF_EID_ERR_CMD_WQ_CHAN
+     *       - Binary file already in progress, #CF_EID_ERR_CMD_WQ_BUSY
      *       - Open file to write failed, #CF_EID_ERR_CMD_WQ_OPEN
      *       - Write RX data failed, #CF_EID_ERR_CMD_WQ_WRITEQ_RX
      *       - Write RX history data failed, #CF_EID_ERR_CMD_WQ_WRITEHIST_RX
@@ -722,8 +731,149 @@ typedef enum
      */
     CF_DISABLE_ENGINE_CC = 23,
 
+    /**
+     * \brief Transmit the files listed in a manifest
+     *
+     *  \par Description
+     *       Opens a manifest file holding a list of #CF_TxManifestEntry_t records, each
+     *       giving the source and destination filename, class, priority and destination
+     *       entity of one file to send.  Transactions are created from the records
+     *       incrementally, on each wakeup, as the manifest's transactions complete.
+     *       Only one manifest may be in progress per channel.  Progress is reported in
+     *       #CF_HkChannel_Data_t.manifest_total, #CF_HkChannel_Data_t.manifest_queued
+     *       and #CF_HkChannel_Data_t.manifest_skipped.
+     *
+     *  \par Command Structure
+     *       #CF_TxManifestCmd_t
+     *
+     *  \par Command Verification
+     *       Successful execution of this command may be verified with
+     *       the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.cmd will increment
+     *       - #CF_EID_INF_CMD_TX_MANIFEST
+     *
+     *  \par Error Conditions
+     *       This command may fail for the following reason(s):
+     *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
+     *       - Invalid parameter, #CF_EID_ERR_CMD_BAD_PARAM
+     *       - Manifest already in progress on the channel, #CF_EID_ERR_CFDP_MANIFEST_SLOT
+     *       - Manifest file could not be opened, #CF_EID_ERR_CFDP_MANIFEST_OPEN
+     *       - Manifest initialization failure, #CF_EID_ERR_CMD_TX_MANIFEST
+     *
+     *  \par Evidence of failure may be found in the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.err will increment
+     *
+     *  \par Criticality
+     *       None
+     *
+     *  \sa #CF_TX_FILE_CC, #CF_PLAYBACK_DIR_CC
+     */
+    CF_TX_MANIFEST_CC = 24,
+
+    /**
+     * \brief Enable performance statistics
+     *
+     *  \par Description
+     *       Clears and starts collecting the execution time statistics of the
+     *       engine phases listed in #CF_PerfPhase_t and the latency
+     *       histograms listed in #CF_LatencyHist_t.  While enabled, a
+     *       #CF_PerfTlmPacket_t and a #CF_LatencyTlmPacket_t per channel are
+     *       sent with every housekeeping packet.  If already enabled the
+     *       statistics are cleared.
+     *
+     *  \par Command Structure
+     *       No Payload / Arguments
+     *
+     *  \par Command Verification
+     *       Successful execution of this command may be verified with
+     *       the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.cmd will increment
+     *       - #CF_EID_INF_CMD_ENABLE_PERF_STATS
+     *
+     *  \par Error Conditions
+     *       This command may fail for the following reason(s):
+     *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
+     *
+     *  \par Evidence of failure may be found in the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.err will increment
+     *
+     *  \par Criticality
+     *       None
+     *
+     *  \sa #CF_DISABLE_PERF_STATS_CC
+     */
+    CF_ENABLE_PERF_STATS_CC = 25,
+
+    /**
+     * \brief Disable performance statistics
+     *
+     *  \par Description
+     *       Stops collecting the engine phase statistics and latency
+     *       histograms and sending #CF_PerfTlmPacket_t and
+     *       #CF_LatencyTlmPacket_t.  The performance log markers are not
+     *       affected.
+     *
+     *  \par Command Structure
+     *       No Payload / Arguments
+     *
+     *  \par Command Verification
+     *       Successful execution of this command may be verified with
+     *       the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.cmd will increment
+     *       - #CF_EID_INF_CMD_DISABLE_PERF_STATS
+     *
+     *  \par Error Conditions
+     *       This command may fail for the following reason(s):
+     *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
+     *
+     *  \par Evidence of failure may be found in the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.err will increment
+     *
+     *  \par Criticality
+     *       None
+     *
+     *  \sa #CF_ENABLE_PERF_STATS_CC
+     */
+    CF_DISABLE_PERF_STATS_CC = 26,
+
+    /**
+     * \brief Transmit a file to several destinations
+     *
+     *  \par Description
+     *       Queues one transaction of the file for each of the destination
+     *       entities listed in the command.  The transactions share a single open
+     *       file and checksum, and while they are sending file data together, each
+     *       part of the file is read once and sent to all of them.  Every transaction
+     *       keeps its own NAK and retransmit state, and completes on its own.
+     *
+     *  \par Command Structure
+     *       #CF_TxFileMultiCmd_t
+     *
+     *  \par Command Verification
+     *       Successful execution of this command may be verified with
+     *       the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.cmd will increment
+     *       - #CF_EID_INF_CMD_TX_FILE_MULTI
+     *
+     *  \par Error Conditions
+     *       This command may fail for the following reason(s):
+     *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
+     *       - Invalid parameter, #CF_EID_ERR_CMD_BAD_PARAM
+     *       - No free transmit group, #CF_EID_ERR_CFDP_GROUP_SLOT
+     *       - Transaction initialization failure, #CF_EID_ERR_CMD_TX_FILE_MULTI
+     *
+     *  \par Evidence of failure may be found in the following telemetry:
+     *       - #CF_HkPacket_Payload_t.counters #CF_HkCmdCounters_t.err will increment
+     *
+     *  \par Criticality
+     *       None
+     *
+     *  \sa #CF_TX_FILE_CC
+     */
+    CF_TX_FILE_MULTI_CC = 27,
+
     /** \brief Command code limit used for validity check and array sizing */
-    CF_NUM_COMMANDS = 24,
+    CF_NUM_COMMANDS = 28,
 } CF_CMDS;
 
 /**\}*/
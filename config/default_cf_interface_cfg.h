@@ -66,6 +66,66 @@
  */
 #define CF_NAK_MAX_SEGMENTS (58)
 
+/**
+ *  @brief Max transactions reported in one transaction status packet
+ *
+ *  @par Description:
+ *       Each channel with active transactions sends as many transaction
+ *       status packets as needed at every housekeeping request, each holding
+ *       up to this many transactions.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 255.
+ */
+#define CF_TXN_TLM_MAX_ENTRIES (8)
+
+/**
+ *  @brief Max number of destinations of a multi-destination file transmit
+ *
+ *  @par Description:
+ *       A transmit multi command names up to this many peers, each of which
+ *       gets its own transaction of the file.  This sets the size of the
+ *       destination list in the command.
+ *
+ *  @par Limits:
+ *       Must be between 2 and 255.
+ */
+#define CF_TX_GROUP_MAX_DEST (4)
+
+/**
+ *  @brief Number of bins in each latency histogram
+ *
+ *  @par Description:
+ *       Bin 0 counts latencies below #CF_LATENCY_HIST_BASE_MSEC, and each
+ *       following bin covers twice the time of the one before.  The last bin
+ *       also counts everything longer.
+ *
+ *  @par Limits:
+ *       Must be between 2 and 32.
+ */
+#define CF_LATENCY_HIST_BINS (20)
+
+/**
+ *  @brief Upper bound of the first latency histogram bin, in milliseconds
+ *
+ *  @par Limits:
+ *       Must be greater than 0.
+ */
+#define CF_LATENCY_HIST_BASE_MSEC (100)
+
+/**
+ *  @brief Number of priority classes in the latency histograms
+ *
+ *  @par Description:
+ *       Transactions of priority 0 up to this value minus 2 each have their
+ *       own histograms, and the last class holds all lower priorities (higher
+ *       values).  RX transactions have no priority and count as priority 0.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 256.
+ */
+#define CF_LATENCY_PRIO_CLASSES (4)
+
 /**
  *  @brief Max number of polling directories per channel.
  *
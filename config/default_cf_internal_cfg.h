@@ -111,7 +111,9 @@
  *  @brief Number of max commanded playback files per chan.
  *
  *  @par Description:
- *       This is the max number of outstanding ground commanded file transmits per channel.
+ *       This is the max number of ground commanded file transmits per channel that
+ *       are in transfer at once.  Commanded files beyond this wait on the pending
+ *       queue, limited by #CF_NUM_PENDING_FILES_PER_CHANNEL.
  *
  *  @par Limits:
  *
@@ -146,25 +148,131 @@
  *  @brief Number of histories per channel
  *
  *  @par Description:
- *       Each channel can support this number of file receive transactions at a time.
+ *       Each channel keeps a record of up to this number of finished
+ *       transactions.  A record takes 16 bytes, the file names are kept
+ *       separately in #CF_HISTORY_NAMES_SIZE_PER_CHANNEL.  The oldest records
+ *       are dropped when either one runs out.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 65535.
+ */
+#define CF_NUM_HISTORIES_PER_CHANNEL (1280)
+
+/**
+ *  @brief Size of the history file name storage per channel
+ *
+ *  @par Description:
+ *       Each history record keeps the last part of its source file name here,
+ *       and the last part of the destination file name if it is different.
+ *       The directories are kept in #CF_NUM_HISTORY_PATH_PREFIXES.  The
+ *       default allows for 15 character file names on average.
+ *
+ *  @par Limits:
+ *       Must be between 256 and 65535, and at least twice #CF_FILENAME_MAX_LEN.
+ */
+#define CF_HISTORY_NAMES_SIZE_PER_CHANNEL (20480)
+
+/**
+ *  @brief Number of interned history path prefixes
+ *
+ *  @par Description:
+ *       Each distinct directory named by a history record on any channel takes
+ *       one entry.  When the table is full, records store the whole file name
+ *       in the name storage of the channel instead.
  *
  *  @par Limits:
- *       65536 is the current max.
+ *       Must be between 1 and 65534.
  */
-#define CF_NUM_HISTORIES_PER_CHANNEL (256)
+#define CF_NUM_HISTORY_PATH_PREFIXES (16)
 
 /**
  *  @brief Number of transactions per playback directory.
  *
  *  @par Description:
- *       Each playback/polling directory operation will be able to have this
- *       many active transfers at a time pending or active.
+ *       The channel transaction pool is sized for each playback/polling
+ *       directory operation to have this many transfers active at a time.
+ *       This is also the default concurrency and pending depth when a playback
+ *       command or polling directory does not set them.  A playback configured
+ *       for more transfers than this may only use transactions that are not
+ *       held back for receive, commanded files, or the unused share of the
+ *       other active playbacks.
  *
  *  @par Limits:
  *
  */
 #define CF_NUM_TRANSACTIONS_PER_PLAYBACK (5)
 
+/**
+ *  @brief Number of pending file records per channel
+ *
+ *  @par Description:
+ *       Every file waiting on the pending queue of a channel, whether it was
+ *       commanded, read from a playback or polling directory, or listed in a
+ *       manifest, is held in a small pending file record.  Only when the file
+ *       moves to the active queue does it get a transaction, history entry and
+ *       chunk list.  This is the number of such records per channel, and so
+ *       the number of files that can be queued on a channel at once.  It is
+ *       also the upper limit for the pending depth of any one playback.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 65535.
+ */
+#define CF_NUM_PENDING_FILES_PER_CHANNEL (256)
+
+/**
+ *  @brief Number of interned path prefixes
+ *
+ *  @par Description:
+ *       Pending file records keep the last part of each path name, and a
+ *       reference to the rest of the path in a table shared by all channels.
+ *       Each distinct directory in use by a pending file or a playback takes
+ *       one entry, no matter how many files refer to it.
+ *
+ *  @par Limits:
+ *       Must be between 2 and 65534.
+ */
+#define CF_NUM_PATH_PREFIXES (32)
+
+/**
+ *  @brief Number of queue entries written to a binary queue file per wakeup
+ *
+ *  @par Description:
+ *       A write queue command for the binary format only opens the file and
+ *       writes its header.  The entries are then written this many at a time,
+ *       one batch per wakeup, so a deep history does not hold up the app.
+ *       History entries of the other direction count toward the limit.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 65535.
+ */
+#define CF_QUEUE_DUMP_RECORDS_PER_WAKEUP (64)
+
+/**
+ *  @brief Number of multi-destination transmits in progress at once, all channels
+ *
+ *  @par Description:
+ *       Each transmit multi command takes a group entry, which holds the open
+ *       file, the checksum and the last file data read that its transactions
+ *       share.  The entry is freed when the last of its files is done.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 255.
+ */
+#define CF_NUM_TX_GROUPS (2)
+
+/**
+ *  @brief Number of class 1 sends adding parity PDUs at once, all channels
+ *
+ *  @par Description:
+ *       Each class 1 send on a channel with a nonzero fec_group_size takes
+ *       an encoder, which holds the parity of the group being sent.  A send
+ *       that finds none free goes without parity.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 255.
+ */
+#define CF_NUM_FEC_ENCODERS (4)
+
 /**
  *  @brief Name of the CF Configuration Table
  *
@@ -203,6 +311,81 @@
  */
 #define CF_R2_CRC_CHUNK_SIZE (1024)
 
+/**
+ *  @brief Depth of the per-channel outgoing PDU buffer pool
+ *
+ *  @par Description
+ *       Each channel keeps this many software bus buffers allocated and
+ *       pre-initialized with the channel output MID. The pool is topped up once
+ *       per engine cycle, so building a PDU does not need to go through the SB
+ *       allocator. If the pool runs dry during a cycle, buffers are allocated
+ *       directly from SB as a fallback. Ideally this is at least as large as
+ *       the channel's max_outgoing_messages_per_wakeup.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 255.  Every buffer held in the pool counts
+ *       against the SB buffer memory pool.
+ */
+#define CF_OUTGOING_BUF_POOL_DEPTH (8)
+
+/**
+ *  @brief Max number of received PDUs taken from the transport at once
+ *
+ *  @par Description
+ *       The engine asks the channel transport for up to this many received
+ *       PDUs per call, and processes them before asking again. Transports that
+ *       can hold several messages at once (e.g. the shared memory ring) hand
+ *       over a whole batch, while the software bus backend always returns one.
+ *       This also sets the number of receive buffers kept for the UDP backend,
+ *       and the number of PDUs copied and reordered together on channels that
+ *       have rx_batch_sort enabled.
+ *
+ *  @par Limits:
+ *       Must be between 1 and 255.
+ */
+#define CF_PDU_RX_BATCH_SIZE (8)
+
+/**
+ *  @brief Number of slots in each shared memory PDU ring
+ *
+ *  @par Description
+ *       Channels using the shared memory transport exchange PDUs with the
+ *       link driver through two single-producer/single-consumer rings, one
+ *       per direction. Each slot holds one encapsulated PDU.
+ *
+ *  @par Limits:
+ *       Must be a power of two, and at least 2.
+ */
+#define CF_SHM_RING_DEPTH (8)
+
+/**
+ *  @brief Build in the shared memory PDU transport
+ *
+ *  @par Description
+ *       The rings take CF_SHM_RING_DEPTH encapsulated PDUs per direction for
+ *       every channel, whether or not the channel uses them.  Set to 0 to
+ *       leave them and the transport out, a channel configured for the
+ *       shared memory transport then fails to open.
+ *
+ *  @par Limits:
+ *       0 or 1.
+ */
+#define CF_ENABLE_SHM_TRANSPORT (1)
+
+/**
+ *  @brief Build in the UDP PDU transport
+ *
+ *  @par Description
+ *       The transport keeps one transmit and CF_PDU_RX_BATCH_SIZE receive
+ *       buffers.  Set to 0 to leave them and the transport out, a channel
+ *       configured for the UDP transport then fails to open.  The addresses
+ *       and ports of each channel are in the configuration table.
+ *
+ *  @par Limits:
+ *       0 or 1.
+ */
+#define CF_ENABLE_UDP_TRANSPORT (1)
+
 /**
  *  @brief Number of milliseconds to wait for a SB message
  */
@@ -84,7 +84,9 @@ typedef struct CF_HkFault
     uint16 nak_limit;          /**< \brief NAK limit exceeded fault counter */
     uint16 ack_limit;          /**< \brief ACK limit exceeded fault counter */
     uint16 inactivity_timer;   /**< \brief Inactivity timer exceeded counter */
-    uint16 spare;              /**< \brief Alignment spare to avoid implicit padding */
+    uint16 out_pool_empty;     /**< \brief Outgoing PDU buffer pool empty counter */
+    uint16 transport_send;     /**< \brief PDU transport send failure counter */
+    uint16 spare[3];           /**< \brief Alignment spare to avoid implicit padding */
 } CF_HkFault_t;
 
 /**
@@ -107,7 +109,11 @@ typedef struct CF_HkChannel_Data
     uint8           poll_counter;            /**< \brief Number of active polling directories */
     uint8           playback_counter;        /**< \brief Number of active playback directories */
     uint8           frozen;                  /**< \brief Frozen state: 0 == not frozen, else frozen */
-    uint8           spare[7];                /**< \brief Alignment spare (uint64 values in the counters) */
+    uint8           manifest_active;         /**< \brief 1 while a TX manifest is being processed */
+    uint8           spare[2];                /**< \brief Alignment spare for the manifest counters */
+    uint32          manifest_total;          /**< \brief Number of records in the current/last TX manifest */
+    uint32          manifest_queued;         /**< \brief Records of the TX manifest queued for transmit so far */
+    uint32          manifest_skipped;        /**< \brief Records of the TX manifest skipped as invalid so far */
 } CF_HkChannel_Data_t;
 
 /**
@@ -138,6 +144,125 @@ typedef struct CF_EotPacket_Payload
     CF_TxnFilenames_t   fnames;     /**< \brief file names associated with this transaction */
 } CF_EotPacket_Payload_t;
 
+/**
+ * \brief Progress of one active transaction
+ *
+ * The rate is over the time since the previous report of the transaction,
+ * and the time in state has the resolution of the report period.
+ */
+typedef struct CF_TxnTlm_Entry
+{
+    CF_TransactionSeq_t seq_num;          /**< \brief Transaction sequence number */
+    CF_EntityId_t       src_eid;          /**< \brief Source entity id of the transaction */
+    CF_EntityId_t       peer_eid;         /**< \brief Entity id of the other side */
+    uint8               direction;        /**< \brief Direction: 0=RX, 1=TX */
+    uint8               state;            /**< \brief Transaction state */
+    uint8               sub_state;        /**< \brief TX or RX sub state within the state */
+    uint8               suspended;        /**< \brief 1 if the transaction is suspended */
+    uint64              fsize;            /**< \brief File size, 0 until known on RX */
+    uint64              progress_bytes;   /**< \brief TX: file data sent at least once, RX: file data received */
+    uint64              gap_bytes;        /**< \brief Class 2 file data NAKed or missing, still to send or receive */
+    uint64              retransmit_bytes; /**< \brief Class 2 file data sent or received again to fill gaps */
+    uint32              rate;             /**< \brief File data bytes per second since the previous report */
+    uint32              time_in_state;    /**< \brief Seconds in the current state and sub state */
+} CF_TxnTlm_Entry_t;
+
+/**
+ * \brief Active transaction status packet
+ */
+typedef struct CF_TxnTlmPacket_Payload
+{
+    uint8 channel;  /**< \brief Channel number */
+    uint8 num_txns; /**< \brief Number of valid entries in txns */
+    uint8 spare[6]; /**< \brief Alignment spare (CF_TxnTlm_Entry_t is 8 byte aligned) */
+
+    CF_TxnTlm_Entry_t txns[CF_TXN_TLM_MAX_ENTRIES]; /**< \brief Active transactions of the channel */
+} CF_TxnTlmPacket_Payload_t;
+
+/**
+ * \brief Engine phases timed by the performance statistics
+ *
+ * Each phase also has a performance log ID in cf_perfids.h.
+ */
+typedef enum
+{
+    CF_PerfPhase_CYCLE         = 0,  /**< \brief Whole engine cycle of one wakeup */
+    CF_PerfPhase_RECV          = 1,  /**< \brief Receive PDUs of one channel */
+    CF_PerfPhase_TICK_RX       = 2,  /**< \brief RX transaction ticks of one channel */
+    CF_PerfPhase_TICK_TXW_NORM = 3,  /**< \brief TX wait transaction ticks of one channel */
+    CF_PerfPhase_TICK_TXW_NAK  = 4,  /**< \brief TX wait NAK response ticks of one channel */
+    CF_PerfPhase_CYCLE_TX      = 5,  /**< \brief New file data of one channel */
+    CF_PerfPhase_PLAYBACK      = 6,  /**< \brief Playback directories of one channel */
+    CF_PerfPhase_POLLING       = 7,  /**< \brief Polling directories of one channel */
+    CF_PerfPhase_NAK           = 8,  /**< \brief Gap computation and sending of one NAK */
+    CF_PerfPhase_CRC           = 9,  /**< \brief One R2 CRC chunk */
+    CF_PerfPhase_ENCODE        = 10, /**< \brief Encoding of one PDU header */
+    CF_PerfPhase_DECODE        = 11, /**< \brief Decoding of one PDU header */
+    CF_PerfPhase_NUM           = 12  /**< \brief Number of phases */
+} CF_PerfPhase_t;
+
+/**
+ * \brief Execution time statistics of one engine phase
+ */
+typedef struct CF_PerfPhaseTlm
+{
+    uint32 count;    /**< \brief Number of times the phase ran */
+    uint32 min_usec; /**< \brief Shortest run in microseconds */
+    uint32 avg_usec; /**< \brief Average run in microseconds */
+    uint32 max_usec; /**< \brief Longest run in microseconds */
+} CF_PerfPhaseTlm_t;
+
+/**
+ * \brief Engine phase performance statistics packet
+ *
+ * Statistics are since the enable performance statistics command, indexed
+ * by #CF_PerfPhase_t.
+ */
+typedef struct CF_PerfTlmPacket_Payload
+{
+    CF_PerfPhaseTlm_t phase[CF_PerfPhase_NUM]; /**< \brief Statistics of each phase */
+} CF_PerfTlmPacket_Payload_t;
+
+/**
+ * \brief Latencies measured by the latency histograms
+ */
+typedef enum
+{
+    CF_LatencyHist_PEND  = 0, /**< \brief Wait on the pending queue */
+    CF_LatencyHist_TXA   = 1, /**< \brief Time on the active TX queue */
+    CF_LatencyHist_TXW   = 2, /**< \brief Time on the TX wait queue, for the peer to finish */
+    CF_LatencyHist_RX    = 3, /**< \brief Time on the RX queue */
+    CF_LatencyHist_TOTAL = 4, /**< \brief Initiation to end of transaction, pending time included */
+    CF_LatencyHist_NUM   = 5  /**< \brief Number of latency histograms per priority class */
+} CF_LatencyHist_t;
+
+/**
+ * \brief One latency histogram
+ *
+ * Bin 0 counts latencies below the base time of the packet, bin n those
+ * from base * 2^(n-1) up to base * 2^n.  The last bin counts everything
+ * from its lower bound up.
+ */
+typedef struct CF_LatencyHistTlm
+{
+    uint32 bins[CF_LATENCY_HIST_BINS]; /**< \brief Number of latencies in each bin */
+} CF_LatencyHistTlm_t;
+
+/**
+ * \brief Queue and transaction latency packet
+ *
+ * Histograms of one channel since the enable performance statistics
+ * command, indexed by #CF_LatencyHist_t and priority class.
+ */
+typedef struct CF_LatencyTlmPacket_Payload
+{
+    uint8  channel;   /**< \brief Channel number */
+    uint8  spare[3];  /**< \brief Alignment spare */
+    uint32 base_msec; /**< \brief Upper bound of bin 0 in milliseconds */
+
+    CF_LatencyHistTlm_t hist[CF_LatencyHist_NUM][CF_LATENCY_PRIO_CLASSES]; /**< \brief Histograms */
+} CF_LatencyTlmPacket_Payload_t;
+
 /**\}*/
 
 /**
@@ -188,6 +313,15 @@ typedef enum
     CF_Queue_all     = 3  /**< \brief Queue all */
 } CF_Queue_t;
 
+/**
+ * \brief File format IDs for use for Write Queue cmd
+ */
+typedef enum
+{
+    CF_QueueFileFormat_text   = 0, /**< \brief One line of text per entry, written within the command */
+    CF_QueueFileFormat_binary = 1  /**< \brief Header and fixed size records, written over several wakeups */
+} CF_QueueFileFormat_t;
+
 /**
  * \brief Parameter IDs for use with Get/Set parameter messages
  *
@@ -249,6 +383,72 @@ typedef struct CF_TxFile_Payload
     char          dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination file/directory name */
 } CF_TxFile_Payload_t;
 
+/**
+ * \brief Transmit file to several destinations command structure
+ *
+ * For command details see #CF_TX_FILE_MULTI_CC
+ */
+typedef struct CF_TxFileMulti_Payload
+{
+    uint8         cfdp_class;                        /**< \brief CFDP class: 0=class 1, 1=class 2 */
+    uint8         keep;                              /**< \brief Keep file flag: 1=keep, else delete */
+    uint8         chan_num;                          /**< \brief Channel number */
+    uint8         priority;                          /**< \brief Priority: 0=highest priority */
+    uint8         num_dest;                          /**< \brief Number of entries used in dest_ids */
+    uint8         spare[3];                          /**< \brief Alignment spare, uint32 multiple */
+    CF_EntityId_t dest_ids[CF_TX_GROUP_MAX_DEST];    /**< \brief Destination entity ids */
+    char          src_filename[CF_FILENAME_MAX_LEN]; /**< \brief Source file name */
+    char          dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination file name, the same at every peer */
+} CF_TxFileMulti_Payload_t;
+
+/**
+ * \brief Playback directory command structure
+ *
+ * For command details see #CF_PLAYBACK_DIR_CC
+ */
+typedef struct CF_PlaybackDir_Payload
+{
+    uint8         cfdp_class;                        /**< \brief CFDP class: 0=class 1, 1=class 2 */
+    uint8         keep;                              /**< \brief Keep file flag: 1=keep, else delete */
+    uint8         chan_num;                          /**< \brief Channel number */
+    uint8         priority;                          /**< \brief Priority: 0=highest priority */
+    CF_EntityId_t dest_id;                           /**< \brief Destination entity id */
+    char          src_filename[CF_FILENAME_MAX_LEN]; /**< \brief Source directory name */
+    char          dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination directory name */
+    uint16        max_active;                        /**< \brief Max files in transfer at once, 0=default */
+    uint16        max_pending;                       /**< \brief Max files read ahead of the transfers, 0=default */
+} CF_PlaybackDir_Payload_t;
+
+/**
+ * \brief Transmit manifest command structure
+ *
+ * For command details see #CF_TX_MANIFEST_CC
+ */
+typedef struct CF_TxManifest_Payload
+{
+    uint8 keep;     /**< \brief Keep file flag: 1=keep, else delete, applies to all listed files */
+    uint8 chan_num; /**< \brief Channel number */
+    uint8 spare[2]; /**< \brief Alignment spare, puts filename on 32-bit boundary */
+
+    char filename[CF_FILENAME_MAX_LEN]; /**< \brief Manifest file to read */
+} CF_TxManifest_Payload_t;
+
+/**
+ * \brief Transmit manifest file record
+ *
+ * A manifest file is a plain sequence of these records, in the byte order
+ * of the flight processor.  See #CF_TX_MANIFEST_CC.
+ */
+typedef struct CF_TxManifestEntry
+{
+    uint8         cfdp_class;                        /**< \brief CFDP class: 0=class 1, 1=class 2 */
+    uint8         priority;                          /**< \brief Priority: 0=highest priority */
+    uint8         spare[2];                          /**< \brief Alignment spare */
+    CF_EntityId_t dest_id;                           /**< \brief Destination entity id */
+    char          src_filename[CF_FILENAME_MAX_LEN]; /**< \brief Source file name */
+    char          dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination file name */
+} CF_TxManifestEntry_t;
+
 /**
  * \brief Write Queue command structure
  *
@@ -258,12 +458,65 @@ typedef struct CF_WriteQueue_Payload
 {
     uint8 type;  /**< \brief Transaction direction: all=0, up=1, down=2 */
     uint8 chan;  /**< \brief Channel number */
-    uint8 queue; /**< \brief Queue type: 0=pending, 1=active, 2=history, 3=all */
-    uint8 spare; /**< \brief Alignment spare, puts filename on 32-bit boundary */
+    uint8 queue;  /**< \brief Queue type: 0=pending, 1=active, 2=history, 3=all */
+    uint8 format; /**< \brief File format: 0=text, 1=binary, see #CF_QueueFileFormat_t */
 
     char filename[CF_FILENAME_MAX_LEN]; /**< \brief Filename written to */
 } CF_WriteQueue_Payload_t;
 
+/**
+ * \brief Magic number at the start of a binary queue file, "CFQD"
+ *
+ * Reads as 0x44514643 on a processor of the other byte order.
+ */
+#define CF_QUEUE_FILE_MAGIC 0x43465144
+
+/**
+ * \brief Version of the binary queue file format
+ */
+#define CF_QUEUE_FILE_VERSION 1
+
+/**
+ * \brief Binary queue file header
+ *
+ * A binary queue file is this header followed by num_records
+ * CF_QueueFileEntry_t records, all in the byte order of the flight
+ * processor.  The sizes let a ground tool decode the file without the
+ * mission configuration.  See #CF_WRITE_QUEUE_CC.
+ */
+typedef struct CF_QueueFileHeader
+{
+    uint32 magic;        /**< \brief #CF_QUEUE_FILE_MAGIC */
+    uint16 version;      /**< \brief #CF_QUEUE_FILE_VERSION */
+    uint16 record_size;  /**< \brief Size of each record, in bytes */
+    uint16 filename_len; /**< \brief Size of each file name in a record, #CF_FILENAME_MAX_LEN */
+    uint8  eid_size;     /**< \brief Size of an entity id in a record */
+    uint8  seq_size;     /**< \brief Size of a transaction sequence number in a record */
+    uint8  chan;         /**< \brief Channel number from the command */
+    uint8  type;         /**< \brief Transaction direction from the command */
+    uint8  queue;        /**< \brief Queue type from the command */
+    uint8  spare;        /**< \brief Alignment spare */
+    uint32 num_records;  /**< \brief Number of records, 0 until the file is complete */
+} CF_QueueFileHeader_t;
+
+/**
+ * \brief Binary queue file record
+ *
+ * One transaction, pending file or history entry.  See #CF_QueueFileHeader_t.
+ */
+typedef struct CF_QueueFileEntry
+{
+    uint8               queue;                             /**< \brief Queue the entry was on, a CF_QueueIdx_t */
+    uint8               direction;                         /**< \brief Direction: 0=RX, 1=TX */
+    int8                txn_stat;                          /**< \brief Transaction status, -1 while undefined */
+    uint8               spare;                             /**< \brief Alignment spare */
+    CF_EntityId_t       src_eid;                           /**< \brief Source entity id */
+    CF_EntityId_t       peer_eid;                          /**< \brief Entity id of the other side */
+    CF_TransactionSeq_t seq_num;                           /**< \brief Transaction sequence number */
+    char                src_filename[CF_FILENAME_MAX_LEN]; /**< \brief Source file name */
+    char                dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination file name */
+} CF_QueueFileEntry_t;
+
 /**
  * \brief Transaction command structure
  *
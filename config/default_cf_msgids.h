@@ -54,6 +54,15 @@
 /** \brief Message ID for end of transaction telemetry */
 #define CF_EOT_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_CF_EOT_TLM_TOPICID)
 
+/** \brief Message ID for active transaction status telemetry */
+#define CF_TXN_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_CF_TXN_TLM_TOPICID)
+
+/** \brief Message ID for engine phase performance telemetry */
+#define CF_PERF_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_CF_PERF_TLM_TOPICID)
+
+/** \brief Message ID for queue and transaction latency telemetry */
+#define CF_LATENCY_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_CF_LATENCY_TLM_TOPICID)
+
 /**\}*/
 
 /**
@@ -59,6 +59,33 @@ typedef struct CF_EotPacket
     CF_EotPacket_Payload_t    Payload;
 } CF_EotPacket_t;
 
+/**
+ * \brief Active transaction status packet
+ */
+typedef struct CF_TxnTlmPacket
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    CF_TxnTlmPacket_Payload_t Payload;
+} CF_TxnTlmPacket_t;
+
+/**
+ * \brief Engine phase performance statistics packet
+ */
+typedef struct CF_PerfTlmPacket
+{
+    CFE_MSG_TelemetryHeader_t  TelemetryHeader; /**< \brief Telemetry header */
+    CF_PerfTlmPacket_Payload_t Payload;
+} CF_PerfTlmPacket_t;
+
+/**
+ * \brief Queue and transaction latency packet
+ */
+typedef struct CF_LatencyTlmPacket
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CF_LatencyTlmPacket_Payload_t Payload;
+} CF_LatencyTlmPacket_t;
+
 /**\}*/
 
 /**
@@ -96,6 +123,26 @@ typedef struct CF_DisableEngineCmd
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } CF_DisableEngineCmd_t;
 
+/**
+ * \brief EnablePerfStats command structure
+ *
+ * For command details see #CF_ENABLE_PERF_STATS_CC
+ */
+typedef struct CF_EnablePerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CF_EnablePerfStatsCmd_t;
+
+/**
+ * \brief DisablePerfStats command structure
+ *
+ * For command details see #CF_DISABLE_PERF_STATS_CC
+ */
+typedef struct CF_DisablePerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CF_DisablePerfStatsCmd_t;
+
 /**
  * \brief Reset command structure
  *
@@ -217,6 +264,17 @@ typedef struct CF_TxFileCmd
     CF_TxFile_Payload_t     Payload;
 } CF_TxFileCmd_t;
 
+/**
+ * \brief Transmit file to several destinations command structure
+ *
+ * For command details see #CF_TX_FILE_MULTI_CC
+ */
+typedef struct CF_TxFileMultiCmd
+{
+    CFE_MSG_CommandHeader_t  CommandHeader; /**< \brief Command header */
+    CF_TxFileMulti_Payload_t Payload;
+} CF_TxFileMultiCmd_t;
+
 /**
  * \brief Write Queue command structure
  *
@@ -235,10 +293,21 @@ typedef struct CF_WriteQueueCmd
  */
 typedef struct CF_PlaybackDirCmd
 {
-    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
-    CF_TxFile_Payload_t     Payload;
+    CFE_MSG_CommandHeader_t  CommandHeader; /**< \brief Command header */
+    CF_PlaybackDir_Payload_t Payload;
 } CF_PlaybackDirCmd_t;
 
+/**
+ * \brief Transmit manifest command structure
+ *
+ * For command details see #CF_TX_MANIFEST_CC
+ */
+typedef struct CF_TxManifestCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+    CF_TxManifest_Payload_t Payload;
+} CF_TxManifestCmd_t;
+
 /**
  * \brief Suspend command structure
  *
@@ -49,6 +49,9 @@ typedef struct CF_PollDir
     char dst_dir[CF_FILENAME_MAX_PATH]; /**< \brief path to destination dir */
 
     uint8 enabled; /**< \brief Enabled flag */
+
+    uint16 max_active;  /**< \brief max number of files in transfer at once (0 - default) */
+    uint16 max_pending; /**< \brief max number of files read ahead of the transfers (0 - default) */
 } CF_PollDir_t;
 
 /**
@@ -76,6 +79,26 @@ typedef struct CF_ChannelConfig
     char  sem_name[OS_MAX_API_NAME]; /**< \brief name of throttling semaphore in TO */
     uint8 dequeue_enabled;           /**< \brief if 1, then the channel will make pending transactions active */
     char  move_dir[OS_MAX_PATH_LEN]; /**< \brief Move directory if not empty */
+
+    uint32 sem_wait_ms; /**< \brief time to block on the throttle sem for a free slot (0 - poll only),
+                         *          the sum over all channels must be less than one wakeup period */
+
+    uint8 transport; /**< \brief PDU transport (0 - software bus, 1 - shared memory ring, 2 - UDP) */
+    uint8 rx_batch_sort; /**< \brief if 1, received PDUs are grouped by transaction and file data sorted by offset
+                          *          before they are processed */
+    uint8 checksum_type; /**< \brief file checksum type of sent files (0 - modular, 2 - CRC32C, 3 - IEEE CRC32,
+                          *          15 - null) */
+    uint8 pdu_crc;       /**< \brief if 1, a CRC is appended to each sent PDU */
+
+    CF_EntityId_t relay_eid;  /**< \brief next hop to relay received files to as they arrive (0 - no relay) */
+    uint8         relay_chan; /**< \brief channel that sends the relayed files, from its unreserved transactions */
+
+    uint8 fec_group_size; /**< \brief class 1 sends add a parity PDU after every this many file data PDUs
+                           *          (0 - no parity) */
+
+    char   udp_peer_addr[OS_MAX_API_NAME]; /**< \brief IPv4 address the UDP transport sends PDUs to */
+    uint16 udp_local_port;                 /**< \brief port the UDP transport receives PDUs on */
+    uint16 udp_peer_port;                  /**< \brief port the UDP transport sends PDUs to */
 } CF_ChannelConfig_t;
 
 
@@ -30,11 +30,14 @@
  * These are for the normal CF app commands and telemtry
  */
 
-#define CFE_MISSION_CF_CMD_TOPICID     0xB3 /**< \brief Message ID for commands */
-#define CFE_MISSION_CF_SEND_HK_TOPICID 0xB4 /**< \brief Message ID to request housekeeping telemetry */
-#define CFE_MISSION_CF_WAKE_UP_TOPICID 0xB5 /**< \brief Message ID for waking up the processing cycle */
-#define CFE_MISSION_CF_HK_TLM_TOPICID  0xB0 /**< \brief Message ID for housekeeping telemetry */
-#define CFE_MISSION_CF_EOT_TLM_TOPICID 0xB3 /**< \brief Message ID for end of transaction telemetry */
+#define CFE_MISSION_CF_CMD_TOPICID         0xB3 /**< \brief Message ID for commands */
+#define CFE_MISSION_CF_SEND_HK_TOPICID     0xB4 /**< \brief Message ID to request housekeeping telemetry */
+#define CFE_MISSION_CF_WAKE_UP_TOPICID     0xB5 /**< \brief Message ID for waking up the processing cycle */
+#define CFE_MISSION_CF_HK_TLM_TOPICID      0xB0 /**< \brief Message ID for housekeeping telemetry */
+#define CFE_MISSION_CF_EOT_TLM_TOPICID     0xB3 /**< \brief Message ID for end of transaction telemetry */
+#define CFE_MISSION_CF_TXN_TLM_TOPICID     0xB1 /**< \brief Message ID for active transaction status telemetry */
+#define CFE_MISSION_CF_PERF_TLM_TOPICID    0xB8 /**< \brief Message ID for engine phase performance telemetry */
+#define CFE_MISSION_CF_LATENCY_TLM_TOPICID 0xB9 /**< \brief Message ID for queue and transaction latency telemetry */
 
 /*
  * The following topic IDs are for the data interface (PDUs)
@@ -212,6 +212,75 @@
  */
 #define CF_EID_ERR_INIT_OUTGOING_SIZE (35)
 
+/**
+ * \brief CF Throttle Semaphore Wait Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel throttle semaphore wait times, summed over the channels, not less than one
+ *  wakeup period
+ */
+#define CF_EID_ERR_INIT_SEM_WAIT (36)
+
+/**
+ * \brief CF Channel PDU Transport Open Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configured PDU transport for a channel is unknown, or the transport failed
+ *  to open during engine channel initialization
+ */
+#define CF_EID_ERR_INIT_TRANSPORT (37)
+
+/**
+ * \brief CF Polling Directory Limits Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table polling directory concurrency or pending depth larger than
+ *  the channel transaction pool or pending file pool
+ */
+#define CF_EID_ERR_INIT_POLLDIR_LIMITS (38)
+
+/**
+ * \brief CF Checksum Type Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel file checksum type not supported
+ */
+#define CF_EID_ERR_INIT_CHECKSUM_TYPE (39)
+
+/**
+ * \brief CF Relay Channel Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel relays received files on a channel that does not exist
+ */
+#define CF_EID_ERR_INIT_RELAY (177)
+
+/**
+ * \brief CF Forward Error Correction Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel FEC group size is larger than the receiver can track
+ */
+#define CF_EID_ERR_INIT_FEC (180)
+
 /**************************************************************************
  * CF_PDU event IDs - Protocol data unit
  */
@@ -238,6 +307,17 @@
  */
 #define CF_EID_ERR_PDU_SHORT_HEADER (41)
 
+/**
+ * \brief CF Metadata PDU Checksum Type Unsupported Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Metadata PDU requests a file checksum type that is not supported
+ */
+#define CF_EID_ERR_PDU_MD_CHECKSUM_TYPE (42)
+
 /**
  * \brief CF Metadata PDU Too Short Event ID
  *
@@ -293,6 +373,17 @@
  */
 #define CF_EID_ERR_PDU_EOF_SHORT (47)
 
+/**
+ * \brief CF Parity PDU Too Short Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Failure processing parity PDU
+ */
+#define CF_EID_ERR_PDU_PARITY_SHORT (181)
+
 /**
  * \brief CF Acknowledgment PDU Too Short Event ID
  *
@@ -327,26 +418,26 @@
 #define CF_EID_ERR_PDU_NAK_SHORT (50)
 
 /**
- * \brief CF File Data PDU Unsupported Option Event ID
+ * \brief CF PDU CRC Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  File Data PDU received with the segment metadata flag set
+ *  PDU received with the CRC flag set, failed its CRC or was too short to hold it
  */
-#define CF_EID_ERR_PDU_FD_UNSUPPORTED (54)
+#define CF_EID_ERR_PDU_CRC (51)
 
 /**
- * \brief CF PDU Header Large File Flag Set Event ID
+ * \brief CF File Data PDU Unsupported Option Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  PDU Header received with the unsupported large file flag set
+ *  File Data PDU received with the segment metadata flag set
  */
-#define CF_EID_ERR_PDU_LARGE_FILE (55)
+#define CF_EID_ERR_PDU_FD_UNSUPPORTED (54)
 
 /**
  * \brief CF PDU Header Field Truncation
@@ -363,6 +454,72 @@
  * CF_CFDP event IDs - Engine
  */
 
+/**
+ * \brief CF Open Manifest File Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Failure opening the manifest file given in a TX manifest command
+ */
+#define CF_EID_ERR_CFDP_MANIFEST_OPEN (57)
+
+/**
+ * \brief CF Manifest Already Active Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  TX manifest command received while the channel is still working through a previous manifest
+ */
+#define CF_EID_ERR_CFDP_MANIFEST_SLOT (58)
+
+/**
+ * \brief CF No Free Transmit Group Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Transmit multi command received while all #CF_NUM_TX_GROUPS transmit groups are in use
+ */
+#define CF_EID_ERR_CFDP_GROUP_SLOT (174)
+
+/**
+ * \brief CF Relay Started Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  A received file is being relayed to the next hop of its channel as it arrives
+ */
+#define CF_EID_INF_CFDP_RELAY_START (178)
+
+/**
+ * \brief CF No Free Relay Transaction Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  No free transaction on the relay channel when a relayed file started, the file is only stored
+ */
+#define CF_EID_ERR_CFDP_RELAY_SLOT (179)
+
+/**
+ * \brief CF Segment Rebuilt From Parity Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  A file data segment lost by a class 1 receive was rebuilt from the parity of its group
+ */
+#define CF_EID_DBG_CFDP_R_FEC_REBUILT (182)
+
 /**
  * \brief Attempt to reset a transaction that has already been freed
  *
@@ -434,6 +591,30 @@
  */
 #define CF_EID_ERR_CFDP_MAX_CMD_TX (64)
 
+/**
+ * \brief CF Transmission Request Rejected Due To No Pending File Record Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Command request to transmit a file received when the channel has no free
+ *  pending file record, or the path name table has no room for its directories
+ */
+#define CF_EID_ERR_CFDP_PENDING_SLOT (183)
+
+/**
+ * \brief CF Transmission Request Rejected Due To File Name Too Long Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Command request to transmit a file whose source file name, without the
+ *  directory, does not fit in a pending file record
+ */
+#define CF_EID_ERR_CFDP_PENDING_NAME (184)
+
 /**
  * \brief CF Playback/Polling Directory Open Failed Event ID
  *
@@ -479,6 +660,41 @@
  */
 #define CF_EID_ERR_CFDP_CLOSE_ERR (68)
 
+/**
+ * \brief CF Outgoing Buffer Pool Empty Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Channel pool of pre-allocated output buffers exhausted when constructing PDU,
+ *  buffer is allocated directly from SB instead.  Sent once until the pool is refilled.
+ */
+#define CF_EID_ERR_CFDP_OUT_POOL_EMPTY (69)
+
+/**
+ * \brief CF Manifest Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  All records of a TX manifest have been read, reports how many were queued and skipped
+ */
+#define CF_EID_INF_CFDP_MANIFEST_DONE (168)
+
+/**
+ * \brief CF Playback Path Prefix Table Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Playback or polling directory could not be started because its source or
+ *  destination directory could not be added to the path prefix table
+ */
+#define CF_EID_ERR_CFDP_PATH_PREFIXES (169)
+
 /**************************************************************************
  * CF_CFDP_R event IDs - Engine receive
  */
@@ -967,6 +1183,17 @@
  */
 #define CF_EID_INF_CMD_WQ (115)
 
+/**
+ * \brief CF Write Queue Binary File Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  All entries of a binary write queue file have been written and the file closed
+ */
+#define CF_EID_INF_CMD_WQ_DONE (170)
+
 /**
  * \brief CF Enable Engine Command Received Event ID
  *
@@ -989,6 +1216,28 @@
  */
 #define CF_EID_INF_CMD_DISABLE_ENGINE (117)
 
+/**
+ * \brief CF Enable Performance Statistics Command Received Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  Receipt and successful processing of enable performance statistics command
+ */
+#define CF_EID_INF_CMD_ENABLE_PERF_STATS (172)
+
+/**
+ * \brief CF Disable Performance Statistics Command Received Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  Receipt and successful processing of disable performance statistics command
+ */
+#define CF_EID_INF_CMD_DISABLE_PERF_STATS (173)
+
 /**
  * \brief CF Transfer File Command Received Event ID
  *
@@ -1286,6 +1535,17 @@
  */
 #define CF_EID_ERR_CMD_WQ_WRITEHIST_TX (144)
 
+/**
+ * \brief CF Write Queue Command Binary File Busy Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Write queue command for the binary format received while a previous binary file is still being written
+ */
+#define CF_EID_ERR_CMD_WQ_BUSY (171)
+
 /**
  * \brief CF Set Parameter Command Parameter Validation Failed Event ID
  *
@@ -1517,6 +1777,50 @@
  */
 #define CF_EID_ERR_CMD_PURGE_QUEUE (165)
 
+/**
+ * \brief CF TX Manifest Command Received Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  Receipt and successful processing of TX manifest command
+ */
+#define CF_EID_INF_CMD_TX_MANIFEST (166)
+
+/**
+ * \brief CF TX Manifest Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  TX manifest command was unsuccessful
+ */
+#define CF_EID_ERR_CMD_TX_MANIFEST (167)
+
+/**
+ * \brief CF Transmit Multi Command Received Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  Receipt and successful processing of transmit multi command
+ */
+#define CF_EID_INF_CMD_TX_FILE_MULTI (175)
+
+/**
+ * \brief CF Transmit Multi Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Transmit multi command was unsuccessful
+ */
+#define CF_EID_ERR_CMD_TX_FILE_MULTI (176)
+
 /**\}*/
 
 #endif /* !CF_EVENTS_H */
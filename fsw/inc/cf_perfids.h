@@ -40,7 +40,16 @@
 #define CF_PERF_ID_DIRREAD   (18) /**< \brief Directory read performance ID */
 #define CF_PERF_ID_CREAT     (19) /**< \brief Create performance ID */
 #define CF_PERF_ID_RENAME    (20) /**< \brief Rename performance ID */
+#define CF_PERF_ID_RECV      (21) /**< \brief Engine receive phase performance ID */
+#define CF_PERF_ID_CYCLE_TX  (25) /**< \brief Engine TX cycle phase performance ID */
+#define CF_PERF_ID_PLAYBACK  (26) /**< \brief Engine playback directory phase performance ID */
+#define CF_PERF_ID_POLLING   (27) /**< \brief Engine polling directory phase performance ID */
+#define CF_PERF_ID_NAK       (28) /**< \brief NAK generation performance ID */
+#define CF_PERF_ID_CRC       (29) /**< \brief R2 CRC chunk performance ID */
+#define CF_PERF_ID_ENCODE    (50) /**< \brief PDU header encode performance ID */
+#define CF_PERF_ID_DECODE    (51) /**< \brief PDU header decode performance ID */
 
+#define CF_PERF_ID_TICK(x)    (22 + x) /**< \brief Engine tick phase performance ID, by CF_TickType_t */
 #define CF_PERF_ID_PDURCVD(x) (30 + x) /**< \brief PDU Received performance ID */
 #define CF_PERF_ID_PDUSENT(x) (40 + x) /**< \brief PDU Sent performance ID */
 
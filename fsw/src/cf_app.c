@@ -100,8 +100,11 @@ void CF_CheckTables(void)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_ValidateConfigTable(void *tbl_ptr)
 {
-    CF_ConfigTable_t *tbl = (CF_ConfigTable_t *)tbl_ptr;
-    CFE_Status_t      ret = CFE_STATUS_VALIDATION_FAILURE;
+    CF_ConfigTable_t *tbl            = (CF_ConfigTable_t *)tbl_ptr;
+    CFE_Status_t      ret            = CFE_STATUS_VALIDATION_FAILURE;
+    uint64            sem_wait_total = 0;
+    int               i;
+    int               j;
 
     if (!tbl->ticks_per_second)
     {
@@ -120,6 +123,64 @@ CFE_Status_t CF_ValidateConfigTable(void *tbl_ptr)
     else
     {
         ret = CFE_SUCCESS;
+
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            /* each channel may block on its throttle sem for up to its sem_wait_ms in total per wakeup,
+             * and all channels together must not be able to consume an entire wakeup */
+            sem_wait_total += tbl->chan[i].sem_wait_ms;
+            if ((sem_wait_total * tbl->ticks_per_second) >= 1000)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_INIT_SEM_WAIT, CFE_EVS_EventType_ERROR,
+                                  "CF: config table has sem waits too large up to channel %d", i);
+                ret = CFE_STATUS_VALIDATION_FAILURE;
+                break;
+            }
+
+            if (CF_CRC_ValidateType(tbl->chan[i].checksum_type) != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_INIT_CHECKSUM_TYPE, CFE_EVS_EventType_ERROR,
+                                  "CF: config table has unsupported checksum type %u for channel %d",
+                                  (unsigned int)tbl->chan[i].checksum_type, i);
+                ret = CFE_STATUS_VALIDATION_FAILURE;
+                break;
+            }
+
+            if (tbl->chan[i].relay_eid && tbl->chan[i].relay_chan >= CF_NUM_CHANNELS)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_INIT_RELAY, CFE_EVS_EventType_ERROR,
+                                  "CF: config table has relay channel %u out of range for channel %d",
+                                  (unsigned int)tbl->chan[i].relay_chan, i);
+                ret = CFE_STATUS_VALIDATION_FAILURE;
+                break;
+            }
+
+            if (tbl->chan[i].fec_group_size > CF_FEC_MAX_GROUP_SIZE)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_INIT_FEC, CFE_EVS_EventType_ERROR,
+                                  "CF: config table has FEC group size %u over %u for channel %d",
+                                  (unsigned int)tbl->chan[i].fec_group_size, (unsigned int)CF_FEC_MAX_GROUP_SIZE, i);
+                ret = CFE_STATUS_VALIDATION_FAILURE;
+                break;
+            }
+
+            for (j = 0; j < CF_MAX_POLLING_DIR_PER_CHAN; ++j)
+            {
+                if ((tbl->chan[i].polldir[j].max_active > CF_NUM_TRANSACTIONS_PER_CHANNEL) ||
+                    (tbl->chan[i].polldir[j].max_pending > CF_NUM_PENDING_FILES_PER_CHANNEL))
+                {
+                    CFE_EVS_SendEvent(CF_EID_ERR_INIT_POLLDIR_LIMITS, CFE_EVS_EventType_ERROR,
+                                      "CF: config table has polling dir %d limits too large for channel %d", j, i);
+                    ret = CFE_STATUS_VALIDATION_FAILURE;
+                    break;
+                }
+            }
+
+            if (ret != CFE_SUCCESS)
+            {
+                break;
+            }
+        }
     }
 
     return ret;
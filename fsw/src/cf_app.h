@@ -54,6 +54,7 @@
 #define CF_REC_PDU_BAD_EOF_ERROR        -5 /**< \brief Receive PDU: Invalid EOF packet */
 #define CF_SEND_PDU_NO_BUF_AVAIL_ERROR  -6 /**< \brief Send PDU: No send buffer available, throttling limit reached */
 #define CF_SEND_PDU_ERROR               -7 /**< \brief Send PDU: Send failed */
+#define CF_NAME_TOO_LONG_ERROR          -8 /**< \brief File name too long for a pending file record */
 /**\}*/
 
 /**
@@ -89,6 +90,10 @@ typedef struct
     CF_ConfigTable_t *config_table;
 
     CF_Engine_t engine;
+
+    CF_QueueDump_t queue_dump; /**< \brief Binary write queue file, kept across engine resets */
+
+    CF_PerfStats_t perf; /**< \brief Engine phase statistics, kept across engine resets */
 } CF_AppData_t;
 
 /**************************************************************************
@@ -37,6 +37,8 @@
 #include "cf_perfids.h"
 #include "cf_cfdp.h"
 #include "cf_utils.h"
+#include "cf_history.h"
+#include "cf_perf.h"
 
 #include "cf_cfdp_r.h"
 #include "cf_cfdp_s.h"
@@ -220,6 +222,12 @@ static void CF_CFDP_SetPduLength(CF_Logical_PduBuffer_t *ph)
     /* final position of the encoder state should reflect the entire PDU length */
     final_pos = CF_CODEC_GET_POSITION(ph->penc);
 
+    /* the CRC is appended with the final size, but is part of the PDU data length */
+    if (ph->pdu_header.crc_flag)
+    {
+        final_pos += sizeof(CF_CFDP_uint16_t);
+    }
+
     if (final_pos >= ph->pdu_header.header_encoded_length)
     {
         /* the value that goes into the packet is length _after_ header */
@@ -240,49 +248,74 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
                                                    CF_TransactionSeq_t tsn, bool silent)
 {
     /* directive_code == 0 if file data */
-    CF_Logical_PduBuffer_t *ph;
-    CF_Logical_PduHeader_t *hdr;
-    uint8                   eid_len;
+    CF_Logical_PduBuffer_t *      ph;
+    CF_Logical_PduHeader_t *      hdr;
+    const CF_PduHeaderTemplate_t *tmpl;
+    uint8                         eid_len;
+    CF_PerfMark_t                 mark;
 
     ph = CF_CFDP_MsgOutGet(txn, silent);
 
     if (ph)
     {
+        CF_Perf_Begin(&mark, CF_PerfPhase_ENCODE);
+
         hdr = &ph->pdu_header;
 
         hdr->version   = 1;
         hdr->pdu_type  = (directive_code == 0); /* set to '1' for file data PDU, '0' for a directive PDU */
         hdr->direction = (towards_sender != 0); /* set to '1' for toward sender, '0' for toward receiver */
         hdr->txm_mode  = (CF_CFDP_GetClass(txn) == CF_CFDP_CLASS_1); /* set to '1' for class 1 data, '0' for class 2 */
+        hdr->crc_flag  = CF_AppData.config_table->chan[txn->chan_num].pdu_crc;
 
-        /* choose the larger of the two EIDs to determine size */
-        if (src_eid > dst_eid)
-        {
-            eid_len = CF_CFDP_GetValueEncodedSize(src_eid);
-        }
-        else
-        {
-            eid_len = CF_CFDP_GetValueEncodedSize(dst_eid);
-        }
-
-        /*
-         * This struct holds the "real" length - when assembled into the final packet
-         * this is encoded as 1 less than this value
-         */
-        hdr->eid_length     = eid_len;
-        hdr->txn_seq_length = CF_CFDP_GetValueEncodedSize(tsn);
+        /* file size and offset fields need 64 bits once the file reaches 4 GiB */
+        hdr->large_flag = (txn->fsize > UINT32_MAX);
 
         hdr->source_eid      = src_eid;
         hdr->destination_eid = dst_eid;
         hdr->sequence_num    = tsn;
 
         /*
-         * encode the known parts so far.  total_size field cannot be
-         * included yet because its value is not known, but the basic
-         * encoding of the other stuff needs to be done so the position
-         * of any data fields can be determined.
+         * The transaction encoded its header when it started, so unless this PDU
+         * is addressed differently, the entity IDs and sequence number are copied
+         * from there rather than encoded again.
          */
-        CF_CFDP_EncodeHeaderWithoutSize(ph->penc, hdr);
+        tmpl = &txn->cold->hdr_template;
+        if (tmpl->length != 0 && tmpl->source_eid == src_eid && tmpl->destination_eid == dst_eid &&
+            tmpl->sequence_num == tsn)
+        {
+            hdr->eid_length     = tmpl->eid_length;
+            hdr->txn_seq_length = tmpl->txn_seq_length;
+
+            CF_CFDP_EncodeHeaderFromTemplate(ph->penc, hdr, tmpl);
+        }
+        else
+        {
+            /* choose the larger of the two EIDs to determine size */
+            if (src_eid > dst_eid)
+            {
+                eid_len = CF_CFDP_GetValueEncodedSize(src_eid);
+            }
+            else
+            {
+                eid_len = CF_CFDP_GetValueEncodedSize(dst_eid);
+            }
+
+            /*
+             * This struct holds the "real" length - when assembled into the final packet
+             * this is encoded as 1 less than this value
+             */
+            hdr->eid_length     = eid_len;
+            hdr->txn_seq_length = CF_CFDP_GetValueEncodedSize(tsn);
+
+            /*
+             * encode the known parts so far.  total_size field cannot be
+             * included yet because its value is not known, but the basic
+             * encoding of the other stuff needs to be done so the position
+             * of any data fields can be determined.
+             */
+            CF_CFDP_EncodeHeaderWithoutSize(ph->penc, hdr);
+        }
 
         /* If directive code is zero, the PDU is a file data PDU which has no directive code field.
          * So only set if non-zero, otherwise it will write a 0 to a byte in a file data PDU where we
@@ -294,6 +327,8 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
 
             CF_CFDP_EncodeFileDirectiveHeader(ph->penc, &ph->fdirective);
         }
+
+        CF_Perf_End(&mark);
     }
 
     return ph;
@@ -339,7 +374,8 @@ CFE_Status_t CF_CFDP_SendMd(CF_Transaction_t *txn)
 
         CF_Assert((txn->state == CF_TxnState_S1) || (txn->state == CF_TxnState_S2));
 
-        md->size = txn->fsize;
+        md->size          = txn->fsize;
+        md->checksum_type = txn->cold->crc.type;
 
         /* at this point, need to append filenames into md packet */
         /* this does not actually copy here - that is done during encode */
@@ -350,6 +386,15 @@ CFE_Status_t CF_CFDP_SendMd(CF_Transaction_t *txn)
             CF_strnlen(txn->history->fnames.dst_filename, sizeof(txn->history->fnames.dst_filename));
         md->dest_filename.data_ptr = txn->history->fnames.dst_filename;
 
+        if (txn->state_data.send.fec)
+        {
+            md->fec = txn->state_data.send.fec->params;
+        }
+        else
+        {
+            memset(&md->fec, 0, sizeof(md->fec));
+        }
+
         CF_CFDP_EncodeMd(ph->penc, md);
         CF_CFDP_SetPduLength(ph);
         CF_CFDP_Send(txn->chan_num, ph);
@@ -438,7 +483,7 @@ CFE_Status_t CF_CFDP_SendEof(CF_Transaction_t *txn)
         eof = &ph->int_header.eof;
 
         eof->cc   = CF_TxnStatus_To_ConditionCode(txn->history->txn_stat);
-        eof->crc  = txn->crc.result;
+        eof->crc  = txn->cold->crc.result;
         eof->size = txn->fsize;
 
         if (eof->cc != CF_CFDP_ConditionCode_NO_ERROR)
@@ -454,6 +499,40 @@ CFE_Status_t CF_CFDP_SendEof(CF_Transaction_t *txn)
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_SendParity(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, size_t len)
+{
+    CF_Logical_PduBuffer_t *ph =
+        CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_PARITY, CF_AppData.config_table->local_eid,
+                                   txn->history->peer_eid, 0, txn->history->seq_num, 0);
+    CF_Logical_PduParity_t *parity;
+    CFE_Status_t            ret = CFE_SUCCESS;
+
+    if (!ph)
+    {
+        ret = CF_SEND_PDU_NO_BUF_AVAIL_ERROR;
+    }
+    else
+    {
+        parity = &ph->int_header.parity;
+
+        parity->offset   = offset;
+        parity->data_ptr = data;
+        parity->data_len = len;
+
+        CF_CFDP_EncodeParity(ph->penc, parity);
+        CF_CFDP_SetPduLength(ph);
+        CF_CFDP_Send(txn->chan_num, ph);
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -587,15 +666,27 @@ CFE_Status_t CF_CFDP_SendNak(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
 {
-    CFE_Status_t ret = CFE_SUCCESS;
+    CFE_Status_t  ret = CFE_SUCCESS;
+    CF_PerfMark_t mark;
 
     CF_Assert(chan_num < CF_NUM_CHANNELS);
+    CF_Perf_Begin(&mark, CF_PerfPhase_DECODE);
+
+    /*
+     * Most PDUs are plain file data, which is decoded along with its file data
+     * header in one pass.  Anything else goes through the full decode below.
+     */
+    ph->fd_decoded = CF_CFDP_DecodeFileDataFast(ph->pdec, &ph->pdu_header, &ph->int_header.fd);
+    if (ph->fd_decoded)
+    {
+        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.pdu;
+    }
     /*
      * If the source eid, destination eid, or sequence number fields
      * are larger than the sizes configured in the cf platform config
      * file, then reject the PDU.
      */
-    if (CF_CFDP_DecodeHeader(ph->pdec, &ph->pdu_header) != CFE_SUCCESS)
+    else if (CF_CFDP_DecodeHeader(ph->pdec, &ph->pdu_header) != CFE_SUCCESS)
     {
         CFE_EVS_SendEvent(CF_EID_ERR_PDU_TRUNCATION, CFE_EVS_EventType_ERROR,
                           "CF: PDU rejected due to EID/seq number field truncation");
@@ -603,15 +694,15 @@ CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
         ret = CF_ERROR;
     }
     /*
-     * The "large file" flag is not supported by this implementation yet.
-     * This means file sizes and offsets will be 64 bits, so codec routines
-     * will need to be updated to understand this.  OSAL also doesn't support
-     * 64-bit file access yet.
+     * A PDU that fails its CRC is dropped here, before any field of it is used.
+     * The sender recovers it like a lost PDU.
      */
-    else if (CF_CODEC_IS_OK(ph->pdec) && ph->pdu_header.large_flag)
+    else if (CF_CODEC_IS_OK(ph->pdec) && ph->pdu_header.crc_flag &&
+             CF_CFDP_DecodePduCrc(ph->pdec, &ph->pdu_header) != CFE_SUCCESS)
     {
-        CFE_EVS_SendEvent(CF_EID_ERR_PDU_LARGE_FILE, CFE_EVS_EventType_ERROR,
-                          "CF: PDU with large file bit received (unsupported)");
+        CFE_EVS_SendEvent(CF_EID_ERR_PDU_CRC, CFE_EVS_EventType_ERROR,
+                          "CF: PDU rejected due to CRC error (%lu bytes received)",
+                          (unsigned long)CF_CODEC_GET_SIZE(ph->pdec));
         ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.error;
         ret = CF_ERROR;
     }
@@ -636,6 +727,8 @@ CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
         }
     }
 
+    CF_Perf_End(&mark);
+
     return ret;
 }
 
@@ -665,6 +758,9 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
         /* store the expected file size in transaction */
         txn->fsize = md->size;
 
+        /* parity PDUs are only used by class 1, but there is no harm in tracking class 2 */
+        CF_FecDecoder_Init(&txn->state_data.receive.fec, &md->fec);
+
         /*
          * store the filenames in transaction.
          *
@@ -694,6 +790,14 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error;
                 ret = CF_PDU_METADATA_ERROR;
             }
+            else if (CF_CRC_StartType(&txn->cold->crc, md->checksum_type) != CFE_SUCCESS)
+            {
+                /* the MD itself is valid, the receiver decides how to end the transaction */
+                CFE_EVS_SendEvent(CF_EID_ERR_PDU_MD_CHECKSUM_TYPE, CFE_EVS_EventType_ERROR,
+                                  "CF: metadata PDU for %s has unsupported checksum type %u",
+                                  txn->history->fnames.dst_filename, (unsigned int)md->checksum_type);
+                CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+            }
             else
             {
                 CFE_EVS_SendEvent(CF_EID_INF_PDU_MD_RECVD, CFE_EVS_EventType_INFORMATION,
@@ -716,19 +820,13 @@ CFE_Status_t CF_CFDP_RecvFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 {
     CFE_Status_t ret = CFE_SUCCESS;
 
-    CF_CFDP_DecodeFileDataHeader(ph->pdec, ph->pdu_header.segment_meta_flag, &ph->int_header.fd);
-
-    /* if the CRC flag is set, need to deduct the size of the CRC from the data - always 32 bits */
-    if (CF_CODEC_IS_OK(ph->pdec) && ph->pdu_header.crc_flag)
+    /*
+     * any PDU CRC was checked and stripped by CF_CFDP_RecvPh(), so the data runs to the end.
+     * If CF_CFDP_RecvPh() took the fast path, the file data header is already decoded.
+     */
+    if (!ph->fd_decoded)
     {
-        if (ph->int_header.fd.data_len < sizeof(CF_CFDP_uint32_t))
-        {
-            CF_CODEC_SET_DONE(ph->pdec);
-        }
-        else
-        {
-            ph->int_header.fd.data_len -= sizeof(CF_CFDP_uint32_t);
-        }
+        CF_CFDP_DecodeFileDataHeader(ph->pdec, ph->pdu_header.segment_meta_flag, &ph->int_header.fd);
     }
 
     if (!CF_CODEC_IS_OK(ph->pdec))
@@ -774,6 +872,29 @@ CFE_Status_t CF_CFDP_RecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+{
+    CFE_Status_t ret = CFE_SUCCESS;
+
+    CF_CFDP_DecodeParity(ph->pdec, &ph->int_header.parity);
+
+    if (!CF_CODEC_IS_OK(ph->pdec))
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_PDU_PARITY_SHORT, CFE_EVS_EventType_ERROR,
+                          "CF: parity PDU too short: %lu bytes received", (unsigned long)CF_CODEC_GET_SIZE(ph->pdec));
+        ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error;
+        ret = CF_SHORT_PDU_ERROR;
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -873,6 +994,10 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     txn->history->peer_eid = ph->pdu_header.source_eid;
     txn->history->src_eid  = ph->pdu_header.source_eid;
 
+    /* every PDU the receiver builds keeps the sender as source and the local entity as destination */
+    CF_CFDP_EncodeHeaderTemplate(&txn->cold->hdr_template, txn->history->peer_eid,
+                                 CF_AppData.config_table->local_eid, txn->history->seq_num);
+
     txn->chunks = CF_CFDP_FindUnusedChunks(&CF_AppData.engine.channels[txn->chan_num], CF_Direction_RX);
 
     /* this is an idle transaction, so see if there's a received packet that can
@@ -947,9 +1072,9 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 CFE_Status_t CF_CFDP_InitEngine(void)
 {
     /* initialize all transaction nodes */
-    CF_History_t *     history;
     CF_Transaction_t * txn              = CF_AppData.engine.transactions;
     CF_ChunkWrapper_t *cw               = CF_AppData.engine.chunks;
+    CF_PendingFile_t * pf               = CF_AppData.engine.pending_files;
     CFE_Status_t       ret              = CFE_SUCCESS;
     int                chunk_mem_offset = 0;
     int                i;
@@ -962,6 +1087,13 @@ CFE_Status_t CF_CFDP_InitEngine(void)
 
     memset(&CF_AppData.engine, 0, sizeof(CF_AppData.engine));
 
+    /* a binary queue file being written must not pick up at a node of the old queues */
+    CF_AppData.queue_dump.resume = NULL;
+
+    CF_NameTable_Init(&CF_AppData.engine.path_prefixes, CF_AppData.engine.path_prefix_mem, CF_NUM_PATH_PREFIXES);
+    CF_NameTable_Init(&CF_AppData.engine.history_prefixes, CF_AppData.engine.history_prefix_mem,
+                      CF_NUM_HISTORY_PATH_PREFIXES);
+
     for (i = 0; i < CF_NUM_CHANNELS; ++i)
     {
         snprintf(nbuf, sizeof(nbuf) - 1, "%s%d", CF_CHANNEL_PIPE_PREFIX, i);
@@ -1032,11 +1164,38 @@ CFE_Status_t CF_CFDP_InitEngine(void)
             }
         }
 
-        for (j = 0; j < CF_NUM_HISTORIES_PER_CHANNEL; ++j)
+        CF_HistoryRing_Init(&CF_AppData.engine.channels[i].history,
+                            &CF_AppData.engine.history_records[i * CF_NUM_HISTORIES_PER_CHANNEL],
+                            CF_NUM_HISTORIES_PER_CHANNEL, CF_AppData.engine.history_names[i],
+                            CF_HISTORY_NAMES_SIZE_PER_CHANNEL, &CF_AppData.engine.history_prefixes);
+
+        for (j = 0; j < CF_NUM_PENDING_FILES_PER_CHANNEL; ++j, ++pf)
+        {
+            CF_CList_InitNode(&pf->cl_node);
+            CF_CList_InitNode(&pf->src_node);
+            CF_CList_InsertBack(&CF_AppData.engine.channels[i].pf_free, &pf->cl_node);
+        }
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            ret = CF_CFDP_TransportOpen(&CF_AppData.engine.channels[i]);
+            if (ret != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_INIT_TRANSPORT, CFE_EVS_EventType_ERROR,
+                                  "CF: failed to open transport %u for channel %d, returned 0x%08lx",
+                                  (unsigned int)CF_AppData.config_table->chan[i].transport, i, (unsigned long)ret);
+                break;
+            }
+        }
+
+        /* the engine stays disabled, so nothing else would close the transports that did open */
+        while (ret != CFE_SUCCESS && i > 0)
         {
-            history = &CF_AppData.engine.histories[(i * CF_NUM_HISTORIES_PER_CHANNEL) + j];
-            CF_CList_InitNode(&history->cl_node);
-            CF_CList_InsertBack_Ex(&CF_AppData.engine.channels[i], CF_QueueIdx_HIST_FREE, &history->cl_node);
+            --i;
+            CF_CFDP_TransportClose(&CF_AppData.engine.channels[i]);
         }
     }
 
@@ -1084,6 +1243,25 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Starts the rest of a transmit group along with its first member, so the
+ * members send the file data together and share the reads.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_StartPendingGroup(CF_Channel_t *chan, const CF_TxGroup_t *group)
+{
+    CF_PendingFile_t *pf;
+
+    /* the files of a group are queued together at one priority, so the rest follow the first one */
+    while ((pf = CF_CFDP_FindStartablePending(chan, group)) != NULL)
+    {
+        CF_CFDP_StartPendingFile(chan, pf);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1092,8 +1270,11 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
  *-----------------------------------------------------------------*/
 void CF_CFDP_CycleTx(CF_Channel_t *chan)
 {
-    CF_Transaction_t *     txn;
     CF_CFDP_CycleTx_args_t args;
+    CF_PendingFile_t *     pf;
+    CF_TxGroup_t *         group;
+    CF_CListIter_t         iter;
+    CF_CListNode_t *       node;
 
     if (CF_AppData.config_table->chan[(chan - CF_AppData.engine.channels)].dequeue_enabled)
     {
@@ -1109,16 +1290,34 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan)
             while (true)
             {
                 /* Attempt to run something on TXA */
-                CF_CList_Traverse(chan->qs[CF_QueueIdx_TXA], CF_CFDP_CycleTxFirstActive, &args);
+                CF_CLIST_FOREACH(iter, node, chan->qs[CF_QueueIdx_TXA])
+                {
+                    if (!CF_CListTraverse_Status_IS_CONTINUE(CF_CFDP_CycleTxFirstActive(node, &args)))
+                    {
+                        break;
+                    }
+                }
+
+                /* Keep going until nothing on CF_QueueIdx_PEND can start or something is run.  Without a
+                 * free transaction nothing can start, so the pending files do not need a look */
+                if (args.ran_one || !chan->qs[CF_QueueIdx_FREE])
+                {
+                    break;
+                }
 
-                /* Keep going until CF_QueueIdx_PEND is empty or something is run */
-                if (args.ran_one || chan->qs[CF_QueueIdx_PEND] == NULL)
+                pf = CF_CFDP_FindStartablePending(chan, NULL);
+                if (!pf)
                 {
                     break;
                 }
 
-                txn = container_of(chan->qs[CF_QueueIdx_PEND], CF_Transaction_t, cl_node);
-                CF_MoveTransaction(txn, CF_QueueIdx_TXA);
+                group = pf->group;
+                CF_CFDP_StartPendingFile(chan, pf);
+
+                if (group)
+                {
+                    CF_CFDP_StartPendingGroup(chan, group);
+                }
             }
         }
 
@@ -1168,7 +1367,10 @@ CF_CListTraverse_Status_t CF_CFDP_DoTick(CF_CListNode_t *node, void *context)
  *-----------------------------------------------------------------*/
 void CF_CFDP_TickTransactions(CF_Channel_t *chan)
 {
-    bool reset = true;
+    bool            reset = true;
+    CF_PerfMark_t   mark;
+    CF_CListIter_t  iter;
+    CF_CListNode_t *node;
 
     void (*fns[CF_TickType_NUM_TYPES])(CF_Transaction_t *, int *) = {CF_CFDP_R_Tick, CF_CFDP_S_Tick,
                                                                      CF_CFDP_S_Tick_Nak};
@@ -1180,10 +1382,20 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan)
     {
         CF_CFDP_Tick_args_t args = {chan, fns[chan->tick_type], 0, 0};
 
+        /* the phases are in the same order as the tick types */
+        CF_Perf_Begin(&mark, CF_PerfPhase_TICK_RX + chan->tick_type);
+
         do
         {
             args.cont = 0;
-            CF_CList_Traverse(chan->qs[qs[chan->tick_type]], CF_CFDP_DoTick, &args);
+            CF_CLIST_FOREACH(iter, node, chan->qs[qs[chan->tick_type]])
+            {
+                if (!CF_CListTraverse_Status_IS_CONTINUE(CF_CFDP_DoTick(node, &args)))
+                {
+                    break;
+                }
+            }
+
             if (args.early_exit)
             {
                 /* early exit means we ran out of available outgoing messages this wakeup.
@@ -1211,6 +1423,8 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan)
             }
         } while (args.cont);
 
+        CF_Perf_End(&mark);
+
         if (!reset)
         {
             break;
@@ -1242,73 +1456,73 @@ void CF_CFDP_InitTxnTxFile(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_class, ui
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-static void CF_CFDP_TxFile_Initiate(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 chan,
-                                    uint8 priority, CF_EntityId_t dest_id)
+static int CF_CFDP_PlaybackUnusedShare(const CF_Playback_t *pb, const CF_Playback_t *self)
 {
-    CFE_EVS_SendEvent(CF_EID_INF_CFDP_S_START_SEND, CFE_EVS_EventType_INFORMATION,
-                      "CF: start class %d tx of file %lu:%.*s -> %lu:%.*s", cfdp_class + 1,
-                      (unsigned long)CF_AppData.config_table->local_eid, CF_FILENAME_MAX_LEN,
-                      txn->history->fnames.src_filename, (unsigned long)dest_id, CF_FILENAME_MAX_LEN,
-                      txn->history->fnames.dst_filename);
-
-    CF_CFDP_InitTxnTxFile(txn, cfdp_class, keep, chan, priority);
-
-    /* Increment sequence number for new transaction */
-    ++CF_AppData.engine.seq_num;
-
-    /* Capture info for history */
-    txn->history->dir      = CF_Direction_TX;
-    txn->history->seq_num  = CF_AppData.engine.seq_num;
-    txn->history->src_eid  = CF_AppData.config_table->local_eid;
-    txn->history->peer_eid = dest_id;
+    int share = 0;
 
-    CF_CFDP_ArmInactTimer(txn);
+    if (pb->busy && (pb != self))
+    {
+        share = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+        if (pb->max_active < share)
+        {
+            share = pb->max_active;
+        }
+        if (pb->num_ts < share)
+        {
+            share -= pb->num_ts;
+        }
+        else
+        {
+            share = 0;
+        }
+    }
 
-    /* NOTE: whether or not class 1 or 2, get a free chunks. It's cheap, and simplifies cleanup path */
-    txn->chunks = CF_CFDP_FindUnusedChunks(&CF_AppData.engine.channels[chan], CF_Direction_TX);
-    CF_InsertSortPrio(txn, CF_QueueIdx_PEND);
+    return share;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_cfdp.h for argument/return detail
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class, uint8 keep,
-                            uint8 chan_num, uint8 priority, CF_EntityId_t dest_id)
+static int CF_CFDP_ReservedTransactions(const CF_Channel_t *chan, const CF_Playback_t *self)
 {
-    CF_Transaction_t *txn;
-    CF_Channel_t *    chan = &CF_AppData.engine.channels[chan_num];
-    CF_Assert(chan_num < CF_NUM_CHANNELS);
+    const CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels];
+    int                        reserved;
+    int                        i;
 
-    CFE_Status_t ret = CFE_SUCCESS;
+    /*
+     * Every active playback other than self may still need the rest of its
+     * share, and receive and commanded files their reserves.  Anything that
+     * takes a transaction beyond these is what leaves FREE short, so whatever
+     * it borrowed must come back before these can run out.
+     */
+    reserved = (CF_MAX_SIMULTANEOUS_RX - (int)hk->q_size[CF_QueueIdx_RX]) +
+               (CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN - (int)chan->num_cmd_tx);
 
-    if (chan->num_cmd_tx == CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN)
+    for (i = 0; i < CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN; ++i)
     {
-        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_MAX_CMD_TX, CFE_EVS_EventType_ERROR,
-                          "CF: max number of commanded files reached");
-        ret = CF_ERROR;
+        reserved += CF_CFDP_PlaybackUnusedShare(&chan->playback[i], self);
     }
-    else
+    for (i = 0; i < CF_MAX_POLLING_DIR_PER_CHAN; ++i)
     {
-        txn = CF_FindUnusedTransaction(&CF_AppData.engine.channels[chan_num]);
-        CF_Assert(txn); /* should always have a free transaction at this point */
-
-        CF_Assert(txn->state == CF_TxnState_IDLE);
+        reserved += CF_CFDP_PlaybackUnusedShare(&chan->poll[i].pb, self);
+    }
+    reserved += CF_CFDP_PlaybackUnusedShare(&chan->manifest.pb, self);
 
-        /* NOTE: the caller of this function ensures the provided src and dst filenames are NULL terminated */
-        strncpy(txn->history->fnames.src_filename, src_filename, sizeof(txn->history->fnames.src_filename) - 1);
-        txn->history->fnames.src_filename[sizeof(txn->history->fnames.src_filename) - 1] = 0;
-        strncpy(txn->history->fnames.dst_filename, dst_filename, sizeof(txn->history->fnames.dst_filename) - 1);
-        txn->history->fnames.dst_filename[sizeof(txn->history->fnames.dst_filename) - 1] = 0;
-        CF_CFDP_TxFile_Initiate(txn, cfdp_class, keep, chan_num, priority, dest_id);
+    return reserved;
+}
 
-        ++chan->num_cmd_tx;
-        txn->flags.tx.cmd_tx = 1;
-    }
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_CanTakeUnreserved(const CF_Channel_t *chan, const CF_Playback_t *self)
+{
+    const CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels];
 
-    return ret;
+    return chan->qs[CF_QueueIdx_FREE] && ((int)hk->q_size[CF_QueueIdx_FREE] > CF_CFDP_ReservedTransactions(chan, self));
 }
 
 /*----------------------------------------------------------------
@@ -1316,87 +1530,777 @@ CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename,
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-static CFE_Status_t CF_CFDP_PlaybackDir_Initiate(CF_Playback_t *pb, const char *src_filename, const char *dst_filename,
-                                                 CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 chan, uint8 priority,
-                                                 CF_EntityId_t dest_id)
+static bool CF_CFDP_PlaybackCanStart(const CF_Channel_t *chan, const CF_Playback_t *pb)
 {
-    CFE_Status_t ret;
+    return (pb->num_ts < pb->max_active) && CF_CFDP_CanTakeUnreserved(chan, pb);
+}
 
-    /* make sure the directory can be open */
-    ret = OS_DirectoryOpen(&pb->dir_id, src_filename);
-    if (ret != OS_SUCCESS)
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_PendingFile_t *CF_CFDP_FindStartablePending(CF_Channel_t *chan, const CF_TxGroup_t *group)
+{
+    CF_PendingFile_t *pf = NULL;
+    CF_PendingFile_t *head;
+    CF_Playback_t *   pb;
+    int               i;
+
+    if (chan->cmd_pend && (chan->num_cmd_tx < CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN) && chan->qs[CF_QueueIdx_FREE])
     {
-        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_OPENDIR, CFE_EVS_EventType_ERROR,
-                          "CF: failed to open playback directory %s, error=%ld", src_filename, (long)ret);
-        ++CF_AppData.hk.Payload.channel_hk[chan].counters.fault.directory_read;
+        pf = container_of(chan->cmd_pend, CF_PendingFile_t, src_node);
+        if (group && pf->group != group)
+        {
+            pf = NULL;
+        }
     }
-    else
+
+    /* the rest of a transmit group is commanded, so playbacks only need a look when not starting one */
+    for (i = 0; !group && i < (CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN + CF_MAX_POLLING_DIR_PER_CHAN + 1); ++i)
     {
-        pb->diropen    = 1;
-        pb->busy       = 1;
-        pb->keep       = keep;
-        pb->priority   = priority;
-        pb->dest_id    = dest_id;
-        pb->cfdp_class = cfdp_class;
+        if (i < CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN)
+        {
+            pb = &chan->playback[i];
+        }
+        else if (i < (CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN + CF_MAX_POLLING_DIR_PER_CHAN))
+        {
+            pb = &chan->poll[i - CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN].pb;
+        }
+        else
+        {
+            pb = &chan->manifest.pb;
+        }
 
-        /* NOTE: the caller of this function ensures the provided src and dst filenames are NULL terminated */
-        strncpy(pb->fnames.src_filename, src_filename, sizeof(pb->fnames.src_filename) - 1);
-        pb->fnames.src_filename[sizeof(pb->fnames.src_filename) - 1] = 0;
-        strncpy(pb->fnames.dst_filename, dst_filename, sizeof(pb->fnames.dst_filename) - 1);
-        pb->fnames.dst_filename[sizeof(pb->fnames.dst_filename) - 1] = 0;
+        if (pb->pend)
+        {
+            head = container_of(pb->pend, CF_PendingFile_t, src_node);
+            if ((!pf || CF_PendingFileBefore(head, pf)) && CF_CFDP_PlaybackCanStart(chan, pb))
+            {
+                pf = head;
+            }
+        }
     }
 
-    /* the executor will start the transfer next cycle */
-    return ret;
+    return pf;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_cfdp.h for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Moves a sent file to the move directory of the channel if there is
+ * one, otherwise or if that fails deletes it.
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_PlaybackDir(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
-                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id)
+static void CF_CFDP_DisposeSourceFile(uint8 chan_num, const char *src_filename)
 {
-    int            i;
-    CF_Playback_t *pb;
+    const char *  filename;
+    char          destination[OS_MAX_PATH_LEN];
+    osal_status_t status = OS_ERROR;
 
-    for (i = 0; i < CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN; ++i)
+    /* If move directory is defined attempt move */
+    if (CF_AppData.config_table->chan[chan_num].move_dir[0] != 0)
     {
-        pb = &CF_AppData.engine.channels[chan].playback[i];
-        if (!pb->busy)
+        filename = strrchr(src_filename, '/');
+        if (filename != NULL)
         {
-            break;
+            snprintf(destination, sizeof(destination), "%s%s", CF_AppData.config_table->chan[chan_num].move_dir,
+                     filename);
+            status = OS_mv(src_filename, destination);
         }
     }
 
-    if (i == CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN)
+    if (status != OS_SUCCESS)
     {
-        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_DIR_SLOT, CFE_EVS_EventType_ERROR, "CF: no playback dir slot available");
-        return CF_ERROR;
+        OS_remove(src_filename);
     }
-
-    return CF_CFDP_PlaybackDir_Initiate(pb, src_filename, dst_filename, cfdp_class, keep, chan, priority, dest_id);
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_cfdp.h for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Drops a reference to a transmit group, held by each of its pending files
+ * and member transactions.  The last one closes the shared file.
  *
  *-----------------------------------------------------------------*/
-void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
+static void CF_CFDP_ReleaseTxGroup(CF_TxGroup_t *group)
 {
-    CF_Transaction_t *txn;
-    os_dirent_t       dirent;
-    int32             status;
-
-    /* either there's no transaction (first one) or the last one was finished, so check for a new one */
-
-    memset(&dirent, 0, sizeof(dirent));
+    CF_Assert(group->num_refs); /* sanity check */
+    --group->num_refs;
 
-    while (pb->diropen && (pb->num_ts < CF_NUM_TRANSACTIONS_PER_PLAYBACK))
+    if (group->num_refs == 0 && OS_ObjectIdDefined(group->fd))
+    {
+        CF_WrappedClose(group->fd);
+        group->fd = OS_OBJECT_ID_UNDEFINED;
+
+        if (!group->keep)
+        {
+            CF_CFDP_DisposeSourceFile(group->chan_num, group->src_filename);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_FreePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_NameTable_Release(&CF_AppData.engine.path_prefixes, pf->src_prefix);
+    CF_NameTable_Release(&CF_AppData.engine.path_prefixes, pf->dst_prefix);
+    CF_CList_InsertBack(&chan->pf_free, &pf->cl_node);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_StartPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_Transaction_t *txn;
+
+    txn = CF_FindUnusedTransaction(chan);
+    CF_Assert(txn); /* CF_CFDP_FindStartablePending() checked there is a free one */
+
+    CF_PendingFileNames(pf, &txn->history->fnames);
+
+    CF_CFDP_InitTxnTxFile(txn, pf->cfdp_class, pf->keep, (chan - CF_AppData.engine.channels), pf->priority);
+
+    /* Capture info for history, the sequence number was assigned when the file was queued */
+    txn->history->dir      = CF_Direction_TX;
+    txn->history->seq_num  = pf->seq_num;
+    txn->history->src_eid  = CF_AppData.config_table->local_eid;
+    txn->history->peer_eid = pf->dest_id;
+
+    /* every PDU the sender builds goes from the local entity to the peer */
+    CF_CFDP_EncodeHeaderTemplate(&txn->cold->hdr_template, txn->history->src_eid, txn->history->peer_eid,
+                                 txn->history->seq_num);
+
+    /* the transaction was initiated when its file was queued */
+    txn->cold->init_time = pf->queued_time;
+    CF_Perf_RecordLatency(txn->chan_num, CF_LatencyHist_PEND, pf->priority, pf->queued_time);
+
+    CF_CFDP_ArmInactTimer(txn);
+
+    /* NOTE: whether or not class 1 or 2, get a free chunks. It's cheap, and simplifies cleanup path */
+    txn->chunks = CF_CFDP_FindUnusedChunks(chan, CF_Direction_TX);
+
+    txn->cold->pb = pf->pb;
+    if (pf->pb)
+    {
+        --pf->pb->num_pending;
+        ++pf->pb->num_ts;
+    }
+    else
+    {
+        txn->flags.tx.cmd_tx = 1;
+        ++chan->num_cmd_tx;
+    }
+
+    /* the group reference of the pending file passes to the transaction */
+    txn->cold->group = pf->group;
+    if (pf->group)
+    {
+        CF_Assert(pf->group->num_members < CF_TX_GROUP_MAX_DEST); /* sanity check */
+        pf->group->members[pf->group->num_members] = txn;
+        ++pf->group->num_members;
+    }
+
+    CF_RemovePendingFile(chan, pf);
+    CF_CFDP_FreePendingFile(chan, pf);
+
+    CF_InsertSortPrio(txn, CF_QueueIdx_TXA);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_DropPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    if (pf->pb)
+    {
+        --pf->pb->num_pending;
+    }
+
+    if (pf->group)
+    {
+        CF_CFDP_ReleaseTxGroup(pf->group);
+    }
+
+    CF_RemovePendingFile(chan, pf);
+    CF_CFDP_FreePendingFile(chan, pf);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Puts the outbound transaction of a relay back on the active queue,
+ * if it is waiting for data from the inbound one.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_ResumeRelay(CF_Transaction_t *txn)
+{
+    CF_Channel_t *chan = &CF_AppData.engine.channels[txn->chan_num];
+
+    if (txn->flags.com.q_index == CF_QueueIdx_TXW && txn->state_data.send.sub_state <= CF_TxSubState_EOF)
+    {
+        if (chan->cur == txn)
+        {
+            chan->cur = NULL; /* the tick of the wait queue starts over */
+        }
+
+        CF_DequeueTransaction(txn);
+        CF_InsertSortPrio(txn, CF_QueueIdx_TXA);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_StartRelay(CF_Transaction_t *rx)
+{
+    const CF_ChannelConfig_t *cc   = &CF_AppData.config_table->chan[rx->chan_num];
+    CF_Channel_t *            chan = &CF_AppData.engine.channels[cc->relay_chan];
+    CF_Transaction_t *        txn  = NULL;
+
+    /* a file is never relayed back to where it came from */
+    if (cc->relay_eid && cc->relay_eid != rx->history->src_eid)
+    {
+        /*
+         * The channel pool has no share for relays, so a relay only takes a
+         * transaction that is not held back for the receives, commanded
+         * files and playbacks of the relay channel.
+         */
+        if (CF_CFDP_CanTakeUnreserved(chan, NULL))
+        {
+            txn = CF_FindUnusedTransaction(chan);
+        }
+
+        if (!txn)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_RELAY_SLOT, CFE_EVS_EventType_ERROR,
+                              "CF R%d(%lu:%lu): no free transaction on channel %u to relay %s",
+                              (rx->state == CF_TxnState_R2), (unsigned long)rx->history->src_eid,
+                              (unsigned long)rx->history->seq_num, (unsigned int)cc->relay_chan,
+                              rx->history->fnames.dst_filename);
+        }
+        else
+        {
+            /* the file goes on under the name it is received as, and is kept here once sent */
+            strncpy(txn->history->fnames.src_filename, rx->history->fnames.dst_filename,
+                    sizeof(txn->history->fnames.src_filename) - 1);
+            strncpy(txn->history->fnames.dst_filename, rx->history->fnames.dst_filename,
+                    sizeof(txn->history->fnames.dst_filename) - 1);
+
+            CF_CFDP_InitTxnTxFile(txn, CF_CFDP_GetClass(rx), 1, cc->relay_chan, 0);
+
+            txn->history->dir      = CF_Direction_TX;
+            txn->history->seq_num  = ++CF_AppData.engine.seq_num;
+            txn->history->src_eid  = CF_AppData.config_table->local_eid;
+            txn->history->peer_eid = cc->relay_eid;
+
+            CF_CFDP_EncodeHeaderTemplate(&txn->cold->hdr_template, txn->history->src_eid, txn->history->peer_eid,
+                                         txn->history->seq_num);
+
+            txn->cold->init_time = CFE_TIME_GetTime();
+            CF_CFDP_ArmInactTimer(txn);
+
+            txn->chunks = CF_CFDP_FindUnusedChunks(chan, CF_Direction_TX);
+
+            txn->cold->relay = rx;
+            rx->cold->relay  = txn;
+
+            CF_InsertSortPrio(txn, CF_QueueIdx_TXA);
+
+            CFE_EVS_SendEvent(CF_EID_INF_CFDP_RELAY_START, CFE_EVS_EventType_INFORMATION,
+                              "CF R%d(%lu:%lu): relaying %s to entity %lu on channel %u", (rx->state == CF_TxnState_R2),
+                              (unsigned long)rx->history->src_eid, (unsigned long)rx->history->seq_num,
+                              rx->history->fnames.dst_filename, (unsigned long)cc->relay_eid,
+                              (unsigned int)cc->relay_chan);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_WakeRelay(CF_Transaction_t *rx)
+{
+    if (rx->cold->relay)
+    {
+        /* the outbound is idle while it waits, new data shows the transfer is still alive */
+        CF_CFDP_ArmInactTimer(rx->cold->relay);
+        CF_CFDP_ResumeRelay(rx->cold->relay);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EndRelay(CF_Transaction_t *txn)
+{
+    CF_Transaction_t *out = txn->cold->relay;
+
+    out->cold->relay = NULL;
+    txn->cold->relay = NULL;
+
+    if (!CF_CFDP_IsSender(txn))
+    {
+        if (!txn->keep)
+        {
+            /* the received file is not good, so neither is the copy on its way to the next hop */
+            CF_CFDP_CancelTransaction(out);
+        }
+
+        /* either way, the outbound no longer waits for anything to send its EOF */
+        CF_CFDP_ResumeRelay(out);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_QueuePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_TxnFilenames_t fnames;
+
+    /* Increment sequence number for new transaction, it is assigned now so commands can find the file */
+    ++CF_AppData.engine.seq_num;
+    pf->seq_num = CF_AppData.engine.seq_num;
+
+    CF_PendingFileNames(pf, &fnames);
+
+    CFE_EVS_SendEvent(CF_EID_INF_CFDP_S_START_SEND, CFE_EVS_EventType_INFORMATION,
+                      "CF: start class %d tx of file %lu:%s -> %lu:%s", pf->cfdp_class + 1,
+                      (unsigned long)CF_AppData.config_table->local_eid, fnames.src_filename,
+                      (unsigned long)pf->dest_id, fnames.dst_filename);
+
+    if (pf->pb)
+    {
+        ++pf->pb->num_pending;
+    }
+
+    pf->queued_time = CFE_TIME_GetTime();
+    pf->dump_stamp  = 0;
+    CF_InsertSortPendingFile(chan, pf);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Sets the names of a pending file from full paths.  The directories are
+ * interned, and each only takes a table entry if no other record or
+ * playback uses it already.  The destination leaf is only stored when it
+ * differs from the source one.  If there is no room for it after the
+ * source leaf, the destination path is interned whole.
+ *
+ * Returns CF_NAME_TOO_LONG_ERROR if the source file name can never fit,
+ * and CF_ERROR if the name table is full.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_SetPendingFileNames(CF_PendingFile_t *pf, const char *src_filename,
+                                                const char *dst_filename)
+{
+    CF_NameTable_t *names  = &CF_AppData.engine.path_prefixes;
+    const char *    slash  = strrchr(dst_filename, '/');
+    const char *    leaf   = slash ? (slash + 1) : dst_filename;
+    CFE_Status_t    ret    = CFE_SUCCESS;
+    size_t          offset = 0;
+
+    pf->dst_prefix = CF_NAME_HANDLE_INVALID;
+    pf->src_prefix = CF_NameTable_InternPath(names, src_filename, pf->leaves, sizeof(pf->leaves));
+    if (pf->src_prefix == CF_NAME_HANDLE_INVALID)
+    {
+        /* the table is full, unless the source file name does not fit in the record at all */
+        slash = strrchr(src_filename, '/');
+        ret   = (strlen(slash ? (slash + 1) : src_filename) >= sizeof(pf->leaves)) ? CF_NAME_TOO_LONG_ERROR : CF_ERROR;
+    }
+    else
+    {
+        pf->same_leaf = !strcmp(leaf, pf->leaves);
+        offset        = strlen(pf->leaves) + 1;
+    }
+
+    if (ret == CFE_SUCCESS && pf->same_leaf)
+    {
+        pf->dst_prefix = CF_NameTable_Intern(names, dst_filename, leaf - dst_filename);
+    }
+    else if (ret == CFE_SUCCESS)
+    {
+        pf->dst_prefix =
+            CF_NameTable_InternPath(names, dst_filename, &pf->leaves[offset], sizeof(pf->leaves) - offset);
+        if (pf->dst_prefix == CF_NAME_HANDLE_INVALID && offset < sizeof(pf->leaves))
+        {
+            pf->leaves[offset] = 0;
+            pf->dst_prefix     = CF_NameTable_Intern(names, dst_filename, strlen(dst_filename));
+        }
+    }
+
+    if (ret == CFE_SUCCESS && pf->dst_prefix == CF_NAME_HANDLE_INVALID)
+    {
+        CF_NameTable_Release(names, pf->src_prefix);
+        pf->src_prefix = CF_NAME_HANDLE_INVALID;
+        ret            = CF_ERROR;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_QueueNamedFile(CF_Channel_t *chan, CF_Playback_t *pb, CF_TxGroup_t *group,
+                                           const char *src_filename, const char *dst_filename,
+                                           CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 priority,
+                                           CF_EntityId_t dest_id)
+{
+    CF_PendingFile_t *pf;
+    CFE_Status_t      ret;
+
+    if (!chan->pf_free)
+    {
+        ret = CF_ERROR;
+    }
+    else
+    {
+        pf  = container_of(chan->pf_free, CF_PendingFile_t, cl_node);
+        ret = CF_CFDP_SetPendingFileNames(pf, src_filename, dst_filename);
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        CF_CList_Remove(&chan->pf_free, &pf->cl_node);
+
+        pf->pb         = pb;
+        pf->group      = group;
+        pf->dest_id    = dest_id;
+        pf->cfdp_class = cfdp_class;
+        pf->keep       = keep;
+        pf->priority   = priority;
+        pf->suspended  = false;
+
+        CF_CFDP_QueuePendingFile(chan, pf);
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_QueuePlaybackFile(CF_Channel_t *chan, CF_Playback_t *pb, const char *name)
+{
+    CF_PendingFile_t *pf;
+
+    pf = container_of(CF_CList_Pop(&chan->pf_free), CF_PendingFile_t, cl_node);
+
+    /* the directories were interned when the playback started, the files only add a reference */
+    CF_NameTable_AddRef(&CF_AppData.engine.path_prefixes, pb->src_prefix);
+    CF_NameTable_AddRef(&CF_AppData.engine.path_prefixes, pb->dst_prefix);
+
+    strncpy(pf->leaves, name, sizeof(pf->leaves) - 1);
+    pf->leaves[sizeof(pf->leaves) - 1] = 0;
+
+    pf->src_prefix = pb->src_prefix;
+    pf->dst_prefix = pb->dst_prefix;
+    pf->same_leaf  = true;
+    pf->pb         = pb;
+    pf->group      = NULL;
+    pf->dest_id    = pb->dest_id;
+    pf->cfdp_class = pb->cfdp_class;
+    pf->keep       = pb->keep;
+    pf->priority   = pb->priority;
+    pf->suspended  = false;
+
+    CF_CFDP_QueuePendingFile(chan, pf);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class, uint8 keep,
+                            uint8 chan_num, uint8 priority, CF_EntityId_t dest_id)
+{
+    CF_Assert(chan_num < CF_NUM_CHANNELS);
+
+    CFE_Status_t ret;
+
+    /* NOTE: the caller of this function ensures the provided src and dst filenames are NULL terminated */
+    ret = CF_CFDP_QueueNamedFile(&CF_AppData.engine.channels[chan_num], NULL, NULL, src_filename, dst_filename,
+                                 cfdp_class, keep, priority, dest_id);
+    if (ret == CF_NAME_TOO_LONG_ERROR)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_PENDING_NAME, CFE_EVS_EventType_ERROR,
+                          "CF: file name of %s too long to queue", src_filename);
+    }
+    else if (ret != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_PENDING_SLOT, CFE_EVS_EventType_ERROR,
+                          "CF: no free pending file record on channel %u", (unsigned int)chan_num);
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_TxFileMulti(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
+                                 uint8 keep, uint8 chan, uint8 priority, const CF_EntityId_t *dest_ids, uint8 num_dest)
+{
+    CF_TxGroup_t *group = NULL;
+    CFE_Status_t  status;
+    int           i;
+
+    CF_Assert(chan < CF_NUM_CHANNELS);
+
+    for (i = 0; i < CF_NUM_TX_GROUPS; ++i)
+    {
+        if (CF_AppData.engine.tx_groups[i].num_refs == 0)
+        {
+            group = &CF_AppData.engine.tx_groups[i];
+            break;
+        }
+    }
+
+    if (!group)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_GROUP_SLOT, CFE_EVS_EventType_ERROR, "CF: no transmit group available");
+        return CF_ERROR;
+    }
+
+    memset(group, 0, sizeof(*group));
+    group->fd       = OS_OBJECT_ID_UNDEFINED;
+    group->chan_num = chan;
+    group->keep     = keep;
+    strncpy(group->src_filename, src_filename, sizeof(group->src_filename) - 1);
+
+    /* NOTE: the caller of this function ensures the provided src and dst filenames are NULL terminated */
+    for (i = 0; i < num_dest; ++i)
+    {
+        status = CF_CFDP_QueueNamedFile(&CF_AppData.engine.channels[chan], NULL, group, src_filename, dst_filename,
+                                        cfdp_class, keep, priority, dest_ids[i]);
+        if (status != CFE_SUCCESS)
+        {
+            if (status == CF_NAME_TOO_LONG_ERROR)
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_CFDP_PENDING_NAME, CFE_EVS_EventType_ERROR,
+                                  "CF: file name of %s too long to queue", src_filename);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(CF_EID_ERR_CFDP_PENDING_SLOT, CFE_EVS_EventType_ERROR,
+                                  "CF: no free pending file record on channel %u, %d of %u destinations queued",
+                                  (unsigned int)chan, i, (unsigned int)num_dest);
+            }
+            break;
+        }
+
+        ++group->num_refs;
+    }
+
+    /* if nothing was queued the group stays free */
+    return group->num_refs ? CFE_SUCCESS : CF_ERROR;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_PlaybackDir_Initiate(CF_Playback_t *pb, const char *src_filename, const char *dst_filename,
+                                                 CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 chan, uint8 priority,
+                                                 CF_EntityId_t dest_id, uint16 max_active, uint16 max_pending)
+{
+    CF_NameTable_t *names = &CF_AppData.engine.path_prefixes;
+    char            prefix[CF_FILENAME_MAX_LEN];
+    int             len;
+    CFE_Status_t    ret;
+
+    /* make sure the directory can be open */
+    ret = OS_DirectoryOpen(&pb->dir_id, src_filename);
+    if (ret != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_OPENDIR, CFE_EVS_EventType_ERROR,
+                          "CF: failed to open playback directory %s, error=%ld", src_filename, (long)ret);
+        ++CF_AppData.hk.Payload.channel_hk[chan].counters.fault.directory_read;
+        return ret;
+    }
+
+    /* the -1 below is to make room for the slash, which is part of the prefix */
+    len            = snprintf(prefix, sizeof(prefix), "%.*s/", CF_FILENAME_MAX_PATH - 1, src_filename);
+    pb->src_prefix = CF_NameTable_Intern(names, prefix, len);
+    len            = snprintf(prefix, sizeof(prefix), "%.*s/", CF_FILENAME_MAX_PATH - 1, dst_filename);
+    pb->dst_prefix = CF_NameTable_Intern(names, prefix, len);
+
+    if ((pb->src_prefix == CF_NAME_HANDLE_INVALID) || (pb->dst_prefix == CF_NAME_HANDLE_INVALID))
+    {
+        CF_NameTable_Release(names, pb->src_prefix);
+        CF_NameTable_Release(names, pb->dst_prefix);
+        OS_DirectoryClose(pb->dir_id);
+
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_PATH_PREFIXES, CFE_EVS_EventType_ERROR,
+                          "CF: no room in path prefix table for playback of %s", src_filename);
+        return CF_ERROR;
+    }
+
+    pb->diropen     = 1;
+    pb->busy        = 1;
+    pb->keep        = keep;
+    pb->priority    = priority;
+    pb->dest_id     = dest_id;
+    pb->cfdp_class  = cfdp_class;
+    pb->num_pending = 0;
+
+    /* zero limits select the defaults the transaction pool was sized for */
+    pb->max_active  = max_active ? max_active : CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    pb->max_pending = max_pending ? max_pending : CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+
+    /* the executor will start the transfer next cycle */
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_PlaybackDir(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
+                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id, uint16 max_active,
+                                 uint16 max_pending)
+{
+    int            i;
+    CF_Playback_t *pb;
+
+    for (i = 0; i < CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN; ++i)
+    {
+        pb = &CF_AppData.engine.channels[chan].playback[i];
+        if (!pb->busy)
+        {
+            break;
+        }
+    }
+
+    if (i == CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_DIR_SLOT, CFE_EVS_EventType_ERROR, "CF: no playback dir slot available");
+        return CF_ERROR;
+    }
+
+    return CF_CFDP_PlaybackDir_Initiate(pb, src_filename, dst_filename, cfdp_class, keep, chan, priority, dest_id,
+                                        max_active, max_pending);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_TxManifest(const char *filename, uint8 keep, uint8 chan)
+{
+    CF_Manifest_t *      mf = &CF_AppData.engine.channels[chan].manifest;
+    CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[chan];
+    char                 path[CF_FILENAME_MAX_LEN];
+    os_fstat_t           fstat;
+    CFE_Status_t         ret;
+
+    CF_Assert(chan < CF_NUM_CHANNELS);
+
+    /* the filename from the command may not be NULL terminated */
+    strncpy(path, filename, sizeof(path) - 1);
+    path[sizeof(path) - 1] = 0;
+
+    if (mf->pb.busy)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CFDP_MANIFEST_SLOT, CFE_EVS_EventType_ERROR,
+                          "CF: a manifest is already in progress on channel %u", (unsigned int)chan);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        ret = CF_WrappedOpenCreate(&mf->fd, path, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+        if (ret != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_MANIFEST_OPEN, CFE_EVS_EventType_ERROR,
+                              "CF: failed to open manifest %s, error=%ld", path, (long)ret);
+            ++hk->counters.fault.file_open;
+        }
+        else
+        {
+            mf->fileopen       = true;
+            mf->pb.busy        = 1;
+            mf->pb.keep        = keep;
+            mf->pb.num_ts      = 0;
+            mf->pb.num_pending = 0;
+            mf->pb.diropen     = 0;
+            mf->pb.max_active  = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+            mf->pb.max_pending = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+
+            /* the total is for progress reporting only, so it is fine if it cannot be determined */
+            hk->manifest_total   = 0;
+            hk->manifest_queued  = 0;
+            hk->manifest_skipped = 0;
+            hk->manifest_active  = 1;
+            if (OS_stat(path, &fstat) == OS_SUCCESS)
+            {
+                hk->manifest_total = OS_FILESTAT_SIZE(fstat) / sizeof(CF_TxManifestEntry_t);
+            }
+        }
+    }
+
+    /* the executor will start the transfers next cycle */
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
+{
+    os_dirent_t dirent;
+    int32       status;
+
+    memset(&dirent, 0, sizeof(dirent));
+
+    /* only the name is held until a transaction is available, the pending queue applies the concurrency limit */
+    while (pb->diropen && (pb->num_pending < pb->max_pending) && chan->pf_free)
     {
         CFE_ES_PerfLogEntry(CF_PERF_ID_DIRREAD);
         status = OS_DirectoryRead(pb->dir_id, &dirent);
@@ -1409,25 +2313,7 @@ void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
                 continue;
             }
 
-            txn = CF_FindUnusedTransaction(chan);
-            CF_Assert(pt); /* should be impossible not to have one because there are limits on the number of uses of
-                                them */
-
-            /* the -1 below is to make room for the slash */
-            snprintf(txn->history->fnames.src_filename, sizeof(txn->history->fnames.src_filename), "%.*s/%.*s",
-                     CF_FILENAME_MAX_PATH - 1, pb->fnames.src_filename, CF_FILENAME_MAX_NAME - 1, dirent.FileName);
-            snprintf(txn->history->fnames.dst_filename, sizeof(txn->history->fnames.dst_filename), "%.*s/%.*s",
-                     CF_FILENAME_MAX_PATH - 1, pb->fnames.dst_filename, CF_FILENAME_MAX_NAME - 1, dirent.FileName);
-
-            /* in case snprintf didn't have room for NULL terminator */
-            txn->history->fnames.src_filename[CF_FILENAME_MAX_LEN - 1] = 0;
-            txn->history->fnames.dst_filename[CF_FILENAME_MAX_LEN - 1] = 0;
-
-            CF_CFDP_TxFile_Initiate(txn, pb->cfdp_class, pb->keep, (chan - CF_AppData.engine.channels), pb->priority,
-                                    pb->dest_id);
-
-            txn->pb = pb;
-            ++pb->num_ts;
+            CF_CFDP_QueuePlaybackFile(chan, pb, dirent.FileName);
         }
         else
         {
@@ -1437,14 +2323,113 @@ void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
         }
     }
 
-    if (!pb->diropen && !pb->num_ts)
+    if (pb->busy && !pb->diropen && !pb->num_ts && !pb->num_pending)
     {
-        /* the directory has been exhausted, and there are no more active transactions
+        /* the directory has been exhausted, and there are no more active or pending transactions
          * for this playback -- so mark it as not busy */
+        CF_NameTable_Release(&CF_AppData.engine.path_prefixes, pb->src_prefix);
+        CF_NameTable_Release(&CF_AppData.engine.path_prefixes, pb->dst_prefix);
         pb->busy = 0;
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * A record read from a manifest has not been checked by anything yet.  It
+ * gets the class check CF_TxFileCmd() makes, both names must be given and
+ * the destination must be another entity.  As for the command, any
+ * priority is acceptable.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_ManifestEntryValid(const CF_TxManifestEntry_t *rec)
+{
+    return (rec->cfdp_class == CF_CFDP_CLASS_1 || rec->cfdp_class == CF_CFDP_CLASS_2) &&
+           (rec->dest_id != CF_AppData.config_table->local_eid) && rec->src_filename[0] && rec->dst_filename[0];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ProcessManifest(CF_Channel_t *chan)
+{
+    CF_Manifest_t *      mf       = &chan->manifest;
+    const uint8          chan_num = (chan - CF_AppData.engine.channels);
+    CF_HkChannel_Data_t *hk       = &CF_AppData.hk.Payload.channel_hk[chan_num];
+    CF_TxManifestEntry_t rec;
+    char                 src_filename[CF_FILENAME_MAX_LEN];
+    char                 dst_filename[CF_FILENAME_MAX_LEN];
+    CFE_Status_t         status;
+    uint32               reads = 0;
+
+    /* the read limit keeps a manifest full of invalid records from stalling the wakeup */
+    while (mf->fileopen && (mf->pb.num_pending < mf->pb.max_pending) && chan->pf_free &&
+           (reads < CF_NUM_TRANSACTIONS_PER_PLAYBACK))
+    {
+        ++reads;
+        status = CF_WrappedRead(mf->fd, &rec, sizeof(rec));
+
+        if (status != sizeof(rec))
+        {
+            /* zero is the end of the manifest, anything else is a read error or a partial record */
+            if (status != 0)
+            {
+                ++hk->counters.fault.file_read;
+                ++hk->manifest_skipped;
+            }
+
+            CF_WrappedClose(mf->fd);
+            mf->fileopen = false;
+
+            CFE_EVS_SendEvent(CF_EID_INF_CFDP_MANIFEST_DONE, CFE_EVS_EventType_INFORMATION,
+                              "CF: manifest read on channel %u, %lu files queued, %lu records skipped",
+                              (unsigned int)chan_num, (unsigned long)hk->manifest_queued,
+                              (unsigned long)hk->manifest_skipped);
+        }
+        else if (!CF_CFDP_ManifestEntryValid(&rec))
+        {
+            ++hk->manifest_skipped;
+        }
+        else
+        {
+            /* the record filenames may not be NULL terminated */
+            strncpy(src_filename, rec.src_filename, sizeof(src_filename) - 1);
+            src_filename[sizeof(src_filename) - 1] = 0;
+            strncpy(dst_filename, rec.dst_filename, sizeof(dst_filename) - 1);
+            dst_filename[sizeof(dst_filename) - 1] = 0;
+
+            status = CF_CFDP_QueueNamedFile(chan, &mf->pb, NULL, src_filename, dst_filename, rec.cfdp_class,
+                                            mf->pb.keep, rec.priority, rec.dest_id);
+            if (status == CFE_SUCCESS)
+            {
+                ++hk->manifest_queued;
+            }
+            else if (status == CF_NAME_TOO_LONG_ERROR)
+            {
+                ++hk->manifest_skipped;
+            }
+            else
+            {
+                /* the name table is full, read the record again once a file is done */
+                CF_WrappedLseek(mf->fd, -(int32)sizeof(rec), OS_SEEK_CUR);
+                break;
+            }
+        }
+    }
+
+    if (!mf->fileopen && !mf->pb.num_ts && !mf->pb.num_pending)
+    {
+        /* all records were read and all of their transactions are done */
+        mf->pb.busy = 0;
+    }
+
+    hk->manifest_active = mf->pb.busy;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -1525,7 +2510,8 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan)
                 {
                     /* the timer has expired */
                     ret = CF_CFDP_PlaybackDir_Initiate(&poll->pb, pd->src_dir, pd->dst_dir, pd->cfdp_class, 0,
-                                                       chan_index, pd->priority, pd->dest_eid);
+                                                       chan_index, pd->priority, pd->dest_eid, pd->max_active,
+                                                       pd->max_pending);
                     if (!ret)
                     {
                         poll->timer_set = 0;
@@ -1565,6 +2551,7 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan)
 void CF_CFDP_CycleEngine(void)
 {
     CF_Channel_t *chan;
+    CF_PerfMark_t mark;
     int           i;
 
     if (CF_AppData.engine.enabled)
@@ -1573,9 +2560,12 @@ void CF_CFDP_CycleEngine(void)
         {
             chan                               = &CF_AppData.engine.channels[i];
             CF_AppData.engine.outgoing_counter = 0;
+            chan->sem_wait_left_ms             = CF_AppData.config_table->chan[i].sem_wait_ms;
 
             /* consume all received messages, even if channel is frozen */
+            CF_Perf_Begin(&mark, CF_PerfPhase_RECV);
             CF_CFDP_ReceiveMessage(chan);
+            CF_Perf_End(&mark);
 
             if (!CF_AppData.hk.Payload.channel_hk[i].frozen)
             {
@@ -1587,13 +2577,50 @@ void CF_CFDP_CycleEngine(void)
                 CF_CFDP_TickTransactions(chan);
 
                 /* cycle the current tx transaction */
+                CF_Perf_Begin(&mark, CF_PerfPhase_CYCLE_TX);
                 CF_CFDP_CycleTx(chan);
+                CF_Perf_End(&mark);
 
+                CF_Perf_Begin(&mark, CF_PerfPhase_PLAYBACK);
                 CF_CFDP_ProcessPlaybackDirectories(chan);
+                CF_Perf_End(&mark);
+
+                CF_Perf_Begin(&mark, CF_PerfPhase_POLLING);
                 CF_CFDP_ProcessPollingDirectories(chan);
+                CF_Perf_End(&mark);
+
+                CF_CFDP_ProcessManifest(chan);
             }
+
+            /* let the transport replenish the output buffers used this cycle, so the next
+             * cycle does not need to allocate them while building PDUs */
+            CF_CFDP_TransportCycle(chan);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_LeaveTxGroup(CF_Transaction_t *txn)
+{
+    CF_TxGroup_t *group = txn->cold->group;
+    uint8         i;
+
+    for (i = 0; i < group->num_members; ++i)
+    {
+        if (group->members[i] == txn)
+        {
+            --group->num_members;
+            group->members[i] = group->members[group->num_members];
+            break;
         }
     }
+
+    txn->cold->group = NULL;
+    CF_CFDP_ReleaseTxGroup(group);
 }
 
 /*----------------------------------------------------------------
@@ -1604,10 +2631,7 @@ void CF_CFDP_CycleEngine(void)
  *-----------------------------------------------------------------*/
 void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, int keep_history)
 {
-    char *        filename;
-    char          destination[OS_MAX_PATH_LEN];
-    osal_status_t status = OS_ERROR;
-    CF_Channel_t *chan   = &CF_AppData.engine.channels[txn->chan_num];
+    CF_Channel_t *chan = &CF_AppData.engine.channels[txn->chan_num];
     CF_Assert(txn->chan_num < CF_NUM_CHANNELS);
 
     if (txn->flags.com.q_index == CF_QueueIdx_FREE)
@@ -1619,31 +2643,22 @@ void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, int keep_history)
 
     CF_CFDP_SendEotPkt(txn);
 
+    CF_Perf_RecordLatency(txn->chan_num, CF_LatencyHist_TOTAL, txn->priority, txn->cold->init_time);
     CF_DequeueTransaction(txn);
 
-    if (OS_ObjectIdDefined(txn->fd))
+    if (txn->cold->relay)
+    {
+        CF_CFDP_EndRelay(txn);
+    }
+
+    if (OS_ObjectIdDefined(txn->cold->fd))
     {
-        CF_WrappedClose(txn->fd);
+        CF_WrappedClose(txn->cold->fd);
         if (!txn->keep)
         {
             if (CF_CFDP_IsSender(txn))
             {
-                /* If move directory is defined attempt move */
-                if (CF_AppData.config_table->chan[txn->chan_num].move_dir[0] != 0)
-                {
-                    filename = strrchr(txn->history->fnames.src_filename, '/');
-                    if (filename != NULL)
-                    {
-                        snprintf(destination, sizeof(destination), "%s%s",
-                                 CF_AppData.config_table->chan[txn->chan_num].move_dir, filename);
-                        status = OS_mv(txn->history->fnames.src_filename, destination);
-                    }
-                }
-
-                if (status != OS_SUCCESS)
-                {
-                    OS_remove(txn->history->fnames.src_filename);
-                }
+                CF_CFDP_DisposeSourceFile(txn->chan_num, txn->history->fnames.src_filename);
             }
             else
             {
@@ -1661,23 +2676,31 @@ void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, int keep_history)
             --chan->num_cmd_tx;
         }
 
-        if (txn->pb)
+        if (txn->cold->pb)
         {
             /* a playback's transaction is now done, decrement the playback counter */
-            CF_Assert(txn->pb->num_ts);
-            --txn->pb->num_ts;
+            CF_Assert(txn->cold->pb->num_ts);
+            --txn->cold->pb->num_ts;
+        }
+
+        if (txn->cold->group)
+        {
+            /* the shared file stays open until the last member is done with it */
+            CF_CFDP_LeaveTxGroup(txn);
+        }
+
+        if (txn->state_data.send.fec)
+        {
+            txn->state_data.send.fec->in_use = false;
+            txn->state_data.send.fec         = NULL;
         }
     }
 
     /* bookkeeping for all transactions */
-    /* move transaction history to history queue */
+    /* store transaction history in the channel history ring */
     if (keep_history)
     {
-        CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST, &txn->history->cl_node);
-    }
-    else
-    {
-        CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST_FREE, &txn->history->cl_node);
+        CF_HistoryRing_Add(&chan->history, txn->history);
     }
 
     CF_CList_InsertBack(&chan->cs[!!CF_CFDP_IsSender(txn)], &txn->chunks->cl_node);
@@ -1734,7 +2757,7 @@ void CF_CFDP_SendEotPkt(CF_Transaction_t *txn)
         EotPktPtr->Payload.peer_eid   = txn->history->peer_eid;
         EotPktPtr->Payload.seq_num    = txn->history->seq_num;
         EotPktPtr->Payload.fsize      = txn->fsize;
-        EotPktPtr->Payload.crc_result = txn->crc.result;
+        EotPktPtr->Payload.crc_result = txn->cold->crc.result;
 
         /*
         ** Timestamp and send eod of transaction telemetry
@@ -1744,6 +2767,177 @@ void CF_CFDP_SendEotPkt(CF_Transaction_t *txn)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_FillTxnTlmEntry(CF_Transaction_t *txn, CF_TxnTlm_Entry_t *entry, CFE_TIME_SysTime_t now)
+{
+    CF_TxnProgress_t * prog = &txn->cold->progress;
+    CFE_TIME_SysTime_t elapsed;
+    uint64             usecs;
+    uint8              sub_state;
+    CF_FileSize_t      end;
+    CF_FileSize_t      covered;
+
+    if (CF_CFDP_IsSender(txn))
+    {
+        sub_state = txn->state_data.send.sub_state;
+    }
+    else
+    {
+        sub_state = txn->state_data.receive.sub_state;
+    }
+
+    memset(entry, 0, sizeof(*entry));
+    entry->seq_num          = txn->history->seq_num;
+    entry->src_eid          = txn->history->src_eid;
+    entry->peer_eid         = txn->history->peer_eid;
+    entry->direction        = txn->history->dir;
+    entry->state            = txn->state;
+    entry->sub_state        = sub_state;
+    entry->suspended        = txn->flags.com.suspended;
+    entry->fsize            = txn->fsize;
+    entry->retransmit_bytes = prog->retransmit_bytes;
+
+    if (txn->state == CF_TxnState_S2)
+    {
+        /* the chunk list of a sender holds the NAKed data not yet resent */
+        entry->progress_bytes = txn->foffs;
+        entry->gap_bytes      = CF_ChunkList_TotalSize(&txn->chunks->chunks);
+    }
+    else if (txn->state == CF_TxnState_R2)
+    {
+        /* before EOF only holes below the highest offset received are gaps */
+        covered = CF_ChunkList_TotalSize(&txn->chunks->chunks);
+        end     = txn->flags.rx.eof_recv ? txn->fsize : CF_ChunkList_GetEnd(&txn->chunks->chunks);
+
+        entry->progress_bytes = covered;
+        entry->gap_bytes      = (end > covered) ? (end - covered) : 0;
+    }
+    else if (CF_CFDP_IsSender(txn))
+    {
+        entry->progress_bytes = txn->foffs;
+    }
+    else
+    {
+        entry->progress_bytes = prog->file_data_bytes;
+    }
+
+    if (prog->reported)
+    {
+        elapsed = CFE_TIME_Subtract(now, prog->rate_time);
+        usecs   = ((uint64)elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(elapsed.Subseconds);
+        if (usecs != 0)
+        {
+            entry->rate = (uint32)(((uint64)(prog->file_data_bytes - prog->rate_bytes) * 1000000) / usecs);
+        }
+    }
+
+    if (!prog->reported || (prog->state != txn->state) || (prog->sub_state != sub_state))
+    {
+        prog->state_time = now;
+        prog->state      = txn->state;
+        prog->sub_state  = sub_state;
+    }
+
+    entry->time_in_state = CFE_TIME_Subtract(now, prog->state_time).Seconds;
+
+    prog->rate_time  = now;
+    prog->rate_bytes = prog->file_data_bytes;
+    prog->reported   = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_FlushTxnTlm(CF_CFDP_TxnTlm_args_t *args)
+{
+    if (args->buf != NULL)
+    {
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(args->pkt->TelemetryHeader));
+        CFE_SB_TransmitBuffer(args->buf, true);
+
+        args->buf = NULL;
+        args->pkt = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_CListTraverse_Status_t CF_CFDP_AddTxnTlm(CF_CListNode_t *node, void *context)
+{
+    CF_CFDP_TxnTlm_args_t *args = (CF_CFDP_TxnTlm_args_t *)context;
+    CF_Transaction_t *     txn  = container_of(node, CF_Transaction_t, cl_node);
+
+    if (args->buf == NULL)
+    {
+        args->buf = CFE_SB_AllocateMessageBuffer(sizeof(*args->pkt));
+        if (args->buf != NULL)
+        {
+            args->pkt = (void *)args->buf;
+
+            CFE_MSG_Init(CFE_MSG_PTR(args->pkt->TelemetryHeader), CFE_SB_ValueToMsgId(CF_TXN_TLM_MID),
+                         sizeof(*args->pkt));
+            memset(&args->pkt->Payload, 0, sizeof(args->pkt->Payload));
+            args->pkt->Payload.channel = args->chan;
+        }
+    }
+
+    /* a transaction is left out of this report if there is no buffer for it */
+    if (args->buf != NULL)
+    {
+        CF_CFDP_FillTxnTlmEntry(txn, &args->pkt->Payload.txns[args->pkt->Payload.num_txns], args->now);
+        ++args->pkt->Payload.num_txns;
+
+        if (args->pkt->Payload.num_txns == CF_TXN_TLM_MAX_ENTRIES)
+        {
+            CF_CFDP_FlushTxnTlm(args);
+        }
+    }
+
+    return CF_CLIST_CONT;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_SendTxnTlm(void)
+{
+    static const CF_QueueIdx_t TLM_QUEUES[] = {CF_QueueIdx_TXA, CF_QueueIdx_TXW, CF_QueueIdx_RX};
+    CF_CFDP_TxnTlm_args_t      args;
+    CF_Channel_t *             chan;
+    int                        i;
+    int                        j;
+
+    memset(&args, 0, sizeof(args));
+    args.now = CFE_TIME_GetTime();
+
+    for (i = 0; i < CF_NUM_CHANNELS; ++i)
+    {
+        chan      = &CF_AppData.engine.channels[i];
+        args.chan = i;
+
+        for (j = 0; j < (sizeof(TLM_QUEUES) / sizeof(TLM_QUEUES[0])); ++j)
+        {
+            CF_CList_Traverse(chan->qs[TLM_QUEUES[j]], CF_CFDP_AddTxnTlm, &args);
+        }
+
+        CF_CFDP_FlushTxnTlm(&args);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1790,9 +2984,9 @@ void CF_CFDP_CancelTransaction(CF_Transaction_t *txn)
 CF_CListTraverse_Status_t CF_CFDP_CloseFiles(CF_CListNode_t *node, void *context)
 {
     CF_Transaction_t *txn = container_of(node, CF_Transaction_t, cl_node);
-    if (OS_ObjectIdDefined(txn->fd))
+    if (OS_ObjectIdDefined(txn->cold->fd))
     {
-        CF_WrappedClose(txn->fd);
+        CF_WrappedClose(txn->cold->fd);
     }
     return CF_CLIST_CONT;
 }
@@ -1839,9 +3033,28 @@ void CF_CFDP_DisableEngine(void)
             }
         }
 
+        /* as does an unfinished manifest */
+        if (chan->manifest.fileopen)
+        {
+            CF_WrappedClose(chan->manifest.fd);
+        }
+        CF_AppData.hk.Payload.channel_hk[i].manifest_active = 0;
+
         /* finally all queue counters must be reset */
         memset(&CF_AppData.hk.Payload.channel_hk[i].q_size, 0, sizeof(CF_AppData.hk.Payload.channel_hk[i].q_size));
 
+        /* give back any pre-allocated output buffers and other transport resources */
+        CF_CFDP_TransportClose(chan);
+
         CFE_SB_DeletePipe(chan->pipe);
     }
+
+    /* the members of transmit groups share the files the groups hold open */
+    for (i = 0; i < CF_NUM_TX_GROUPS; ++i)
+    {
+        if (CF_AppData.engine.tx_groups[i].num_refs && OS_ObjectIdDefined(CF_AppData.engine.tx_groups[i].fd))
+        {
+            CF_WrappedClose(CF_AppData.engine.tx_groups[i].fd);
+        }
+    }
 }
@@ -48,6 +48,17 @@ typedef struct CF_CFDP_Tick_args
     int cont;                              /**< \brief if 1, then re-traverse the list */
 } CF_CFDP_Tick_args_t;
 
+/**
+ * @brief Structure for use with the CF_CFDP_AddTxnTlm() function
+ */
+typedef struct CF_CFDP_TxnTlm_args
+{
+    CFE_SB_Buffer_t *  buf;  /**< \brief packet being filled, NULL until the first entry */
+    CF_TxnTlmPacket_t *pkt;  /**< \brief same as buf */
+    uint8              chan; /**< \brief channel number */
+    CFE_TIME_SysTime_t now;  /**< \brief time of this report */
+} CF_CFDP_TxnTlm_args_t;
+
 /********************************************************************************/
 /**
  * @brief Initiate the process of encoding a new PDU to send
@@ -117,6 +128,33 @@ void CF_CFDP_SetTxnStatus(CF_Transaction_t *txn, CF_TxnStatus_t txn_stat);
  */
 void CF_CFDP_SendEotPkt(CF_Transaction_t *txn);
 
+/************************************************************************/
+/** @brief Fill one entry of the active transaction status packet.
+ *
+ * Also records the state and byte count seen by this report, which the
+ * next report uses to compute the rate and time in state.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn and entry must not be NULL.
+ *
+ * @param txn    Pointer to the transaction object
+ * @param entry  Entry to fill
+ * @param now    Time of this report
+ */
+void CF_CFDP_FillTxnTlmEntry(CF_Transaction_t *txn, CF_TxnTlm_Entry_t *entry, CFE_TIME_SysTime_t now);
+
+/************************************************************************/
+/** @brief Send the active transaction status packets of all channels.
+ *
+ * @par Description
+ *       Each channel with active transactions sends as many packets as it
+ *       needs to report all of them. Called on the housekeeping request.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       None
+ */
+void CF_CFDP_SendTxnTlm(void);
+
 /************************************************************************/
 /** @brief Initialization function for the CFDP engine
  *
@@ -154,11 +192,12 @@ void CF_CFDP_DisableEngine(void);
 /** @brief Begin transmit of a file.
  *
  * @par Description
- *       This function sets up a transaction for and starts transmit of
- *       the given filename.
+ *       This function queues the given filename on the channel pending queue,
+ *       where it waits for a transaction to become available.
  *
  * @par Assumptions, External Events, and Notes:
  *       src_filename must not be NULL. dst_filename must not be NULL.
+ *       Both must be NULL terminated within CF_FILENAME_MAX_LEN.
  *
  * @param src_filename  Local filename
  * @param dst_filename  Remote filename
@@ -174,6 +213,35 @@ void CF_CFDP_DisableEngine(void);
 CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class, uint8 keep,
                             uint8 chan, uint8 priority, CF_EntityId_t dest_id);
 
+/************************************************************************/
+/** @brief Begin transmit of a file to several destinations.
+ *
+ * @par Description
+ *       This function takes a free transmit group and queues one pending file
+ *       per destination on the channel pending queue, all in the group.  The
+ *       transactions of the group share the open file, the file checksum and
+ *       the last file data read.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       src_filename must not be NULL. dst_filename must not be NULL.
+ *       Both must be NULL terminated within CF_FILENAME_MAX_LEN.
+ *       dest_ids must not be NULL, and num_dest must be between 1 and #CF_TX_GROUP_MAX_DEST.
+ *
+ * @param src_filename  Local filename
+ * @param dst_filename  Remote filename, the same for every destination
+ * @param cfdp_class    Whether to perform a class 1 or class 2 transfer
+ * @param keep          Whether to keep or delete the local file after all transfers complete
+ * @param chan          CF channel number to use
+ * @param priority      CF priority level
+ * @param dest_ids      Entity IDs of the remote receivers
+ * @param num_dest      Number of entries in dest_ids
+ *
+ * @retval #CFE_SUCCESS \copydoc CFE_SUCCESS
+ * @returns CFE_SUCCESS if at least one destination was queued. CF_ERROR on error.
+ */
+CFE_Status_t CF_CFDP_TxFileMulti(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
+                                 uint8 keep, uint8 chan, uint8 priority, const CF_EntityId_t *dest_ids, uint8 num_dest);
+
 /************************************************************************/
 /** @brief Begin transmit of a directory.
  *
@@ -191,12 +259,36 @@ CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename,
  * @param chan          CF channel number to use
  * @param priority      CF priority level
  * @param dest_id       Entity ID of remote receiver
+ * @param max_active    Max number of files in transfer at once, 0 for the default
+ * @param max_pending   Max number of files read ahead of the transfers, 0 for the default
  *
  * @retval #CFE_SUCCESS \copydoc CFE_SUCCESS
  * @returns CFE_SUCCESS on success. CF_ERROR on error.
  */
 CFE_Status_t CF_CFDP_PlaybackDir(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
-                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id);
+                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id, uint16 max_active,
+                                 uint16 max_pending);
+
+/************************************************************************/
+/** @brief Begin transmit of the files listed in a manifest.
+ *
+ * @par Description
+ *       Opens the manifest file and sets up the channel manifest state so the
+ *       records are queued as pending files at each engine cycle.  Also resets
+ *       the manifest progress counters in housekeeping.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       filename must not be NULL, but need not be NULL terminated within
+ *       CF_FILENAME_MAX_LEN.  chan must be a valid channel number.
+ *
+ * @param filename      Manifest file to read
+ * @param keep          Whether to keep or delete the local files after completion
+ * @param chan          CF channel number to use
+ *
+ * @retval #CFE_SUCCESS \copydoc CFE_SUCCESS
+ * @returns CFE_SUCCESS on success. CF_ERROR or an OSAL error code on error.
+ */
+CFE_Status_t CF_CFDP_TxManifest(const char *filename, uint8 keep, uint8 chan);
 
 /************************************************************************/
 /** @brief Build the PDU header in the output buffer to prepare to send a packet.
@@ -266,6 +358,23 @@ CFE_Status_t CF_CFDP_SendFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
  */
 CFE_Status_t CF_CFDP_SendEof(CF_Transaction_t *txn);
 
+/************************************************************************/
+/** @brief Build a parity PDU for transmit.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.  len must not be more than CF_FEC_MAX_SEGMENT_SIZE.
+ *
+ * @param txn     Pointer to the transaction object
+ * @param offset  File offset of the group the parity is of
+ * @param data    Parity data, copied into the PDU
+ * @param len     Length of the parity data
+ *
+ * @returns CFE_Status_t status code
+ * @retval CFE_SUCCESS on success.
+ * @retval CF_SEND_PDU_NO_BUF_AVAIL_ERROR if message buffer cannot be obtained.
+ */
+CFE_Status_t CF_CFDP_SendParity(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, size_t len);
+
 /************************************************************************/
 /** @brief Build an ACK PDU for transmit.
  *
@@ -418,6 +527,24 @@ CFE_Status_t CF_CFDP_RecvFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
  */
 CFE_Status_t CF_CFDP_RecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
 
+/************************************************************************/
+/** @brief Unpack a parity PDU from a received message.
+ *
+ * This should only be invoked for buffers that have been identified
+ * as a parity PDU.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.
+ *
+ * @param txn    Pointer to the transaction state
+ * @param ph   The logical PDU buffer being received
+ *
+ * @returns integer status code
+ * @retval CFE_SUCCESS on success
+ * @retval CF_SHORT_PDU_ERROR on error
+ */
+CFE_Status_t CF_CFDP_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
+
 /************************************************************************/
 /** @brief Unpack an ACK PDU from a received message.
  *
@@ -604,14 +731,31 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
  */
 CF_CListTraverse_Status_t CF_CFDP_CloseFiles(CF_CListNode_t *node, void *context);
 
+/************************************************************************/
+/** @brief List traversal function to add a transaction to the status packet.
+ *
+ * This helper is used in conjunction with CF_CList_Traverse(). A full
+ * packet is sent and a new one started.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       node must not be NULL. context must not be NULL.
+ *
+ * @param node    List node pointer
+ * @param context Pointer to CF_CFDP_TxnTlm_args_t object
+ *
+ * @returns integer traversal code
+ * @retval Always CF_LIST_CONT indicate list traversal should not exit early.
+ */
+CF_CListTraverse_Status_t CF_CFDP_AddTxnTlm(CF_CListNode_t *node, void *context);
+
 /************************************************************************/
 /** @brief Cycle the current active tx or make a new one active.
  *
  * @par Description
  *       First traverses all tx transactions on the active queue. If at
- *       least one is found, then it stops. Otherwise it moves a
- *       transaction on the pending queue to the active queue and
- *       tries again to find an active one.
+ *       least one is found, then it stops. Otherwise it starts a transaction
+ *       for the first file on the pending queue that is allowed to start,
+ *       and tries again to find an active one.
  *
  * @par Assumptions, External Events, and Notes:
  *       None
@@ -623,7 +767,7 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan);
 /************************************************************************/
 /** @brief List traversal function that cycles the first active tx.
  *
- * This helper is used in conjunction with CF_CList_Traverse().
+ * This helper is called by CF_CFDP_CycleTx() for each node of its inline walk of TXA.
  *
  * @par Description
  *       There can only be one active tx transaction per engine cycle.
@@ -642,6 +786,100 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan);
  */
 CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void *context);
 
+/************************************************************************/
+/** @brief Find the pending file that should start next.
+ *
+ * @par Description
+ *       Only the head of the pending list of each source needs a look, the
+ *       commanded files and each playback.  A head can start if a
+ *       transaction is available for it within the share of the playback it
+ *       belongs to, or within the commanded file share if it has no
+ *       playback.  The one that comes first on the pending queue is chosen.
+ *       If a transmit group is given, only the commanded head is considered,
+ *       and only if it belongs to that group.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL.  group may be NULL.
+ *
+ * @param chan   The channel to look at
+ * @param group  Transmit group the file must belong to, or NULL for any file
+ *
+ * @returns the pending file to start
+ * @retval NULL if no pending file can start
+ */
+CF_PendingFile_t *CF_CFDP_FindStartablePending(CF_Channel_t *chan, const CF_TxGroup_t *group);
+
+/************************************************************************/
+/** @brief Start the transfer of a pending file.
+ *
+ * @par Description
+ *       Takes a free transaction and history entry, fills them in from the
+ *       pending file record and puts the transaction on the active queue.
+ *       The pending file record is freed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL, pf must be on the channel pending queue and
+ *       CF_CFDP_FindStartablePending() must have selected it.
+ *
+ * @param chan  The channel the file is pending on
+ * @param pf    The pending file to start
+ */
+void CF_CFDP_StartPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Remove a file from the pending queue without sending it.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL, pf must be on the channel pending queue.
+ *
+ * @param chan  The channel the file is pending on
+ * @param pf    The pending file to drop
+ */
+void CF_CFDP_DropPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Start relaying a file that is being received to the next hop.
+ *
+ * @par Description
+ *       If the channel of the receive transaction has a relay entity,
+ *       takes a free transaction on the relay channel that sends the
+ *       received file there under the same name, and binds the two.  The
+ *       outbound sends the file data that has been received without a gap,
+ *       and holds its EOF until the inbound transaction is done.  If there
+ *       is no free transaction, the file is only received.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       rx must not be NULL, and must have received the metadata of the file.
+ *
+ * @param rx  The receive transaction
+ */
+void CF_CFDP_StartRelay(CF_Transaction_t *rx);
+
+/************************************************************************/
+/** @brief Let the outbound transaction of a relay send newly received data.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       rx must not be NULL.  Does nothing if the transaction is not relayed.
+ *
+ * @param rx  The receive transaction, after its gap free data has grown
+ */
+void CF_CFDP_WakeRelay(CF_Transaction_t *rx);
+
+/************************************************************************/
+/** @brief Unbind the two transactions of a relay.
+ *
+ * @par Description
+ *       When the inbound transaction ends, the outbound one may send its
+ *       EOF.  If the file was not received correctly, the outbound is
+ *       canceled.  When the outbound ends first, the inbound goes on alone.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL and must be bound to a relay.
+ *
+ * @param txn  Either transaction of the relay
+ */
+void CF_CFDP_EndRelay(CF_Transaction_t *txn);
+
 /************************************************************************/
 /** @brief Call R and then S tick functions for all active transactions.
  *
@@ -662,7 +900,9 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan);
  *
  * @par Description
  *       Check if a playback directory needs iterated, and if so does, and
- *       if a valid file is found initiates playback on it.
+ *       if a valid file is found queues it on the channel pending queue, up
+ *       to the pending depth of the playback.  The playback concurrency limit
+ *       is applied when the pending files are started.
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must not be NULL, pb must not be NULL.
@@ -672,6 +912,23 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan);
  */
 void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb);
 
+/************************************************************************/
+/** @brief Queue the files listed in the records of the channel TX manifest.
+ *
+ * @par Description
+ *       Reads manifest records and queues a pending file for each one, as long
+ *       as the manifest has fewer than CF_NUM_TRANSACTIONS_PER_PLAYBACK files
+ *       on the pending queue.  Invalid records are counted and skipped.  Once
+ *       all records are read and all transfers are done, the manifest is no
+ *       longer busy.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL.
+ *
+ * @param chan  The channel associated with the manifest
+ */
+void CF_CFDP_ProcessManifest(CF_Channel_t *chan);
+
 /************************************************************************/
 /** @brief Kick the dir playback if timer elapsed.
  *
@@ -689,7 +946,7 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan);
 /************************************************************************/
 /** @brief List traversal function that calls a r or s tick function.
  *
- * This helper is used in conjunction with CF_CList_Traverse().
+ * This helper is called by CF_CFDP_TickTransactions() for each node of its inline walk.
  *
  * @par Assumptions, External Events, and Notes:
  *       node must not be NULL, context must not be NULL.
@@ -199,7 +199,9 @@ typedef enum
 /**
  * @brief Values for "directive_code" within CF_CFDP_PduFileDirectiveHeader_t
  *
- * Defined per table 5-4 of CCSDS 727.0-B-5
+ * Defined per table 5-4 of CCSDS 727.0-B-5, except for PARITY which is
+ * a CF extension (see CF_CFDP_FecMsg_t).  A receiver that does not know
+ * a directive code drops the PDU.
  */
 typedef enum
 {
@@ -211,7 +213,8 @@ typedef enum
     CF_CFDP_FileDirective_NAK         = 8,
     CF_CFDP_FileDirective_PROMPT      = 9,
     CF_CFDP_FileDirective_KEEP_ALIVE  = 12,
-    CF_CFDP_FileDirective_INVALID_MAX = 13, /**< \brief Maximum used to limit range */
+    CF_CFDP_FileDirective_PARITY      = 13, /**< \brief CF extension, parity of a group of file data segments */
+    CF_CFDP_FileDirective_INVALID_MAX = 14, /**< \brief Maximum used to limit range */
 } CF_CFDP_FileDirective_t;
 
 /**
@@ -289,16 +292,27 @@ typedef enum
     CF_CFDP_ConditionCode_CANCEL_REQUEST_RECEIVED   = 15,
 } CF_CFDP_ConditionCode_t;
 
+/*
+ * File sizes and offsets are "file size sensitive" (FSS) fields, encoded in
+ * 32 bits, or in 64 bits if the large file flag of the PDU header is set.
+ * As their size is not fixed, they are _not_ included in the definitions
+ * below, and are encoded by the codec where noted.  The segment requests of
+ * a NAK PDU and the offset of a file data PDU consist only of FSS fields, so
+ * have no fixed definition at all.  Likewise a parity PDU is the offset of
+ * its group followed by the parity data.
+ */
+
 /**
  * @brief Structure representing CFDP End of file PDU
  *
  * Defined per section 5.2.2 / table 5-6 of CCSDS 727.0-B-5
+ *
+ * @note followed by the file size FSS field
  */
 typedef struct CF_CFDP_PduEof
 {
     CF_CFDP_uint8_t  cc;
     CF_CFDP_uint32_t crc;
-    CF_CFDP_uint32_t size;
 } CF_CFDP_PduEof_t;
 
 /**
@@ -323,50 +337,45 @@ typedef struct CF_CFDP_PduAck
 } CF_CFDP_PduAck_t;
 
 /**
- * @brief Structure representing CFDP Segment Request
+ * @brief Structure representing CFDP Metadata PDU
  *
- * Defined per section 5.2.6 / table 5-11 of CCSDS 727.0-B-5
+ * Defined per section 5.2.5 / table 5-9 of CCSDS 727.0-B-5
+ *
+ * @note followed by the file size FSS field
  */
-typedef struct CF_CFDP_SegmentRequest
+typedef struct CF_CFDP_PduMd
 {
-    CF_CFDP_uint32_t offset_start;
-    CF_CFDP_uint32_t offset_end;
-} CF_CFDP_SegmentRequest_t;
+    CF_CFDP_uint8_t segmentation_control;
+} CF_CFDP_PduMd_t;
 
 /**
- * @brief Structure representing CFDP Non-Acknowledge PDU
- *
- * Defined per section 5.2.6 / table 5-10 of CCSDS 727.0-B-5
+ * @brief Value of the tag at the start of a CF forward error correction message ("CFEC")
  */
-typedef struct CF_CFDP_PduNak
-{
-    CF_CFDP_uint32_t scope_start;
-    CF_CFDP_uint32_t scope_end;
-} CF_CFDP_PduNak_t;
+#define CF_CFDP_FEC_MSG_TAG 0x43464543
 
 /**
- * @brief Structure representing CFDP Metadata PDU
- *
- * Defined per section 5.2.5 / table 5-9 of CCSDS 727.0-B-5
+ * @brief Values for "scheme" within CF_CFDP_FecMsg_t
  */
-typedef struct CF_CFDP_PduMd
+typedef enum
 {
-    CF_CFDP_uint8_t  segmentation_control;
-    CF_CFDP_uint32_t size;
-} CF_CFDP_PduMd_t;
+    CF_CFDP_FecScheme_XOR = 1, /**< \brief parity is the XOR of the segments of the group */
+} CF_CFDP_FecScheme_t;
 
 /**
- * @brief PDU file data header
+ * @brief Structure representing CF forward error correction message
+ *
+ * Not part of CCSDS 727.0-B-5.  CF puts this in a message to user TLV
+ * of the metadata PDU of a class 1 transaction, to tell the receiver that
+ * a parity PDU follows every group_size file data segments.  A receiver
+ * that does not recognize the message ignores it along with the parity.
  */
-typedef struct CF_CFDP_PduFileDataHeader
+typedef struct CF_CFDP_FecMsg
 {
-    /**
-     * NOTE: while this is the only fixed/required field in the data PDU, it may
-     * have segment metadata prior to this, depending on how the fields in the
-     * base header are set
-     */
-    CF_CFDP_uint32_t offset;
-} CF_CFDP_PduFileDataHeader_t;
+    CF_CFDP_uint32_t tag; /**< \brief CF_CFDP_FEC_MSG_TAG */
+    CF_CFDP_uint8_t  scheme;
+    CF_CFDP_uint8_t  group_size;
+    CF_CFDP_uint16_t segment_size;
+} CF_CFDP_FecMsg_t;
 
 /**
  * @brief
@@ -379,7 +388,7 @@ typedef struct CF_CFDP_PduFileDataHeader
  */
 typedef struct CF_CFDP_PduFileDataContent
 {
-    uint8 data[CF_MAX_PDU_SIZE - sizeof(CF_CFDP_PduFileDataHeader_t) - CF_CFDP_MIN_HEADER_SIZE];
+    uint8 data[CF_MAX_PDU_SIZE - sizeof(CF_CFDP_uint32_t) - CF_CFDP_MIN_HEADER_SIZE]; /* 32-bit file offset */
 } CF_CFDP_PduFileDataContent_t;
 
 #endif /* !CF_CFDP_PDU_H */
@@ -30,6 +30,7 @@
 #include "cf_perfids.h"
 #include "cf_cfdp.h"
 #include "cf_utils.h"
+#include "cf_perf.h"
 
 #include "cf_cfdp_r.h"
 #include "cf_cfdp_dispatch.h"
@@ -91,13 +92,15 @@ void CF_CFDP_R2_Reset(CF_Transaction_t *txn)
 CFE_Status_t CF_CFDP_R_CheckCrc(CF_Transaction_t *txn, uint32 expected_crc)
 {
     CFE_Status_t ret = CFE_SUCCESS;
-    CF_CRC_Finalize(&txn->crc);
-    if (txn->crc.result != expected_crc)
+    CF_CRC_Finalize(&txn->cold->crc);
+
+    /* the null checksum always passes, whatever the sender put in the EOF */
+    if (txn->cold->crc.type != CF_CRC_Type_NULL && txn->cold->crc.result != expected_crc)
     {
         CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_CRC, CFE_EVS_EventType_ERROR,
                           "CF R%d(%lu:%lu): CRC mismatch for R trans. got 0x%08lx expected 0x%08lx",
                           (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                          (unsigned long)txn->history->seq_num, (unsigned long)txn->crc.result,
+                          (unsigned long)txn->history->seq_num, (unsigned long)txn->cold->crc.result,
                           (unsigned long)expected_crc);
         ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.crc_mismatch;
         ret = 1;
@@ -205,13 +208,13 @@ CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *
 
     if (txn->state_data.receive.cached_pos != fd->offset)
     {
-        fret = CF_WrappedLseek(txn->fd, fd->offset, OS_SEEK_SET);
-        if (fret != fd->offset)
+        fret = CF_WrappedSeek(txn->cold->fd, fd->offset);
+        if (fret != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_SEEK_FD, CFE_EVS_EventType_ERROR,
-                              "CF R%d(%lu:%lu): failed to seek offset %ld, got %ld", (txn->state == CF_TxnState_R2),
+                              "CF R%d(%lu:%lu): failed to seek offset %llu, got %ld", (txn->state == CF_TxnState_R2),
                               (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                              (long)fd->offset, (long)fret);
+                              (unsigned long long)fd->offset, (long)fret);
             CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
             ret = CF_ERROR; /* connection will reset in caller */
@@ -220,7 +223,7 @@ CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *
 
     if (ret != CF_ERROR)
     {
-        fret = CF_WrappedWrite(txn->fd, fd->data_ptr, fd->data_len);
+        fret = CF_WrappedWrite(txn->cold->fd, fd->data_ptr, fd->data_len);
         if (fret != fd->data_len)
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_WRITE, CFE_EVS_EventType_ERROR,
@@ -235,6 +238,7 @@ CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *
         {
             txn->state_data.receive.cached_pos = fd->data_len + fd->offset;
             CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes += fd->data_len;
+            txn->cold->progress.file_data_bytes += fd->data_len;
         }
     }
 
@@ -261,10 +265,10 @@ CFE_Status_t CF_CFDP_R_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuff
         if (txn->flags.rx.md_recv && (eof->size != txn->fsize))
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_SIZE_MISMATCH, CFE_EVS_EventType_ERROR,
-                              "CF R%d(%lu:%lu): EOF file size mismatch: got %lu expected %lu",
+                              "CF R%d(%lu:%lu): EOF file size mismatch: got %llu expected %llu",
                               (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                              (unsigned long)txn->history->seq_num, (unsigned long)eof->size,
-                              (unsigned long)txn->fsize);
+                              (unsigned long)txn->history->seq_num, (unsigned long long)eof->size,
+                              (unsigned long long)txn->fsize);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_size_mismatch;
             ret = CF_REC_PDU_FSIZE_MISMATCH_ERROR;
         }
@@ -370,6 +374,23 @@ void CF_CFDP_R2_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *p
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Records how much of the file has been received without a gap, and
+ * lets the outbound transaction of a relay send what is new.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_R_SetRelayPos(CF_Transaction_t *txn, CF_FileSize_t pos)
+{
+    if (pos > txn->state_data.receive.relay_pos)
+    {
+        txn->state_data.receive.relay_pos = pos;
+        CF_CFDP_WakeRelay(txn);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -378,7 +399,9 @@ void CF_CFDP_R2_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *p
  *-----------------------------------------------------------------*/
 void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 {
-    int ret;
+    const CF_Logical_PduFileDataHeader_t *fd = &ph->int_header.fd;
+    CF_FileSize_t                         relay_pos;
+    int                                   ret;
 
     /* got file data PDU? */
     ret = CF_CFDP_RecvFd(txn, ph);
@@ -389,8 +412,29 @@ void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 
     if (ret == CFE_SUCCESS)
     {
-        /* class 1 digests CRC */
-        CF_CRC_Digest(&txn->crc, ph->int_header.fd.data_ptr, ph->int_header.fd.data_len);
+        if (txn->state_data.receive.fec.params.group_size != 0)
+        {
+            /* with parity, lost data may be rebuilt later, so the CRC is digested in file order */
+            CF_FecDecoder_Add(&txn->state_data.receive.fec, fd->offset, fd->data_len, txn->fsize);
+
+            relay_pos = txn->state_data.receive.relay_pos;
+            if (fd->offset <= relay_pos && relay_pos < (fd->offset + fd->data_len))
+            {
+                CF_CRC_Digest(&txn->cold->crc, (const uint8 *)fd->data_ptr + (relay_pos - fd->offset),
+                              (fd->offset + fd->data_len) - relay_pos);
+            }
+        }
+        else
+        {
+            /* class 1 digests CRC */
+            CF_CRC_Digest(&txn->cold->crc, ph->int_header.fd.data_ptr, ph->int_header.fd.data_len);
+        }
+
+        /* class 1 keeps no chunk list, data past a gap only counts once the gap is filled in order */
+        if (fd->offset <= txn->state_data.receive.relay_pos)
+        {
+            CF_CFDP_R_SetRelayPos(txn, fd->offset + fd->data_len);
+        }
     }
     else
     {
@@ -399,6 +443,169 @@ void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Reads back part of the received file, for rebuilding a segment from
+ * parity.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_R1_FecRead(CF_Transaction_t *txn, CF_FileSize_t offset, uint8 *buf, size_t len)
+{
+    int          fret;
+    CFE_Status_t ret = CFE_SUCCESS;
+
+    if (txn->state_data.receive.cached_pos != offset)
+    {
+        fret = CF_WrappedSeek(txn->cold->fd, offset);
+        if (fret != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_SEEK_CRC, CFE_EVS_EventType_ERROR,
+                              "CF R%d(%lu:%lu): failed to seek offset %llu, got %ld", (txn->state == CF_TxnState_R2),
+                              (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
+                              (unsigned long long)offset, (long)fret);
+            CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
+            ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
+            ret = CF_ERROR;
+        }
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        fret = CF_WrappedRead(txn->cold->fd, buf, len);
+        if (fret != len)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_READ, CFE_EVS_EventType_ERROR,
+                              "CF R%d(%lu:%lu): failed to read file expected %lu, got %ld",
+                              (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
+                              (unsigned long)txn->history->seq_num, (unsigned long)len, (long)fret);
+            CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
+            ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read;
+            ret = CF_ERROR;
+        }
+        else
+        {
+            txn->state_data.receive.cached_pos = offset + len;
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Rebuilds the one lost segment of a group, as the XOR of the parity and
+ * the other segments, and writes it as if it had been received.  The data
+ * received after it in the group is then digested from the file.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_R1_FecRebuild(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph, uint8 lost,
+                                          size_t lost_len)
+{
+    CF_FecDecoder_t *               dec          = &txn->state_data.receive.fec;
+    CF_FileSize_t                   group_offset = ph->int_header.parity.offset;
+    CF_FileSize_t                   group_end    = CF_Fec_GroupEnd(&dec->params, group_offset, txn->fsize);
+    CF_Logical_PduFileDataHeader_t *fd;
+    uint8                           seg_buf[CF_FEC_MAX_SEGMENT_SIZE];
+    uint8                           buf[CF_FEC_MAX_SEGMENT_SIZE];
+    CF_FileSize_t                   pos;
+    size_t                          len;
+    uint8                           i;
+    CFE_Status_t                    ret = CFE_SUCCESS;
+
+    memcpy(buf, ph->int_header.parity.data_ptr, lost_len);
+
+    for (i = 0; ret == CFE_SUCCESS && i < dec->params.group_size; ++i)
+    {
+        /* only as much of the other segments as the lost one is long matters */
+        len = CF_Fec_SegmentLength(&dec->params, group_offset, i, txn->fsize);
+        if (len > lost_len)
+        {
+            len = lost_len;
+        }
+
+        if (i != lost && len != 0)
+        {
+            ret = CF_CFDP_R1_FecRead(txn, group_offset + ((CF_FileSize_t)i * dec->params.segment_size), seg_buf, len);
+            if (ret == CFE_SUCCESS)
+            {
+                CF_Fec_Xor(buf, seg_buf, len);
+            }
+        }
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        /* the parity is no longer needed, so the PDU is reused for the rebuilt file data */
+        fd = &ph->int_header.fd;
+        memset(fd, 0, sizeof(*fd));
+        fd->offset   = group_offset + ((CF_FileSize_t)lost * dec->params.segment_size);
+        fd->data_ptr = buf;
+        fd->data_len = lost_len;
+
+        ret = CF_CFDP_R_ProcessFd(txn, ph);
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        CF_FecDecoder_Add(dec, fd->offset, fd->data_len, txn->fsize);
+        CFE_EVS_SendEvent(CF_EID_DBG_CFDP_R_FEC_REBUILT, CFE_EVS_EventType_DEBUG,
+                          "CF R1(%lu:%lu): rebuilt %lu bytes at offset %llu from parity",
+                          (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
+                          (unsigned long)fd->data_len, (unsigned long long)fd->offset);
+
+        /* the whole group is now in the file, digest it from where the file was received without a gap */
+        pos = txn->state_data.receive.relay_pos;
+        while (ret == CFE_SUCCESS && pos >= group_offset && pos < group_end)
+        {
+            len = sizeof(seg_buf);
+            if ((group_end - pos) < len)
+            {
+                len = group_end - pos;
+            }
+
+            ret = CF_CFDP_R1_FecRead(txn, pos, seg_buf, len);
+            if (ret == CFE_SUCCESS)
+            {
+                CF_CRC_Digest(&txn->cold->crc, seg_buf, len);
+                pos += len;
+            }
+        }
+
+        CF_CFDP_R_SetRelayPos(txn, pos);
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_R1_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+{
+    const CF_FecDecoder_t *dec = &txn->state_data.receive.fec;
+    size_t                 lost_len;
+    uint8                  lost;
+
+    if (CF_CFDP_RecvParity(txn, ph) == CFE_SUCCESS &&
+        CF_FecDecoder_GetLost(dec, ph->int_header.parity.offset, txn->fsize, &lost))
+    {
+        /* parity shorter than the lost segment is not of this group as the receiver knows it */
+        lost_len = CF_Fec_SegmentLength(&dec->params, ph->int_header.parity.offset, lost, txn->fsize);
+        if (ph->int_header.parity.data_len >= lost_len && CF_CFDP_R1_FecRebuild(txn, ph, lost, lost_len) != CFE_SUCCESS)
+        {
+            /* Reset transaction on failure */
+            CF_CFDP_R1_Reset(txn);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -408,6 +615,7 @@ void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 {
     const CF_Logical_PduFileDataHeader_t *fd;
+    const CF_Chunk_t *                    chunk;
     int                                   ret;
 
     /* this function is only entered for data PDUs */
@@ -422,9 +630,21 @@ void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 
     if (ret == CFE_SUCCESS)
     {
+        /* data below the highest offset seen so far is filling a gap */
+        if (fd->offset < CF_ChunkList_GetEnd(&txn->chunks->chunks))
+        {
+            txn->cold->progress.retransmit_bytes += fd->data_len;
+        }
+
         /* class 2 does CRC at FIN, but track gaps */
         CF_ChunkListAdd(&txn->chunks->chunks, fd->offset, fd->data_len);
 
+        chunk = CF_ChunkList_GetFirstChunk(&txn->chunks->chunks);
+        if (chunk && chunk->offset == 0)
+        {
+            CF_CFDP_R_SetRelayPos(txn, chunk->size);
+        }
+
         if (txn->flags.rx.fd_nak_sent)
         {
             CF_CFDP_R2_Complete(txn, 0); /* once nak-retransmit received, start checking for completion at each fd */
@@ -484,13 +704,17 @@ void CF_CFDP_R2_GapCompute(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn)
 {
-    CF_Logical_PduBuffer_t *ph =
-        CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_NAK, txn->history->peer_eid,
-                                   CF_AppData.config_table->local_eid, 1, txn->history->seq_num, 1);
-    CF_Logical_PduNak_t *nak;
-    CFE_Status_t         sret;
-    uint32               cret;
-    CFE_Status_t         ret = CF_ERROR;
+    CF_Logical_PduBuffer_t *ph;
+    CF_Logical_PduNak_t *   nak;
+    CFE_Status_t            sret;
+    uint32                  cret;
+    CF_PerfMark_t           mark;
+    CFE_Status_t            ret = CF_ERROR;
+
+    CF_Perf_Begin(&mark, CF_PerfPhase_NAK);
+
+    ph = CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_NAK, txn->history->peer_eid,
+                                    CF_AppData.config_table->local_eid, 1, txn->history->seq_num, 1);
 
     if (ph)
     {
@@ -554,6 +778,8 @@ CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn)
         }
     }
 
+    CF_Perf_End(&mark);
+
     return ret;
 }
 
@@ -586,8 +812,8 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
         CF_CFDP_ArmAckTimer(txn);
     }
 
-    ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.dst_filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
-                               OS_READ_WRITE);
+    ret = CF_WrappedOpenCreate(&txn->cold->fd, txn->history->fnames.dst_filename,
+                               OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
     if (ret < 0)
     {
         CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_CREAT, CFE_EVS_EventType_ERROR,
@@ -595,7 +821,7 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
                           (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
                           (unsigned long)txn->history->seq_num, txn->history->fnames.dst_filename, (long)ret);
         ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
-        txn->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
+        txn->cold->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
         if (txn->state == CF_TxnState_R2)
         {
             CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
@@ -608,6 +834,24 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
     else
     {
         txn->state_data.receive.sub_state = CF_RxSubState_FILEDATA;
+
+        /* a received MD may ask for a checksum that cannot be verified */
+        if (txn->history->txn_stat == CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE)
+        {
+            if (txn->state == CF_TxnState_R2)
+            {
+                CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+            }
+            else
+            {
+                CF_CFDP_R1_Reset(txn);
+            }
+        }
+        else if (txn->flags.rx.md_recv)
+        {
+            /* the file name is known, so the file can be relayed as it arrives */
+            CF_CFDP_StartRelay(txn);
+        }
     }
 }
 
@@ -619,22 +863,30 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
 {
-    uint8        buf[CF_R2_CRC_CHUNK_SIZE];
-    size_t       count_bytes;
-    size_t       want_offs_size;
-    size_t       read_size;
-    int          fret;
-    CFE_Status_t ret;
-    bool         success = true;
+    uint8         buf[CF_R2_CRC_CHUNK_SIZE];
+    size_t        count_bytes;
+    size_t        want_offs_size;
+    size_t        read_size;
+    int           fret;
+    CFE_Status_t  ret;
+    CF_PerfMark_t mark;
+    bool          success = true;
+
+    CF_Perf_Begin(&mark, CF_PerfPhase_CRC);
 
     memset(buf, 0, sizeof(buf));
 
     count_bytes = 0;
     ret         = CF_ERROR;
 
-    if (txn->state_data.receive.r2.rx_crc_calc_bytes == 0)
+    if (txn->cold->crc.type == CF_CRC_Type_NULL)
+    {
+        /* the null checksum always passes, so there is no need to read the file back */
+        txn->state_data.receive.r2.rx_crc_calc_bytes = txn->fsize;
+    }
+    else if (txn->state_data.receive.r2.rx_crc_calc_bytes == 0)
     {
-        CF_CRC_Start(&txn->crc);
+        CF_CRC_StartType(&txn->cold->crc, txn->cold->crc.type);
     }
 
     while ((count_bytes < CF_AppData.config_table->rx_crc_calc_bytes_per_wakeup) &&
@@ -653,13 +905,14 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
 
         if (txn->state_data.receive.cached_pos != txn->state_data.receive.r2.rx_crc_calc_bytes)
         {
-            fret = CF_WrappedLseek(txn->fd, txn->state_data.receive.r2.rx_crc_calc_bytes, OS_SEEK_SET);
-            if (fret != txn->state_data.receive.r2.rx_crc_calc_bytes)
+            fret = CF_WrappedSeek(txn->cold->fd, txn->state_data.receive.r2.rx_crc_calc_bytes);
+            if (fret != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_SEEK_CRC, CFE_EVS_EventType_ERROR,
-                                  "CF R%d(%lu:%lu): failed to seek offset %lu, got %ld", (txn->state == CF_TxnState_R2),
-                                  (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                                  (unsigned long)txn->state_data.receive.r2.rx_crc_calc_bytes, (long)fret);
+                                  "CF R%d(%lu:%lu): failed to seek offset %llu, got %ld",
+                                  (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
+                                  (unsigned long)txn->history->seq_num,
+                                  (unsigned long long)txn->state_data.receive.r2.rx_crc_calc_bytes, (long)fret);
                 CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
                 success = false;
@@ -667,7 +920,7 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
             }
         }
 
-        fret = CF_WrappedRead(txn->fd, buf, read_size);
+        fret = CF_WrappedRead(txn->cold->fd, buf, read_size);
         if (fret != read_size)
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_READ, CFE_EVS_EventType_ERROR,
@@ -680,7 +933,7 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
             break;
         }
 
-        CF_CRC_Digest(&txn->crc, buf, read_size);
+        CF_CRC_Digest(&txn->cold->crc, buf, read_size);
         txn->state_data.receive.r2.rx_crc_calc_bytes += read_size;
         txn->state_data.receive.cached_pos = txn->state_data.receive.r2.rx_crc_calc_bytes;
         count_bytes += read_size;
@@ -697,6 +950,12 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
             /* set FIN PDU status */
             txn->state_data.receive.r2.dc = CF_CFDP_FinDeliveryCode_COMPLETE;
             txn->state_data.receive.r2.fs = CF_CFDP_FinFileStatus_RETAINED;
+
+            /* the file is good, a relay need not wait for the FIN exchange to send its EOF */
+            if (txn->cold->relay)
+            {
+                CF_CFDP_EndRelay(txn);
+            }
         }
         else
         {
@@ -708,6 +967,8 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
         ret = CFE_SUCCESS;
     }
 
+    CF_Perf_End(&mark);
+
     return ret;
 }
 
@@ -798,16 +1059,21 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
         if (!status)
         {
             /* successfully obtained md PDU */
-            if (txn->flags.rx.eof_recv)
+            if (txn->history->txn_stat == CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE)
+            {
+                CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+                success = false;
+            }
+            else if (txn->flags.rx.eof_recv)
             {
                 /* EOF was received, so check that md and EOF sizes match */
                 if (txn->state_data.receive.r2.eof_size != txn->fsize)
                 {
                     CFE_EVS_SendEvent(CF_EID_ERR_CFDP_R_EOF_MD_SIZE, CFE_EVS_EventType_ERROR,
-                                      "CF R%d(%lu:%lu): EOF/md size mismatch md: %lu, EOF: %lu",
+                                      "CF R%d(%lu:%lu): EOF/md size mismatch md: %llu, EOF: %llu",
                                       (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                                      (unsigned long)txn->history->seq_num, (unsigned long)txn->fsize,
-                                      (unsigned long)txn->state_data.receive.r2.eof_size);
+                                      (unsigned long)txn->history->seq_num, (unsigned long long)txn->fsize,
+                                      (unsigned long long)txn->state_data.receive.r2.eof_size);
                     ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_size_mismatch;
                     CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
                     success = false;
@@ -817,7 +1083,7 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
             if (success)
             {
                 /* close and rename file */
-                CF_WrappedClose(txn->fd);
+                CF_WrappedClose(txn->cold->fd);
                 CFE_ES_PerfLogEntry(CF_PERF_ID_RENAME);
 
                 /* Note OS_mv attempts a rename, then copy/delete if that fails so it works across file systems */
@@ -830,14 +1096,14 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                                       "CF R%d(%lu:%lu): failed to rename file in R2, error=%ld",
                                       (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
                                       (unsigned long)txn->history->seq_num, (long)status);
-                    txn->fd = OS_OBJECT_ID_UNDEFINED;
+                    txn->cold->fd = OS_OBJECT_ID_UNDEFINED;
                     CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
                     ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_rename;
                     success = false;
                 }
                 else
                 {
-                    ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.dst_filename, OS_FILE_FLAG_NONE,
+                    ret = CF_WrappedOpenCreate(&txn->cold->fd, txn->history->fnames.dst_filename, OS_FILE_FLAG_NONE,
                                                OS_READ_WRITE);
                     if (ret < 0)
                     {
@@ -847,8 +1113,8 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                                           (unsigned long)txn->history->seq_num, (long)ret);
                         CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
                         ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
-                        txn->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
-                        success = false;
+                        txn->cold->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
+                        success       = false;
                     }
                 }
 
@@ -858,6 +1124,8 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                     txn->flags.rx.md_recv                   = 1;
                     txn->state_data.receive.r2.acknak_count = 0; /* in case part of NAK */
                     CF_CFDP_R2_Complete(txn, 1);                 /* check for completion now that md is received */
+
+                    CF_CFDP_StartRelay(txn);
                 }
             }
         }
@@ -881,7 +1149,8 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 void CF_CFDP_R1_Recv(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 {
     static const CF_CFDP_FileDirectiveDispatchTable_t r1_fdir_handlers = {
-        .fdirective = {[CF_CFDP_FileDirective_EOF] = CF_CFDP_R1_SubstateRecvEof}};
+        .fdirective = {[CF_CFDP_FileDirective_EOF]    = CF_CFDP_R1_SubstateRecvEof,
+                       [CF_CFDP_FileDirective_PARITY] = CF_CFDP_R1_RecvParity}};
     static const CF_CFDP_R_SubstateDispatchTable_t substate_fns = {
         .state = {[CF_RxSubState_FILEDATA]         = &r1_fdir_handlers,
                   [CF_RxSubState_EOF]              = &r1_fdir_handlers,
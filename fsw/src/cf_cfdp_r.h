@@ -257,6 +257,22 @@ void CF_CFDP_R2_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *p
  */
 void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
 
+/************************************************************************/
+/** @brief Process received parity for R1.
+ *
+ * @par Description
+ *       If exactly one segment of the group of the parity is missing, it
+ *       is rebuilt from the parity and the other segments, and written to
+ *       the file.  Otherwise the parity is of no use and is dropped.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. ph must not be NULL.
+ *
+ * @param txn  Pointer to the transaction object
+ * @param ph Pointer to the PDU information
+ */
+void CF_CFDP_R1_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
+
 /************************************************************************/
 /** @brief Process received file data for R2.
  *
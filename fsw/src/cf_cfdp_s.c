@@ -51,6 +51,91 @@ static inline void CF_CFDP_S_Reset(CF_Transaction_t *txn)
     CF_CFDP_ResetTransaction(txn, 1);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if a relayed file has no more received data to send.  If so,
+ * the transaction waits on TXW until the inbound one wakes it up.  A
+ * canceled transaction never waits.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_S_RelayWait(CF_Transaction_t *txn)
+{
+    bool wait =
+        (txn->cold->relay && !txn->flags.com.canceled && txn->foffs >= txn->cold->relay->state_data.receive.relay_pos);
+
+    if (wait)
+    {
+        CF_DequeueTransaction(txn);
+        CF_InsertSortPrio(txn, CF_QueueIdx_TXW);
+    }
+
+    return wait;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Takes a parity encoder for a class 1 send on a channel that adds parity
+ * PDUs.  If none is free, the file is sent without parity.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_S_FecStart(CF_Transaction_t *txn)
+{
+    CF_Logical_FecParams_t params;
+    int                    i;
+
+    params.group_size = CF_AppData.config_table->chan[txn->chan_num].fec_group_size;
+    if (txn->state == CF_TxnState_S1 && params.group_size != 0 && !txn->state_data.send.fec)
+    {
+        params.segment_size = CF_AppData.config_table->outgoing_file_chunk_size;
+        if (params.segment_size > CF_FEC_MAX_SEGMENT_SIZE)
+        {
+            params.segment_size = CF_FEC_MAX_SEGMENT_SIZE;
+        }
+
+        for (i = 0; i < CF_NUM_FEC_ENCODERS; ++i)
+        {
+            if (!CF_AppData.engine.fec_encoders[i].in_use)
+            {
+                txn->state_data.send.fec         = &CF_AppData.engine.fec_encoders[i];
+                txn->state_data.send.fec->in_use = true;
+                CF_FecEncoder_Init(txn->state_data.send.fec, &params);
+                break;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Sends the parity of a group once all of its file data is sent.  The
+ * file is done once the parity of the last group is sent.  Returns true
+ * if there was parity to send, so no file data is sent on this call.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_S_FecSendParity(CF_Transaction_t *txn)
+{
+    CF_FecEncoder_t *fec     = txn->state_data.send.fec;
+    bool             pending = (fec && fec->ready);
+
+    /* if there is no buffer, try again next cycle */
+    if (pending && CF_CFDP_SendParity(txn, fec->group_offset, fec->parity, fec->parity_len) == CFE_SUCCESS)
+    {
+        CF_FecEncoder_NextGroup(fec);
+        if (txn->foffs == txn->fsize)
+        {
+            txn->state_data.send.sub_state = CF_TxSubState_EOF;
+        }
+    }
+
+    return pending;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -61,7 +146,12 @@ CFE_Status_t CF_CFDP_S_SendEof(CF_Transaction_t *txn)
 {
     if (!txn->flags.com.crc_calc)
     {
-        CF_CRC_Finalize(&txn->crc);
+        if (txn->cold->group)
+        {
+            /* the members share the checksum of the file, each finalizes its own copy */
+            txn->cold->crc = txn->cold->group->crc;
+        }
+        CF_CRC_Finalize(&txn->cold->crc);
         txn->flags.com.crc_calc = 1;
     }
     return CF_CFDP_SendEof(txn);
@@ -77,8 +167,9 @@ void CF_CFDP_S1_SubstateSendEof(CF_Transaction_t *txn)
 {
     /* this looks weird, but the idea is we want to reset the transaction if some error occurs while sending
      * and we want to reset the transaction if no error occurs. But, if we couldn't send because there are
-     * no buffers, then we need to try and send again next time. */
-    if (CF_CFDP_S_SendEof(txn) != CF_SEND_PDU_NO_BUF_AVAIL_ERROR)
+     * no buffers, then we need to try and send again next time. The EOF of a relayed file waits until the
+     * file is received. */
+    if (!CF_CFDP_S_RelayWait(txn) && CF_CFDP_S_SendEof(txn) != CF_SEND_PDU_NO_BUF_AVAIL_ERROR)
     {
         CF_CFDP_S_Reset(txn); /* all done, so clean up */
     }
@@ -92,14 +183,51 @@ void CF_CFDP_S1_SubstateSendEof(CF_Transaction_t *txn)
  *-----------------------------------------------------------------*/
 void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn)
 {
-    txn->state_data.send.sub_state = CF_TxSubState_WAIT_FOR_EOF_ACK;
-    txn->flags.com.ack_timer_armed = 1; /* will cause tick to see ack_timer as expired, and act */
+    /* the EOF of a relayed file waits until the file is received */
+    if (!CF_CFDP_S_RelayWait(txn))
+    {
+        txn->state_data.send.sub_state = CF_TxSubState_WAIT_FOR_EOF_ACK;
+        txn->flags.com.ack_timer_armed = 1; /* will cause tick to see ack_timer as expired, and act */
 
-    /* no longer need to send file data PDU except in the case of NAK response */
+        /* no longer need to send file data PDU except in the case of NAK response */
+
+        /* move this transaction off Q_PEND */
+        CF_DequeueTransaction(txn);
+        CF_InsertSortPrio(txn, CF_QueueIdx_TXW);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if the file data a group read last covers the given range.
+ *
+ *-----------------------------------------------------------------*/
+static inline bool CF_CFDP_S_GroupHasData(const CF_TxGroup_t *group, CF_FileSize_t foffs, size_t len)
+{
+    return group && (foffs >= group->buf_offset) && ((foffs - group->buf_offset) + len <= group->buf_len);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds file data to the checksum of a group.  The members send the file
+ * in order on their first pass, so the first to send each part of the file
+ * digests it, and parts digested before are skipped.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_S_GroupDigest(CF_TxGroup_t *group, CF_FileSize_t foffs, const uint8 *data, size_t len)
+{
+    size_t skip;
 
-    /* move this transaction off Q_PEND */
-    CF_DequeueTransaction(txn);
-    CF_InsertSortPrio(txn, CF_QueueIdx_TXW);
+    if ((foffs <= group->crc_offset) && (group->crc_offset < (foffs + len)))
+    {
+        skip = group->crc_offset - foffs;
+        CF_CRC_Digest(&group->crc, data + skip, len - skip);
+        group->crc_offset = foffs + len;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -108,7 +236,8 @@ void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn)
  * See description in cf_cfdp_s.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc)
+CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+                                    uint8 calc_crc)
 {
     bool                            success = true;
     int                             status  = 0;
@@ -118,6 +247,9 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
     CF_Logical_PduFileDataHeader_t *fd;
     size_t                          actual_bytes;
     void *                          data_ptr;
+    osal_id_t                       file_fd    = txn->cold->fd;
+    CF_FileSize_t *                 cached_pos = &txn->state_data.send.cached_pos;
+    bool                            need_read  = true;
 
     if (!ph)
     {
@@ -162,23 +294,36 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
         fd->data_len = actual_bytes;
         fd->data_ptr = data_ptr;
 
-        if (txn->state_data.send.cached_pos != foffs)
+        if (txn->cold->group)
         {
-            status = CF_WrappedLseek(txn->fd, foffs, OS_SEEK_SET);
-            if (status != foffs)
+            /* the members of a group read the one file it holds open */
+            file_fd    = txn->cold->group->fd;
+            cached_pos = &txn->cold->group->cached_pos;
+        }
+
+        if (CF_CFDP_S_GroupHasData(txn->cold->group, foffs, actual_bytes))
+        {
+            /* another member has just sent this part of the file, so it is not read again */
+            memcpy(data_ptr, &txn->cold->group->buf[foffs - txn->cold->group->buf_offset], actual_bytes);
+            need_read = false;
+        }
+        else if (*cached_pos != foffs)
+        {
+            status = CF_WrappedSeek(file_fd, foffs);
+            if (status != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_SEEK_FD, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): error seeking to offset %ld, got %ld",
+                                  "CF S%d(%lu:%lu): error seeking to offset %llu, got %ld",
                                   (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
-                                  (unsigned long)txn->history->seq_num, (long)foffs, (long)status);
+                                  (unsigned long)txn->history->seq_num, (unsigned long long)foffs, (long)status);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
                 success = false;
             }
         }
 
-        if (success)
+        if (success && need_read)
         {
-            status = CF_WrappedRead(txn->fd, data_ptr, actual_bytes);
+            status = CF_WrappedRead(file_fd, data_ptr, actual_bytes);
             if (status != actual_bytes)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_READ, CFE_EVS_EventType_ERROR,
@@ -190,16 +335,41 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
             }
         }
 
+        if (success && need_read)
+        {
+            *cached_pos = foffs + actual_bytes;
+            if (txn->cold->group && actual_bytes <= sizeof(txn->cold->group->buf))
+            {
+                /* keep the data for the other members */
+                memcpy(txn->cold->group->buf, data_ptr, actual_bytes);
+                txn->cold->group->buf_offset = foffs;
+                txn->cold->group->buf_len    = actual_bytes;
+            }
+        }
+
         if (success)
         {
-            txn->state_data.send.cached_pos += status;
             CF_CFDP_SendFd(txn, ph); /* CF_CFDP_SendFd only returns CFE_SUCCESS */
 
             CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes += actual_bytes;
+            txn->cold->progress.file_data_bytes += actual_bytes;
+            if (!calc_crc)
+            {
+                /* only the first pass over the file digests it, the rest are NAK responses */
+                txn->cold->progress.retransmit_bytes += actual_bytes;
+            }
             CF_Assert((foffs + actual_bytes) <= txn->fsize); /* sanity check */
-            if (calc_crc)
+            if (calc_crc && txn->cold->group)
             {
-                CF_CRC_Digest(&txn->crc, fd->data_ptr, fd->data_len);
+                CF_CFDP_S_GroupDigest(txn->cold->group, foffs, fd->data_ptr, fd->data_len);
+            }
+            else if (calc_crc)
+            {
+                CF_CRC_Digest(&txn->cold->crc, fd->data_ptr, fd->data_len);
+            }
+            if (calc_crc && txn->state_data.send.fec)
+            {
+                CF_FecEncoder_Add(txn->state_data.send.fec, foffs, fd->data_ptr, fd->data_len, txn->fsize);
             }
 
             ret = actual_bytes;
@@ -209,6 +379,77 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if a group member is still to send the file data at foffs on its
+ * first pass, or its metadata before that.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_S_GroupMemberBehind(const CF_TxGroup_t *group, const CF_Transaction_t *txn, CF_FileSize_t foffs)
+{
+    return (txn->cold->group == group) && (txn->flags.com.q_index == CF_QueueIdx_TXA) && !txn->flags.com.suspended &&
+           ((txn->state_data.send.sub_state == CF_TxSubState_METADATA) ||
+            ((txn->state_data.send.sub_state == CF_TxSubState_FILEDATA) && (txn->foffs <= foffs)));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * A channel runs its first active transaction until it is out of PDUs, so
+ * left alone the members of a group would each read the whole file in turn.
+ * Instead, once a member has sent file data on its first pass, the others
+ * that have not got that far are run right away, while the data is still
+ * in the group buffer.  A member that makes no progress, e.g. as it is
+ * answering a NAK, is left to catch up on the next file data PDU.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_S_GroupFanOut(CF_Transaction_t *txn, CF_FileSize_t foffs)
+{
+    CF_TxGroup_t *    group = txn->cold->group;
+    CF_Channel_t *    chan  = &CF_AppData.engine.channels[txn->chan_num];
+    CF_Transaction_t *members[CF_TX_GROUP_MAX_DEST];
+    CF_Transaction_t *member;
+    CF_FileSize_t     prev_foffs;
+    uint8             prev_sub_state;
+    uint8             num_members;
+    uint8             i;
+
+    /* a member leaves the group if it is reset, so work from a copy of the list */
+    num_members = group->num_members;
+    memcpy(members, group->members, num_members * sizeof(members[0]));
+
+    group->fanning_out = true;
+
+    for (i = 0; i < num_members; ++i)
+    {
+        member = members[i];
+        while (member != txn && !chan->cur && CF_CFDP_S_GroupMemberBehind(group, member, foffs))
+        {
+            prev_foffs     = member->foffs;
+            prev_sub_state = member->state_data.send.sub_state;
+
+            if (member->state == CF_TxnState_S2)
+            {
+                CF_CFDP_S2_Tx(member);
+            }
+            else
+            {
+                CF_CFDP_S1_Tx(member);
+            }
+
+            if (member->foffs == prev_foffs && member->state_data.send.sub_state == prev_sub_state)
+            {
+                break;
+            }
+        }
+    }
+
+    group->fanning_out = false;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -217,26 +458,56 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
  *-----------------------------------------------------------------*/
 void CF_CFDP_S_SubstateSendFileData(CF_Transaction_t *txn)
 {
-    int32 bytes_processed = CF_CFDP_S_SendFileData(txn, txn->foffs, (txn->fsize - txn->foffs), 1);
+    CF_FecEncoder_t *fec   = txn->state_data.send.fec;
+    CF_FileSize_t    foffs = txn->foffs;
+    CF_FileSize_t    end   = txn->fsize;
+    CF_FileSize_t    seg_end;
+    int32            bytes_processed;
 
-    if (bytes_processed > 0)
+    if (!CF_CFDP_S_FecSendParity(txn) && !CF_CFDP_S_RelayWait(txn))
     {
-        txn->foffs += bytes_processed;
-        if (txn->foffs == txn->fsize)
+        if (txn->cold->relay)
+        {
+            /* a relayed file is sent only as far as it has been received */
+            end = txn->cold->relay->state_data.receive.relay_pos;
+        }
+
+        if (fec)
+        {
+            /* a file data PDU does not cross into the next parity segment */
+            seg_end = CF_Fec_SegmentEnd(&fec->params, txn->foffs);
+            if (seg_end < end)
+            {
+                end = seg_end;
+            }
+        }
+
+        bytes_processed = CF_CFDP_S_SendFileData(txn, txn->foffs, (end - txn->foffs), 1);
+
+        if (bytes_processed > 0)
+        {
+            txn->foffs += bytes_processed;
+            if (txn->foffs == txn->fsize && !(fec && fec->ready))
+            {
+                /* file is done, after the parity of its last group if any */
+                txn->state_data.send.sub_state = CF_TxSubState_EOF;
+            }
+
+            if (txn->cold->group && !txn->cold->group->fanning_out)
+            {
+                CF_CFDP_S_GroupFanOut(txn, foffs);
+            }
+        }
+        else if (bytes_processed < 0)
         {
-            /* file is done */
+            /* IO error -- change state and send EOF */
+            CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
             txn->state_data.send.sub_state = CF_TxSubState_EOF;
         }
-    }
-    else if (bytes_processed < 0)
-    {
-        /* IO error -- change state and send EOF */
-        CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
-        txn->state_data.send.sub_state = CF_TxSubState_EOF;
-    }
-    else
-    {
-        /* don't care about other cases */
+        else
+        {
+            /* don't care about other cases */
+        }
     }
 }
 
@@ -320,6 +591,32 @@ void CF_CFDP_S2_SubstateSendFileData(CF_Transaction_t *txn)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_FileSize_t CF_CFDP_S_FileSize(osal_id_t fd, const os_fstat_t *fstat)
+{
+    CF_FileSize_t fsize = OS_FILESTAT_SIZE(*fstat);
+    uint8         probe;
+
+    if (sizeof(OS_FILESTAT_SIZE(*fstat)) < sizeof(CF_FileSize_t))
+    {
+        /*
+         * Where size_t is 32 bits the size from OS_stat() wraps at 4 GiB.  The
+         * file is as many 4 GiB longer as there is a byte at the last offset
+         * of each further 4 GiB.
+         */
+        while (CF_WrappedSeek(fd, fsize + 0xFFFFFFFF) == CFE_SUCCESS && CF_WrappedRead(fd, &probe, 1) == 1)
+        {
+            fsize += 0x100000000;
+        }
+    }
+
+    return fsize;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -328,14 +625,25 @@ void CF_CFDP_S2_SubstateSendFileData(CF_Transaction_t *txn)
  *-----------------------------------------------------------------*/
 void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 {
-    CFE_Status_t sret;
-    int32        ret;
-    int          status  = 0;
-    bool         success = true;
+    CFE_Status_t   sret;
+    int32          ret;
+    int            status  = 0;
+    bool           success = true;
+    os_fstat_t     fstat;
+    osal_id_t *    fd    = &txn->cold->fd;
+    CF_FileSize_t *fsize = &txn->fsize;
+
+    if (txn->cold->group)
+    {
+        /* the members of a group share the file, the first one here opens it for all */
+        fd    = &txn->cold->group->fd;
+        fsize = &txn->cold->group->fsize;
+    }
 
-    if (!OS_ObjectIdDefined(txn->fd))
+    if (!OS_ObjectIdDefined(*fd))
     {
-        if (OS_FileOpenCheck(txn->history->fnames.src_filename) == OS_SUCCESS)
+        /* a relayed file is still open for writing by the transaction receiving it */
+        if (!txn->cold->relay && OS_FileOpenCheck(txn->history->fnames.src_filename) == OS_SUCCESS)
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_ALREADY_OPEN, CFE_EVS_EventType_ERROR,
                               "CF S%d(%lu:%lu): file %s already open", (txn->state == CF_TxnState_S2),
@@ -347,7 +655,7 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 
         if (success)
         {
-            ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.src_filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+            ret = CF_WrappedOpenCreate(fd, txn->history->fnames.src_filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
             if (ret < 0)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_OPEN, CFE_EVS_EventType_ERROR,
@@ -355,18 +663,19 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
                                   (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
                                   txn->history->fnames.src_filename, (long)ret);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
-                txn->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
+                *fd     = OS_OBJECT_ID_UNDEFINED; /* just in case */
                 success = false;
             }
         }
 
         if (success)
         {
-            status = CF_WrappedLseek(txn->fd, 0, OS_SEEK_END);
-            if (status < 0)
+            /* the size comes from the file system, as OS_lseek() cannot report a position of 2 GiB or more */
+            status = OS_stat(txn->history->fnames.src_filename, &fstat);
+            if (status != OS_SUCCESS)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_SEEK_END, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): failed to seek end file %s, error=%ld",
+                                  "CF S%d(%lu:%lu): failed to get size of file %s, error=%ld",
                                   (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
                                   (unsigned long)txn->history->seq_num, txn->history->fnames.src_filename,
                                   (long)status);
@@ -377,9 +686,10 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 
         if (success)
         {
-            txn->fsize = status;
+            /* a relayed file has not grown to its full size yet, the sender told its size in the MD */
+            *fsize = txn->cold->relay ? txn->cold->relay->fsize : CF_CFDP_S_FileSize(*fd, &fstat);
 
-            status = CF_WrappedLseek(txn->fd, 0, OS_SEEK_SET);
+            status = CF_WrappedLseek(*fd, 0, OS_SEEK_SET);
             if (status != 0)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CFDP_S_SEEK_BEG, CFE_EVS_EventType_ERROR,
@@ -391,10 +701,25 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
                 success = false;
             }
         }
+
+        if (success && txn->cold->group)
+        {
+            /* the file checksum is computed once for the group */
+            txn->cold->group->cached_pos = 0;
+            CF_CRC_StartType(&txn->cold->group->crc, CF_AppData.config_table->chan[txn->chan_num].checksum_type);
+        }
     }
 
     if (success)
     {
+        txn->fsize = *fsize;
+
+        /* the checksum type goes out in the MD, the table validation ensures it is supported */
+        CF_CRC_StartType(&txn->cold->crc, CF_AppData.config_table->chan[txn->chan_num].checksum_type);
+
+        /* so do the parity parameters */
+        CF_CFDP_S_FecStart(txn);
+
         sret = CF_CFDP_SendMd(txn);
         if (sret == CF_SEND_PDU_ERROR)
         {
@@ -417,9 +742,6 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
         CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
         CF_CFDP_S_Reset(txn);
     }
-
-    /* don't need CF_CRC_Start() since taken care of by reset_cfdp() */
-    /*CF_CRC_Start(&txn->crc);*/
 }
 
 /*----------------------------------------------------------------
@@ -26,6 +26,18 @@
  *  - CF_CFDP_Send() - sends the buffer from CF_CFDP_MsgOutGet
  *  - CF_CFDP_ReceiveMessage() - gets a received message
  *
+ * The actual buffer handling is done by the transport backend selected for
+ * each channel (CF_CFDP_Transport_t).  The software bus backend is
+ * implemented here, the other backends are in separate files:
+ *  - cf_cfdp_shmintf.c - lock-free shared memory ring
+ *  - cf_cfdp_udpintf.c - UDP
+ *
+ * In addition, each channel keeps a small pool of SB buffers that are
+ * allocated and initialized ahead of time, so that CF_CFDP_MsgOutGet()
+ * does not need to go through the SB allocator for every PDU:
+ *  - CF_CFDP_MsgOutPoolFill() - tops up the pool, called once per cycle
+ *  - CF_CFDP_MsgOutPoolDrain() - releases the pool when the engine stops
+ *
  * These functions were originally part of the CFDP engine itself
  * but were split into a separate file, both to improve testability
  * as well as to (potentially) allow interfaces to message/packet services
@@ -48,10 +60,127 @@
 #include "cf_cfdp_r.h"
 #include "cf_cfdp_s.h"
 #include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_shmintf.h"
+#include "cf_cfdp_udpintf.h"
 
 #include <string.h>
 #include "cf_assert.h"
 
+/**
+ * @brief Operations for each of the PDU transport backends, indexed by CF_CFDP_TransportType_t
+ */
+static const CF_CFDP_Transport_t CF_CFDP_TRANSPORTS[CF_CFDP_TransportType_NUM] = {
+    [CF_CFDP_TransportType_SB]  = {.Open          = NULL,
+                                   .Close         = CF_CFDP_MsgOutPoolDrain,
+                                   .Cycle         = CF_CFDP_MsgOutPoolFill,
+                                   .GetBuffer     = CF_CFDP_SB_GetBuffer,
+                                   .ReleaseBuffer = CF_CFDP_SB_ReleaseBuffer,
+                                   .Transmit      = CF_CFDP_SB_Transmit,
+                                   .ReceiveBatch  = CF_CFDP_SB_ReceiveBatch},
+#if CF_ENABLE_SHM_TRANSPORT
+    [CF_CFDP_TransportType_SHM] = {.Open          = CF_CFDP_SHM_Open,
+                                   .Close         = NULL,
+                                   .Cycle         = NULL,
+                                   .GetBuffer     = CF_CFDP_SHM_GetBuffer,
+                                   .ReleaseBuffer = NULL,
+                                   .Transmit      = CF_CFDP_SHM_Transmit,
+                                   .ReceiveBatch  = CF_CFDP_SHM_ReceiveBatch},
+#endif
+#if CF_ENABLE_UDP_TRANSPORT
+    [CF_CFDP_TransportType_UDP] = {.Open          = CF_CFDP_UDP_Open,
+                                   .Close         = CF_CFDP_UDP_Close,
+                                   .Cycle         = NULL,
+                                   .GetBuffer     = CF_CFDP_UDP_GetBuffer,
+                                   .ReleaseBuffer = NULL,
+                                   .Transmit      = CF_CFDP_UDP_Transmit,
+                                   .ReceiveBatch  = CF_CFDP_UDP_ReceiveBatch},
+#endif
+};
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const CF_CFDP_Transport_t *CF_CFDP_GetTransport(uint8 type)
+{
+    const CF_CFDP_Transport_t *transport;
+
+    /* a transport that is not built in has an empty entry */
+    if (type < CF_CFDP_TransportType_NUM && CF_CFDP_TRANSPORTS[type].GetBuffer)
+    {
+        transport = &CF_CFDP_TRANSPORTS[type];
+    }
+    else
+    {
+        transport = NULL;
+    }
+
+    return transport;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_TransportOpen(CF_Channel_t *chan)
+{
+    const int                  chan_num = (chan - CF_AppData.engine.channels);
+    const CF_CFDP_Transport_t *transport;
+    CFE_Status_t               ret = CFE_SUCCESS;
+
+    transport = CF_CFDP_GetTransport(CF_AppData.config_table->chan[chan_num].transport);
+    if (transport == NULL)
+    {
+        ret = CF_ERROR;
+    }
+    else if (transport->Open)
+    {
+        ret = transport->Open(chan);
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        chan->transport = transport;
+        CF_CFDP_TransportCycle(chan);
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_TransportClose(CF_Channel_t *chan)
+{
+    if (chan->transport && chan->transport->Close)
+    {
+        chan->transport->Close(chan);
+    }
+
+    chan->transport = NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_TransportCycle(CF_Channel_t *chan)
+{
+    if (chan->transport && chan->transport->Cycle)
+    {
+        chan->transport->Cycle(chan);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -62,9 +191,13 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
 {
     /* if channel is frozen, do not take message */
     CF_Channel_t *          chan    = CF_AppData.engine.channels + txn->chan_num;
+    CF_Channel_t *          prev_chan;
     bool                    success = true;
     CF_Logical_PduBuffer_t *ret;
     int32                   os_status;
+    CFE_TIME_SysTime_t      wait_start;
+    CFE_TIME_SysTime_t      waited;
+    uint32                  waited_ms;
 
     /* this function should not be called more than once before the message
      * is sent, so if there's already an outgoing message allocated
@@ -72,7 +205,11 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
     ret = NULL;
     if (CF_AppData.engine.out.msg)
     {
-        CFE_SB_ReleaseMessageBuffer(CF_AppData.engine.out.msg);
+        prev_chan = CF_AppData.engine.channels + CF_AppData.engine.out.chan_num;
+        if (prev_chan->transport && prev_chan->transport->ReleaseBuffer)
+        {
+            prev_chan->transport->ReleaseBuffer(prev_chan, CF_AppData.engine.out.msg);
+        }
         CF_AppData.engine.out.msg = NULL;
     }
 
@@ -90,18 +227,49 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
         /* first, check if there's room in the pipe for the message we want to build */
         if (OS_ObjectIdDefined(chan->sem_id))
         {
-            os_status = OS_CountSemTimedWait(chan->sem_id, 0);
+            /* If configured, block until TO gives back a slot so transmission can continue
+             * within this cycle. All waits of the cycle share one budget of sem_wait_ms, so
+             * once it is used up, whether by a wait that timed out or by several that did not,
+             * only poll until the next cycle. */
+            if (chan->sem_wait_left_ms == 0)
+            {
+                os_status = OS_CountSemTimedWait(chan->sem_id, 0);
+            }
+            else
+            {
+                wait_start = CFE_TIME_GetTime();
+                os_status  = OS_CountSemTimedWait(chan->sem_id, chan->sem_wait_left_ms);
+                waited     = CFE_TIME_Subtract(CFE_TIME_GetTime(), wait_start);
+
+                /* the budget is less than one wakeup, so a wait of a second or more used all of it */
+                if ((os_status != OS_SUCCESS) || (waited.Seconds != 0))
+                {
+                    chan->sem_wait_left_ms = 0;
+                }
+                else
+                {
+                    waited_ms = CFE_TIME_Sub2MicroSecs(waited.Subseconds) / 1000;
+                    if (waited_ms < chan->sem_wait_left_ms)
+                    {
+                        chan->sem_wait_left_ms -= waited_ms;
+                    }
+                    else
+                    {
+                        chan->sem_wait_left_ms = 0;
+                    }
+                }
+            }
         }
         else
         {
             os_status = OS_SUCCESS;
         }
 
-        /* Allocate message buffer on success */
+        /* Get a buffer with an initialized header from the channel transport on success */
         if (os_status == OS_SUCCESS)
         {
-            CF_AppData.engine.out.msg = CFE_SB_AllocateMessageBuffer(offsetof(CF_PduTlmMsg_t, ph) + CF_MAX_PDU_SIZE +
-                                                                     CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES);
+            CF_AppData.engine.out.msg      = chan->transport->GetBuffer(chan, silent);
+            CF_AppData.engine.out.chan_num = txn->chan_num;
         }
 
         if (!CF_AppData.engine.out.msg)
@@ -117,9 +285,6 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
 
         if (success)
         {
-            CFE_MSG_Init(&CF_AppData.engine.out.msg->Msg,
-                         CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[txn->chan_num].mid_output),
-                         offsetof(CF_PduTlmMsg_t, ph));
             ++CF_AppData.engine.outgoing_counter; /* even if max_outgoing_messages_per_wakeup is 0 (unlimited), it's ok
                                                     to inc this */
 
@@ -138,6 +303,137 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CF_CFDP_SB_GetBuffer(CF_Channel_t *chan, bool silent)
+{
+    const int        chan_num = (chan - CF_AppData.engine.channels);
+    CFE_SB_Buffer_t *bufptr;
+
+    if (chan->out_pool_count > 0)
+    {
+        /* pooled buffers were already initialized when the pool was filled */
+        --chan->out_pool_count;
+        bufptr                               = chan->out_pool[chan->out_pool_count];
+        chan->out_pool[chan->out_pool_count] = NULL;
+    }
+    else
+    {
+        /* pool ran dry this cycle, fall back to allocating directly from SB */
+        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.fault.out_pool_empty;
+        if (!silent && !chan->out_pool_exhausted)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_OUT_POOL_EMPTY, CFE_EVS_EventType_ERROR,
+                              "CF: outgoing buffer pool empty on channel %d", chan_num);
+            chan->out_pool_exhausted = true;
+        }
+
+        bufptr = CFE_SB_AllocateMessageBuffer(CF_CFDP_OUT_MSG_SIZE);
+        if (bufptr)
+        {
+            CFE_MSG_Init(&bufptr->Msg, CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[chan_num].mid_output),
+                         offsetof(CF_PduTlmMsg_t, ph));
+        }
+    }
+
+    return bufptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_SB_ReleaseBuffer(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    CFE_SB_ReleaseMessageBuffer(bufptr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_SB_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    CFE_SB_TransmitBuffer(bufptr, true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CF_CFDP_SB_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    uint32 count = 0;
+
+    if (max_count > 0 && CFE_SB_ReceiveBuffer(&bufs[0], chan->pipe, CFE_SB_POLL) == CFE_SUCCESS)
+    {
+        count = 1;
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_MsgOutPoolFill(CF_Channel_t *chan)
+{
+    const int        chan_num = (chan - CF_AppData.engine.channels);
+    CFE_SB_Buffer_t *bufptr;
+
+    while (chan->out_pool_count < CF_OUTGOING_BUF_POOL_DEPTH)
+    {
+        bufptr = CFE_SB_AllocateMessageBuffer(CF_CFDP_OUT_MSG_SIZE);
+        if (!bufptr)
+        {
+            break; /* SB is out of buffers, try again next cycle */
+        }
+
+        CFE_MSG_Init(&bufptr->Msg, CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[chan_num].mid_output),
+                     offsetof(CF_PduTlmMsg_t, ph));
+
+        chan->out_pool[chan->out_pool_count] = bufptr;
+        ++chan->out_pool_count;
+    }
+
+    if (chan->out_pool_count == CF_OUTGOING_BUF_POOL_DEPTH)
+    {
+        /* pool is full again, so report the next time it runs dry */
+        chan->out_pool_exhausted = false;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_MsgOutPoolDrain(CF_Channel_t *chan)
+{
+    while (chan->out_pool_count > 0)
+    {
+        --chan->out_pool_count;
+        CFE_SB_ReleaseMessageBuffer(chan->out_pool[chan->out_pool_count]);
+        chan->out_pool[chan->out_pool_count] = NULL;
+    }
+
+    chan->out_pool_exhausted = false;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -146,9 +442,11 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
  *-----------------------------------------------------------------*/
 void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
 {
+    CF_Channel_t * chan;
     CFE_MSG_Size_t sb_msgsize;
 
     CF_Assert(chan_num < CF_NUM_CHANNELS);
+    chan = &CF_AppData.engine.channels[chan_num];
 
     /* now handle the SB encapsulation - this should reflect the
      * length of the entire message, including encapsulation */
@@ -159,7 +457,7 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
 
     CFE_MSG_SetSize(&CF_AppData.engine.out.msg->Msg, sb_msgsize);
     CFE_MSG_SetMsgTime(&CF_AppData.engine.out.msg->Msg, CFE_TIME_GetTime());
-    CFE_SB_TransmitBuffer(CF_AppData.engine.out.msg, true);
+    chan->transport->Transmit(chan, CF_AppData.engine.out.msg);
 
     ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.sent.pdu;
 
@@ -173,132 +471,333 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
  *
  *-----------------------------------------------------------------*/
 void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
+{
+    const int        chan_num = (chan - CF_AppData.engine.channels);
+    const uint32     rx_max   = CF_AppData.config_table->chan[chan_num].rx_max_messages_per_wakeup;
+    const bool       sort     = CF_AppData.config_table->chan[chan_num].rx_batch_sort;
+    uint32           count    = 0;
+    uint32           batch_count;
+    uint32           i;
+    CFE_SB_Buffer_t *batch[CF_PDU_RX_BATCH_SIZE];
+
+    while (count < rx_max)
+    {
+        batch_count = rx_max - count;
+        if (batch_count > CF_PDU_RX_BATCH_SIZE)
+        {
+            batch_count = CF_PDU_RX_BATCH_SIZE;
+        }
+
+        if (sort)
+        {
+            batch_count = CF_CFDP_ReceiveSortedBatch(chan, batch_count);
+        }
+        else
+        {
+            batch_count = chan->transport->ReceiveBatch(chan, batch, batch_count);
+            for (i = 0; i < batch_count; ++i)
+            {
+                CF_CFDP_ReceivePdu(chan, batch[i]);
+            }
+        }
+
+        if (batch_count == 0)
+        {
+            break; /* no more messages */
+        }
+
+        count += batch_count;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ReceivePdu(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
 {
     CF_Transaction_t *txn; /* initialized below */
-    uint32            count = 0;
-    int32             status;
     const int         chan_num = (chan - CF_AppData.engine.channels);
-    CFE_SB_Buffer_t * bufptr;
-    CFE_MSG_Size_t    msg_size;
-    CFE_MSG_Type_t    msg_type = CFE_MSG_Type_Invalid;
 
     CF_Logical_PduBuffer_t *ph;
     CF_Transaction_t        t_finack;
+    CF_TransactionCold_t    t_finack_cold;
 
-    for (; count < CF_AppData.config_table->chan[chan_num].rx_max_messages_per_wakeup; ++count)
+    ph = &CF_AppData.engine.in.rx_pdudata;
+    CFE_ES_PerfLogEntry(CF_PERF_ID_PDURCVD(chan_num));
+    CF_CFDP_ReceiveDecodeStart(bufptr, ph);
+    if (!CF_CFDP_RecvPh(chan_num, ph))
     {
-        status = CFE_SB_ReceiveBuffer(&bufptr, chan->pipe, CFE_SB_POLL);
-        if (status != CFE_SUCCESS)
+        /* got a valid PDU -- look it up by sequence number */
+        txn = CF_FindTransactionBySequenceNumber(chan, ph->pdu_header.sequence_num, ph->pdu_header.source_eid);
+        if (txn)
         {
-            break; /* no more messages */
+            /* found one! Send it to the transaction state processor */
+            CF_Assert(txn->state > CF_TxnState_IDLE);
+            CF_CFDP_DispatchRecv(txn, ph);
         }
+        else if (ph->pdu_header.source_eid == CF_AppData.config_table->local_eid &&
+                 ph->fdirective.directive_code == CF_CFDP_FileDirective_FIN)
+        {
+            /* didn't find a match, but there's a special case:
+             *
+             * If an R2 sent FIN-ACK, the transaction is freed and the history data
+             * is placed in the history queue. It's possible that the peer missed the
+             * FIN-ACK and is sending another FIN. Since we don't know about this
+             * transaction, we don't want to leave R2 hanging. That wouldn't be elegant.
+             * So, send a FIN-ACK by cobbling together a temporary transaction on the
+             * stack and calling CF_CFDP_SendAck() */
+            if (!CF_CFDP_RecvFin(txn, ph))
+            {
+                memset(&t_finack, 0, sizeof(t_finack));
+                memset(&t_finack_cold, 0, sizeof(t_finack_cold));
+                t_finack.cold = &t_finack_cold; /* no header template, so the header is encoded in full */
+                CF_CFDP_InitTxnTxFile(&t_finack, CF_CFDP_CLASS_2, 1, chan_num,
+                                      0); /* populate transaction with needed fields for CF_CFDP_SendAck() */
+                if (CF_CFDP_SendAck(&t_finack, CF_CFDP_AckTxnStatus_UNRECOGNIZED, CF_CFDP_FileDirective_FIN,
+                                    ph->int_header.fin.cc, ph->pdu_header.destination_eid,
+                                    ph->pdu_header.sequence_num) != CF_SEND_PDU_NO_BUF_AVAIL_ERROR)
+                {
+                    /* couldn't get output buffer -- don't care about a send error (oh well, can't send) but we
+                     * do care that there was no message because chan->cur will be set to this transaction */
+                    chan->cur = NULL; /* do not remember temp transaction for next time */
+                }
 
-        ph = &CF_AppData.engine.in.rx_pdudata;
-        CFE_ES_PerfLogEntry(CF_PERF_ID_PDURCVD(chan_num));
-        CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
-        CFE_MSG_GetType(&bufptr->Msg, &msg_type);
-        if (msg_size > CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+                /* NOTE: recv and recv_spurious will both be incremented */
+                ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.spurious;
+            }
+        }
+        else if (ph->pdu_header.destination_eid == CF_AppData.config_table->local_eid)
         {
-            /* Ignore/subtract any fixed trailing bytes */
-            msg_size -= CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES;
+            /* if no match found, then it must be the case that we would be the destination entity id, so
+             * we didn't find a match, so assign it to a transaction */
+            if (CF_AppData.hk.Payload.channel_hk[chan_num].q_size[CF_QueueIdx_RX] == CF_MAX_SIMULTANEOUS_RX)
+            {
+                CFE_EVS_SendEvent(
+                    CF_EID_ERR_CFDP_RX_DROPPED, CFE_EVS_EventType_ERROR,
+                    "CF: dropping packet from %lu transaction number 0x%08lx due max RX transactions reached",
+                    (unsigned long)ph->pdu_header.source_eid, (unsigned long)ph->pdu_header.sequence_num);
+
+                /* NOTE: as there is no transaction (txn) associated with this, there is no known channel,
+                    and therefore no known counter to account it to (because dropped is per-chan) */
+            }
+            else
+            {
+                txn = CF_FindUnusedTransaction(chan);
+                CF_Assert(txn);
+                txn->history->dir = CF_Direction_RX;
+
+                /* set default FIN status */
+                txn->state_data.receive.r2.dc = CF_CFDP_FinDeliveryCode_INCOMPLETE;
+                txn->state_data.receive.r2.fs = CF_CFDP_FinFileStatus_DISCARDED;
+
+                txn->cold->init_time   = CFE_TIME_GetTime();
+                txn->cold->queue_time  = txn->cold->init_time;
+                txn->flags.com.q_index = CF_QueueIdx_RX;
+                CF_CList_InsertBack_Ex(chan, txn->flags.com.q_index, &txn->cl_node);
+                CF_CFDP_DispatchRecv(txn, ph); /* will enter idle state */
+            }
         }
         else
         {
-            /* bad message size - not supposed to happen */
-            msg_size = 0;
+            CFE_EVS_SendEvent(CF_EID_ERR_CFDP_INVALID_DST_EID, CFE_EVS_EventType_ERROR,
+                              "CF: dropping packet for invalid destination eid 0x%lx",
+                              (unsigned long)ph->pdu_header.destination_eid);
+        }
+    }
+
+    CFE_ES_PerfLogExit(CF_PERF_ID_PDURCVD(chan_num));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ReceiveDecodeStart(const CFE_SB_Buffer_t *bufptr, CF_Logical_PduBuffer_t *ph)
+{
+    CFE_MSG_Size_t msg_size = 0;
+    CFE_MSG_Type_t msg_type = CFE_MSG_Type_Invalid;
+
+    CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
+    CFE_MSG_GetType(&bufptr->Msg, &msg_type);
+    if (msg_size > CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+    {
+        /* Ignore/subtract any fixed trailing bytes */
+        msg_size -= CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES;
+    }
+    else
+    {
+        /* bad message size - not supposed to happen */
+        msg_size = 0;
+    }
+    if (msg_type == CFE_MSG_Type_Tlm)
+    {
+        CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduTlmMsg_t, ph), msg_size);
+    }
+    else
+    {
+        CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduCmdMsg_t, ph), msg_size);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CF_CFDP_ReceiveSortedBatch(CF_Channel_t *chan, uint32 max_count)
+{
+    CF_CFDP_RxBatchEntry_t entries[CF_PDU_RX_BATCH_SIZE];
+    CFE_SB_Buffer_t       *batch[CF_PDU_RX_BATCH_SIZE];
+    uint32                 count = 0;
+    uint32                 batch_count;
+    uint32                 i;
+
+    /* drain the transport first, copying as its buffers do not survive the next receive */
+    while (count < max_count)
+    {
+        batch_count = chan->transport->ReceiveBatch(chan, batch, max_count - count);
+        if (batch_count == 0)
+        {
+            break; /* no more messages */
         }
-        if (msg_type == CFE_MSG_Type_Tlm)
+
+        for (i = 0; i < batch_count; ++i)
         {
-            CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduTlmMsg_t, ph), msg_size);
+            CF_CFDP_RxBatchStage(&entries[count], batch[i], &CF_AppData.engine.rx_batch_buf[count]);
+            ++count;
         }
-        else
+    }
+
+    CF_CFDP_RxBatchSort(entries, count);
+
+    for (i = 0; i < count; ++i)
+    {
+        CF_CFDP_ReceivePdu(chan, entries[i].bufptr);
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_RxBatchStage(CF_CFDP_RxBatchEntry_t *entry, const CFE_SB_Buffer_t *bufptr, CF_EncapBuffer_t *copy)
+{
+    CF_Logical_PduBuffer_t *ph       = &CF_AppData.engine.in.rx_pdudata;
+    CFE_MSG_Size_t          msg_size = 0;
+
+    CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
+    if (msg_size > sizeof(copy->bytes))
+    {
+        memcpy(copy->bytes, bufptr, sizeof(copy->bytes));
+        CFE_MSG_SetSize(&copy->buf.Msg, sizeof(copy->bytes));
+    }
+    else
+    {
+        memcpy(copy->bytes, bufptr, msg_size);
+    }
+
+    memset(entry, 0, sizeof(*entry));
+    entry->bufptr = &copy->buf;
+
+    /*
+     * Only decode as much as the sort key needs.  The decoder state is reused by
+     * CF_CFDP_ReceivePdu(), which fully decodes and validates the PDU again later.
+     */
+    CF_CFDP_ReceiveDecodeStart(entry->bufptr, ph);
+    if (CF_CFDP_DecodeHeader(ph->pdec, &ph->pdu_header) == CFE_SUCCESS)
+    {
+        if (ph->pdu_header.pdu_type != 0)
         {
-            CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduCmdMsg_t, ph), msg_size);
+            CF_CFDP_DecodeFileDataHeader(ph->pdec, ph->pdu_header.segment_meta_flag, &ph->int_header.fd);
+            entry->is_fd  = true;
+            entry->offset = ph->int_header.fd.offset;
         }
-        if (!CF_CFDP_RecvPh(chan_num, ph))
+
+        if (CF_CODEC_IS_OK(ph->pdec))
         {
-            /* got a valid PDU -- look it up by sequence number */
-            txn = CF_FindTransactionBySequenceNumber(chan, ph->pdu_header.sequence_num, ph->pdu_header.source_eid);
-            if (txn)
-            {
-                /* found one! Send it to the transaction state processor */
-                CF_Assert(txn->state > CF_TxnState_IDLE);
-                CF_CFDP_DispatchRecv(txn, ph);
-            }
-            else
-            {
-                /* didn't find a match, but there's a special case:
-                 *
-                 * If an R2 sent FIN-ACK, the transaction is freed and the history data
-                 * is placed in the history queue. It's possible that the peer missed the
-                 * FIN-ACK and is sending another FIN. Since we don't know about this
-                 * transaction, we don't want to leave R2 hanging. That wouldn't be elegant.
-                 * So, send a FIN-ACK by cobbling together a temporary transaction on the
-                 * stack and calling CF_CFDP_SendAck() */
-                if (ph->pdu_header.source_eid == CF_AppData.config_table->local_eid &&
-                    ph->fdirective.directive_code == CF_CFDP_FileDirective_FIN)
-                {
-                    if (!CF_CFDP_RecvFin(txn, ph))
-                    {
-                        memset(&t_finack, 0, sizeof(t_finack));
-                        CF_CFDP_InitTxnTxFile(&t_finack, CF_CFDP_CLASS_2, 1, chan_num,
-                                              0); /* populate transaction with needed fields for CF_CFDP_SendAck() */
-                        if (CF_CFDP_SendAck(&t_finack, CF_CFDP_AckTxnStatus_UNRECOGNIZED, CF_CFDP_FileDirective_FIN,
-                                            ph->int_header.fin.cc, ph->pdu_header.destination_eid,
-                                            ph->pdu_header.sequence_num) != CF_SEND_PDU_NO_BUF_AVAIL_ERROR)
-                        {
-                            /* couldn't get output buffer -- don't care about a send error (oh well, can't send) but we
-                             * do care that there was no message because chan->cur will be set to this transaction */
-                            chan->cur = NULL; /* do not remember temp transaction for next time */
-                        }
-
-                        /* NOTE: recv and recv_spurious will both be incremented */
-                        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.spurious;
-                    }
+            entry->is_valid   = true;
+            entry->source_eid = ph->pdu_header.source_eid;
+            entry->seq_num    = ph->pdu_header.sequence_num;
+        }
+    }
+}
 
-                    CFE_ES_PerfLogExit(CF_PERF_ID_PDURCVD(chan_num));
-                    continue;
-                }
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static inline bool CF_CFDP_RxBatchIsBefore(const CF_CFDP_RxBatchEntry_t *a, const CF_CFDP_RxBatchEntry_t *b)
+{
+    if (a->group != b->group)
+    {
+        return (a->group < b->group);
+    }
+    if (a->run != b->run)
+    {
+        return (a->run < b->run);
+    }
+    return (a->offset < b->offset);
+}
 
-                /* if no match found, then it must be the case that we would be the destination entity id, so verify it
-                 */
-                if (ph->pdu_header.destination_eid == CF_AppData.config_table->local_eid)
-                {
-                    /* we didn't find a match, so assign it to a transaction */
-                    if (CF_AppData.hk.Payload.channel_hk[chan_num].q_size[CF_QueueIdx_RX] == CF_MAX_SIMULTANEOUS_RX)
-                    {
-                        CFE_EVS_SendEvent(
-                            CF_EID_ERR_CFDP_RX_DROPPED, CFE_EVS_EventType_ERROR,
-                            "CF: dropping packet from %lu transaction number 0x%08lx due max RX transactions reached",
-                            (unsigned long)ph->pdu_header.source_eid, (unsigned long)ph->pdu_header.sequence_num);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_RxBatchSort(CF_CFDP_RxBatchEntry_t *entries, uint32 count)
+{
+    CF_CFDP_RxBatchEntry_t temp;
+    uint32                 i;
+    uint32                 j;
 
-                        /* NOTE: as there is no transaction (txn) associated with this, there is no known channel,
-                            and therefore no known counter to account it to (because dropped is per-chan) */
-                    }
-                    else
-                    {
-                        txn = CF_FindUnusedTransaction(chan);
-                        CF_Assert(txn);
-                        txn->history->dir = CF_Direction_RX;
+    /* find the group of each entry from the latest earlier entry of the same transaction */
+    for (i = 0; i < count; ++i)
+    {
+        entries[i].group = i;
+        entries[i].run   = 0;
 
-                        /* set default FIN status */
-                        txn->state_data.receive.r2.dc = CF_CFDP_FinDeliveryCode_INCOMPLETE;
-                        txn->state_data.receive.r2.fs = CF_CFDP_FinFileStatus_DISCARDED;
+        j = i;
+        while (entries[i].is_valid && j > 0)
+        {
+            --j;
+            if (entries[j].is_valid && entries[j].source_eid == entries[i].source_eid &&
+                entries[j].seq_num == entries[i].seq_num)
+            {
+                entries[i].group = entries[j].group;
+                entries[i].run   = entries[j].run;
 
-                        txn->flags.com.q_index = CF_QueueIdx_RX;
-                        CF_CList_InsertBack_Ex(chan, txn->flags.com.q_index, &txn->cl_node);
-                        CF_CFDP_DispatchRecv(txn, ph); /* will enter idle state */
-                    }
-                }
-                else
+                /* a directive is a barrier, file data may only move within a run of file data */
+                if (!entries[i].is_fd || !entries[j].is_fd)
                 {
-                    CFE_EVS_SendEvent(CF_EID_ERR_CFDP_INVALID_DST_EID, CFE_EVS_EventType_ERROR,
-                                      "CF: dropping packet for invalid destination eid 0x%lx",
-                                      (unsigned long)ph->pdu_header.destination_eid);
+                    ++entries[i].run;
                 }
+                break;
             }
         }
+    }
 
-        CFE_ES_PerfLogExit(CF_PERF_ID_PDURCVD(chan_num));
+    /* the batch is small, so a stable insertion sort is enough */
+    for (i = 1; i < count; ++i)
+    {
+        temp = entries[i];
+        j    = i;
+        while (j > 0 && CF_CFDP_RxBatchIsBefore(&temp, &entries[j - 1]))
+        {
+            entries[j] = entries[j - 1];
+            --j;
+        }
+        entries[j] = temp;
     }
 }
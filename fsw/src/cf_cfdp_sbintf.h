@@ -22,8 +22,10 @@
  *
  * This is the interface to the CFE Software Bus for PDU transmit/recv.
  *
- * It may serve as a future point of abstraction to interface with message
- * passing interfaces other than the CFE software bus, if necessary.
+ * It also serves as the point of abstraction to interface with message
+ * passing interfaces other than the CFE software bus.  Each channel selects
+ * a transport backend (see CF_CFDP_Transport_t) from its configuration, with
+ * the software bus being the default.
  */
 
 #ifndef CF_CFDP_SBINTF_H
@@ -63,15 +65,115 @@ typedef struct CF_PduTlmMsg
     CF_CFDP_PduHeader_t       ph;  /**< \brief Beginning of CFDP headers */
 } CF_PduTlmMsg_t;
 
+/**
+ * @brief Size of the SB buffer allocated for each outgoing PDU
+ *
+ * Large enough for the telemetry encapsulation header, the largest PDU,
+ * and any fixed trailing bytes.
+ */
+#define CF_CFDP_OUT_MSG_SIZE \
+    (offsetof(CF_PduTlmMsg_t, ph) + CF_MAX_PDU_SIZE + CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+
+/**
+ * @brief PDU transport backend selection
+ *
+ * Values for the "transport" entry in the channel configuration table
+ */
+typedef enum
+{
+    CF_CFDP_TransportType_SB  = 0, /**< \brief CFE software bus (default) */
+    CF_CFDP_TransportType_SHM = 1, /**< \brief Lock-free shared memory ring */
+    CF_CFDP_TransportType_UDP = 2, /**< \brief UDP datagrams to a configured peer */
+    CF_CFDP_TransportType_NUM = 3
+} CF_CFDP_TransportType_t;
+
+/**
+ * @brief PDU transport backend operations
+ *
+ * All backends carry the PDU within the same encapsulation as the software
+ * bus (a CFE message header followed by the PDU), so the rest of the engine
+ * does not need to know which backend a channel uses.
+ *
+ * The Open, Close, Cycle and ReleaseBuffer entries are optional and may be NULL.
+ */
+typedef struct CF_CFDP_Transport
+{
+    /**
+     * @brief Prepare the backend for use on the channel, called at engine init
+     */
+    CFE_Status_t (*Open)(CF_Channel_t *chan);
+
+    /**
+     * @brief Release all backend resources for the channel, called when the engine is disabled
+     */
+    void (*Close)(CF_Channel_t *chan);
+
+    /**
+     * @brief Housekeeping outside of the PDU path, called once per engine cycle (and after Open)
+     */
+    void (*Cycle)(CF_Channel_t *chan);
+
+    /**
+     * @brief Get a buffer of CF_CFDP_OUT_MSG_SIZE with the message header initialized
+     *
+     * @returns Pointer to the buffer, or NULL if none is available right now
+     */
+    CFE_SB_Buffer_t *(*GetBuffer)(CF_Channel_t *chan, bool silent);
+
+    /**
+     * @brief Give back a buffer from GetBuffer that will not be transmitted
+     */
+    void (*ReleaseBuffer)(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+    /**
+     * @brief Transmit a buffer from GetBuffer, the message size is already set in its header
+     */
+    void (*Transmit)(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+    /**
+     * @brief Get up to max_count received messages
+     *
+     * The buffers stay valid until the next call to ReceiveBatch on any channel.
+     *
+     * @returns Number of buffers stored in bufs, 0 if nothing was received
+     */
+    uint32 (*ReceiveBatch)(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count);
+} CF_CFDP_Transport_t;
+
+/**
+ * @brief Sort key for a received PDU held in a batch
+ *
+ * Filled in by a light decode of the PDU header when the PDU is staged, so
+ * that the batch can be reordered before the PDUs are processed.
+ */
+typedef struct CF_CFDP_RxBatchEntry
+{
+    CFE_SB_Buffer_t *bufptr; /**< \brief Staged copy of the received message */
+
+    CF_EntityId_t       source_eid; /**< \brief Source entity ID from the PDU header */
+    CF_TransactionSeq_t seq_num;    /**< \brief Transaction sequence number from the PDU header */
+    CF_FileSize_t       offset;     /**< \brief File data offset, 0 for directives */
+
+    uint8 group; /**< \brief Batch position of the first PDU belonging to the same transaction */
+    uint8 run;   /**< \brief Number of directives ahead of this PDU within its group */
+
+    bool is_valid; /**< \brief Header decoded successfully, so the transaction fields are usable */
+    bool is_fd;    /**< \brief PDU is file data */
+} CF_CFDP_RxBatchEntry_t;
+
 /************************************************************************/
 /** @brief Obtain a message buffer to construct a PDU inside.
  *
  * @par Description
  *       This performs the handshaking via semaphore with the consumer
- *       of the PDU. If the semaphore can be obtained, a software bus
- *       buffer is obtained and it is returned. If the semaphore is
- *       unavailable, then the current transaction is remembered for next
- *       engine cycle. If silent is true, then the event message is not
+ *       of the PDU. If the semaphore can be obtained, a buffer is
+ *       obtained from the channel transport (for the software bus, from
+ *       the channel pool or directly from SB if the pool is empty) and it
+ *       is returned. If the channel has a non-zero sem_wait_ms, the
+ *       semaphore waits of one engine cycle block for up to that long
+ *       in total, after which they only poll until the next cycle.
+ *       If the semaphore is unavailable, then the current transaction is
+ *       remembered for next engine cycle. If silent is true, then the event message is not
  *       printed in the case of no buffer available.
  *
  * @par Assumptions, External Events, and Notes:
@@ -86,7 +188,130 @@ typedef struct CF_PduTlmMsg
 CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool silent);
 
 /************************************************************************/
-/** @brief Sends the current output buffer via the software bus.
+/** @brief Look up the operations for a PDU transport backend.
+ *
+ * @param type   Transport type, as found in the channel configuration
+ *
+ * @returns Pointer to the backend operations
+ * @retval  NULL if type is not a known transport, or was not built in
+ */
+const CF_CFDP_Transport_t *CF_CFDP_GetTransport(uint8 type);
+
+/************************************************************************/
+/** @brief Select and open the configured PDU transport for a channel.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to open the transport on
+ *
+ * @returns CFE_SUCCESS on success
+ * @retval  CF_ERROR if the configured transport is unknown
+ * @retval  Error status from the backend if it failed to open
+ */
+CFE_Status_t CF_CFDP_TransportOpen(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Close the PDU transport of a channel.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object.
+ *       Does nothing if the transport was never opened.
+ *
+ * @param chan       Channel to close the transport on
+ */
+void CF_CFDP_TransportClose(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Run the once per cycle housekeeping of the channel PDU transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to service
+ */
+void CF_CFDP_TransportCycle(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Get an outgoing PDU buffer from the software bus.
+ *
+ * @par Description
+ *       Takes a pre-initialized buffer from the channel pool, or allocates
+ *       one directly from SB if the pool is empty.  This is the GetBuffer
+ *       operation of the software bus transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to get the buffer for
+ * @param silent     If true, suppresses the pool empty event
+ *
+ * @returns Pointer to the buffer, or NULL if SB has none available
+ */
+CFE_SB_Buffer_t *CF_CFDP_SB_GetBuffer(CF_Channel_t *chan, bool silent);
+
+/************************************************************************/
+/** @brief Release an unsent outgoing PDU buffer back to the software bus.
+ *
+ * @param chan       Channel the buffer was obtained for
+ * @param bufptr     Buffer to release
+ */
+void CF_CFDP_SB_ReleaseBuffer(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+/************************************************************************/
+/** @brief Transmit an outgoing PDU buffer on the software bus.
+ *
+ * @param chan       Channel the buffer was obtained for
+ * @param bufptr     Buffer to transmit
+ */
+void CF_CFDP_SB_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+/************************************************************************/
+/** @brief Receive PDUs from the channel software bus pipe.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       A buffer obtained from SB is only valid until the next receive on
+ *       the same pipe, so this returns at most one buffer per call.
+ *
+ * @param chan       Channel to receive on
+ * @param bufs       Output array of received buffers
+ * @param max_count  Size of the bufs array, must be at least 1
+ *
+ * @returns Number of buffers received (0 or 1)
+ */
+uint32 CF_CFDP_SB_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count);
+
+/************************************************************************/
+/** @brief Top up the channel pool of outgoing PDU buffers.
+ *
+ * @par Description
+ *       Allocates SB buffers until the pool holds CF_OUTGOING_BUF_POOL_DEPTH
+ *       entries, initializing each one with the channel output MID. This is
+ *       intended to be called once per engine cycle, outside of the PDU
+ *       construction path. If SB cannot supply a buffer the pool is left
+ *       partially filled and the remainder is retried on the next call.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel whose pool should be refilled
+ *
+ */
+void CF_CFDP_MsgOutPoolFill(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Release all buffers held in the channel outgoing PDU pool.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel whose pool should be emptied
+ *
+ */
+void CF_CFDP_MsgOutPoolDrain(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Sends the current output buffer via the channel transport.
  *
  * @par Assumptions, External Events, and Notes:
  *       The PDU in the output buffer is ready to transmit.
@@ -98,7 +323,13 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
 void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph);
 
 /************************************************************************/
-/** @brief Process received message on channel PDU input pipe.
+/** @brief Process received messages on channel PDU input.
+ *
+ * @par Description
+ *       Takes batches of received messages from the channel transport and
+ *       processes each of them, up to the channel rx_max_messages_per_wakeup.
+ *       If rx_batch_sort is set for the channel, each batch is reordered by
+ *       CF_CFDP_ReceiveSortedBatch() first.
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must be a member of the array within the CF_AppData global object
@@ -108,4 +339,92 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph);
  */
 void CF_CFDP_ReceiveMessage(CF_Channel_t *chan);
 
+/************************************************************************/
+/** @brief Process a single received message.
+ *
+ * @par Description
+ *       Decodes the PDU header and hands the PDU to the matching transaction,
+ *       creating a new receive transaction when needed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object.
+ *       bufptr must not be NULL.
+ *
+ * @param chan       Channel the message was received on
+ * @param bufptr     Received message
+ *
+ */
+void CF_CFDP_ReceivePdu(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+/************************************************************************/
+/** @brief Attach the engine input decoder to a received message.
+ *
+ * @par Description
+ *       Determines the encapsulation header size from the message type and
+ *       the PDU size from the message length, and starts decoding at the
+ *       beginning of the PDU header.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       bufptr and ph must not be NULL.
+ *
+ * @param bufptr     Received message
+ * @param ph         Logical PDU buffer to decode into
+ *
+ */
+void CF_CFDP_ReceiveDecodeStart(const CFE_SB_Buffer_t *bufptr, CF_Logical_PduBuffer_t *ph);
+
+/************************************************************************/
+/** @brief Receive, reorder and process one batch of messages.
+ *
+ * @par Description
+ *       Drains up to max_count messages from the channel transport, copying
+ *       each one to engine storage as the transport buffers do not stay valid
+ *       across calls. The batch is then grouped by transaction, with file data
+ *       sorted by offset, and each message is processed in the new order.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object.
+ *       max_count must not exceed CF_PDU_RX_BATCH_SIZE.
+ *
+ * @param chan       Channel to receive messages on
+ * @param max_count  Maximum number of messages to take
+ *
+ * @returns Number of messages processed, 0 if nothing was received
+ */
+uint32 CF_CFDP_ReceiveSortedBatch(CF_Channel_t *chan, uint32 max_count);
+
+/************************************************************************/
+/** @brief Copy a received message into batch storage and fill its sort key.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       entry, bufptr and copy must not be NULL.  Messages longer than the
+ *       copy buffer are truncated, and their length is adjusted to match.
+ *
+ * @param entry      Batch entry to fill in
+ * @param bufptr     Received message
+ * @param copy       Storage for the copy of the message
+ *
+ */
+void CF_CFDP_RxBatchStage(CF_CFDP_RxBatchEntry_t *entry, const CFE_SB_Buffer_t *bufptr, CF_EncapBuffer_t *copy);
+
+/************************************************************************/
+/** @brief Reorder a batch of received messages for processing.
+ *
+ * @par Description
+ *       Groups the messages by transaction, in order of first appearance,
+ *       and sorts runs of file data within each group by offset. Directives
+ *       keep their position relative to the file data of their transaction,
+ *       so each directive is still processed after exactly the same data.
+ *       Messages whose header could not be decoded are left in a group of
+ *       their own.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       entries must not be NULL, count must not exceed CF_PDU_RX_BATCH_SIZE.
+ *
+ * @param entries    Batch entries, reordered in place
+ * @param count      Number of entries
+ *
+ */
+void CF_CFDP_RxBatchSort(CF_CFDP_RxBatchEntry_t *entries, uint32 count);
+
 #endif /* !CF_CFDP_SBINTF_H */
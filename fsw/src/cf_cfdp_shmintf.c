@@ -0,0 +1,236 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Lock-free shared memory ring transport for CF PDU transmit/recv.
+ *
+ * The rings are single-producer/single-consumer, so the only requirement
+ * for correctness without a lock is that the slot content is visible to
+ * the other side before the index update that hands it over.  This is done
+ * with a memory barrier around every index update.
+ */
+
+#include "cfe.h"
+#include "cf_verify.h"
+#include "cf_app.h"
+#include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_shmintf.h"
+
+#if CF_ENABLE_SHM_TRANSPORT
+
+/**
+ * @brief Full memory barrier between ring content and ring index accesses
+ *
+ * May be defined by the mission for compilers without the GCC atomic builtins.
+ */
+#ifndef CF_SHM_BARRIER
+#if defined(__GNUC__)
+#define CF_SHM_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#error CF_SHM_BARRIER must be defined for this compiler
+#endif
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ShmRing_t *CF_CFDP_ShmGetRing(uint8 chan_num, CF_Direction_t dir)
+{
+    CF_ShmRing_t *ring = NULL;
+
+    if (chan_num < CF_NUM_CHANNELS && dir < CF_Direction_NUM)
+    {
+        ring = &CF_AppData.engine.shm_rings[chan_num][dir];
+    }
+
+    return ring;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CF_CFDP_ShmRingReserve(CF_ShmRing_t *ring)
+{
+    CFE_SB_Buffer_t *bufptr = NULL;
+    uint32           head   = ring->head;
+
+    if ((head - ring->tail) < CF_SHM_RING_DEPTH)
+    {
+        /* do not touch the slot until the consumer release of it is visible */
+        CF_SHM_BARRIER();
+        bufptr = &ring->slots[head & (CF_SHM_RING_DEPTH - 1)].buf;
+    }
+
+    return bufptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ShmRingCommit(CF_ShmRing_t *ring)
+{
+    /* slot content must be visible before the consumer can see the new head */
+    CF_SHM_BARRIER();
+    ring->head = ring->head + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CF_CFDP_ShmRingPeek(CF_ShmRing_t *ring, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    uint32 tail  = ring->tail;
+    uint32 count = ring->head - tail;
+    uint32 i;
+
+    if (count > max_count)
+    {
+        count = max_count;
+    }
+
+    /* do not read slot content older than the head that published it */
+    CF_SHM_BARRIER();
+
+    for (i = 0; i < count; ++i)
+    {
+        bufs[i] = &ring->slots[(tail + i) & (CF_SHM_RING_DEPTH - 1)].buf;
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ShmRingRelease(CF_ShmRing_t *ring, uint32 count)
+{
+    /* all reads of the slots must be complete before the producer can reuse them */
+    CF_SHM_BARRIER();
+    ring->tail = ring->tail + count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_SHM_Open(CF_Channel_t *chan)
+{
+    const int chan_num = (chan - CF_AppData.engine.channels);
+    int       i;
+
+    for (i = 0; i < CF_Direction_NUM; ++i)
+    {
+        CF_AppData.engine.shm_rings[chan_num][i].head = 0;
+        CF_AppData.engine.shm_rings[chan_num][i].tail = 0;
+    }
+
+    chan->shm_rx_held = 0;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CF_CFDP_SHM_GetBuffer(CF_Channel_t *chan, bool silent)
+{
+    const int        chan_num = (chan - CF_AppData.engine.channels);
+    CFE_SB_Buffer_t *bufptr;
+
+    bufptr = CF_CFDP_ShmRingReserve(&CF_AppData.engine.shm_rings[chan_num][CF_Direction_TX]);
+    if (bufptr)
+    {
+        CFE_MSG_Init(&bufptr->Msg, CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[chan_num].mid_output),
+                     offsetof(CF_PduTlmMsg_t, ph));
+    }
+
+    return bufptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_SHM_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    const int chan_num = (chan - CF_AppData.engine.channels);
+
+    /* the buffer is always the reserved slot, so publishing it is all that is left */
+    CF_CFDP_ShmRingCommit(&CF_AppData.engine.shm_rings[chan_num][CF_Direction_TX]);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_shmintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CF_CFDP_SHM_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    const int      chan_num = (chan - CF_AppData.engine.channels);
+    CF_ShmRing_t * ring     = &CF_AppData.engine.shm_rings[chan_num][CF_Direction_RX];
+    CFE_MSG_Size_t msg_size = 0;
+    uint32         i;
+
+    /* the engine is done with the previous batch, give those slots back to the link */
+    if (chan->shm_rx_held)
+    {
+        CF_CFDP_ShmRingRelease(ring, chan->shm_rx_held);
+    }
+
+    chan->shm_rx_held = CF_CFDP_ShmRingPeek(ring, bufs, max_count);
+
+    /* the slot size bounds the message, whatever the link put in the header */
+    for (i = 0; i < chan->shm_rx_held; ++i)
+    {
+        CFE_MSG_GetSize(&bufs[i]->Msg, &msg_size);
+        if (msg_size > sizeof(CF_EncapBuffer_t))
+        {
+            CFE_MSG_SetSize(&bufs[i]->Msg, sizeof(CF_EncapBuffer_t));
+        }
+    }
+
+    return chan->shm_rx_held;
+}
+
+#endif /* CF_ENABLE_SHM_TRANSPORT */
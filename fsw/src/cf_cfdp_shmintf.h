@@ -0,0 +1,165 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Lock-free shared memory ring transport for CF PDU transmit/recv.
+ *
+ * Each channel using this transport owns two single-producer/single-consumer
+ * rings in the engine state, one per direction.  CF is the producer of the
+ * TX ring and the consumer of the RX ring, the link driver sharing the address
+ * space takes the other side of each, using the same ring functions declared
+ * here.  PDUs are carried with the same encapsulation as on the software bus.
+ */
+
+#ifndef CF_CFDP_SHMINTF_H
+#define CF_CFDP_SHMINTF_H
+
+#include "cf_cfdp_types.h"
+
+/************************************************************************/
+/** @brief Get the shared memory ring of a channel.
+ *
+ * @par Description
+ *       This is the entry point for the link driver.  The TX ring carries
+ *       PDUs from CF to the link, and the RX ring carries PDUs from the link
+ *       to CF.
+ *
+ * @param chan_num   Channel number
+ * @param dir        Direction of the ring, from the perspective of CF
+ *
+ * @returns Pointer to the ring
+ * @retval  NULL if chan_num or dir is out of range
+ */
+CF_ShmRing_t *CF_CFDP_ShmGetRing(uint8 chan_num, CF_Direction_t dir);
+
+/************************************************************************/
+/** @brief Get the next free slot of a ring, without publishing it.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Only to be called by the producer of the ring.  Calling this again
+ *       before CF_CFDP_ShmRingCommit() returns the same slot.
+ *
+ * @param ring       Ring to produce into
+ *
+ * @returns Pointer to the free slot
+ * @retval  NULL if the ring is full
+ */
+CFE_SB_Buffer_t *CF_CFDP_ShmRingReserve(CF_ShmRing_t *ring);
+
+/************************************************************************/
+/** @brief Publish the slot obtained from CF_CFDP_ShmRingReserve() to the consumer.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Only to be called by the producer of the ring, after a successful
+ *       CF_CFDP_ShmRingReserve() and after the slot content is complete.
+ *
+ * @param ring       Ring to produce into
+ */
+void CF_CFDP_ShmRingCommit(CF_ShmRing_t *ring);
+
+/************************************************************************/
+/** @brief Get the oldest published slots of a ring, without releasing them.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Only to be called by the consumer of the ring.
+ *
+ * @param ring       Ring to consume from
+ * @param bufs       Output array of slots, oldest first
+ * @param max_count  Size of the bufs array
+ *
+ * @returns Number of slots stored in bufs
+ */
+uint32 CF_CFDP_ShmRingPeek(CF_ShmRing_t *ring, CFE_SB_Buffer_t **bufs, uint32 max_count);
+
+/************************************************************************/
+/** @brief Release the oldest slots of a ring back to the producer.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Only to be called by the consumer of the ring, with a count no
+ *       larger than the last CF_CFDP_ShmRingPeek() returned.
+ *
+ * @param ring       Ring to consume from
+ * @param count      Number of slots to release
+ */
+void CF_CFDP_ShmRingRelease(CF_ShmRing_t *ring, uint32 count);
+
+/************************************************************************/
+/** @brief Reset both rings of a channel to empty.
+ *
+ * This is the Open operation of the shared memory transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to open the transport on
+ *
+ * @returns CFE_SUCCESS
+ */
+CFE_Status_t CF_CFDP_SHM_Open(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Get an outgoing PDU buffer from the channel TX ring.
+ *
+ * This is the GetBuffer operation of the shared memory transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to get the buffer for
+ * @param silent     Unused, this transport does not send events
+ *
+ * @returns Pointer to the buffer with the header initialized
+ * @retval  NULL if the ring is full
+ */
+CFE_SB_Buffer_t *CF_CFDP_SHM_GetBuffer(CF_Channel_t *chan, bool silent);
+
+/************************************************************************/
+/** @brief Publish an outgoing PDU buffer on the channel TX ring.
+ *
+ * This is the Transmit operation of the shared memory transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel the buffer was obtained for
+ * @param bufptr     Buffer from CF_CFDP_SHM_GetBuffer()
+ */
+void CF_CFDP_SHM_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+/************************************************************************/
+/** @brief Receive a batch of PDUs from the channel RX ring.
+ *
+ * This is the ReceiveBatch operation of the shared memory transport.  The
+ * slots returned by the previous call are released first, the new ones are
+ * processed in place and held until the next call.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to receive on
+ * @param bufs       Output array of received buffers
+ * @param max_count  Size of the bufs array
+ *
+ * @returns Number of buffers received
+ */
+uint32 CF_CFDP_SHM_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count);
+
+#endif /* !CF_CFDP_SHMINTF_H */
@@ -40,14 +40,16 @@
 #include "cf_chunk.h"
 #include "cf_timer.h"
 #include "cf_crc.h"
+#include "cf_fec.h"
 #include "cf_codec.h"
+#include "cf_names.h"
 
 /**
  * @brief Maximum possible number of transactions that may exist on a single CF channel
  */
-#define CF_NUM_TRANSACTIONS_PER_CHANNEL                                                \
-    (CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + CF_MAX_SIMULTANEOUS_RX +               \
-     ((CF_MAX_POLLING_DIR_PER_CHAN + CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN) * \
+#define CF_NUM_TRANSACTIONS_PER_CHANNEL                                                    \
+    (CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + CF_MAX_SIMULTANEOUS_RX +                   \
+     ((CF_MAX_POLLING_DIR_PER_CHAN + CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN + 1) * \
       CF_NUM_TRANSACTIONS_PER_PLAYBACK))
 
 /**
@@ -56,7 +58,7 @@
 #define CF_NUM_TRANSACTIONS (CF_NUM_CHANNELS * CF_NUM_TRANSACTIONS_PER_CHANNEL)
 
 /**
- * @brief Maximum possible number of history entries that may exist in the CF application
+ * @brief Maximum possible number of history records that may exist in the CF application
  */
 #define CF_NUM_HISTORIES (CF_NUM_CHANNELS * CF_NUM_HISTORIES_PER_CHANNEL)
 
@@ -65,6 +67,15 @@
  */
 #define CF_NUM_CHUNKS_ALL_CHANNELS (CF_TOTAL_CHUNKS * CF_NUM_TRANSACTIONS_PER_CHANNEL)
 
+/**
+ * @brief Size of a buffer that can hold any encapsulated PDU
+ *
+ * Large enough for the telemetry encapsulation header, the largest PDU,
+ * and any fixed trailing bytes.
+ */
+#define CF_ENCAP_BUF_SIZE \
+    (sizeof(CFE_MSG_TelemetryHeader_t) + CF_MAX_PDU_SIZE + CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+
 /**
  * @brief High-level state of a transaction
  */
@@ -168,12 +179,13 @@ typedef enum
 /**
  * @brief CF History entry
  *
- * Records CF app operations for future reference
+ * Records CF app operations for future reference.  Each active transaction
+ * has one of these, once the transaction is done it is stored in the
+ * channel history ring as a CF_HistoryRecord_t.
  */
 typedef struct CF_History
 {
     CF_TxnFilenames_t   fnames;   /**< \brief file names associated with this history entry */
-    CF_CListNode_t      cl_node;  /**< \brief for connection to a CList */
     CF_Direction_t      dir;      /**< \brief direction of this history entry */
     CF_TxnStatus_t      txn_stat; /**< \brief final status of operation */
     CF_EntityId_t       src_eid;  /**< \brief the source eid of the transaction */
@@ -181,6 +193,59 @@ typedef struct CF_History
     CF_TransactionSeq_t seq_num;  /**< \brief transaction identifier, stays constant for entire transfer */
 } CF_History_t;
 
+/**
+ * @brief Mask of the direction in CF_HistoryRecord_t flags
+ */
+#define CF_HISTORY_FLAG_DIR_MASK 0x03
+
+/**
+ * @brief Set in CF_HistoryRecord_t flags when the destination leaf is not stored
+ *
+ * The destination file has the same last part of the name as the source,
+ * which is the case for most transfers.
+ */
+#define CF_HISTORY_FLAG_SAME_LEAF 0x04
+
+/**
+ * @brief Compact CF history record
+ *
+ * A finished transaction as kept in the channel history ring.  Directories
+ * are handles to a name table, and the rest of each name is stored in the
+ * ring's name arena.  The source entity ID is not stored: it is the peer for
+ * RX and the local entity for TX.
+ */
+typedef struct CF_HistoryRecord
+{
+    CF_TransactionSeq_t seq_num;     /**< \brief transaction identifier */
+    CF_EntityId_t       peer_eid;    /**< \brief the other entity of the transaction */
+    CF_NameHandle_t     src_prefix;  /**< \brief directory of the source file */
+    CF_NameHandle_t     dst_prefix;  /**< \brief directory of the destination file */
+    uint16              name_offset; /**< \brief source leaf in the arena, the destination leaf follows it */
+    uint8               txn_stat;    /**< \brief final status of operation, a CF_TxnStatus_t */
+    uint8               flags;       /**< \brief direction and CF_HISTORY_FLAG_* bits */
+} CF_HistoryRecord_t;
+
+/**
+ * @brief CF history ring
+ *
+ * A fixed ring of history records, oldest first, and an arena for the
+ * names they refer to.  The names are written in the same order as the
+ * records, wrapping to the start of the arena when a name does not fit at
+ * the end, so the oldest records are dropped when either space runs out.
+ */
+typedef struct CF_HistoryRing
+{
+    CF_HistoryRecord_t *records;     /**< \brief storage for the records, owned by the caller */
+    char *              names;       /**< \brief storage for the names, owned by the caller */
+    CF_NameTable_t *    prefixes;    /**< \brief table the record directories are held in */
+    uint16              num_records; /**< \brief number of records in the storage */
+    uint16              names_size;  /**< \brief size of the name storage */
+    uint16              oldest;      /**< \brief index of the oldest record */
+    uint16              count;       /**< \brief number of records held */
+    uint16              names_head;  /**< \brief where the next names are written */
+    uint32              num_added;   /**< \brief records ever added, the oldest held is num_added - count */
+} CF_HistoryRing_t;
+
 /**
  * @brief Wrapper around a CF_ChunkList_t object
  *
@@ -201,17 +266,87 @@ typedef struct CF_Playback
 {
     osal_id_t         dir_id;
     CF_CFDP_Class_t   cfdp_class;
-    CF_TxnFilenames_t fnames;
     uint16            num_ts; /**< \brief number of transactions */
     uint8             priority;
     CF_EntityId_t     dest_id;
 
+    CF_NameHandle_t src_prefix;  /**< \brief source directory with a trailing slash */
+    CF_NameHandle_t dst_prefix;  /**< \brief destination directory with a trailing slash */
+    uint16          num_pending; /**< \brief number of files on the channel pending queue */
+    uint16          max_active;  /**< \brief max number of transactions at once */
+    uint16          max_pending; /**< \brief max number of files on the pending queue */
+
+    CF_CListNode_t *pend; /**< \brief pending files that are not suspended, in PEND queue order */
+
     bool busy;
     bool diropen;
     bool keep;
     bool counted;
 } CF_Playback_t;
 
+struct CF_Transaction;
+
+/**
+ * @brief CF transmit group
+ *
+ * Ties together the transactions that send one file to several peers.  The
+ * file is opened once, and the checksum is computed once as the members first
+ * send each part of the file.  The last file data read is kept, so members
+ * sending the same part of the file at the same time do not read it again.
+ * Everything else, gap tracking included, is kept per member transaction.
+ */
+typedef struct CF_TxGroup
+{
+    osal_id_t     fd;         /**< \brief shared by all members, closed when the last member is done */
+    CF_FileSize_t fsize;      /**< \brief size of the file, valid once fd is open */
+    CF_FileSize_t cached_pos; /**< \brief file position of fd */
+    CF_FileSize_t crc_offset; /**< \brief file data digested into crc so far */
+    CF_Crc_t      crc;        /**< \brief working checksum of the file, finalized by each member on a copy */
+    CF_FileSize_t buf_offset; /**< \brief file offset of the data in buf */
+    size_t        buf_len;    /**< \brief bytes of file data in buf, 0 if none */
+    uint8         buf[CF_MAX_PDU_SIZE];
+
+    char  src_filename[CF_FILENAME_MAX_LEN]; /**< \brief source file, for its disposal once the group is done */
+    uint8 chan_num;                          /**< \brief channel of all the members */
+    uint8 keep;                              /**< \brief keep the file once the group is done */
+    uint8 num_refs;                          /**< \brief pending files plus member transactions, free when 0 */
+    uint8 num_members;                       /**< \brief entries used in members */
+    bool  fanning_out;                       /**< \brief set while a member is driving the others */
+
+    struct CF_Transaction *members[CF_TX_GROUP_MAX_DEST]; /**< \brief member transactions, not pending files */
+} CF_TxGroup_t;
+
+/**
+ * @brief CF pending file record
+ *
+ * A file send that is waiting on the PEND queue of a channel.  It only gets
+ * a transaction, with its history entry and chunk list, when it moves to TXA.
+ * The paths are kept as a handle to an interned directory plus the last part
+ * of the name.  Both last parts share one buffer, and the destination one is
+ * only stored when it differs from the source one, as it never does for
+ * playback files.  With its second list node this keeps a record at a third
+ * of the size of a transaction, its cold part and its history entry.
+ */
+typedef struct CF_PendingFile
+{
+    CF_CListNode_t      cl_node;     /**< \brief on the PEND queue of the channel */
+    CF_CListNode_t      src_node;    /**< \brief on the pending list of its source, unless suspended */
+    CF_Playback_t *     pb;          /**< \brief playback the file belongs to, NULL if commanded */
+    CF_TxGroup_t *      group;       /**< \brief transmit group the file belongs to, NULL if none */
+    CFE_TIME_SysTime_t  queued_time; /**< \brief when the file was queued, the initiation of its transaction */
+    CF_TransactionSeq_t seq_num;     /**< \brief assigned when queued, so commands can find the file */
+    uint32              dump_stamp;  /**< \brief stamp of the last binary queue file that wrote the file */
+    CF_EntityId_t       dest_id;     /**< \brief peer to send the file to */
+    CF_NameHandle_t     src_prefix;  /**< \brief source path up to the source leaf */
+    CF_NameHandle_t     dst_prefix;  /**< \brief destination path up to the destination leaf */
+    uint8               cfdp_class;
+    uint8               keep;
+    uint8               priority;
+    bool                suspended;                    /**< \brief not moved to TXA until resumed */
+    bool                same_leaf;                    /**< \brief the destination leaf is the source leaf, not stored */
+    char                leaves[CF_FILENAME_MAX_NAME]; /**< \brief source leaf, then destination leaf if stored */
+} CF_PendingFile_t;
+
 /**
  * @brief CF Poll entry
  *
@@ -224,6 +359,90 @@ typedef struct CF_Poll
     bool          timer_set;
 } CF_Poll_t;
 
+/**
+ * @brief CF TX manifest entry
+ *
+ * Keeps the state of a TX manifest being worked through on a channel.  The
+ * embedded playback object does the transaction accounting, the same as for
+ * a directory playback, but the file list comes from the manifest records.
+ */
+typedef struct CF_Manifest
+{
+    CF_Playback_t pb;       /**< \brief File accounting, only busy, keep and the counts and limits are used */
+    osal_id_t     fd;       /**< \brief Open manifest file */
+    bool          fileopen; /**< \brief Manifest still has records to read */
+} CF_Manifest_t;
+
+/**
+ * @brief Stages of a binary queue file, in the order they are written
+ */
+typedef enum
+{
+    CF_QueueDumpStage_RX,      /**< \brief RX active transactions */
+    CF_QueueDumpStage_HIST_RX, /**< \brief RX history */
+    CF_QueueDumpStage_TXA,     /**< \brief TX active transactions */
+    CF_QueueDumpStage_TXW,     /**< \brief TX transactions waiting on the peer */
+    CF_QueueDumpStage_PEND,    /**< \brief Pending files */
+    CF_QueueDumpStage_HIST_TX, /**< \brief TX history */
+    CF_QueueDumpStage_NUM      /**< \brief All stages written */
+} CF_QueueDumpStage_t;
+
+/**
+ * @brief CF binary queue file in progress
+ *
+ * For a history stage the position is the next record number of the ring.
+ * For a queue stage the dump picks up after the last node it wrote, which
+ * the queue helpers move back to the node before it if it leaves its queue.
+ * Each entry written is stamped, so one that is moved further along its
+ * queue, or on to the queue of a later stage, is not written again.
+ */
+typedef struct CF_QueueDump
+{
+    osal_id_t       fd;          /**< \brief Open queue file */
+    CF_CListNode_t *resume;      /**< \brief Last node written of a queue stage, NULL to start at the head */
+    uint32          position;    /**< \brief Next record number of a history stage */
+    uint32          stamp;       /**< \brief Marks the entries this file has written, never 0 */
+    uint32          num_records; /**< \brief Records written so far */
+    uint8           chan;        /**< \brief Channel being written */
+    uint8           type;        /**< \brief Direction selection, a CF_Type_t */
+    uint8           queue;       /**< \brief Queue selection, a CF_Queue_t */
+    uint8           stage;       /**< \brief Current stage, a CF_QueueDumpStage_t */
+    bool            busy;        /**< \brief A file is being written */
+} CF_QueueDump_t;
+
+/**
+ * @brief Execution time statistics of one engine phase
+ */
+typedef struct CF_PerfPhaseStats
+{
+    uint32 count;      /**< \brief number of timed runs */
+    uint32 min_usec;   /**< \brief shortest run, only valid if count is nonzero */
+    uint32 max_usec;   /**< \brief longest run */
+    uint64 total_usec; /**< \brief sum of all runs, for the average */
+} CF_PerfPhaseStats_t;
+
+/**
+ * @brief Engine phase performance statistics
+ */
+typedef struct CF_PerfStats
+{
+    bool                enabled; /**< \brief set by command, timing is skipped while clear */
+    CF_PerfPhaseStats_t phase[CF_PerfPhase_NUM];
+
+    /** \brief latency histograms of each channel, in the telemetry layout */
+    CF_LatencyHistTlm_t latency[CF_NUM_CHANNELS][CF_LatencyHist_NUM][CF_LATENCY_PRIO_CLASSES];
+} CF_PerfStats_t;
+
+/**
+ * @brief One timed run of an engine phase, see CF_Perf_Begin()
+ */
+typedef struct CF_PerfMark
+{
+    CF_PerfPhase_t     phase;
+    bool               timed; /**< \brief false if the statistics were disabled when the run began */
+    CFE_TIME_SysTime_t start;
+} CF_PerfMark_t;
+
 /**
  * @brief Data specific to a class 2 send file transaction
  */
@@ -238,8 +457,9 @@ typedef struct CF_TxS2_Data
  */
 typedef struct CF_TxState_Data
 {
-    CF_TxSubState_t sub_state;
-    uint32          cached_pos;
+    CF_TxSubState_t  sub_state;
+    CF_FileSize_t    cached_pos;
+    CF_FecEncoder_t *fec; /**< \brief parity of a class 1 send, NULL if it adds no parity PDUs */
 
     CF_TxS2_Data_t s2;
 } CF_TxState_Data_t;
@@ -250,8 +470,8 @@ typedef struct CF_TxState_Data
 typedef struct CF_RxS2_Data
 {
     uint32                    eof_crc;
-    uint32                    eof_size;
-    uint32                    rx_crc_calc_bytes;
+    CF_FileSize_t             eof_size;
+    CF_FileSize_t             rx_crc_calc_bytes;
     CF_CFDP_FinDeliveryCode_t dc;
     CF_CFDP_FinFileStatus_t   fs;
     uint8                     eof_cc; /**< \brief remember the cc in the received EOF PDU to echo in eof-ack */
@@ -264,7 +484,9 @@ typedef struct CF_RxS2_Data
 typedef struct CF_RxState_Data
 {
     CF_RxSubState_t sub_state;
-    uint32          cached_pos;
+    CF_FileSize_t   cached_pos;
+    CF_FileSize_t   relay_pos; /**< \brief bytes from the start of the file received without a gap */
+    CF_FecDecoder_t fec;       /**< \brief segments received of a class 1 file, for rebuilding from parity */
 
     CF_RxS2_Data_t r2;
 } CF_RxState_Data_t;
@@ -329,34 +551,63 @@ typedef union CF_StateData
 } CF_StateData_t;
 
 /**
- * @brief Transaction state object
+ * @brief Progress counters of a transaction for the status telemetry
  *
- * This keeps the state of CF file transactions
+ * The rate and state fields hold what was seen at the previous report, so
+ * the next report can compute the rate and time in state from them.
  */
-typedef struct CF_Transaction
+typedef struct CF_TxnProgress
 {
-    CF_TxnState_t state; /**< \brief each engine is commanded to do something, which is the overall state */
+    uint64             file_data_bytes;  /**< \brief file data sent or received, including retransmits */
+    uint64             retransmit_bytes; /**< \brief file data sent or received again to fill gaps */
+    uint64             rate_bytes;       /**< \brief file_data_bytes at the previous report */
+    CFE_TIME_SysTime_t rate_time;        /**< \brief time of the previous report */
+    CFE_TIME_SysTime_t state_time;       /**< \brief time the state or sub state was first reported */
+    uint8              state;            /**< \brief state at the previous report */
+    uint8              sub_state;        /**< \brief sub state at the previous report */
+    bool               reported;         /**< \brief set once the transaction has been in a report */
+} CF_TxnProgress_t;
 
-    CF_History_t *     history;          /**< \brief weird, holds active filenames and possibly other info */
-    CF_ChunkWrapper_t *chunks;           /**< \brief for gap tracking, only used on class 2 */
-    CF_Timer_t         inactivity_timer; /**< \brief set to the overall inactivity timer of a remote */
-    CF_Timer_t         ack_timer;        /**< \brief called ack_timer, but is also nak_timer */
-
-    uint32    fsize; /**< \brief lseek() should be 64-bit on 64-bit system, but osal limits to 32-bit */
-    uint32    foffs; /**< \brief offset into file for next read */
+/**
+ * @brief Parts of a transaction only used when a PDU goes out or comes in, or for telemetry
+ *
+ * Kept apart from CF_Transaction_t so the channel tick, which looks at every
+ * transaction on a queue, does not pull these into the cache.
+ */
+typedef struct CF_TransactionCold
+{
     osal_id_t fd;
+    CF_Crc_t  crc;
 
-    CF_Crc_t crc;
+    CF_Playback_t *        pb;    /**< \brief NULL if transaction does not belong to a playback */
+    CF_TxGroup_t *         group; /**< \brief NULL if transaction does not belong to a transmit group */
+    struct CF_Transaction *relay; /**< \brief NULL unless relayed, else the transaction at the other end */
 
-    uint8 keep;
-    uint8 chan_num; /**< \brief if ever more than one engine, this may need to change to pointer */
-    uint8 priority;
+    CF_TxnProgress_t progress; /**< \brief for the transaction status telemetry */
 
-    CF_CListNode_t cl_node;
+    CF_PduHeaderTemplate_t hdr_template; /**< \brief header of the PDUs this transaction sends, encoded once */
 
-    CF_Playback_t *pb; /**< \brief NULL if transaction does not belong to a playback */
+    CFE_TIME_SysTime_t init_time;  /**< \brief when the transaction was initiated, for the latency histograms */
+    CFE_TIME_SysTime_t queue_time; /**< \brief when the transaction entered its current queue */
 
-    CF_StateData_t state_data;
+    uint32 dump_stamp; /**< \brief stamp of the last binary queue file that wrote the transaction */
+} CF_TransactionCold_t;
+
+/**
+ * @brief Transaction state object
+ *
+ * This keeps the state of CF file transactions
+ *
+ * A tick of an idle transaction reads the members up to and including
+ * chunks, and the sub state at the start of state_data, which all fit in
+ * one 64 byte cache line.  Everything else a tick reads only when a timer
+ * expires or a PDU is due.
+ */
+typedef struct CF_Transaction
+{
+    CF_CListNode_t cl_node;
+
+    CF_TxnState_t state; /**< \brief each engine is commanded to do something, which is the overall state */
 
     /**
      * @brief State flags
@@ -367,8 +618,34 @@ typedef struct CF_Transaction
      * Please ignore the duplicate declarations of the "all" flags.
      */
     CF_StateFlags_t flags;
+
+    uint8 keep;
+    uint8 chan_num; /**< \brief if ever more than one engine, this may need to change to pointer */
+    uint8 priority;
+
+    CF_Timer_t inactivity_timer; /**< \brief set to the overall inactivity timer of a remote */
+    CF_Timer_t ack_timer;        /**< \brief called ack_timer, but is also nak_timer */
+
+    CF_ChunkWrapper_t *chunks; /**< \brief for gap tracking, only used on class 2 */
+
+    CF_StateData_t state_data;
+
+    CF_History_t *        history; /**< \brief weird, holds active filenames and possibly other info */
+    CF_TransactionCold_t *cold;    /**< \brief rarely used state, bound while in use like history */
+
+    CF_FileSize_t fsize; /**< \brief file size, 4 GiB or more makes the PDUs of the transaction use large files */
+    CF_FileSize_t foffs; /**< \brief offset into file for next read */
 } CF_Transaction_t;
 
+/* a tick of an idle transaction stays within one cache line */
+CompileTimeAssert(offsetof(CF_Transaction_t, state_data) + sizeof(CF_TxSubState_t) <= 64, CF_TxnTickTxLine);
+CompileTimeAssert(offsetof(CF_Transaction_t, state_data) + sizeof(CF_RxSubState_t) <= 64, CF_TxnTickRxLine);
+
+/* a pending file record is at most a third of what a transaction in use takes */
+CompileTimeAssert(sizeof(CF_PendingFile_t) * 3 <=
+                      sizeof(CF_Transaction_t) + sizeof(CF_TransactionCold_t) + sizeof(CF_History_t),
+                  CF_PendingFileSize);
+
 /**
  * @brief Identifies the type of timer tick being processed
  */
@@ -380,6 +657,34 @@ typedef enum
     CF_TickType_NUM_TYPES
 } CF_TickType_t;
 
+/**
+ * @brief Storage for one encapsulated PDU outside of the software bus
+ *
+ * Used by transports that do not get their buffers from SB.  The union
+ * keeps the storage aligned the same way as an SB buffer.
+ */
+typedef union CF_EncapBuffer
+{
+    CFE_SB_Buffer_t buf;
+    uint8           bytes[CF_ENCAP_BUF_SIZE];
+} CF_EncapBuffer_t;
+
+/**
+ * @brief Single-producer/single-consumer PDU ring
+ *
+ * The head and tail are free-running counters, the slot index is the
+ * counter modulo CF_SHM_RING_DEPTH.  Only the producer writes head and
+ * only the consumer writes tail, so no lock is needed between the two.
+ */
+typedef struct CF_ShmRing
+{
+    volatile uint32  head; /**< \brief number of slots published, written only by the producer */
+    volatile uint32  tail; /**< \brief number of slots released, written only by the consumer */
+    CF_EncapBuffer_t slots[CF_SHM_RING_DEPTH];
+} CF_ShmRing_t;
+
+struct CF_CFDP_Transport;
+
 /**
  * @brief Channel state object
  *
@@ -403,10 +708,33 @@ typedef struct CF_Channel
     /* For polling directories, the configuration data is in a table. */
     CF_Poll_t poll[CF_MAX_POLLING_DIR_PER_CHAN];
 
+    CF_Manifest_t manifest; /**< \brief TX manifest being worked through, if any */
+
+    CF_CListNode_t *pf_free;  /**< \brief unused pending file records */
+    CF_CListNode_t *cmd_pend; /**< \brief commanded pending files that are not suspended, in PEND queue order */
+
+    CF_HistoryRing_t history; /**< \brief finished transactions */
+
     osal_id_t sem_id; /**< \brief semaphore id for output pipe */
 
     const CF_Transaction_t *cur; /**< \brief current transaction during channel cycle */
 
+    CFE_SB_Buffer_t *out_pool[CF_OUTGOING_BUF_POOL_DEPTH]; /**< \brief pre-initialized outgoing PDU buffers */
+    uint8            out_pool_count;     /**< \brief number of buffers currently held in out_pool */
+    bool             out_pool_exhausted; /**< \brief latched once the pool empty event was sent */
+
+    uint32 sem_wait_left_ms; /**< \brief time left to block on the throttle sem this cycle, 0 - poll only */
+
+    const struct CF_CFDP_Transport *transport; /**< \brief PDU transport backend, selected at engine init */
+
+#if CF_ENABLE_UDP_TRANSPORT
+    osal_id_t     udp_sock; /**< \brief socket used by the UDP transport */
+    OS_SockAddr_t udp_peer; /**< \brief destination address used by the UDP transport */
+#endif
+#if CF_ENABLE_SHM_TRANSPORT
+    uint32 shm_rx_held; /**< \brief inbound ring slots handed to the engine by the last receive */
+#endif
+
     uint8 tick_type;
 } CF_Channel_t;
 
@@ -420,6 +748,7 @@ typedef struct CF_Output
     CFE_SB_Buffer_t       *msg;        /**< \brief Binary message to be sent to underlying transport */
     CF_EncoderState_t      encode;     /**< \brief Encoding state (while building message) */
     CF_Logical_PduBuffer_t tx_pdudata; /**< \brief Tx PDU logical values */
+    uint8                  chan_num;   /**< \brief Channel whose transport supplied msg */
 } CF_Output_t;
 
 /**
@@ -447,13 +776,39 @@ typedef struct CF_Engine
     CF_Input_t  in;
 
     /* NOTE: could have separate array of transactions as part of channel? */
-    CF_Transaction_t transactions[CF_NUM_TRANSACTIONS];
-    CF_History_t     histories[CF_NUM_HISTORIES];
-    CF_Channel_t     channels[CF_NUM_CHANNELS];
+    CF_Transaction_t     transactions[CF_NUM_TRANSACTIONS];
+    CF_History_t         histories[CF_NUM_TRANSACTIONS];        /**< \brief one per transaction while it is active */
+    CF_TransactionCold_t transaction_cold[CF_NUM_TRANSACTIONS]; /**< \brief the cold part of each transaction */
+    CF_Channel_t         channels[CF_NUM_CHANNELS];
 
     CF_ChunkWrapper_t chunks[CF_NUM_TRANSACTIONS * CF_Direction_NUM];
     CF_Chunk_t        chunk_mem[CF_NUM_CHUNKS_ALL_CHANNELS];
 
+    CF_PendingFile_t pending_files[CF_NUM_CHANNELS * CF_NUM_PENDING_FILES_PER_CHANNEL];
+    CF_TxGroup_t     tx_groups[CF_NUM_TX_GROUPS]; /**< \brief multi-destination sends, free when num_refs is 0 */
+    CF_NameEntry_t   path_prefix_mem[CF_NUM_PATH_PREFIXES];
+    CF_NameTable_t   path_prefixes; /**< \brief directories of pending files and playbacks */
+
+    CF_HistoryRecord_t history_records[CF_NUM_HISTORIES];
+    char               history_names[CF_NUM_CHANNELS][CF_HISTORY_NAMES_SIZE_PER_CHANNEL];
+    CF_NameEntry_t     history_prefix_mem[CF_NUM_HISTORY_PATH_PREFIXES];
+    CF_NameTable_t     history_prefixes; /**< \brief directories of history records, all channels */
+
+    /* parity of the class 1 sends that add parity PDUs, free unless in_use */
+    CF_FecEncoder_t fec_encoders[CF_NUM_FEC_ENCODERS];
+
+    /* storage for the transports that do not use SB buffers, only if they are built in */
+#if CF_ENABLE_SHM_TRANSPORT
+    CF_ShmRing_t shm_rings[CF_NUM_CHANNELS][CF_Direction_NUM];
+#endif
+#if CF_ENABLE_UDP_TRANSPORT
+    CF_EncapBuffer_t udp_tx_buf;
+    CF_EncapBuffer_t udp_rx_buf[CF_PDU_RX_BATCH_SIZE];
+#endif
+
+    /* copies of received PDUs held while a batch is being sorted */
+    CF_EncapBuffer_t rx_batch_buf[CF_PDU_RX_BATCH_SIZE];
+
     uint32 outgoing_counter;
     uint8  enabled;
 } CF_Engine_t;
@@ -0,0 +1,175 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * UDP transport for CF PDU transmit/recv.
+ */
+
+#include "cfe.h"
+#include "cf_verify.h"
+#include "cf_app.h"
+#include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_udpintf.h"
+
+#include <string.h>
+
+#if CF_ENABLE_UDP_TRANSPORT
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_udpintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_UDP_Open(CF_Channel_t *chan)
+{
+    const int                 chan_num = (chan - CF_AppData.engine.channels);
+    const CF_ChannelConfig_t *cc       = &CF_AppData.config_table->chan[chan_num];
+    char                      peer_addr[sizeof(cc->udp_peer_addr)];
+    OS_SockAddr_t             local_addr;
+    int32                     os_status;
+
+    /* the address from the table may not be NULL terminated */
+    strncpy(peer_addr, cc->udp_peer_addr, sizeof(peer_addr) - 1);
+    peer_addr[sizeof(peer_addr) - 1] = 0;
+
+    /* the peer is another CF instance, a ground system or a link simulator, on this host or another one */
+    OS_SocketAddrInit(&chan->udp_peer, OS_SocketDomain_INET);
+    os_status = OS_SocketAddrFromString(&chan->udp_peer, peer_addr);
+    if (os_status == OS_SUCCESS)
+    {
+        OS_SocketAddrSetPort(&chan->udp_peer, cc->udp_peer_port);
+        os_status = OS_SocketOpen(&chan->udp_sock, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    }
+
+    if (os_status == OS_SUCCESS)
+    {
+        /* receive on any local address, so a peer on another host can reach the channel */
+        OS_SocketAddrInit(&local_addr, OS_SocketDomain_INET);
+        OS_SocketAddrSetPort(&local_addr, cc->udp_local_port);
+
+        os_status = OS_SocketBind(chan->udp_sock, &local_addr);
+        if (os_status != OS_SUCCESS)
+        {
+            OS_close(chan->udp_sock);
+            chan->udp_sock = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+
+    return os_status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_udpintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_UDP_Close(CF_Channel_t *chan)
+{
+    if (OS_ObjectIdDefined(chan->udp_sock))
+    {
+        OS_close(chan->udp_sock);
+        chan->udp_sock = OS_OBJECT_ID_UNDEFINED;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_udpintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CF_CFDP_UDP_GetBuffer(CF_Channel_t *chan, bool silent)
+{
+    const int        chan_num = (chan - CF_AppData.engine.channels);
+    CFE_SB_Buffer_t *bufptr   = &CF_AppData.engine.udp_tx_buf.buf;
+
+    CFE_MSG_Init(&bufptr->Msg, CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[chan_num].mid_output),
+                 offsetof(CF_PduTlmMsg_t, ph));
+
+    return bufptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_udpintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_UDP_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    const int      chan_num = (chan - CF_AppData.engine.channels);
+    CFE_MSG_Size_t msg_size = 0;
+    int32          os_status;
+
+    CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
+    os_status = OS_SocketSendTo(chan->udp_sock, bufptr, msg_size, &chan->udp_peer);
+
+    /* the PDU is gone either way, a datagram is never sent in part so anything short is a failure */
+    if (os_status < 0 || (CFE_MSG_Size_t)os_status != msg_size)
+    {
+        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.fault.transport_send;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_udpintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CF_CFDP_UDP_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    OS_SockAddr_t     src_addr;
+    CF_EncapBuffer_t *rx_buf;
+    uint32            count = 0;
+    uint32            tries;
+    int32             os_status;
+
+    if (max_count > CF_PDU_RX_BATCH_SIZE)
+    {
+        max_count = CF_PDU_RX_BATCH_SIZE;
+    }
+
+    for (tries = 0; tries < max_count; ++tries)
+    {
+        rx_buf    = &CF_AppData.engine.udp_rx_buf[count];
+        os_status = OS_SocketRecvFrom(chan->udp_sock, rx_buf->bytes, sizeof(rx_buf->bytes), &src_addr, OS_CHECK);
+        if (os_status <= 0)
+        {
+            break; /* nothing pending */
+        }
+
+        /* a datagram that cannot even hold the header is dropped, keep the buffer for the next one.
+         * Otherwise the datagram length is what was actually received, so it overrides the header. */
+        if ((size_t)os_status >= sizeof(CFE_MSG_CommandHeader_t))
+        {
+            CFE_MSG_SetSize(&rx_buf->buf.Msg, os_status);
+            bufs[count] = &rx_buf->buf;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+#endif /* CF_ENABLE_UDP_TRANSPORT */
@@ -0,0 +1,110 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * UDP transport for CF PDU transmit/recv.
+ *
+ * Each channel using this transport binds a datagram socket and exchanges one
+ * encapsulated PDU per datagram with a peer, e.g. a link simulator or a ground
+ * software instance.  The local port and the peer address and port come from
+ * the channel configuration.
+ */
+
+#ifndef CF_CFDP_UDPINTF_H
+#define CF_CFDP_UDPINTF_H
+
+#include "cf_cfdp_types.h"
+
+/************************************************************************/
+/** @brief Open and bind the channel socket.
+ *
+ * This is the Open operation of the UDP transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to open the transport on
+ *
+ * @returns CFE_SUCCESS on success
+ * @retval  Error status from OSAL if the socket could not be opened or bound
+ */
+CFE_Status_t CF_CFDP_UDP_Open(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Close the channel socket.
+ *
+ * This is the Close operation of the UDP transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to close the transport on
+ */
+void CF_CFDP_UDP_Close(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Get the outgoing PDU buffer.
+ *
+ * This is the GetBuffer operation of the UDP transport.  The datagram is
+ * built in a single buffer within the engine, since only one outgoing PDU
+ * is under construction at any time.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to get the buffer for
+ * @param silent     Unused, this transport does not send events
+ *
+ * @returns Pointer to the buffer with the header initialized
+ */
+CFE_SB_Buffer_t *CF_CFDP_UDP_GetBuffer(CF_Channel_t *chan, bool silent);
+
+/************************************************************************/
+/** @brief Send an outgoing PDU buffer as a datagram to the channel peer.
+ *
+ * This is the Transmit operation of the UDP transport.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel the buffer was obtained for
+ * @param bufptr     Buffer from CF_CFDP_UDP_GetBuffer()
+ */
+void CF_CFDP_UDP_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr);
+
+/************************************************************************/
+/** @brief Receive a batch of pending datagrams from the channel socket.
+ *
+ * This is the ReceiveBatch operation of the UDP transport.  Datagrams too
+ * short to hold a message header are discarded.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object
+ *
+ * @param chan       Channel to receive on
+ * @param bufs       Output array of received buffers
+ * @param max_count  Size of the bufs array
+ *
+ * @returns Number of buffers received
+ */
+uint32 CF_CFDP_UDP_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count);
+
+#endif /* !CF_CFDP_UDPINTF_H */
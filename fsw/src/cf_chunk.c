@@ -327,6 +327,45 @@ const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks)
     return chunks->count ? &chunks->chunks[0] : NULL;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ChunkOffset_t CF_ChunkList_GetEnd(const CF_ChunkList_t *chunks)
+{
+    const CF_Chunk_t *last;
+    CF_ChunkOffset_t  end = 0;
+
+    if (chunks->count)
+    {
+        last = &chunks->chunks[chunks->count - 1];
+        end  = last->offset + last->size;
+    }
+
+    return end;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ChunkSize_t CF_ChunkList_TotalSize(const CF_ChunkList_t *chunks)
+{
+    CF_ChunkIdx_t  i;
+    CF_ChunkSize_t total = 0;
+
+    for (i = 0; i < chunks->count; ++i)
+    {
+        total += chunks->chunks[i].size;
+    }
+
+    return total;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -29,8 +29,8 @@
 #include "cfe.h"
 
 typedef uint32 CF_ChunkIdx_t;
-typedef uint32 CF_ChunkOffset_t;
-typedef uint32 CF_ChunkSize_t;
+typedef uint64 CF_ChunkOffset_t; /* same as CF_FileSize_t, so large files can be tracked */
+typedef uint64 CF_ChunkSize_t;
 
 /**
  * @brief Pairs an offset with a size to identify a specific piece of a file
@@ -156,6 +156,27 @@ void CF_ChunkList_RemoveFromFirst(CF_ChunkList_t *chunks, CF_ChunkSize_t size);
  */
 const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks);
 
+/************************************************************************/
+/** @brief Public function to get the end offset of the last chunk in the list
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL.
+ *
+ * @returns Offset just past the last chunk
+ * @retval  0 if the list was empty
+ */
+CF_ChunkOffset_t CF_ChunkList_GetEnd(const CF_ChunkList_t *chunks);
+
+/************************************************************************/
+/** @brief Public function to get the sum of the sizes of all chunks in the list
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL.
+ *
+ * @returns Total number of bytes covered by the chunks
+ */
+CF_ChunkSize_t CF_ChunkList_TotalSize(const CF_ChunkList_t *chunks);
+
 /************************************************************************/
 /** @brief Compute gaps between chunks, and call a callback for each.
  *
@@ -188,34 +188,15 @@ void CF_CList_InsertAfter(CF_CListNode_t **head, CF_CListNode_t *start, CF_CList
  *-----------------------------------------------------------------*/
 void CF_CList_Traverse(CF_CListNode_t *start, CF_CListFn_t fn, void *context)
 {
-    CF_CListNode_t *node = start;
-    CF_CListNode_t *node_next;
-    int             last = 0;
+    CF_CListIter_t  iter;
+    CF_CListNode_t *node;
 
-    if (node)
+    CF_CLIST_FOREACH(iter, node, start)
     {
-        do
+        if (!CF_CListTraverse_Status_IS_CONTINUE(fn(node, context)))
         {
-            /* set node_next in case callback removes this node from the list */
-            node_next = node->next;
-            if (node_next == start)
-            {
-                last = 1;
-            }
-            if (!CF_CListTraverse_Status_IS_CONTINUE(fn(node, context)))
-            {
-                break;
-            }
-            /* list traversal is robust against an item deleting itself during traversal,
-             * but there is a special case if that item is the starting node. Since this is
-             * a circular list, start is remembered so we know when to stop. Must set start
-             * to the next node in this case. */
-            if ((start == node) && (node->next != node_next))
-            {
-                start = node_next;
-            }
-            node = node_next;
-        } while (!last);
+            break;
+        }
     }
 }
 
@@ -227,40 +208,14 @@ void CF_CList_Traverse(CF_CListNode_t *start, CF_CListFn_t fn, void *context)
  *-----------------------------------------------------------------*/
 void CF_CList_Traverse_R(CF_CListNode_t *end, CF_CListFn_t fn, void *context)
 {
-    if (end)
-    {
-        CF_CListNode_t *node = end->prev;
-        CF_CListNode_t *node_next;
-        int             last = 0;
+    CF_CListIter_t  iter;
+    CF_CListNode_t *node;
 
-        if (node)
+    CF_CLIST_FOREACH_R(iter, node, end)
+    {
+        if (!CF_CListTraverse_Status_IS_CONTINUE(fn(node, context)))
         {
-            end = node;
-
-            do
-            {
-                /* set node_next in case callback removes this node from the list */
-                node_next = node->prev;
-                if (node_next == end)
-                {
-                    last = 1;
-                }
-
-                if (!CF_CListTraverse_Status_IS_CONTINUE(fn(node, context)))
-                {
-                    break;
-                }
-
-                /* list traversal is robust against an item deleting itself during traversal,
-                 * but there is a special case if that item is the starting node. Since this is
-                 * a circular list, "end" is remembered so we know when to stop. Must set "end"
-                 * to the next node in this case. */
-                if ((end == node) && (node->prev != node_next))
-                {
-                    end = node_next;
-                }
-                node = node_next;
-            } while (!last);
+            break;
         }
     }
 }
@@ -68,6 +68,103 @@ typedef struct CF_CListNode CF_CListNode_t;
  */
 #define container_of(ptr, type, member) ((type *)((char *)(ptr) - (char *)offsetof(type, member)))
 
+/**
+ * @brief State of an inline walk over a list
+ *
+ * Visits the same nodes in the same order as CF_CList_Traverse() or
+ * CF_CList_Traverse_R(), but the caller writes the loop body, so there is
+ * no callback or opaque context.  As with those, the body may remove the
+ * current node from the list, but no other node.
+ */
+typedef struct CF_CListIter
+{
+    CF_CListNode_t *stop;    /**< \brief the walk ends when it gets back to this node */
+    CF_CListNode_t *node;    /**< \brief current node, NULL once the walk is done */
+    CF_CListNode_t *next;    /**< \brief node after the current one, read before the body runs */
+    bool            reverse; /**< \brief walk by prev instead of next */
+    bool            last;    /**< \brief the current node is the last one of the walk */
+} CF_CListIter_t;
+
+/**
+ * @brief Walks every node of a list starting from start, see CF_CList_Traverse()
+ *
+ * @param iter  CF_CListIter_t object holding the walk state
+ * @param node  CF_CListNode_t pointer set to each node in turn
+ * @param start List to walk (first node), may be NULL
+ */
+#define CF_CLIST_FOREACH(iter, node, start) \
+    for ((node) = CF_CListIter_Begin(&(iter), (start)); (node) != NULL; (node) = CF_CListIter_Next(&(iter)))
+
+/**
+ * @brief Walks every node of a list backwards starting from end->prev, see CF_CList_Traverse_R()
+ *
+ * @param iter  CF_CListIter_t object holding the walk state
+ * @param node  CF_CListNode_t pointer set to each node in turn
+ * @param end   List to walk (first node), may be NULL
+ */
+#define CF_CLIST_FOREACH_R(iter, node, end) \
+    for ((node) = CF_CListIter_Begin_R(&(iter), (end)); (node) != NULL; (node) = CF_CListIter_Next(&(iter)))
+
+/**
+ * @brief Makes node the current node of the walk, and reads the one after it
+ */
+static inline CF_CListNode_t *CF_CListIter_Load(CF_CListIter_t *iter, CF_CListNode_t *node)
+{
+    iter->node = node;
+    if (node)
+    {
+        iter->next = iter->reverse ? node->prev : node->next;
+        iter->last = (iter->next == iter->stop);
+    }
+
+    return node;
+}
+
+/**
+ * @brief Starts a forward walk, returns the first node or NULL if the list is empty
+ */
+static inline CF_CListNode_t *CF_CListIter_Begin(CF_CListIter_t *iter, CF_CListNode_t *start)
+{
+    iter->stop    = start;
+    iter->reverse = false;
+
+    return CF_CListIter_Load(iter, start);
+}
+
+/**
+ * @brief Starts a reverse walk, returns the last node or NULL if the list is empty
+ */
+static inline CF_CListNode_t *CF_CListIter_Begin_R(CF_CListIter_t *iter, CF_CListNode_t *end)
+{
+    iter->stop    = end ? end->prev : NULL;
+    iter->reverse = true;
+
+    return CF_CListIter_Load(iter, iter->stop);
+}
+
+/**
+ * @brief Moves the walk on, returns the next node or NULL when the walk is done
+ */
+static inline CF_CListNode_t *CF_CListIter_Next(CF_CListIter_t *iter)
+{
+    CF_CListNode_t *node = iter->node;
+    CF_CListNode_t *next = NULL;
+
+    if (!iter->last)
+    {
+        /* the walk is robust against a node removing itself, but if that is the node the walk
+         * stops at, this circular list now ends at the node after it */
+        if ((iter->stop == node) && ((iter->reverse ? node->prev : node->next) != iter->next))
+        {
+            iter->stop = iter->next;
+        }
+
+        next = iter->next;
+    }
+
+    return CF_CListIter_Load(iter, next);
+}
+
 /**
  * @brief Callback function type for use with CF_CList_Traverse()
  *
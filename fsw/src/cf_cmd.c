@@ -36,6 +36,8 @@
 
 #include "cf_cfdp.h"
 #include "cf_cmd.h"
+#include "cf_history.h"
+#include "cf_perf.h"
 
 #include <string.h>
 
@@ -174,6 +176,52 @@ CFE_Status_t CF_TxFileCmd(const CF_TxFileCmd_t *msg)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_TxFileMultiCmd(const CF_TxFileMultiCmd_t *msg)
+{
+    const CF_TxFileMulti_Payload_t *tx = &msg->Payload;
+
+    /*
+     * This needs to validate all its inputs.
+     * "keep" should only be 0 or 1 (logical true/false).
+     * At least one destination must be given, and no more than the list holds.
+     * For priority and dest_ids params, anything is acceptable.
+     */
+    if ((tx->cfdp_class != CF_CFDP_CLASS_1 && tx->cfdp_class != CF_CFDP_CLASS_2) || tx->chan_num >= CF_NUM_CHANNELS ||
+        (int)tx->keep > 1 || tx->num_dest == 0 || tx->num_dest > CF_TX_GROUP_MAX_DEST)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_BAD_PARAM, CFE_EVS_EventType_ERROR,
+                          "CF: bad parameter in CF_TxFileMultiCmd(): chan=%u, class=%u keep=%u num_dest=%u",
+                          (unsigned int)tx->chan_num, (unsigned int)tx->cfdp_class, (unsigned int)tx->keep,
+                          (unsigned int)tx->num_dest);
+        ++CF_AppData.hk.Payload.counters.err;
+
+        /* This must return CFE_SUCCESS because the command is done (error counter was incremented, no more events) */
+        return CFE_SUCCESS;
+    }
+
+    if (CF_CFDP_TxFileMulti(tx->src_filename, tx->dst_filename, tx->cfdp_class, tx->keep, tx->chan_num, tx->priority,
+                            tx->dest_ids, tx->num_dest) == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CF_EID_INF_CMD_TX_FILE_MULTI, CFE_EVS_EventType_INFORMATION,
+                          "CF: file transfer to %u destinations successfully initiated", (unsigned int)tx->num_dest);
+        ++CF_AppData.hk.Payload.counters.cmd;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_TX_FILE_MULTI, CFE_EVS_EventType_ERROR,
+                          "CF: multi-destination file transfer initiation failed");
+        ++CF_AppData.hk.Payload.counters.err;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -182,19 +230,22 @@ CFE_Status_t CF_TxFileCmd(const CF_TxFileCmd_t *msg)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_PlaybackDirCmd(const CF_PlaybackDirCmd_t *msg)
 {
-    const CF_TxFile_Payload_t *tx = &msg->Payload;
+    const CF_PlaybackDir_Payload_t *tx = &msg->Payload;
 
     /*
      * This needs to validate all its inputs.
      * "keep" should only be 0 or 1 (logical true/false).
      * For priority and dest_id params, anything is acceptable.
+     * The limits may be 0 to use the defaults, but cannot be more than the channel can hold.
      */
     if ((tx->cfdp_class != CF_CFDP_CLASS_1 && tx->cfdp_class != CF_CFDP_CLASS_2) || tx->chan_num >= CF_NUM_CHANNELS ||
-        (int)tx->keep > 1)
+        (int)tx->keep > 1 || tx->max_active > CF_NUM_TRANSACTIONS_PER_CHANNEL ||
+        tx->max_pending > CF_NUM_PENDING_FILES_PER_CHANNEL)
     {
         CFE_EVS_SendEvent(CF_EID_ERR_CMD_BAD_PARAM, CFE_EVS_EventType_ERROR,
-                          "CF: bad parameter in CF_PlaybackDirCmd(): chan=%u, class=%u keep=%u",
-                          (unsigned int)tx->chan_num, (unsigned int)tx->cfdp_class, (unsigned int)tx->keep);
+                          "CF: bad parameter in CF_PlaybackDirCmd(): chan=%u, class=%u keep=%u active=%u pending=%u",
+                          (unsigned int)tx->chan_num, (unsigned int)tx->cfdp_class, (unsigned int)tx->keep,
+                          (unsigned int)tx->max_active, (unsigned int)tx->max_pending);
         ++CF_AppData.hk.Payload.counters.err;
 
         /* This must return CFE_SUCCESS because the command is done (error counter was incremented, no more events) */
@@ -208,7 +259,7 @@ CFE_Status_t CF_PlaybackDirCmd(const CF_PlaybackDirCmd_t *msg)
 #endif
 
     if (CF_CFDP_PlaybackDir(tx->src_filename, tx->dst_filename, tx->cfdp_class, tx->keep, tx->chan_num, tx->priority,
-                            tx->dest_id) == CFE_SUCCESS)
+                            tx->dest_id, tx->max_active, tx->max_pending) == CFE_SUCCESS)
     {
         CFE_EVS_SendEvent(CF_EID_INF_CMD_PLAYBACK_DIR, CFE_EVS_EventType_INFORMATION,
                           "CF: directory playback initiation successful");
@@ -224,6 +275,48 @@ CFE_Status_t CF_PlaybackDirCmd(const CF_PlaybackDirCmd_t *msg)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_TxManifestCmd(const CF_TxManifestCmd_t *msg)
+{
+    const CF_TxManifest_Payload_t *tx = &msg->Payload;
+
+    /*
+     * This needs to validate all its inputs.
+     * "keep" should only be 0 or 1 (logical true/false).
+     * The per-file parameters come from the manifest records, and are checked as they are read.
+     */
+    if (tx->chan_num >= CF_NUM_CHANNELS || (int)tx->keep > 1)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_BAD_PARAM, CFE_EVS_EventType_ERROR,
+                          "CF: bad parameter in CF_TxManifestCmd(): chan=%u, keep=%u", (unsigned int)tx->chan_num,
+                          (unsigned int)tx->keep);
+        ++CF_AppData.hk.Payload.counters.err;
+
+        /* This must return CFE_SUCCESS because the command is done (error counter was incremented, no more events) */
+        return CFE_SUCCESS;
+    }
+
+    if (CF_CFDP_TxManifest(tx->filename, tx->keep, tx->chan_num) == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CF_EID_INF_CMD_TX_MANIFEST, CFE_EVS_EventType_INFORMATION,
+                          "CF: manifest transfer initiation successful");
+        ++CF_AppData.hk.Payload.counters.cmd;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_TX_MANIFEST, CFE_EVS_EventType_ERROR,
+                          "CF: manifest transfer initiation failed");
+        ++CF_AppData.hk.Payload.counters.err;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -357,10 +450,12 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumberAllChannels(CF_TransactionSe
  *
  *-----------------------------------------------------------------*/
 int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr, CF_TsnChanAction_fn_t fn,
-                       void *context)
+                       CF_TsnChanPendingAction_fn_t pf_fn, void *context)
 {
     CF_Transaction_t *txn;
+    CF_PendingFile_t *pf;
     int32             ret = -1;
+    int               i;
 
     if (data->chan == CF_COMPOUND_KEY)
     {
@@ -372,7 +467,22 @@ int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr,
             fn(txn, context);
             ret = 1; /* because one transaction was matched - this should return a count */
         }
-        else
+        else if (data->eid == CF_AppData.config_table->local_eid)
+        {
+            /* a file that has not started yet is only on a pending queue, and is always sent by this entity */
+            for (i = 0; i < CF_NUM_CHANNELS; ++i)
+            {
+                pf = CF_FindPendingFileBySequenceNumber(CF_AppData.engine.channels + i, data->ts);
+                if (pf)
+                {
+                    pf_fn(CF_AppData.engine.channels + i, pf, context);
+                    ret = 1;
+                    break;
+                }
+            }
+        }
+
+        if (ret < 0)
         {
             CFE_EVS_SendEvent(CF_EID_ERR_CMD_TRANS_NOT_FOUND, CFE_EVS_EventType_ERROR,
                               "CF: %s cmd: failed to find transaction for (eid %lu, ts %lu)", cmdstr,
@@ -381,13 +491,18 @@ int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr,
     }
     else if (data->chan == CF_ALL_CHANNELS)
     {
-        /* perform action on all channels, all transactions */
+        /* perform action on all channels, all transactions and pending files */
         ret = CF_TraverseAllTransactions_All_Channels(fn, context);
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            ret += CF_TraversePendingFiles(CF_AppData.engine.channels + i, pf_fn, context);
+        }
     }
     else if (data->chan < CF_NUM_CHANNELS)
     {
-        /* perform action on a specific channel, all transactions */
+        /* perform action on a specific channel, all transactions and pending files */
         ret = CF_TraverseAllTransactions(CF_AppData.engine.channels + data->chan, fn, context);
+        ret += CF_TraversePendingFiles(CF_AppData.engine.channels + data->chan, pf_fn, context);
     }
     else
     {
@@ -417,6 +532,32 @@ void CF_DoSuspRes_Txn(CF_Transaction_t *txn, CF_ChanAction_SuspResArg_t *context
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_DoSuspRes_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, CF_ChanAction_SuspResArg_t *context)
+{
+    CF_Assert(pf);
+    if (pf->suspended == context->action)
+    {
+        context->same = 1;
+    }
+    else if (context->action)
+    {
+        /* a suspended file is off its source list so it does not hide the ones behind it */
+        CF_UnlinkPendingFileSource(chan, pf);
+        pf->suspended = true;
+    }
+    else
+    {
+        pf->suspended = false;
+        CF_LinkPendingFileSource(chan, pf);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -428,7 +569,8 @@ void CF_DoSuspRes(const CF_Transaction_Payload_t *payload, uint8 action)
     /* ok to not bounds check action, because the caller is using it in two places with constant values 0 or 1 */
     static const char *        msgstr[] = {"resume", "suspend"};
     CF_ChanAction_SuspResArg_t args     = {0, action};
-    int ret = CF_TsnChanAction(payload, msgstr[action], (CF_TsnChanAction_fn_t)CF_DoSuspRes_Txn, &args);
+    int ret = CF_TsnChanAction(payload, msgstr[action], (CF_TsnChanAction_fn_t)CF_DoSuspRes_Txn,
+                               (CF_TsnChanPendingAction_fn_t)CF_DoSuspRes_Pending, &args);
 
     /*
      * Note that this command may affect multiple transactions, depending on the value of the "chan" argument.
@@ -493,6 +635,17 @@ void CF_CmdCancel_Txn(CF_Transaction_t *txn, void *ignored)
     CF_CFDP_CancelTransaction(txn);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CmdDrop_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, void *ignored)
+{
+    CF_CFDP_DropPendingFile(chan, pf);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -501,7 +654,7 @@ void CF_CmdCancel_Txn(CF_Transaction_t *txn, void *ignored)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_CancelCmd(const CF_CancelCmd_t *msg)
 {
-    if (CF_TsnChanAction(&msg->Payload, "cancel", CF_CmdCancel_Txn, NULL) > 0)
+    if (CF_TsnChanAction(&msg->Payload, "cancel", CF_CmdCancel_Txn, CF_CmdDrop_Pending, NULL) > 0)
     {
         CFE_EVS_SendEvent(CF_EID_INF_CMD_CANCEL, CFE_EVS_EventType_INFORMATION,
                           "CF: cancel transaction successfully initiated");
@@ -536,7 +689,7 @@ void CF_CmdAbandon_Txn(CF_Transaction_t *txn, void *ignored)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_AbandonCmd(const CF_AbandonCmd_t *msg)
 {
-    if (CF_TsnChanAction(&msg->Payload, "abandon", CF_CmdAbandon_Txn, NULL) > 0)
+    if (CF_TsnChanAction(&msg->Payload, "abandon", CF_CmdAbandon_Txn, CF_CmdDrop_Pending, NULL) > 0)
     {
         CFE_EVS_SendEvent(CF_EID_INF_CMD_ABANDON, CFE_EVS_EventType_INFORMATION, "CF: abandon successful");
         ++CF_AppData.hk.Payload.counters.cmd;
@@ -703,33 +856,6 @@ CFE_Status_t CF_DisableDirPollingCmd(const CF_DisableDirPollingCmd_t *msg)
     return CFE_SUCCESS;
 }
 
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in cf_cmd.h for argument/return detail
- *
- *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_PurgeHistory(CF_CListNode_t *node, void *arg)
-{
-    CF_Channel_t *chan    = arg;
-    CF_History_t *history = container_of(node, CF_History_t, cl_node);
-    CF_ResetHistory(chan, history); /* ok to reset transaction since it's in PEND it hasn't started yet */
-    return CF_CLIST_CONT;
-}
-
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in cf_cmd.h for argument/return detail
- *
- *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_PurgeTransaction(CF_CListNode_t *node, void *ignored)
-{
-    CF_Transaction_t *txn = container_of(node, CF_Transaction_t, cl_node);
-    CF_CFDP_ResetTransaction(txn, 0);
-    return CF_CLIST_CONT;
-}
-
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -770,12 +896,12 @@ CF_ChanAction_Status_t CF_DoPurgeQueue(uint8 chan_num, void *arg)
 
     if (pend)
     {
-        CF_CList_Traverse(chan->qs[CF_QueueIdx_PEND], CF_PurgeTransaction, NULL);
+        CF_TraversePendingFiles(chan, CF_CmdDrop_Pending, NULL);
     }
 
     if (hist)
     {
-        CF_CList_Traverse(chan->qs[CF_QueueIdx_HIST], CF_PurgeHistory, chan);
+        CF_HistoryRing_Clear(&chan->history);
     }
 
     return ret;
@@ -814,10 +940,12 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
 {
     const CF_WriteQueue_Payload_t *wq = &msg->Payload;
 
-    CF_Channel_t *chan    = &CF_AppData.engine.channels[wq->chan];
-    osal_id_t     fd      = OS_OBJECT_ID_UNDEFINED;
-    bool          success = true;
-    int32         ret;
+    CF_Channel_t *  chan    = &CF_AppData.engine.channels[wq->chan];
+    CF_QueueDump_t *dump    = &CF_AppData.queue_dump;
+    osal_id_t       fd      = OS_OBJECT_ID_UNDEFINED;
+    bool            success = true;
+    int32           ret;
+    uint32          stamp;
 
     /* check the commands for validity */
     if (wq->chan >= CF_NUM_CHANNELS)
@@ -826,18 +954,24 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
         ++CF_AppData.hk.Payload.counters.err;
         success = false;
     }
-    /* only invalid combination is up direction, pending queue */
-    else if ((wq->type == CF_Type_up) && (wq->queue == CF_Queue_pend))
+    /* there is no up direction pending queue, and the file format must be known */
+    else if (((wq->type == CF_Type_up) && (wq->queue == CF_Queue_pend)) || (wq->format > CF_QueueFileFormat_binary))
     {
         CFE_EVS_SendEvent(CF_EID_ERR_CMD_WQ_ARGS, CFE_EVS_EventType_ERROR,
                           "CF: write queue invalid command parameters");
         ++CF_AppData.hk.Payload.counters.err;
         success = false;
     }
+    else if ((wq->format == CF_QueueFileFormat_binary) && dump->busy)
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_WQ_BUSY, CFE_EVS_EventType_ERROR,
+                          "CF: write queue binary file already in progress");
+        ++CF_AppData.hk.Payload.counters.err;
+        success = false;
+    }
     else
     {
-        /* PTFO: queues can be large. may want to split this work up across the state machine and take several wakeups
-         * to complete */
+        /* the text format is written here, queues can be large so the binary format takes several wakeups */
         ret = CF_WrappedOpenCreate(&fd, wq->filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
         if (ret < 0)
         {
@@ -848,8 +982,34 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
         }
     }
 
+    if (success && (wq->format == CF_QueueFileFormat_binary))
+    {
+        /* a new stamp, so entries an earlier file wrote do not look written, and 0 is that of a fresh entry */
+        stamp = dump->stamp + 1;
+        memset(dump, 0, sizeof(*dump));
+        dump->fd    = fd;
+        dump->stamp = (stamp != 0) ? stamp : 1;
+        dump->chan  = wq->chan;
+        dump->type  = wq->type;
+        dump->queue = wq->queue;
+        dump->stage = CF_QueueDumpStage_RX;
+
+        /* the record count is filled in once the last entry is written */
+        ret = CF_WriteQueueFileHeader(fd, dump);
+        if (ret)
+        {
+            CF_WrappedClose(fd);
+            ++CF_AppData.hk.Payload.counters.err;
+            success = false;
+        }
+        else
+        {
+            dump->busy = true;
+        }
+    }
+
     /* if type is type_up, or all types */
-    if (success && ((wq->type == CF_Type_all) || (wq->type == CF_Type_up)))
+    if (success && (wq->format == CF_QueueFileFormat_text) && ((wq->type == CF_Type_all) || (wq->type == CF_Type_up)))
     {
         /* process uplink queue data */
         if ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active))
@@ -880,7 +1040,8 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
     }
 
     /* if type is type_down, or all types */
-    if (success && ((wq->type == CF_Type_all) || (wq->type == CF_Type_down)))
+    if (success && (wq->format == CF_QueueFileFormat_text) &&
+        ((wq->type == CF_Type_all) || (wq->type == CF_Type_down)))
     {
         /* process downlink queue data */
         if ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active))
@@ -905,7 +1066,7 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
         if (success && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_pend)))
         {
             /* write pending queue */
-            ret = CF_WriteTxnQueueDataToFile(fd, chan, CF_QueueIdx_PEND);
+            ret = CF_WritePendingQueueDataToFile(fd, chan);
             if (ret)
             {
                 CFE_EVS_SendEvent(CF_EID_ERR_CMD_WQ_WRITEQ_PEND, CFE_EVS_EventType_ERROR,
@@ -933,7 +1094,8 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
 
     if (success)
     {
-        CFE_EVS_SendEvent(CF_EID_INF_CMD_WQ, CFE_EVS_EventType_INFORMATION, "CF: write queue successful");
+        CFE_EVS_SendEvent(CF_EID_INF_CMD_WQ, CFE_EVS_EventType_INFORMATION, "CF: write queue %s",
+                          (wq->format == CF_QueueFileFormat_binary) ? "started" : "successful");
         ++CF_AppData.hk.Payload.counters.cmd;
     }
 
@@ -946,7 +1108,7 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
  * See description in cf_cmd.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_ChanAction_Status_t CF_CmdValidateChunkSize(CF_ChunkSize_t val, uint8 chan_num /* ignored */)
+CF_ChanAction_Status_t CF_CmdValidateChunkSize(uint32 val, uint8 chan_num /* ignored */)
 {
     CF_ChanAction_Status_t ret = CF_ChanAction_Status_SUCCESS;
     if (val > sizeof(CF_CFDP_PduFileDataContent_t))
@@ -1216,6 +1378,42 @@ CFE_Status_t CF_DisableEngineCmd(const CF_DisableEngineCmd_t *msg)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_EnablePerfStatsCmd(const CF_EnablePerfStatsCmd_t *msg)
+{
+    /* a fresh start each time, so the statistics cover a known window */
+    CF_Perf_Reset();
+    CF_AppData.perf.enabled = true;
+
+    CFE_EVS_SendEvent(CF_EID_INF_CMD_ENABLE_PERF_STATS, CFE_EVS_EventType_INFORMATION,
+                      "CF: enabled performance statistics");
+    ++CF_AppData.hk.Payload.counters.cmd;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cmd.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_DisablePerfStatsCmd(const CF_DisablePerfStatsCmd_t *msg)
+{
+    CF_AppData.perf.enabled = false;
+
+    CFE_EVS_SendEvent(CF_EID_INF_CMD_DISABLE_PERF_STATS, CFE_EVS_EventType_INFORMATION,
+                      "CF: disabled performance statistics");
+    ++CF_AppData.hk.Payload.counters.cmd;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1224,9 +1422,24 @@ CFE_Status_t CF_DisableEngineCmd(const CF_DisableEngineCmd_t *msg)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_SendHkCmd(const CF_SendHkCmd_t *msg)
 {
+    CF_HistoryRing_t *ring;
+    int               i;
+
+    /* the history rings are not lists, so their sizes are filled in here */
+    for (i = 0; i < CF_NUM_CHANNELS; ++i)
+    {
+        ring = &CF_AppData.engine.channels[i].history;
+
+        CF_AppData.hk.Payload.channel_hk[i].q_size[CF_QueueIdx_HIST]      = ring->count;
+        CF_AppData.hk.Payload.channel_hk[i].q_size[CF_QueueIdx_HIST_FREE] = ring->num_records - ring->count;
+    }
+
     CFE_MSG_SetMsgTime(CFE_MSG_PTR(CF_AppData.hk.TelemetryHeader), CFE_TIME_GetTime());
     /* return value ignored */ CFE_SB_TransmitMsg(CFE_MSG_PTR(CF_AppData.hk.TelemetryHeader), true);
 
+    CF_CFDP_SendTxnTlm();
+    CF_Perf_SendTlm();
+
     /* This is also used to check tables */
     CF_CheckTables();
 
@@ -1241,9 +1454,13 @@ CFE_Status_t CF_SendHkCmd(const CF_SendHkCmd_t *msg)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_WakeupCmd(const CF_WakeupCmd_t *msg)
 {
-    CFE_ES_PerfLogEntry(CF_PERF_ID_CYCLE_ENG);
+    CF_PerfMark_t mark;
+
+    CF_Perf_Begin(&mark, CF_PerfPhase_CYCLE);
     CF_CFDP_CycleEngine();
-    CFE_ES_PerfLogExit(CF_PERF_ID_CYCLE_ENG);
+    CF_Perf_End(&mark);
+
+    CF_ProcessQueueDump();
 
     return CFE_SUCCESS;
 }
@@ -67,6 +67,13 @@ typedef struct CF_ChanAction_BoolArg
  */
 typedef CF_TraverseAllTransactions_fn_t CF_TsnChanAction_fn_t;
 
+/**
+ * @brief A callback to use with transaction actions on files that have not started yet
+ *
+ * For now this is the same as CF_TraversePendingFiles_fn_t
+ */
+typedef CF_TraversePendingFiles_fn_t CF_TsnChanPendingAction_fn_t;
+
 /**
  * @brief An object to use with channel-scope actions for suspend/resume
  *
@@ -173,6 +180,20 @@ CFE_Status_t CF_ResetCmd(const CF_ResetCmd_t *msg);
  */
 CFE_Status_t CF_TxFileCmd(const CF_TxFileCmd_t *msg);
 
+/************************************************************************/
+/** @brief Ground command to start sending a file to several destinations.
+ *
+ * @par Description
+ *       This function has a signature the same of all cmd_ functions.
+ *       Increments the command accept or reject counter.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       msg must not be NULL.
+ *
+ * @param msg   Pointer to command message
+ */
+CFE_Status_t CF_TxFileMultiCmd(const CF_TxFileMultiCmd_t *msg);
+
 /************************************************************************/
 /** @brief Ground command to start directory playback.
  *
@@ -187,6 +208,20 @@ CFE_Status_t CF_TxFileCmd(const CF_TxFileCmd_t *msg);
  */
 CFE_Status_t CF_PlaybackDirCmd(const CF_PlaybackDirCmd_t *msg);
 
+/************************************************************************/
+/** @brief Ground command to start transmitting the files listed in a manifest.
+ *
+ * @par Description
+ *       This function has a signature the same of all cmd_ functions.
+ *       Increments the command accept or reject counter.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       msg must not be NULL.
+ *
+ * @param msg   Pointer to command message
+ */
+CFE_Status_t CF_TxManifestCmd(const CF_TxManifestCmd_t *msg);
+
 /************************************************************************/
 /** @brief Common logic for all channel-based commands.
  *
@@ -267,18 +302,21 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumberAllChannels(CF_TransactionSe
  *       does handle the command accept or reject counters.
  *
  * @par Assumptions, External Events, and Notes:
- *       cmd must not be NULL, fn must be a valid function, context may be NULL.
+ *       cmd must not be NULL, fn and pf_fn must be valid functions, context may be NULL.
+ *       Files on the pending queue do not have a transaction yet, so pf_fn is
+ *       called for those instead of fn.
  *
  * @param data      Pointer to payload being processed
  * @param cmdstr    String to include in any generated EVS events
  * @param fn        Callback function to invoke for each matched transaction
- * @param context   Opaque object to pass through to the callback
+ * @param pf_fn     Callback function to invoke for each matched pending file
+ * @param context   Opaque object to pass through to the callbacks
  *
- * @returns returns the number of transactions acted upon
+ * @returns returns the number of transactions and pending files acted upon
  *
  */
 int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr, CF_TsnChanAction_fn_t fn,
-                       void *context);
+                       CF_TsnChanPendingAction_fn_t pf_fn, void *context);
 
 /************************************************************************/
 /** @brief Set the suspended bit in a transaction.
@@ -291,6 +329,20 @@ int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr,
  */
 void CF_DoSuspRes_Txn(CF_Transaction_t *txn, CF_ChanAction_SuspResArg_t *context);
 
+/************************************************************************/
+/** @brief Set the suspended flag in a pending file.
+ *
+ * A suspended pending file is not started until it is resumed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       pf must not be NULL. context must not be NULL.
+ *
+ * @param chan      Channel the file is pending on
+ * @param pf        Pointer to the pending file
+ * @param context   Pointer to CF_ChanAction_SuspResArg_t structure from initial call
+ */
+void CF_DoSuspRes_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, CF_ChanAction_SuspResArg_t *context);
+
 /************************************************************************/
 /** @brief Handle transaction suspend and resume commands.
  *
@@ -339,6 +391,22 @@ CFE_Status_t CF_ResumeCmd(const CF_ResumeCmd_t *msg);
  */
 void CF_CmdCancel_Txn(CF_Transaction_t *txn, void *ignored);
 
+/************************************************************************/
+/** @brief tsn chan action to cancel or abandon a pending file.
+ *
+ * This helper function is used with CF_TsnChanAction() for matched pending
+ * files, and to purge the pending queue.  The file has not started, so it is
+ * dropped without a history entry.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. pf must not be NULL.
+ *
+ * @param chan     Channel the file is pending on
+ * @param pf       Pointer to the pending file
+ * @param ignored  Not used by this function
+ */
+void CF_CmdDrop_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, void *ignored);
+
 /************************************************************************/
 /** @brief Handle a cancel ground command.
  *
@@ -441,36 +509,6 @@ CFE_Status_t CF_EnableDirPollingCmd(const CF_EnableDirPollingCmd_t *msg);
  */
 CFE_Status_t CF_DisableDirPollingCmd(const CF_DisableDirPollingCmd_t *msg);
 
-/************************************************************************/
-/** @brief Purge the history queue for the given channel.
- *
- * This helper function is used in conjunction with CF_CList_Traverse()
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL. chan must not be NULL.
- *
- * @param node  Current list node being traversed
- * @param arg   Channel pointer passed through as opaque object, must be CF_Channel_t*
- *
- * @returns Always #CF_CLIST_CONT to process all entries
- */
-CF_CListTraverse_Status_t CF_PurgeHistory(CF_CListNode_t *node, void *arg);
-
-/************************************************************************/
-/** @brief Purge the pending transaction queue.
- *
- * This helper function is used in conjunction with CF_CList_Traverse()
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL.
- *
- * @param node  Current list node being traversed
- * @param ignored  Not used by this implementation
- *
- * @returns Always #CF_CLIST_CONT to process all entries
- */
-CF_CListTraverse_Status_t CF_PurgeTransaction(CF_CListNode_t *node, void *ignored);
-
 /************************************************************************/
 /** @brief Channel action command to perform purge queue operations.
  *
@@ -524,7 +562,7 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg);
  * @retval CF_ChanAction_Status_ERROR if failed (val is greater than max PDU)
  *
  */
-CF_ChanAction_Status_t CF_CmdValidateChunkSize(CF_ChunkSize_t val, uint8 chan_num);
+CF_ChanAction_Status_t CF_CmdValidateChunkSize(uint32 val, uint8 chan_num);
 
 /************************************************************************/
 /** @brief Checks if the value is within allowable range as outgoing packets per wakeup
@@ -602,4 +640,24 @@ CFE_Status_t CF_EnableEngineCmd(const CF_EnableEngineCmd_t *msg);
  */
 CFE_Status_t CF_DisableEngineCmd(const CF_DisableEngineCmd_t *msg);
 
+/************************************************************************/
+/** @brief Ground command enable engine phase performance statistics.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       msg must not be NULL.
+ *
+ * @param msg   Pointer to command message
+ */
+CFE_Status_t CF_EnablePerfStatsCmd(const CF_EnablePerfStatsCmd_t *msg);
+
+/************************************************************************/
+/** @brief Ground command disable engine phase performance statistics.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       msg must not be NULL.
+ *
+ * @param msg   Pointer to command message
+ */
+CFE_Status_t CF_DisablePerfStatsCmd(const CF_DisablePerfStatsCmd_t *msg);
+
 #endif
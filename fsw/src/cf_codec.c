@@ -79,6 +79,7 @@ static const CF_Codec_BitField_t CF_CFDP_PduHeader_FLAGS_LARGEFILE = CF_INIT_FIE
  * Fields within the "eid_tsn_lengths" byte of the PDU header
  */
 static const CF_Codec_BitField_t CF_CFDP_PduHeader_LENGTHS_ENTITY               = CF_INIT_FIELD(3, 4);
+static const CF_Codec_BitField_t CF_CFDP_PduHeader_LENGTHS_SEGMENT_METADATA     = CF_INIT_FIELD(1, 3);
 static const CF_Codec_BitField_t CF_CFDP_PduHeader_LENGTHS_TRANSACTION_SEQUENCE = CF_INIT_FIELD(3, 0);
 
 /*
@@ -117,6 +118,73 @@ static const CF_Codec_BitField_t CF_CFDP_PduMd_CHECKSUM_TYPE     = CF_INIT_FIELD
 static const CF_Codec_BitField_t CF_CFDP_PduFileData_RECORD_CONTINUATION_STATE = CF_INIT_FIELD(2, 6);
 static const CF_Codec_BitField_t CF_CFDP_PduFileData_SEGMENT_METADATA_LENGTH   = CF_INIT_FIELD(6, 0);
 
+/*
+ * Lookup table of the PDU CRC, which is CRC-16/CCITT as given in the CFDP
+ * blue book: polynomial 0x1021, initial value 0xFFFF, no reflection and no
+ * final XOR.  Entry i is the CRC of the single byte i with a zero register.
+ */
+static const uint16 CF_CFDP_PDU_CRC_TABLE[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+    0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+    0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+    0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+    0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+    0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+    0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+    0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+    0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+    0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+    0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+    0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+    0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+    0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+    0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+    0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+    0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+    0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+    0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+    0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+    0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+    0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
+};
+
+/*
+ * Initial register value of the PDU CRC
+ */
+#define CF_CFDP_PDU_CRC_INIT 0xFFFF
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Runs the PDU CRC over a block.  As there is no final XOR, running it
+ * over a PDU followed by its own CRC, stored big-endian, gives zero.
+ *
+ *-----------------------------------------------------------------*/
+static uint16 CF_CFDP_PduCrc(const uint8 *data, size_t len)
+{
+    uint16 crc = CF_CFDP_PDU_CRC_INIT;
+
+    while (len > 0)
+    {
+        crc = (uint16)(crc << 8) ^ CF_CFDP_PDU_CRC_TABLE[(crc >> 8) ^ *data];
+        ++data;
+        --len;
+    }
+
+    return crc;
+}
+
 /* NOTE: get/set will handle endianess */
 /*
  * ALSO NOTE: These store/set inline functions/macros are used with
@@ -260,6 +328,56 @@ static inline void CF_Codec_Load_uint64(uint64 *pdst, const CF_CFDP_uint64_t *ps
     *pdst = val;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Whether an encoded integer width has a fixed-width load, and the value
+ * fits in a logical field of the given size.
+ *
+ *-----------------------------------------------------------------*/
+static inline bool CF_Codec_IsLoadSize(uint8 size, size_t max_size)
+{
+    return (size <= max_size && (size & (size - 1)) == 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Loads an integer of 1, 2, 4 or 8 octets, as checked by CF_Codec_IsLoadSize().
+ * Each width uses its own fixed-width load rather than a loop over the octets.
+ *
+ *-----------------------------------------------------------------*/
+static inline uint64 CF_Codec_Load_InSize(const uint8 *psrc, uint8 size)
+{
+    uint8  val8;
+    uint16 val16;
+    uint32 val32;
+    uint64 val;
+
+    switch (size)
+    {
+        case sizeof(CF_CFDP_uint8_t):
+            CF_Codec_Load_uint8(&val8, (const CF_CFDP_uint8_t *)psrc);
+            val = val8;
+            break;
+        case sizeof(CF_CFDP_uint16_t):
+            CF_Codec_Load_uint16(&val16, (const CF_CFDP_uint16_t *)psrc);
+            val = val16;
+            break;
+        case sizeof(CF_CFDP_uint32_t):
+            CF_Codec_Load_uint32(&val32, (const CF_CFDP_uint32_t *)psrc);
+            val = val32;
+            break;
+        default:
+            CF_Codec_Load_uint64(&val, (const CF_CFDP_uint64_t *)psrc);
+            break;
+    }
+
+    return val;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -362,6 +480,79 @@ void CF_EncodeIntegerInSize(CF_EncoderState_t *state, uint64 value, uint8 encode
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Encodes a file size sensitive field, in the size set by the large
+ * file flag of the header encoded earlier.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_EncodeFileSize(CF_EncoderState_t *state, CF_FileSize_t value)
+{
+    if (state->codec_state.large_file)
+    {
+        CF_EncodeIntegerInSize(state, value, sizeof(CF_CFDP_uint64_t));
+    }
+    else
+    {
+        CF_EncodeIntegerInSize(state, value, sizeof(CF_CFDP_uint32_t));
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Encodes the flags octet of the PDU header, which is what differs
+ * between the PDUs of a transaction.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_EncodeHeaderFlags(CF_EncoderState_t *state, CF_CFDP_PduHeader_t *peh,
+                                      const CF_Logical_PduHeader_t *plh)
+{
+    CF_Codec_Store_uint8(&(peh->flags), 0);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_VERSION, plh->version);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_DIR, plh->direction);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_TYPE, plh->pdu_type);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_MODE, plh->txm_mode);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_CRC, plh->crc_flag);
+    FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_LARGEFILE, plh->large_flag);
+
+    /* the rest of the PDU follows the size of file sizes and offsets set here */
+    state->codec_state.large_file = plh->large_flag;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Completes the PDU header once its variable-length fields are encoded.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_EncodeHeaderEnd(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh)
+{
+    /* The position now reflects the length of the basic header */
+    plh->header_encoded_length = CF_CODEC_GET_POSITION(state);
+
+    /*
+     * Hold back room for the CRC at the end of the PDU, so the fields that fill
+     * the remaining space cannot take it.  CF_CFDP_EncodeHeaderFinalSize() gives
+     * it back when the CRC is appended.
+     */
+    if (plh->crc_flag)
+    {
+        if (CF_CODEC_GET_REMAIN(state) >= sizeof(CF_CFDP_uint16_t))
+        {
+            state->codec_state.max_size -= sizeof(CF_CFDP_uint16_t);
+        }
+        else
+        {
+            CF_CODEC_SET_DONE(state);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -375,11 +566,7 @@ void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHea
     peh = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_PduHeader_t);
     if (peh != NULL)
     {
-        CF_Codec_Store_uint8(&(peh->flags), 0);
-        FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_VERSION, plh->version);
-        FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_DIR, plh->direction);
-        FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_TYPE, plh->pdu_type);
-        FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_MODE, plh->txm_mode);
+        CF_CFDP_EncodeHeaderFlags(state, peh, plh);
 
         /* The eid+tsn lengths are encoded as -1 */
         CF_Codec_Store_uint8(&(peh->eid_tsn_lengths), 0);
@@ -393,8 +580,72 @@ void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHea
         CF_EncodeIntegerInSize(state, plh->sequence_num, plh->txn_seq_length);
         CF_EncodeIntegerInSize(state, plh->destination_eid, plh->eid_length);
 
-        /* The position now reflects the length of the basic header */
-        plh->header_encoded_length = CF_CODEC_GET_POSITION(state);
+        CF_CFDP_EncodeHeaderEnd(state, plh);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeHeaderTemplate(CF_PduHeaderTemplate_t *tmpl, CF_EntityId_t src_eid, CF_EntityId_t dst_eid,
+                                  CF_TransactionSeq_t tsn)
+{
+    CF_EncoderState_t      state;
+    CF_Logical_PduHeader_t hdr;
+
+    memset(tmpl, 0, sizeof(*tmpl));
+    memset(&hdr, 0, sizeof(hdr));
+
+    /* choose the larger of the two EIDs to determine size */
+    if (src_eid > dst_eid)
+    {
+        hdr.eid_length = CF_CFDP_GetValueEncodedSize(src_eid);
+    }
+    else
+    {
+        hdr.eid_length = CF_CFDP_GetValueEncodedSize(dst_eid);
+    }
+
+    hdr.txn_seq_length  = CF_CFDP_GetValueEncodedSize(tsn);
+    hdr.source_eid      = src_eid;
+    hdr.destination_eid = dst_eid;
+    hdr.sequence_num    = tsn;
+
+    state.base = tmpl->bytes;
+    CF_CFDP_CodecReset(&state.codec_state, sizeof(tmpl->bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &hdr);
+
+    tmpl->source_eid      = src_eid;
+    tmpl->destination_eid = dst_eid;
+    tmpl->sequence_num    = tsn;
+    tmpl->eid_length      = hdr.eid_length;
+    tmpl->txn_seq_length  = hdr.txn_seq_length;
+
+    /* the buffer is sized for the widest header, so this always fits */
+    tmpl->length = CF_CODEC_GET_POSITION(&state);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_PduHeaderTemplate_t *tmpl)
+{
+    CF_CFDP_PduHeader_t *peh;
+
+    peh = CF_CFDP_DoEncodeChunk(state, tmpl->length);
+    if (peh != NULL)
+    {
+        memcpy(peh, tmpl->bytes, tmpl->length);
+
+        CF_CFDP_EncodeHeaderFlags(state, peh, plh);
+        CF_CFDP_EncodeHeaderEnd(state, plh);
     }
 }
 
@@ -421,6 +672,13 @@ void CF_CFDP_EncodeHeaderFinalSize(CF_EncoderState_t *state, CF_Logical_PduHeade
 
         /* Total length is a simple 16-bit quantity */
         CF_Codec_Store_uint16(&(peh->length), plh->data_encoded_length);
+
+        /* The CRC covers everything before it, so it must come after the length */
+        if (plh->crc_flag)
+        {
+            state->codec_state.max_size += sizeof(CF_CFDP_uint16_t);
+            CF_CFDP_EncodeCrc16(state, CF_CFDP_PduCrc(state->base, CF_CODEC_GET_POSITION(state)));
+        }
     }
 
     /* This "closes" the packet so nothing else can be added to this EncoderState,
@@ -522,14 +780,9 @@ void CF_CFDP_EncodeTLV(CF_EncoderState_t *state, CF_Logical_Tlv_t *pltlv)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeSegmentRequest(CF_EncoderState_t *state, CF_Logical_SegmentRequest_t *plseg)
 {
-    CF_CFDP_SegmentRequest_t *sr; /* for encoding fixed sized fields */
-
-    sr = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_SegmentRequest_t);
-    if (sr != NULL)
-    {
-        CF_Codec_Store_uint32(&(sr->offset_start), plseg->offset_start);
-        CF_Codec_Store_uint32(&(sr->offset_end), plseg->offset_end);
-    }
+    /* both fields are file size sensitive */
+    CF_CFDP_EncodeFileSize(state, plseg->offset_start);
+    CF_CFDP_EncodeFileSize(state, plseg->offset_end);
 }
 
 /*----------------------------------------------------------------
@@ -564,6 +817,33 @@ void CF_CFDP_EncodeAllSegments(CF_EncoderState_t *state, CF_Logical_SegmentList_
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Encodes the CF forward error correction message as a message to
+ * user TLV.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_EncodeFecMsg(CF_EncoderState_t *state, const CF_Logical_FecParams_t *plfec)
+{
+    CF_CFDP_tlv_t *   tlv;
+    CF_CFDP_FecMsg_t *msg;
+
+    tlv = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_tlv_t);
+    msg = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_FecMsg_t);
+    if (tlv != NULL && msg != NULL)
+    {
+        CF_Codec_Store_uint8(&(tlv->type), CF_CFDP_TLV_TYPE_MESSAGE_TO_USER);
+        CF_Codec_Store_uint8(&(tlv->length), sizeof(CF_CFDP_FecMsg_t));
+
+        CF_Codec_Store_uint32(&(msg->tag), CF_CFDP_FEC_MSG_TAG);
+        CF_Codec_Store_uint8(&(msg->scheme), CF_CFDP_FecScheme_XOR);
+        CF_Codec_Store_uint8(&(msg->group_size), plfec->group_size);
+        CF_Codec_Store_uint16(&(msg->segment_size), plfec->segment_size);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -580,11 +860,16 @@ void CF_CFDP_EncodeMd(CF_EncoderState_t *state, CF_Logical_PduMd_t *plmd)
         CF_Codec_Store_uint8(&(md->segmentation_control), 0);
         FSV(md->segmentation_control, CF_CFDP_PduMd_CLOSURE_REQUESTED, plmd->close_req);
         FSV(md->segmentation_control, CF_CFDP_PduMd_CHECKSUM_TYPE, plmd->checksum_type);
-        CF_Codec_Store_uint32(&(md->size), plmd->size);
+        CF_CFDP_EncodeFileSize(state, plmd->size);
 
         /* Add in LV for src/dest */
         CF_CFDP_EncodeLV(state, &plmd->source_filename);
         CF_CFDP_EncodeLV(state, &plmd->dest_filename);
+
+        if (plmd->fec.group_size != 0)
+        {
+            CF_CFDP_EncodeFecMsg(state, &plmd->fec);
+        }
     }
 }
 
@@ -596,8 +881,7 @@ void CF_CFDP_EncodeMd(CF_EncoderState_t *state, CF_Logical_PduMd_t *plmd)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeFileDataHeader(CF_EncoderState_t *state, bool with_meta, CF_Logical_PduFileDataHeader_t *plfd)
 {
-    CF_CFDP_PduFileDataHeader_t *fd;
-    CF_CFDP_uint8_t *            optional_fields;
+    CF_CFDP_uint8_t *optional_fields;
 
     /* in this packet, the optional fields actually come first */
     if (with_meta)
@@ -618,11 +902,7 @@ void CF_CFDP_EncodeFileDataHeader(CF_EncoderState_t *state, bool with_meta, CF_L
         CF_CFDP_EncodeAllSegments(state, &plfd->segment_list);
     }
 
-    fd = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_PduFileDataHeader_t);
-    if (fd != NULL)
-    {
-        CF_Codec_Store_uint32(&(fd->offset), plfd->offset);
-    }
+    CF_CFDP_EncodeFileSize(state, plfd->offset);
 }
 
 /*----------------------------------------------------------------
@@ -641,7 +921,7 @@ void CF_CFDP_EncodeEof(CF_EncoderState_t *state, CF_Logical_PduEof_t *pleof)
         CF_Codec_Store_uint8(&(eof->cc), 0);
         FSV(eof->cc, CF_CFDP_PduEof_FLAGS_CC, pleof->cc);
         CF_Codec_Store_uint32(&(eof->crc), pleof->crc);
-        CF_Codec_Store_uint32(&(eof->size), pleof->size);
+        CF_CFDP_EncodeFileSize(state, pleof->size);
 
         CF_CFDP_EncodeAllTlv(state, &pleof->tlv_list);
     }
@@ -700,15 +980,33 @@ void CF_CFDP_EncodeAck(CF_EncoderState_t *state, CF_Logical_PduAck_t *plack)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeNak(CF_EncoderState_t *state, CF_Logical_PduNak_t *plnak)
 {
-    CF_CFDP_PduNak_t *nak; /* for encoding fixed sized fields */
+    /* all fields are file size sensitive */
+    CF_CFDP_EncodeFileSize(state, plnak->scope_start);
+    CF_CFDP_EncodeFileSize(state, plnak->scope_end);
 
-    nak = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_PduNak_t);
-    if (nak != NULL)
-    {
-        CF_Codec_Store_uint32(&(nak->scope_start), plnak->scope_start);
-        CF_Codec_Store_uint32(&(nak->scope_end), plnak->scope_end);
+    CF_CFDP_EncodeAllSegments(state, &plnak->segment_list);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeParity(CF_EncoderState_t *state, CF_Logical_PduParity_t *plpar)
+{
+    void *data_ptr;
 
-        CF_CFDP_EncodeAllSegments(state, &plnak->segment_list);
+    CF_CFDP_EncodeFileSize(state, plpar->offset);
+
+    data_ptr = CF_CFDP_DoEncodeChunk(state, plpar->data_len);
+    if (data_ptr != NULL && plpar->data_ptr != NULL)
+    {
+        memcpy(data_ptr, plpar->data_ptr, plpar->data_len);
+    }
+    else
+    {
+        CF_CODEC_SET_DONE(state);
     }
 }
 
@@ -729,6 +1027,23 @@ void CF_CFDP_EncodeCrc(CF_EncoderState_t *state, uint32 *plcrc)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeCrc16(CF_EncoderState_t *state, uint16 crc)
+{
+    CF_CFDP_uint16_t *pecrc;
+
+    pecrc = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_uint16_t);
+    if (pecrc != NULL)
+    {
+        CF_Codec_Store_uint16(pecrc, crc);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -757,6 +1072,58 @@ uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size)
     return temp_val;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Decodes a file size sensitive field, in the size set by the large
+ * file flag of the header decoded earlier.
+ *
+ *-----------------------------------------------------------------*/
+static CF_FileSize_t CF_CFDP_DecodeFileSize(CF_DecoderState_t *state)
+{
+    CF_FileSize_t value;
+
+    if (state->codec_state.large_file)
+    {
+        value = CF_DecodeIntegerInSize(state, sizeof(CF_CFDP_uint64_t));
+    }
+    else
+    {
+        value = CF_DecodeIntegerInSize(state, sizeof(CF_CFDP_uint32_t));
+    }
+
+    return value;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Decodes the fixed size part of the PDU header, up to the entity IDs.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_DecodeHeaderFixed(CF_DecoderState_t *state, const CF_CFDP_PduHeader_t *peh,
+                                      CF_Logical_PduHeader_t *plh)
+{
+    plh->version    = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_VERSION);
+    plh->direction  = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_DIR);
+    plh->pdu_type   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_TYPE);
+    plh->txm_mode   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_MODE);
+    plh->crc_flag   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_CRC);
+    plh->large_flag = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_LARGEFILE);
+
+    /* the rest of the PDU follows the size of file sizes and offsets set here */
+    state->codec_state.large_file = plh->large_flag;
+
+    /* The eid+tsn lengths are encoded as -1 */
+    plh->eid_length     = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_ENTITY) + 1;
+    plh->txn_seq_length = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_TRANSACTION_SEQUENCE) + 1;
+
+    /* Length is a simple 16-bit quantity and refers to the content after this header */
+    CF_Codec_Load_uint16(&(plh->data_encoded_length), &(peh->length));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -772,19 +1139,8 @@ CFE_Status_t CF_CFDP_DecodeHeader(CF_DecoderState_t *state, CF_Logical_PduHeader
     peh = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduHeader_t);
     if (peh != NULL)
     {
-        plh->version    = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_VERSION);
-        plh->direction  = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_DIR);
-        plh->pdu_type   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_TYPE);
-        plh->txm_mode   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_MODE);
-        plh->crc_flag   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_CRC);
-        plh->large_flag = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_LARGEFILE);
+        CF_CFDP_DecodeHeaderFixed(state, peh, plh);
 
-        /* The eid+tsn lengths are encoded as -1 */
-        plh->eid_length     = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_ENTITY) + 1;
-        plh->txn_seq_length = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_TRANSACTION_SEQUENCE) + 1;
-
-        /* Length is a simple 16-bit quantity and refers to the content after this header */
-        CF_Codec_Load_uint16(&(plh->data_encoded_length), &(peh->length));
         if ((plh->eid_length > sizeof(plh->source_eid)) || (plh->txn_seq_length > sizeof(plh->sequence_num)))
         {
             ret = CF_ERROR;
@@ -880,13 +1236,43 @@ void CF_CFDP_DecodeTLV(CF_DecoderState_t *state, CF_Logical_Tlv_t *pltlv)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeSegmentRequest(CF_DecoderState_t *state, CF_Logical_SegmentRequest_t *plseg)
 {
-    const CF_CFDP_SegmentRequest_t *sr; /* for decoding fixed sized fields */
+    CF_FileSize_t offset_start;
+    CF_FileSize_t offset_end;
 
-    sr = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_SegmentRequest_t);
-    if (sr != NULL)
+    /* both fields are file size sensitive, only store them if the whole request was there */
+    offset_start = CF_CFDP_DecodeFileSize(state);
+    offset_end   = CF_CFDP_DecodeFileSize(state);
+    if (CF_CODEC_IS_OK(state))
     {
-        CF_Codec_Load_uint32(&(plseg->offset_start), &(sr->offset_start));
-        CF_Codec_Load_uint32(&(plseg->offset_end), &(sr->offset_end));
+        plseg->offset_start = offset_start;
+        plseg->offset_end   = offset_end;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Decodes the value of a message to user TLV, if it is a CF forward
+ * error correction message of a known scheme.  Other messages are
+ * left alone.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_DecodeFecMsg(const CF_Logical_Tlv_t *pltlv, CF_Logical_FecParams_t *plfec)
+{
+    const CF_CFDP_FecMsg_t *msg = pltlv->data.data_ptr;
+    uint32                  tag;
+    uint8                   scheme;
+
+    if (pltlv->type == CF_CFDP_TLV_TYPE_MESSAGE_TO_USER && pltlv->length == sizeof(CF_CFDP_FecMsg_t))
+    {
+        CF_Codec_Load_uint32(&tag, &(msg->tag));
+        CF_Codec_Load_uint8(&scheme, &(msg->scheme));
+        if (tag == CF_CFDP_FEC_MSG_TAG && scheme == CF_CFDP_FecScheme_XOR)
+        {
+            CF_Codec_Load_uint8(&(plfec->group_size), &(msg->group_size));
+            CF_Codec_Load_uint16(&(plfec->segment_size), &(msg->segment_size));
+        }
     }
 }
 
@@ -899,17 +1285,30 @@ void CF_CFDP_DecodeSegmentRequest(CF_DecoderState_t *state, CF_Logical_SegmentRe
 void CF_CFDP_DecodeMd(CF_DecoderState_t *state, CF_Logical_PduMd_t *plmd)
 {
     const CF_CFDP_PduMd_t *md; /* for decoding fixed sized fields */
+    CF_Logical_Tlv_t       tlv;
 
     md = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduMd_t);
     if (md != NULL)
     {
+        memset(&plmd->fec, 0, sizeof(plmd->fec));
+
         plmd->close_req     = FGV(md->segmentation_control, CF_CFDP_PduMd_CLOSURE_REQUESTED);
         plmd->checksum_type = FGV(md->segmentation_control, CF_CFDP_PduMd_CHECKSUM_TYPE);
-        CF_Codec_Load_uint32(&(plmd->size), &(md->size));
+        plmd->size          = CF_CFDP_DecodeFileSize(state);
 
         /* Add in LV for src/dest */
         CF_CFDP_DecodeLV(state, &plmd->source_filename);
         CF_CFDP_DecodeLV(state, &plmd->dest_filename);
+
+        /* The options run to the end of the PDU, only the CF messages are of interest */
+        while (CF_CODEC_IS_OK(state) && CF_CODEC_GET_REMAIN(state) != 0)
+        {
+            CF_CFDP_DecodeTLV(state, &tlv);
+            if (CF_CODEC_IS_OK(state))
+            {
+                CF_CFDP_DecodeFecMsg(&tlv, &plmd->fec);
+            }
+        }
     }
 }
 
@@ -921,9 +1320,9 @@ void CF_CFDP_DecodeMd(CF_DecoderState_t *state, CF_Logical_PduMd_t *plmd)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeFileDataHeader(CF_DecoderState_t *state, bool with_meta, CF_Logical_PduFileDataHeader_t *plfd)
 {
-    const CF_CFDP_PduFileDataHeader_t *fd;
-    const CF_CFDP_uint8_t *            optional_fields;
-    uint8                              field_count;
+    const CF_CFDP_uint8_t *optional_fields;
+    uint8                  field_count;
+    CF_FileSize_t          offset;
 
     plfd->continuation_state        = 0;
     plfd->segment_list.num_segments = 0;
@@ -965,16 +1364,79 @@ void CF_CFDP_DecodeFileDataHeader(CF_DecoderState_t *state, bool with_meta, CF_L
         }
     }
 
-    fd = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduFileDataHeader_t);
-    if (fd != NULL)
+    offset = CF_CFDP_DecodeFileSize(state);
+    if (CF_CODEC_IS_OK(state))
     {
-        CF_Codec_Load_uint32(&(plfd->offset), &(fd->offset));
+        plfd->offset = offset;
 
         plfd->data_len = CF_CODEC_GET_REMAIN(state);
         plfd->data_ptr = CF_CFDP_DoDecodeChunk(state, plfd->data_len);
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_CFDP_DecodeFileDataFast(CF_DecoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                CF_Logical_PduFileDataHeader_t *plfd)
+{
+    const CF_CFDP_PduHeader_t *peh;
+    const uint8 *              ptr;
+    size_t                     header_size;
+    uint8                      offset_size;
+    bool                       ret = false;
+
+    /* look at the fixed part of the header without consuming it, in case this falls back */
+    peh = (const CF_CFDP_PduHeader_t *)(state->base + CF_CODEC_GET_POSITION(state));
+    if (CF_CODEC_IS_OK(state) && CF_CODEC_GET_REMAIN(state) >= sizeof(CF_CFDP_PduHeader_t))
+    {
+        CF_CFDP_DecodeHeaderFixed(state, peh, plh);
+
+        header_size = sizeof(CF_CFDP_PduHeader_t) + plh->eid_length + plh->txn_seq_length + plh->eid_length;
+        if (plh->large_flag)
+        {
+            offset_size = sizeof(CF_CFDP_uint64_t);
+        }
+        else
+        {
+            offset_size = sizeof(CF_CFDP_uint32_t);
+        }
+
+        if (plh->pdu_type && !plh->crc_flag && !FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_SEGMENT_METADATA) &&
+            CF_Codec_IsLoadSize(plh->eid_length, sizeof(plh->source_eid)) &&
+            CF_Codec_IsLoadSize(plh->txn_seq_length, sizeof(plh->sequence_num)) &&
+            CF_CODEC_GET_REMAIN(state) >= (header_size + offset_size))
+        {
+            /* the check above covers every field up to the file data */
+            ptr = CF_CFDP_DoDecodeChunk(state, header_size + offset_size);
+            ptr += sizeof(CF_CFDP_PduHeader_t);
+
+            plh->source_eid = CF_Codec_Load_InSize(ptr, plh->eid_length);
+            ptr += plh->eid_length;
+            plh->sequence_num = CF_Codec_Load_InSize(ptr, plh->txn_seq_length);
+            ptr += plh->txn_seq_length;
+            plh->destination_eid = CF_Codec_Load_InSize(ptr, plh->eid_length);
+            ptr += plh->eid_length;
+
+            plh->header_encoded_length = CF_CODEC_GET_POSITION(state) - offset_size;
+
+            plfd->continuation_state        = 0;
+            plfd->segment_list.num_segments = 0;
+            plfd->offset                    = CF_Codec_Load_InSize(ptr, offset_size);
+
+            plfd->data_len = CF_CODEC_GET_REMAIN(state);
+            plfd->data_ptr = CF_CFDP_DoDecodeChunk(state, plfd->data_len);
+
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -992,6 +1454,40 @@ void CF_CFDP_DecodeCrc(CF_DecoderState_t *state, uint32 *plcrc)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_DecodePduCrc(CF_DecoderState_t *state, const CF_Logical_PduHeader_t *plh)
+{
+    CFE_Status_t ret = CFE_SUCCESS;
+    size_t       pdu_len;
+
+    pdu_len = (size_t)plh->header_encoded_length + plh->data_encoded_length;
+
+    if (!CF_CODEC_IS_OK(state) || plh->data_encoded_length < sizeof(CF_CFDP_uint16_t) ||
+        pdu_len > CF_CODEC_GET_SIZE(state))
+    {
+        CF_CODEC_SET_DONE(state);
+        ret = CF_SHORT_PDU_ERROR;
+    }
+    else if (CF_CFDP_PduCrc(state->base, pdu_len) != 0)
+    {
+        /* the CRC over the PDU and its own CRC is zero when intact */
+        CF_CODEC_SET_DONE(state);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        /* decoding ends before the CRC, so fields running to the end of the PDU exclude it */
+        state->codec_state.max_size = pdu_len - sizeof(CF_CFDP_uint16_t);
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1007,7 +1503,7 @@ void CF_CFDP_DecodeEof(CF_DecoderState_t *state, CF_Logical_PduEof_t *pleof)
     {
         pleof->cc = FGV(eof->cc, CF_CFDP_PduEof_FLAGS_CC);
         CF_Codec_Load_uint32(&(pleof->crc), &(eof->crc));
-        CF_Codec_Load_uint32(&(pleof->size), &(eof->size));
+        pleof->size = CF_CFDP_DecodeFileSize(state);
 
         CF_CFDP_DecodeAllTlv(state, &pleof->tlv_list, CF_PDU_MAX_TLV);
     }
@@ -1063,18 +1559,41 @@ void CF_CFDP_DecodeAck(CF_DecoderState_t *state, CF_Logical_PduAck_t *plack)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeNak(CF_DecoderState_t *state, CF_Logical_PduNak_t *plnak)
 {
-    const CF_CFDP_PduNak_t *nak; /* for encoding fixed sized fields */
+    CF_FileSize_t scope_start;
+    CF_FileSize_t scope_end;
 
-    nak = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduNak_t);
-    if (nak != NULL)
+    /* all fields are file size sensitive */
+    scope_start = CF_CFDP_DecodeFileSize(state);
+    scope_end   = CF_CFDP_DecodeFileSize(state);
+    if (CF_CODEC_IS_OK(state))
     {
-        CF_Codec_Load_uint32(&(plnak->scope_start), &(nak->scope_start));
-        CF_Codec_Load_uint32(&(plnak->scope_end), &(nak->scope_end));
+        plnak->scope_start = scope_start;
+        plnak->scope_end   = scope_end;
 
         CF_CFDP_DecodeAllSegments(state, &plnak->segment_list, CF_PDU_MAX_SEGMENTS);
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_DecodeParity(CF_DecoderState_t *state, CF_Logical_PduParity_t *plpar)
+{
+    CF_FileSize_t offset;
+
+    offset = CF_CFDP_DecodeFileSize(state);
+    if (CF_CODEC_IS_OK(state))
+    {
+        plpar->offset = offset;
+
+        plpar->data_len = CF_CODEC_GET_REMAIN(state);
+        plpar->data_ptr = CF_CFDP_DoDecodeChunk(state, plpar->data_len);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
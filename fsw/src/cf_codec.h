@@ -40,8 +40,28 @@ typedef struct CF_CodecState
     bool   is_valid;    /**< \brief whether decode is valid or not.  Set false on end of decode or error condition. */
     size_t next_offset; /**< \brief Offset of next byte to encode/decode, current position in PDU */
     size_t max_size;    /**< \brief Maximum number of bytes in the PDU */
+    bool   large_file;  /**< \brief whether file sizes and offsets are 64-bit, per the large file flag of the header */
 } CF_CodecState_t;
 
+/**
+ * @brief A PDU header encoded ahead of time
+ *
+ * The entity IDs and sequence number in the headers of the PDUs a transaction
+ * sends stay the same over its lifetime, and so do their encoded widths.  The
+ * header is encoded once into a template, and each PDU starts as a copy of it,
+ * with only the flags and the length left to set.
+ */
+typedef struct CF_PduHeaderTemplate
+{
+    CF_EntityId_t       source_eid;      /**< \brief source entity ID the template was encoded with */
+    CF_EntityId_t       destination_eid; /**< \brief destination entity ID the template was encoded with */
+    CF_TransactionSeq_t sequence_num;    /**< \brief sequence number the template was encoded with */
+    uint8               eid_length;      /**< \brief encoded width of the entity IDs */
+    uint8               txn_seq_length;  /**< \brief encoded width of the sequence number */
+    uint8               length;          /**< \brief size of the encoded header, 0 if no template is set */
+    uint8               bytes[CF_CFDP_MAX_HEADER_SIZE];
+} CF_PduHeaderTemplate_t;
+
 /**
  * @brief Current state of an encode operation
  *
@@ -145,6 +165,7 @@ static inline void CF_CFDP_CodecReset(CF_CodecState_t *state, size_t max_size)
     state->is_valid    = true;
     state->next_offset = 0;
     state->max_size    = max_size;
+    state->large_file  = false;
 }
 
 /************************************************************************/
@@ -367,6 +388,9 @@ uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size);
  * remainder of encoding is done.  Luckily, the total_length is in the first fixed
  * position binary blob so it is easy to update later.
  *
+ * If the crc_flag of the header is set, space for the PDU CRC is held back at the
+ * end of the PDU, so the remainder reported by the encoder already excludes it.
+ *
  * If the encoder is in an error state, nothing is encoded, and the state of the
  * encoder is not changed.
  *
@@ -377,17 +401,59 @@ uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size);
  */
 void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh);
 
+/************************************************************************/
+/**
+ * @brief Encodes the PDU header template for a set of entity IDs and sequence number
+ *
+ * The encoded widths of the entity IDs and sequence number are chosen the same
+ * way as for any other PDU, the larger of the two entity IDs setting the width of
+ * both.  The flags and length in the template are left at zero.
+ *
+ * @sa CF_CFDP_EncodeHeaderFromTemplate() for starting a PDU from the template
+ *
+ * @param tmpl     Template to encode
+ * @param src_eid  Source entity ID
+ * @param dst_eid  Destination entity ID
+ * @param tsn      Transaction sequence number
+ */
+void CF_CFDP_EncodeHeaderTemplate(CF_PduHeaderTemplate_t *tmpl, CF_EntityId_t src_eid, CF_EntityId_t dst_eid,
+                                  CF_TransactionSeq_t tsn);
+
+/************************************************************************/
+/**
+ * @brief Encodes a CFDP PDU base header block from a template, bypassing the size field
+ *
+ * Has the same result as CF_CFDP_EncodeHeaderWithoutSize(), but copies the entity
+ * IDs and sequence number already encoded in the template, and only encodes the
+ * flags from the logical PDU header.  The logical header must hold the same entity
+ * IDs, sequence number and encoded widths as the template.
+ *
+ * If the encoder is in an error state, nothing is encoded, and the state of the
+ * encoder is not changed.
+ *
+ * @sa CF_CFDP_EncodeHeaderFinalSize() for updating the length field once it is known
+ *
+ * @param state  Encoder state object
+ * @param plh    Pointer to logical PDU header data
+ * @param tmpl   Template encoded by CF_CFDP_EncodeHeaderTemplate()
+ */
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_PduHeaderTemplate_t *tmpl);
+
 /************************************************************************/
 /**
  * @brief Updates an already-encoded PDU base header block with the final PDU size
  *
  * This function encodes the "data_encoded_length" field from the logical PDU structure
- * into the encoded header block.  The PDU will also be closed (set done) to indicate that
- * no more data should be added.
+ * into the encoded header block.  If the crc_flag of the header is set, the PDU CRC is
+ * then computed over the whole PDU and appended, so "data_encoded_length" must already
+ * count it.  The PDU will also be closed (set done) to indicate that no more data should
+ * be added.
  *
  * @note Unlike other encode operations, this function does not add any new blocks to the
  * PDU.  It only updates the already-encoded block at the beginning of the PDU, which must
- * have been done by a prior call to CF_CFDP_EncodeHeaderWithoutSize().
+ * have been done by a prior call to CF_CFDP_EncodeHeaderWithoutSize() or
+ * CF_CFDP_EncodeHeaderFromTemplate().
  *
  * @sa CF_CFDP_EncodeHeaderWithoutSize() for initially encoding the PDU header block
  *
@@ -497,7 +563,8 @@ void CF_CFDP_EncodeAllSegments(CF_EncoderState_t *state, CF_Logical_SegmentList_
  * encoder is not changed.
  *
  * @note this encode includes the LV pairs for source and destination file names, which are
- * logically part of the overall MD block.
+ * logically part of the overall MD block, and the CF forward error correction message if
+ * the group size of the logical fec parameters is nonzero.
  *
  * @param state  Encoder state object
  * @param plmd   Pointer to logical PDU metadata header data
@@ -584,6 +651,21 @@ void CF_CFDP_EncodeAck(CF_EncoderState_t *state, CF_Logical_PduAck_t *plack);
  */
 void CF_CFDP_EncodeNak(CF_EncoderState_t *state, CF_Logical_PduNak_t *plnak);
 
+/************************************************************************/
+/**
+ * @brief Encodes a CF Parity block
+ *
+ * The data in the logical header will be appended to the encoded PDU at the current position,
+ * followed by a copy of the parity data.
+ *
+ * If the encoder is in an error state, nothing is encoded, and the state of the
+ * encoder is not changed.
+ *
+ * @param state  Encoder state object
+ * @param plpar  Pointer to logical PDU parity data
+ */
+void CF_CFDP_EncodeParity(CF_EncoderState_t *state, CF_Logical_PduParity_t *plpar);
+
 /************************************************************************/
 /**
  * @brief Encodes a CFDP CRC/Checksum
@@ -598,6 +680,20 @@ void CF_CFDP_EncodeNak(CF_EncoderState_t *state, CF_Logical_PduNak_t *plnak);
  */
 void CF_CFDP_EncodeCrc(CF_EncoderState_t *state, uint32 *plcrc);
 
+/************************************************************************/
+/**
+ * @brief Encodes a 16-bit PDU CRC
+ *
+ * The value will be appended to the encoded PDU at the current position
+ *
+ * If the encoder is in an error state, nothing is encoded, and the state of the
+ * encoder is not changed.
+ *
+ * @param state  Encoder state object
+ * @param crc    CRC value
+ */
+void CF_CFDP_EncodeCrc16(CF_EncoderState_t *state, uint16 crc);
+
 /*********************************************************************************
  *
  *   DECODE API
@@ -726,6 +822,9 @@ void CF_CFDP_DecodeAllSegments(CF_DecoderState_t *state, CF_Logical_SegmentList_
  * If the encoder is in an error state, nothing is decoded, and the state of the
  * decoder is not changed.
  *
+ * @note Of any TLVs following the file names, only the CF forward error correction
+ * message is decoded, into the fec parameters.  These are all 0 if it is not present.
+ *
  * @param state  Decoder state object
  * @param plmd   Pointer to logical PDU metadata header data
  */
@@ -747,6 +846,29 @@ void CF_CFDP_DecodeMd(CF_DecoderState_t *state, CF_Logical_PduMd_t *plmd);
  */
 void CF_CFDP_DecodeFileDataHeader(CF_DecoderState_t *state, bool with_meta, CF_Logical_PduFileDataHeader_t *plfd);
 
+/************************************************************************/
+/**
+ * @brief Decodes a complete file data PDU in one pass, if it is of the common kind
+ *
+ * Handles the file data PDUs that carry nothing beyond an offset and the data:
+ * no PDU CRC, no segment metadata, and entity ID and sequence number widths of
+ * 1, 2, 4 or 8 octets that fit the configured types.  The size of the headers is
+ * checked once, and each field is then loaded with a fixed-width load.
+ *
+ * The result is the same as CF_CFDP_DecodeHeader() followed by
+ * CF_CFDP_DecodeFileDataHeader().  If the PDU is of any other kind, or the decoder
+ * is in an error state, false is returned and the position of the decoder is not
+ * changed, so the PDU can be decoded in full from the same point.
+ *
+ * @param state  Decoder state object
+ * @param plh    Pointer to logical PDU base header data
+ * @param plfd   Pointer to logical PDU file header data
+ *
+ * @returns true if the PDU was decoded
+ */
+bool CF_CFDP_DecodeFileDataFast(CF_DecoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                CF_Logical_PduFileDataHeader_t *plfd);
+
 /************************************************************************/
 /**
  * @brief Decodes a CFDP End-of-File (EOF) header block
@@ -807,6 +929,22 @@ void CF_CFDP_DecodeAck(CF_DecoderState_t *state, CF_Logical_PduAck_t *plack);
  */
 void CF_CFDP_DecodeNak(CF_DecoderState_t *state, CF_Logical_PduNak_t *plnak);
 
+/************************************************************************/
+/**
+ * @brief Decodes a CF Parity block
+ *
+ * The data will be decoded from the encoded PDU at the current position and
+ * the logical fields will be saved to the given data structure.  The parity
+ * data is the rest of the PDU, and is referred to in place.
+ *
+ * If the encoder is in an error state, nothing is decoded, and the state of the
+ * decoder is not changed.
+ *
+ * @param state  Decoder state object
+ * @param plpar  Pointer to logical PDU parity data
+ */
+void CF_CFDP_DecodeParity(CF_DecoderState_t *state, CF_Logical_PduParity_t *plpar);
+
 /************************************************************************/
 /**
  * @brief Decodes a CFDP CRC/Checksum
@@ -822,4 +960,24 @@ void CF_CFDP_DecodeNak(CF_DecoderState_t *state, CF_Logical_PduNak_t *plnak);
  */
 void CF_CFDP_DecodeCrc(CF_DecoderState_t *state, uint32 *plcrc);
 
+/************************************************************************/
+/**
+ * @brief Verifies and strips the CRC at the end of a PDU
+ *
+ * Checks the CRC-16/CCITT of the whole PDU, whose length is taken from the
+ * logical base header, so this must follow CF_CFDP_DecodeHeader().  If the
+ * CRC is correct, the decoder ends before the CRC so that fields running to
+ * the end of the PDU, such as file data, do not include it.  Otherwise the
+ * decoder is closed.
+ *
+ * This should only be called when the crc_flag of the header is set.
+ *
+ * @param state  Decoder state object
+ * @param plh    Pointer to the decoded logical PDU base header
+ * @retval #CFE_SUCCESS \copydoc CFE_SUCCESS
+ * @retval CF_SHORT_PDU_ERROR if the PDU is shorter than its header says, or too short for a CRC
+ * @retval CF_ERROR if the CRC does not match
+ */
+CFE_Status_t CF_CFDP_DecodePduCrc(CF_DecoderState_t *state, const CF_Logical_PduHeader_t *plh);
+
 #endif /* !CF_CODEC_H */
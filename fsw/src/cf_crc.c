@@ -23,7 +23,9 @@
  *  The CF Application CRC calculation source file
  *
  *  This is a streaming CRC calculator. Data can all be given at once for
- *  a result or it can trickle in.
+ *  a result or it can trickle in.  It implements the file checksum types of
+ *  CFDP that CF supports: the modular checksum, CRC-32C, IEEE CRC-32 and the
+ *  null checksum.
  *
  *  This file is intended to be generic and usable by other apps.
  */
@@ -33,49 +35,202 @@
 #include "cf_crc.h"
 #include <string.h>
 
+/*
+ * Whole words are summed with vector instructions where the compiler offers
+ * them.  This may be disabled by the mission by defining CF_CRC_NO_VECTOR.
+ */
+#if !defined(CF_CRC_NO_VECTOR) && defined(__SSE2__)
+#include <emmintrin.h>
+#define CF_CRC_VECTOR_SSE2
+#elif !defined(CF_CRC_NO_VECTOR) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+#define CF_CRC_VECTOR_NEON
+#endif
+
+/*
+ * CRC-32C uses the CRC instructions where the compiler offers them, and
+ * otherwise the same table method as CRC-32.  This may be disabled by the
+ * mission by defining CF_CRC_NO_HW_CRC32C.
+ */
+#if !defined(CF_CRC_NO_HW_CRC32C) && defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define CF_CRC_HW_CRC32C_SSE42
+#elif !defined(CF_CRC_NO_HW_CRC32C) && defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_acle.h>
+#define CF_CRC_HW_CRC32C_ARM
+#endif
+
+/* reflected polynomials of the CRC types */
+#define CF_CRC_CRC32_POLY  0xEDB88320
+#define CF_CRC_CRC32C_POLY 0x82F63B78
+
+/**
+ * @brief Functions implementing one checksum algorithm
+ */
+typedef struct CF_CRC_Algorithm
+{
+    uint32 initial; /**< \brief initial value of the working register */
+    void (*digest)(CF_Crc_t *crc, const uint8 *data, size_t len);
+    void (*finalize)(CF_Crc_t *crc);
+} CF_CRC_Algorithm_t;
+
+/**
+ * @brief Slice-by-8 lookup table of a reflected CRC-32
+ */
+typedef uint32 CF_CRC_SliceTable_t[8][256];
+
+static CF_CRC_SliceTable_t CF_CRC_Crc32Table;
+static bool                CF_CRC_Crc32TableReady;
+
+#if !defined(CF_CRC_HW_CRC32C_SSE42) && !defined(CF_CRC_HW_CRC32C_ARM)
+static CF_CRC_SliceTable_t CF_CRC_Crc32cTable;
+static bool                CF_CRC_Crc32cTableReady;
+#endif
+
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_crc.h for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Shift one byte into the working word, adding the word to the result
+ * once it is complete.
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Start(CF_Crc_t *crc)
+static inline void CF_CRC_DigestByte(CF_Crc_t *crc, uint8 byte)
 {
-    memset(crc, 0, sizeof(*crc));
+    crc->working <<= 8;
+    crc->working |= byte;
+
+    ++crc->index;
+
+    if (crc->index == 4)
+    {
+        crc->result += crc->working;
+        crc->index = 0;
+    }
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_crc.h for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Load a big-endian word from any address.  Compilers turn this into a
+ * single load, with a byte swap on little-endian hosts.
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
+static inline uint32 CF_CRC_LoadWord(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | (uint32)data[3];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Add the big-endian words in as many whole 16 byte vectors of data as fit
+ * in len to sum, and return the number of bytes consumed.  The sum is
+ * modulo 2^32, so the lanes can be added up in any order.
+ *
+ *-----------------------------------------------------------------*/
+#if defined(CF_CRC_VECTOR_SSE2)
+static size_t CF_CRC_SumVectors(const uint8 *data, size_t len, uint32 *sum)
+{
+    const __m128i mask_b1 = _mm_set1_epi32(0x00FF0000);
+    const __m128i mask_b2 = _mm_set1_epi32(0x0000FF00);
+    __m128i       acc     = _mm_setzero_si128();
+    __m128i       v;
+    uint32        lanes[4];
+    size_t        i;
+
+    for (i = 0; (i + 16) <= len; i += 16)
+    {
+        /* SSE2 has no byte shuffle, so swap each little-endian lane with shifts and masks */
+        v   = _mm_loadu_si128((const __m128i *)&data[i]);
+        acc = _mm_add_epi32(acc, _mm_slli_epi32(v, 24));
+        acc = _mm_add_epi32(acc, _mm_and_si128(_mm_slli_epi32(v, 8), mask_b1));
+        acc = _mm_add_epi32(acc, _mm_and_si128(_mm_srli_epi32(v, 8), mask_b2));
+        acc = _mm_add_epi32(acc, _mm_srli_epi32(v, 24));
+    }
+
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    *sum += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    return i;
+}
+#elif defined(CF_CRC_VECTOR_NEON)
+static size_t CF_CRC_SumVectors(const uint8 *data, size_t len, uint32 *sum)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    size_t     i;
+
+    for (i = 0; (i + 16) <= len; i += 16)
+    {
+        acc = vaddq_u32(acc, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&data[i]))));
+    }
+
+    *sum += vgetq_lane_u32(acc, 0) + vgetq_lane_u32(acc, 1) + vgetq_lane_u32(acc, 2) + vgetq_lane_u32(acc, 3);
+
+    return i;
+}
+#else
+static inline size_t CF_CRC_SumVectors(const uint8 *data, size_t len, uint32 *sum)
+{
+    return 0;
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Legacy modular checksum: the sum of the big-endian 4-byte words of the
+ * file, the final partial word padded with zeros.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_ModularDigest(CF_Crc_t *crc, const uint8 *data, size_t len)
 {
     size_t i = 0;
+    size_t words_end;
+    uint32 sum = 0;
 
-    for (; i < len; ++i)
+    /* complete the word left partial by the previous call */
+    while (crc->index != 0 && i < len)
     {
-        crc->working <<= 8;
-        crc->working |= data[i];
+        CF_CRC_DigestByte(crc, data[i]);
+        ++i;
+    }
 
-        ++crc->index;
+    /*
+     * The rest starts on a word boundary of the stream (though not
+     * necessarily of memory), so whole words can be added directly.  This
+     * leaves the same working word as shifting in every byte would.
+     */
+    words_end = i + ((len - i) & ~(size_t)3);
+    if (words_end > i)
+    {
+        i += CF_CRC_SumVectors(&data[i], words_end - i, &sum);
 
-        if (crc->index == 4)
+        for (; i < words_end; i += 4)
         {
-            crc->result += crc->working;
-            crc->index = 0;
+            sum += CF_CRC_LoadWord(&data[i]);
         }
+
+        crc->result += sum;
+        crc->working = CF_CRC_LoadWord(&data[words_end - 4]);
+    }
+
+    /* the bytes of a final partial word */
+    for (; i < len; ++i)
+    {
+        CF_CRC_DigestByte(crc, data[i]);
     }
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_crc.h for argument/return detail
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Finalize(CF_Crc_t *crc)
+static void CF_CRC_ModularFinalize(CF_Crc_t *crc)
 {
     if (crc->index)
     {
@@ -88,3 +243,304 @@ void CF_CRC_Finalize(CF_Crc_t *crc)
         crc->working = 0;
     }
 }
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Build the slice-by-8 table of a reflected CRC-32 polynomial: row 0 is
+ * the usual byte table, and row n advances a byte by n further zero bytes.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_BuildSliceTable(CF_CRC_SliceTable_t table, uint32 poly)
+{
+    uint32 c;
+    int    i;
+    int    k;
+
+    for (i = 0; i < 256; ++i)
+    {
+        c = i;
+        for (k = 0; k < 8; ++k)
+        {
+            c = (c & 1) ? ((c >> 1) ^ poly) : (c >> 1);
+        }
+        table[0][i] = c;
+    }
+
+    for (i = 0; i < 256; ++i)
+    {
+        for (k = 1; k < 8; ++k)
+        {
+            table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Run a reflected CRC-32 over data, 8 bytes per table round.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CRC_SliceBy8(CF_CRC_SliceTable_t table, uint32 crc, const uint8 *data, size_t len)
+{
+    uint32 lo;
+    uint32 hi;
+
+    while (len >= 8)
+    {
+        lo = crc ^ ((uint32)data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24));
+        hi = (uint32)data[4] | ((uint32)data[5] << 8) | ((uint32)data[6] << 16) | ((uint32)data[7] << 24);
+
+        crc = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^ table[5][(lo >> 16) & 0xFF] ^ table[4][lo >> 24] ^
+              table[3][hi & 0xFF] ^ table[2][(hi >> 8) & 0xFF] ^ table[1][(hi >> 16) & 0xFF] ^ table[0][hi >> 24];
+
+        data += 8;
+        len -= 8;
+    }
+
+    while (len > 0)
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFF];
+        ++data;
+        --len;
+    }
+
+    return crc;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Crc32Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    crc->working = CF_CRC_SliceBy8(CF_CRC_Crc32Table, crc->working, data, len);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+#if defined(CF_CRC_HW_CRC32C_SSE42)
+static void CF_CRC_Crc32cDigest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    uint32 c = crc->working;
+    uint32 word32;
+#if defined(__x86_64__)
+    uint64 c64 = c;
+    uint64 word64;
+
+    while (len >= 8)
+    {
+        memcpy(&word64, data, sizeof(word64));
+        c64 = _mm_crc32_u64(c64, word64);
+        data += 8;
+        len -= 8;
+    }
+    c = (uint32)c64;
+#endif
+
+    while (len >= 4)
+    {
+        memcpy(&word32, data, sizeof(word32));
+        c = _mm_crc32_u32(c, word32);
+        data += 4;
+        len -= 4;
+    }
+
+    while (len > 0)
+    {
+        c = _mm_crc32_u8(c, *data);
+        ++data;
+        --len;
+    }
+
+    crc->working = c;
+}
+#elif defined(CF_CRC_HW_CRC32C_ARM)
+static void CF_CRC_Crc32cDigest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    uint32 c = crc->working;
+    uint64 word64;
+
+    while (len >= 8)
+    {
+        memcpy(&word64, data, sizeof(word64));
+        c = __crc32cd(c, word64);
+        data += 8;
+        len -= 8;
+    }
+
+    while (len > 0)
+    {
+        c = __crc32cb(c, *data);
+        ++data;
+        --len;
+    }
+
+    crc->working = c;
+}
+#else
+static void CF_CRC_Crc32cDigest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    crc->working = CF_CRC_SliceBy8(CF_CRC_Crc32cTable, crc->working, data, len);
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Result of the CRC types, which invert the register.  The register
+ * itself is kept, so digesting can continue.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Crc32Finalize(CF_Crc_t *crc)
+{
+    crc->result = ~crc->working;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_NullDigest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    /* the null checksum does not depend on the data */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_NullFinalize(CF_Crc_t *crc)
+{
+    crc->result = 0;
+}
+
+/**
+ * @brief The supported algorithms, by checksum type; unsupported types have no functions
+ */
+static const CF_CRC_Algorithm_t CF_CRC_ALGORITHMS[CF_CRC_Type_NUM] = {
+    [CF_CRC_Type_MODULAR] = {0, CF_CRC_ModularDigest, CF_CRC_ModularFinalize},
+    [CF_CRC_Type_CRC32C]  = {0xFFFFFFFF, CF_CRC_Crc32cDigest, CF_CRC_Crc32Finalize},
+    [CF_CRC_Type_CRC32]   = {0xFFFFFFFF, CF_CRC_Crc32Digest, CF_CRC_Crc32Finalize},
+    [CF_CRC_Type_NULL]    = {0, CF_CRC_NullDigest, CF_CRC_NullFinalize},
+};
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static const CF_CRC_Algorithm_t *CF_CRC_GetAlgorithm(uint8 type)
+{
+    const CF_CRC_Algorithm_t *alg = NULL;
+
+    if (type < CF_CRC_Type_NUM && CF_CRC_ALGORITHMS[type].digest != NULL)
+    {
+        alg = &CF_CRC_ALGORITHMS[type];
+    }
+
+    return alg;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Start(CF_Crc_t *crc)
+{
+    memset(crc, 0, sizeof(*crc));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CRC_StartType(CF_Crc_t *crc, uint8 type)
+{
+    const CF_CRC_Algorithm_t *alg = CF_CRC_GetAlgorithm(type);
+    CFE_Status_t              ret = CFE_SUCCESS;
+
+    memset(crc, 0, sizeof(*crc));
+    crc->type = type;
+
+    if (alg == NULL)
+    {
+        ret = CFE_STATUS_NOT_IMPLEMENTED;
+    }
+    else
+    {
+        crc->working = alg->initial;
+
+        if (type == CF_CRC_Type_CRC32 && !CF_CRC_Crc32TableReady)
+        {
+            CF_CRC_BuildSliceTable(CF_CRC_Crc32Table, CF_CRC_CRC32_POLY);
+            CF_CRC_Crc32TableReady = true;
+        }
+#if !defined(CF_CRC_HW_CRC32C_SSE42) && !defined(CF_CRC_HW_CRC32C_ARM)
+        if (type == CF_CRC_Type_CRC32C && !CF_CRC_Crc32cTableReady)
+        {
+            CF_CRC_BuildSliceTable(CF_CRC_Crc32cTable, CF_CRC_CRC32C_POLY);
+            CF_CRC_Crc32cTableReady = true;
+        }
+#endif
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CRC_ValidateType(uint8 type)
+{
+    return (CF_CRC_GetAlgorithm(type) != NULL) ? CFE_SUCCESS : CFE_STATUS_NOT_IMPLEMENTED;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    const CF_CRC_Algorithm_t *alg = CF_CRC_GetAlgorithm(crc->type);
+
+    if (alg != NULL)
+    {
+        alg->digest(crc, data, len);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Finalize(CF_Crc_t *crc)
+{
+    const CF_CRC_Algorithm_t *alg = CF_CRC_GetAlgorithm(crc->type);
+
+    if (alg != NULL)
+    {
+        alg->finalize(crc);
+    }
+}
@@ -28,18 +28,41 @@
 
 #include "cfe.h"
 
+/**
+ * @brief File checksum algorithms
+ *
+ * The values are the checksum type identifiers carried in the metadata PDU,
+ * as assigned in the SANA checksum identifiers registry.  Types not listed
+ * here are not supported.
+ */
+typedef enum
+{
+    CF_CRC_Type_MODULAR = 0,  /**< \brief Legacy CFDP modular checksum */
+    CF_CRC_Type_CRC32C  = 2,  /**< \brief CRC-32C (Castagnoli) */
+    CF_CRC_Type_CRC32   = 3,  /**< \brief IEEE 802.3 CRC-32 */
+    CF_CRC_Type_NULL    = 15, /**< \brief Null checksum, always 0 and always passes */
+    CF_CRC_Type_NUM     = 16  /**< \brief Number of checksum type identifiers, the field is 4 bits */
+} CF_CRC_Type_t;
+
 /**
  * @brief CRC state object
+ *
+ * For the modular checksum, working is the partial word and index the number
+ * of bytes in it.  For the CRC types, working is the CRC register.
  */
 typedef struct CF_Crc
 {
     uint32 working;
     uint32 result;
     uint8  index;
+    uint8  type; /**< \brief checksum algorithm, a CF_CRC_Type_t value */
 } CF_Crc_t;
 
 /************************************************************************/
 /** @brief Start a CRC streamable digest.
+ *
+ * @par Description
+ *       Starts a digest with the modular checksum.
  *
  * @par Assumptions, External Events, and Notes:
  *       crc must not be NULL.
@@ -48,12 +71,42 @@ typedef struct CF_Crc
  */
 void CF_CRC_Start(CF_Crc_t *crc);
 
+/************************************************************************/
+/** @brief Start a CRC streamable digest with the given checksum algorithm.
+ *
+ * @par Description
+ *       The type is kept in the CRC object even if it is not supported, in
+ *       which case digesting does nothing and the result stays 0.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       crc must not be NULL.  The first start of a CRC type builds its
+ *       lookup tables, so this is not safe to call from several tasks.
+ *
+ * @param crc   CRC object to operate on
+ * @param type  Checksum type, see CF_CRC_Type_t
+ *
+ * @returns CFE_SUCCESS if the type is supported
+ * @retval  CFE_STATUS_NOT_IMPLEMENTED if the type is not supported
+ */
+CFE_Status_t CF_CRC_StartType(CF_Crc_t *crc, uint8 type);
+
+/************************************************************************/
+/** @brief Check whether a checksum algorithm is supported.
+ *
+ * @param type  Checksum type, see CF_CRC_Type_t
+ *
+ * @returns CFE_SUCCESS if the type is supported
+ * @retval  CFE_STATUS_NOT_IMPLEMENTED if the type is not supported
+ */
+CFE_Status_t CF_CRC_ValidateType(uint8 type);
+
 /************************************************************************/
 /** @brief Digest a chunk for CRC calculation.
  *
  * @par Description
- *       Does the CRC calculation, and stores an index into the given
- *       4-byte word in case the input was not evenly divisible for 4.
+ *       Does the CRC calculation.  For the modular checksum, stores an index
+ *       into the given 4-byte word in case the input was not evenly divisible
+ *       for 4.
  *
  * @par Assumptions, External Events, and Notes:
  *       crc must not be NULL.
@@ -71,7 +124,8 @@ void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len);
  * @par Description
  *       Checks the index and if it isn't 0, does the final calculations
  *       on the bytes in the shift register. After this call is made, the
- *       result field of the structure holds the result.
+ *       result field of the structure holds the result.  Digesting may
+ *       continue afterwards, for all types.
  *
  * @par Assumptions, External Events, and Notes:
  *       crc must not be NULL.
@@ -64,6 +64,10 @@ void CF_ProcessGroundCommand(const CFE_SB_Buffer_t *msg)
         [CF_PURGE_QUEUE_CC]         = (handler_fn_t)CF_PurgeQueueCmd,
         [CF_ENABLE_ENGINE_CC]       = (handler_fn_t)CF_EnableEngineCmd,
         [CF_DISABLE_ENGINE_CC]      = (handler_fn_t)CF_DisableEngineCmd,
+        [CF_TX_MANIFEST_CC]         = (handler_fn_t)CF_TxManifestCmd,
+        [CF_ENABLE_PERF_STATS_CC]   = (handler_fn_t)CF_EnablePerfStatsCmd,
+        [CF_DISABLE_PERF_STATS_CC]  = (handler_fn_t)CF_DisablePerfStatsCmd,
+        [CF_TX_FILE_MULTI_CC]       = (handler_fn_t)CF_TxFileMultiCmd,
     };
 
     static const uint16 expected_lengths[] = {
@@ -87,6 +91,10 @@ void CF_ProcessGroundCommand(const CFE_SB_Buffer_t *msg)
         [CF_PURGE_QUEUE_CC]         = sizeof(CF_UnionArgs_Payload_t),
         [CF_ENABLE_ENGINE_CC]       = sizeof(CF_EnableEngineCmd_t),
         [CF_DISABLE_ENGINE_CC]      = sizeof(CF_DisableEngineCmd_t),
+        [CF_TX_MANIFEST_CC]         = sizeof(CF_TxManifestCmd_t),
+        [CF_ENABLE_PERF_STATS_CC]   = sizeof(CF_EnablePerfStatsCmd_t),
+        [CF_DISABLE_PERF_STATS_CC]  = sizeof(CF_DisablePerfStatsCmd_t),
+        [CF_TX_FILE_MULTI_CC]       = sizeof(CF_TxFileMultiCmd_t),
     };
 
     CFE_MSG_FcnCode_t cmd = 0;
@@ -17,9 +17,11 @@ static const EdsDispatchTable_CF_Application_CFE_SB_Telecommand_t CF_TC_DISPATCH
             .DisableDequeueCmd_indication    = CF_DisableDequeueCmd,
             .DisableDirPollingCmd_indication = CF_DisableDirPollingCmd,
             .DisableEngineCmd_indication     = CF_DisableEngineCmd,
+            .DisablePerfStatsCmd_indication  = CF_DisablePerfStatsCmd,
             .EnableDequeueCmd_indication     = CF_EnableDequeueCmd,
             .EnableDirPollingCmd_indication  = CF_EnableDirPollingCmd,
             .EnableEngineCmd_indication      = CF_EnableEngineCmd,
+            .EnablePerfStatsCmd_indication   = CF_EnablePerfStatsCmd,
             .FreezeCmd_indication            = CF_FreezeCmd,
             .GetParamCmd_indication          = CF_GetParamCmd,
             .NoopCmd_indication              = CF_NoopCmd,
@@ -31,6 +33,8 @@ static const EdsDispatchTable_CF_Application_CFE_SB_Telecommand_t CF_TC_DISPATCH
             .SuspendCmd_indication           = CF_SuspendCmd,
             .ThawCmd_indication              = CF_ThawCmd,
             .TxFileCmd_indication            = CF_TxFileCmd,
+            .TxFileMultiCmd_indication       = CF_TxFileMultiCmd,
+            .TxManifestCmd_indication        = CF_TxManifestCmd,
             .WriteQueueCmd_indication        = CF_WriteQueueCmd,
         },
     .SEND_HK = {.indication = CF_SendHkCmd},
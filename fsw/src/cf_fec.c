@@ -0,0 +1,247 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application forward error correction source file
+ *
+ *  These are the calculations of the XOR parity of class 1 transactions.
+ *  They do not touch the file or send anything, which is left to the
+ *  send and receive state machines.
+ */
+
+#include "cf_fec.h"
+
+#include <string.h>
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Fec_Xor(uint8 *dst, const uint8 *src, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i)
+    {
+        dst[i] ^= src[i];
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_FileSize_t CF_Fec_SegmentEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t offset)
+{
+    return (offset / params->segment_size + 1) * params->segment_size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_FileSize_t CF_Fec_GroupEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, CF_FileSize_t fsize)
+{
+    CF_FileSize_t end = group_offset + ((CF_FileSize_t)params->group_size * params->segment_size);
+
+    return (end < fsize) ? end : fsize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CF_Fec_SegmentLength(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, uint8 index,
+                            CF_FileSize_t fsize)
+{
+    CF_FileSize_t start = group_offset + ((CF_FileSize_t)index * params->segment_size);
+    size_t        len   = 0;
+
+    if (start < fsize)
+    {
+        len = params->segment_size;
+        if ((fsize - start) < len)
+        {
+            len = fsize - start;
+        }
+    }
+
+    return len;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_FecEncoder_Init(CF_FecEncoder_t *enc, const CF_Logical_FecParams_t *params)
+{
+    enc->params       = *params;
+    enc->group_offset = 0;
+    enc->parity_len   = 0;
+    enc->ready        = false;
+    memset(enc->parity, 0, sizeof(enc->parity));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_FecEncoder_Add(CF_FecEncoder_t *enc, CF_FileSize_t offset, const uint8 *data, size_t len,
+                       CF_FileSize_t fsize)
+{
+    CF_FileSize_t group_end = CF_Fec_GroupEnd(&enc->params, enc->group_offset, fsize);
+    size_t        seg_pos;
+
+    if (offset >= enc->group_offset && offset < group_end)
+    {
+        seg_pos = (offset - enc->group_offset) % enc->params.segment_size;
+        if ((seg_pos + len) <= enc->params.segment_size)
+        {
+            CF_Fec_Xor(&enc->parity[seg_pos], data, len);
+            if ((seg_pos + len) > enc->parity_len)
+            {
+                enc->parity_len = seg_pos + len;
+            }
+
+            if ((offset + len) >= group_end)
+            {
+                enc->ready = true;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_FecEncoder_NextGroup(CF_FecEncoder_t *enc)
+{
+    enc->group_offset += (CF_FileSize_t)enc->params.group_size * enc->params.segment_size;
+    enc->parity_len = 0;
+    enc->ready      = false;
+    memset(enc->parity, 0, sizeof(enc->parity));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_FecDecoder_Init(CF_FecDecoder_t *dec, const CF_Logical_FecParams_t *params)
+{
+    memset(dec, 0, sizeof(*dec));
+
+    if (params->group_size != 0 && params->group_size <= CF_FEC_MAX_GROUP_SIZE && params->segment_size != 0 &&
+        params->segment_size <= CF_FEC_MAX_SEGMENT_SIZE)
+    {
+        dec->params = *params;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_FecDecoder_Add(CF_FecDecoder_t *dec, CF_FileSize_t offset, size_t len, CF_FileSize_t fsize)
+{
+    CF_FileSize_t group_len = (CF_FileSize_t)dec->params.group_size * dec->params.segment_size;
+    CF_FileSize_t group_offset;
+    CF_FileSize_t seg_start;
+    size_t        seg_len;
+    uint8         i;
+
+    if (group_len != 0)
+    {
+        group_offset = offset - (offset % group_len);
+        if (group_offset > dec->group_offset)
+        {
+            dec->group_offset = group_offset;
+            dec->recv_mask    = 0;
+        }
+
+        if (group_offset == dec->group_offset)
+        {
+            /* first segment starting within the data, then all those the data covers to their end */
+            i = (offset - group_offset + dec->params.segment_size - 1) / dec->params.segment_size;
+            while (i < dec->params.group_size)
+            {
+                seg_start = group_offset + ((CF_FileSize_t)i * dec->params.segment_size);
+                seg_len   = CF_Fec_SegmentLength(&dec->params, group_offset, i, fsize);
+                if (seg_len == 0 || (seg_start + seg_len) > (offset + len))
+                {
+                    break;
+                }
+
+                dec->recv_mask |= (uint32)1 << i;
+                ++i;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_fec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_FecDecoder_GetLost(const CF_FecDecoder_t *dec, CF_FileSize_t group_offset, CF_FileSize_t fsize, uint8 *lost)
+{
+    CF_FileSize_t group_len = (CF_FileSize_t)dec->params.group_size * dec->params.segment_size;
+    uint32        recv_mask;
+    uint8         num_lost = 0;
+    uint8         i;
+
+    if (group_len != 0 && (group_offset % group_len) == 0 && group_offset >= dec->group_offset)
+    {
+        /* nothing is known of a later group, so all of it is missing */
+        recv_mask = (group_offset == dec->group_offset) ? dec->recv_mask : 0;
+
+        for (i = 0; i < dec->params.group_size && CF_Fec_SegmentLength(&dec->params, group_offset, i, fsize) != 0; ++i)
+        {
+            if (!(recv_mask & ((uint32)1 << i)))
+            {
+                *lost = i;
+                ++num_lost;
+            }
+        }
+    }
+
+    return num_lost == 1;
+}
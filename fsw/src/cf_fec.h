@@ -0,0 +1,197 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * The CF Application forward error correction header file
+ *
+ * A class 1 sender may follow each group of file data segments with a
+ * parity PDU, which is the XOR of the segments of the group.  A receiver
+ * that lost one segment of a group rebuilds it from the parity and the
+ * other segments, without any return link.
+ *
+ * The file is cut into segments of segment_size bytes, and the segments
+ * into groups of group_size segments, counting from the start of the file.
+ * The last segment and the last group of the file may be shorter.
+ */
+
+#ifndef CF_FEC_H
+#define CF_FEC_H
+
+#include "cfe.h"
+#include "cf_logical_pdu.h"
+
+/**
+ * @brief Maximum number of segments in a group, one per bit of the received mask
+ */
+#define CF_FEC_MAX_GROUP_SIZE 32
+
+/**
+ * @brief Maximum size of a segment, so that its parity fits in a single PDU
+ *
+ * Leaves room for the largest header, the directive code, a 64-bit offset and the PDU CRC.
+ */
+#define CF_FEC_MAX_SEGMENT_SIZE \
+    (CF_MAX_PDU_SIZE - CF_APP_MAX_HEADER_SIZE - 1 - sizeof(CF_CFDP_uint64_t) - sizeof(CF_CFDP_uint16_t))
+
+/**
+ * @brief Parity calculation of the group being sent
+ */
+typedef struct CF_FecEncoder
+{
+    CF_Logical_FecParams_t params;
+    CF_FileSize_t          group_offset; /**< \brief file offset of the first segment of the group */
+    size_t                 parity_len;   /**< \brief length of the longest segment of the group so far */
+    bool                   ready;        /**< \brief the group is complete, its parity is to be sent */
+    bool                   in_use;       /**< \brief taken by a send transaction */
+    uint8                  parity[CF_FEC_MAX_SEGMENT_SIZE];
+} CF_FecEncoder_t;
+
+/**
+ * @brief Tracking of the group being received
+ *
+ * Only the segments received whole in a single file data PDU are counted.
+ */
+typedef struct CF_FecDecoder
+{
+    CF_Logical_FecParams_t params;       /**< \brief group_size is 0 if the sender adds no parity */
+    CF_FileSize_t          group_offset; /**< \brief file offset of the first segment of the group */
+    uint32                 recv_mask;    /**< \brief one bit for each segment of the group received */
+} CF_FecDecoder_t;
+
+/************************************************************************/
+/** @brief XOR a block of data into another.
+ *
+ * @param dst  Data to XOR into
+ * @param src  Data to XOR with
+ * @param len  Length of both blocks
+ */
+void CF_Fec_Xor(uint8 *dst, const uint8 *src, size_t len);
+
+/************************************************************************/
+/** @brief Get the end of the segment holding a file offset.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       segment_size of params must not be 0.
+ *
+ * @param params  Forward error correction parameters
+ * @param offset  File offset
+ *
+ * @returns File offset of the end of the segment, which may be past the end of the file
+ */
+CF_FileSize_t CF_Fec_SegmentEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t offset);
+
+/************************************************************************/
+/** @brief Get the end of a group.
+ *
+ * @param params        Forward error correction parameters
+ * @param group_offset  File offset of the first segment of the group
+ * @param fsize         Size of the file
+ *
+ * @returns File offset of the end of the group, no further than the end of the file
+ */
+CF_FileSize_t CF_Fec_GroupEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, CF_FileSize_t fsize);
+
+/************************************************************************/
+/** @brief Get the length of a segment of a group.
+ *
+ * @param params        Forward error correction parameters
+ * @param group_offset  File offset of the first segment of the group
+ * @param index         Index of the segment in the group
+ * @param fsize         Size of the file
+ *
+ * @returns Length of the segment, 0 if it starts at or past the end of the file
+ */
+size_t CF_Fec_SegmentLength(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, uint8 index,
+                            CF_FileSize_t fsize);
+
+/************************************************************************/
+/** @brief Start the parity calculation of the first group of a file.
+ *
+ * @param enc     Encoder to start
+ * @param params  Forward error correction parameters, copied
+ */
+void CF_FecEncoder_Init(CF_FecEncoder_t *enc, const CF_Logical_FecParams_t *params);
+
+/************************************************************************/
+/** @brief Add file data to the parity of the group.
+ *
+ * @par Description
+ *       Marks the parity ready once the data reaches the end of the group.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       The data must be sent in order and lie within a single segment of
+ *       the group.  Data that does not is not added.
+ *
+ * @param enc     Encoder to add to
+ * @param offset  File offset of the data
+ * @param data    File data
+ * @param len     Length of the data
+ * @param fsize   Size of the file
+ */
+void CF_FecEncoder_Add(CF_FecEncoder_t *enc, CF_FileSize_t offset, const uint8 *data, size_t len,
+                       CF_FileSize_t fsize);
+
+/************************************************************************/
+/** @brief Move on to the next group, once the parity of the group is sent.
+ *
+ * @param enc  Encoder to advance
+ */
+void CF_FecEncoder_NextGroup(CF_FecEncoder_t *enc);
+
+/************************************************************************/
+/** @brief Start tracking the segments of a file being received.
+ *
+ * @par Description
+ *       Parameters out of the range CF supports are taken as no parity,
+ *       so the parity PDUs are ignored.
+ *
+ * @param dec     Decoder to start
+ * @param params  Forward error correction parameters from the metadata PDU, copied
+ */
+void CF_FecDecoder_Init(CF_FecDecoder_t *dec, const CF_Logical_FecParams_t *params);
+
+/************************************************************************/
+/** @brief Record received file data.
+ *
+ * @par Description
+ *       Marks the segments the data covers whole.  Data of a later group
+ *       starts tracking that group, data of an earlier group is ignored.
+ *
+ * @param dec     Decoder to record in
+ * @param offset  File offset of the data
+ * @param len     Length of the data
+ * @param fsize   Size of the file
+ */
+void CF_FecDecoder_Add(CF_FecDecoder_t *dec, CF_FileSize_t offset, size_t len, CF_FileSize_t fsize);
+
+/************************************************************************/
+/** @brief Find the segment a parity PDU can rebuild.
+ *
+ * @param dec           Decoder to check
+ * @param group_offset  File offset of the group of the parity PDU
+ * @param fsize         Size of the file
+ * @param lost          Output index of the missing segment in the group
+ *
+ * @returns true if exactly one segment of the group is missing
+ */
+bool CF_FecDecoder_GetLost(const CF_FecDecoder_t *dec, CF_FileSize_t group_offset, CF_FileSize_t fsize, uint8 *lost);
+
+#endif /* !CF_FEC_H */
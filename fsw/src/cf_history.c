@@ -0,0 +1,243 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application history ring source file
+ *
+ *  The names of each record are written to the arena right after those of
+ *  the record before it, so the arena is used as a byte FIFO in step with
+ *  the record ring.  The names of one record are never split across the
+ *  end of the arena.
+ */
+
+#include "cfe.h"
+#include "cf_app.h"
+#include "cf_history.h"
+#include "cf_assert.h"
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Splits a path into a directory held in the ring's name table and the
+ * rest of the name.  If the table is full, the leaf is the whole path.
+ *
+ *-----------------------------------------------------------------*/
+static CF_NameHandle_t CF_HistoryRing_SplitName(CF_HistoryRing_t *ring, const char *path, char *leaf,
+                                                size_t leaf_size)
+{
+    CF_NameHandle_t prefix = CF_NameTable_InternPath(ring->prefixes, path, leaf, leaf_size);
+
+    if (prefix == CF_NAME_HANDLE_INVALID)
+    {
+        strncpy(leaf, path, leaf_size - 1);
+        leaf[leaf_size - 1] = 0;
+    }
+
+    return prefix;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Drops the oldest record, releasing its directories.  Its names are
+ * freed implicitly, as the oldest record now starts further on.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_HistoryRing_DropOldest(CF_HistoryRing_t *ring)
+{
+    CF_HistoryRecord_t *rec = &ring->records[ring->oldest];
+
+    CF_NameTable_Release(ring->prefixes, rec->src_prefix);
+    CF_NameTable_Release(ring->prefixes, rec->dst_prefix);
+
+    ring->oldest = (ring->oldest + 1) % ring->num_records;
+    --ring->count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Drops the oldest records until there is a free record and len bytes
+ * of contiguous free arena, and returns the offset of that space.
+ *
+ *-----------------------------------------------------------------*/
+static uint16 CF_HistoryRing_MakeRoom(CF_HistoryRing_t *ring, uint16 len)
+{
+    uint16 start;
+
+    while (ring->count)
+    {
+        if (ring->count < ring->num_records)
+        {
+            /* every record has at least one byte of names, so start == names_head means the arena is full */
+            start = ring->records[ring->oldest].name_offset;
+            if (start < ring->names_head)
+            {
+                /* free space is from names_head to the end, and from the start up to the oldest names */
+                if ((ring->names_size - ring->names_head) >= len)
+                {
+                    return ring->names_head;
+                }
+                if (start >= len)
+                {
+                    return 0;
+                }
+            }
+            else if ((start > ring->names_head) && ((start - ring->names_head) >= len))
+            {
+                return ring->names_head;
+            }
+        }
+
+        CF_HistoryRing_DropOldest(ring);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_history.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_HistoryRing_Init(CF_HistoryRing_t *ring, CF_HistoryRecord_t *records, uint16 num_records, char *names,
+                         uint16 names_size, CF_NameTable_t *prefixes)
+{
+    CF_Assert(num_records && (names_size >= (CF_FILENAME_MAX_LEN * 2)));
+
+    memset(ring, 0, sizeof(*ring));
+    ring->records     = records;
+    ring->num_records = num_records;
+    ring->names       = names;
+    ring->names_size  = names_size;
+    ring->prefixes    = prefixes;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_history.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_HistoryRing_Add(CF_HistoryRing_t *ring, const CF_History_t *history)
+{
+    CF_HistoryRecord_t *rec;
+    CF_NameHandle_t     src_prefix;
+    CF_NameHandle_t     dst_prefix;
+    char                src_leaf[CF_FILENAME_MAX_LEN];
+    char                dst_leaf[CF_FILENAME_MAX_LEN];
+    uint16              src_len;
+    uint16              dst_len;
+    uint16              offset;
+    uint8               flags;
+
+    CF_Assert(history->dir < CF_Direction_NUM);
+
+    src_prefix = CF_HistoryRing_SplitName(ring, history->fnames.src_filename, src_leaf, sizeof(src_leaf));
+    dst_prefix = CF_HistoryRing_SplitName(ring, history->fnames.dst_filename, dst_leaf, sizeof(dst_leaf));
+
+    flags   = history->dir;
+    src_len = strlen(src_leaf) + 1;
+    dst_len = strlen(dst_leaf) + 1;
+    if (!strcmp(src_leaf, dst_leaf))
+    {
+        flags |= CF_HISTORY_FLAG_SAME_LEAF;
+        dst_len = 0;
+    }
+
+    offset = CF_HistoryRing_MakeRoom(ring, src_len + dst_len);
+    memcpy(&ring->names[offset], src_leaf, src_len);
+    memcpy(&ring->names[offset + src_len], dst_leaf, dst_len);
+    ring->names_head = offset + src_len + dst_len;
+
+    rec = &ring->records[(ring->oldest + ring->count) % ring->num_records];
+    ++ring->count;
+    ++ring->num_added;
+
+    rec->seq_num     = history->seq_num;
+    rec->peer_eid    = history->peer_eid;
+    rec->src_prefix  = src_prefix;
+    rec->dst_prefix  = dst_prefix;
+    rec->name_offset = offset;
+    rec->txn_stat    = history->txn_stat;
+    rec->flags       = flags;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_history.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_HistoryRing_Get(const CF_HistoryRing_t *ring, uint16 index, CF_History_t *history)
+{
+    const CF_HistoryRecord_t *rec;
+    const char *              src_leaf;
+    const char *              dst_leaf;
+
+    CF_Assert(index < ring->count);
+
+    rec      = &ring->records[(ring->oldest + index) % ring->num_records];
+    src_leaf = &ring->names[rec->name_offset];
+    dst_leaf = src_leaf;
+    if (!(rec->flags & CF_HISTORY_FLAG_SAME_LEAF))
+    {
+        dst_leaf += strlen(src_leaf) + 1;
+    }
+
+    history->dir      = rec->flags & CF_HISTORY_FLAG_DIR_MASK;
+    history->txn_stat = rec->txn_stat;
+    history->peer_eid = rec->peer_eid;
+    history->seq_num  = rec->seq_num;
+    if (history->dir == CF_Direction_TX)
+    {
+        history->src_eid = CF_AppData.config_table->local_eid;
+    }
+    else
+    {
+        history->src_eid = rec->peer_eid;
+    }
+
+    CF_NameTable_BuildPath(ring->prefixes, rec->src_prefix, src_leaf, history->fnames.src_filename,
+                           sizeof(history->fnames.src_filename));
+    CF_NameTable_BuildPath(ring->prefixes, rec->dst_prefix, dst_leaf, history->fnames.dst_filename,
+                           sizeof(history->fnames.dst_filename));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_history.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_HistoryRing_Clear(CF_HistoryRing_t *ring)
+{
+    while (ring->count)
+    {
+        CF_HistoryRing_DropOldest(ring);
+    }
+
+    ring->names_head = 0;
+}
@@ -0,0 +1,90 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application history ring header file
+ *
+ *  Finished transactions are kept per channel as small fixed size records,
+ *  with the file names split into a shared directory and a leaf that is
+ *  stored in a name arena.  Entries are expanded back to a CF_History_t
+ *  when they are read.
+ */
+
+#ifndef CF_HISTORY_H
+#define CF_HISTORY_H
+
+#include "cf_cfdp_types.h"
+
+/************************************************************************/
+/** @brief Initialize a history ring.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       None of the pointers may be NULL.  names_size must be at least twice
+ *       CF_FILENAME_MAX_LEN so that any one entry fits.
+ *
+ * @param ring         History ring to initialize
+ * @param records      Storage for the records
+ * @param num_records  Number of records in the storage
+ * @param names        Storage for the names
+ * @param names_size   Size of the name storage
+ * @param prefixes     Name table to keep the directories in
+ */
+void CF_HistoryRing_Init(CF_HistoryRing_t *ring, CF_HistoryRecord_t *records, uint16 num_records, char *names,
+                         uint16 names_size, CF_NameTable_t *prefixes);
+
+/************************************************************************/
+/** @brief Add a finished transaction to a history ring.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       ring and history must not be NULL.  history->dir must be RX or TX.
+ *       The oldest entries are dropped to make room, as many as needed.  If
+ *       a directory cannot be added to the name table, the whole file name
+ *       is stored in the arena instead.
+ *
+ * @param ring     History ring
+ * @param history  Entry to store
+ */
+void CF_HistoryRing_Add(CF_HistoryRing_t *ring, const CF_History_t *history);
+
+/************************************************************************/
+/** @brief Get an entry from a history ring.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       ring and history must not be NULL.  index must be less than the
+ *       number of entries in the ring.
+ *
+ * @param ring     History ring
+ * @param index    Index of the entry, 0 is the oldest
+ * @param history  Output entry
+ */
+void CF_HistoryRing_Get(const CF_HistoryRing_t *ring, uint16 index, CF_History_t *history);
+
+/************************************************************************/
+/** @brief Drop all entries from a history ring.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       ring must not be NULL.
+ *
+ * @param ring  History ring
+ */
+void CF_HistoryRing_Clear(CF_HistoryRing_t *ring);
+
+#endif /* !CF_HISTORY_H */
@@ -68,12 +68,11 @@
 /**
  * @brief Type for logical file size/offset value
  *
- * The CFDP protocol permits use of 64-bit values for file size/offsets
- * Although the CF application only supports 32-bit legacy file size
- * type at this point, the logical structures should use this type in
- * case future support for large files is added.
+ * The CFDP protocol permits use of 64-bit values for file size/offsets.
+ * These are encoded in 32 bits, unless the large file flag of the PDU
+ * header is set, which CF does for files of 4 GiB or more.
  */
-typedef uint32 CF_FileSize_t;
+typedef uint64 CF_FileSize_t;
 
 /*
  * Note that by exploding the bit-fields into separate members, this will make the
@@ -257,6 +256,20 @@ typedef struct CF_Logical_PduAck
     CF_CFDP_AckTxnStatus_t  txn_status;
 } CF_Logical_PduAck_t;
 
+/**
+ * @brief Structure representing forward error correction parameters
+ *
+ * Not part of CCSDS 727.0-B-5, these are carried in the metadata PDU
+ * of a class 1 transaction in a CF message to user.
+ *
+ * @sa CF_CFDP_FecMsg_t for encoded form
+ */
+typedef struct CF_Logical_FecParams
+{
+    uint8  group_size;   /**< \brief file data segments per parity PDU, 0 if there are no parity PDUs */
+    uint16 segment_size; /**< \brief size of each segment, the last one of the file may be shorter */
+} CF_Logical_FecParams_t;
+
 /**
  * @brief Structure representing CFDP Metadata PDU
  *
@@ -271,6 +284,8 @@ typedef struct CF_Logical_PduMd
 
     CF_Logical_Lv_t source_filename;
     CF_Logical_Lv_t dest_filename;
+
+    CF_Logical_FecParams_t fec; /**< \brief from the CF message to user, if any, otherwise all 0 */
 } CF_Logical_PduMd_t;
 
 /**
@@ -303,6 +318,19 @@ typedef struct CF_Logical_PduFileDataHeader
     size_t      data_len; /**< \brief Length of data blob within encoded PDU (derived field) */
 } CF_Logical_PduFileDataHeader_t;
 
+/**
+ * @brief Structure representing logical Parity PDU
+ *
+ * Not part of CCSDS 727.0-B-5, see CF_CFDP_FileDirective_PARITY
+ */
+typedef struct CF_Logical_PduParity
+{
+    CF_FileSize_t offset; /**< \brief Offset in file of the first segment of the group */
+
+    const void *data_ptr; /**< \brief pointer to read-only data blob within encoded PDU */
+    size_t      data_len; /**< \brief Length of data blob within encoded PDU (derived field) */
+} CF_Logical_PduParity_t;
+
 /**
  * @brief A union of all possible internal header types in a PDU
  *
@@ -311,12 +339,13 @@ typedef struct CF_Logical_PduFileDataHeader
  */
 typedef union CF_Logical_IntHeader
 {
-    CF_Logical_PduEof_t            eof; /**< \brief valid when pdu_type=0 + directive_code=EOF (4) */
-    CF_Logical_PduFin_t            fin; /**< \brief valid when pdu_type=0 + directive_code=FIN (5) */
-    CF_Logical_PduAck_t            ack; /**< \brief valid when pdu_type=0 + directive_code=ACK (6) */
-    CF_Logical_PduMd_t             md;  /**< \brief valid when pdu_type=0 + directive_code=METADATA (7) */
-    CF_Logical_PduNak_t            nak; /**< \brief valid when pdu_type=0 + directive_code=NAK (8) */
-    CF_Logical_PduFileDataHeader_t fd;  /**< \brief valid when pdu_type=1 (directive_code is not applicable) */
+    CF_Logical_PduEof_t            eof;    /**< \brief valid when pdu_type=0 + directive_code=EOF (4) */
+    CF_Logical_PduFin_t            fin;    /**< \brief valid when pdu_type=0 + directive_code=FIN (5) */
+    CF_Logical_PduAck_t            ack;    /**< \brief valid when pdu_type=0 + directive_code=ACK (6) */
+    CF_Logical_PduMd_t             md;     /**< \brief valid when pdu_type=0 + directive_code=METADATA (7) */
+    CF_Logical_PduNak_t            nak;    /**< \brief valid when pdu_type=0 + directive_code=NAK (8) */
+    CF_Logical_PduParity_t         parity; /**< \brief valid when pdu_type=0 + directive_code=PARITY (13) */
+    CF_Logical_PduFileDataHeader_t fd;     /**< \brief valid when pdu_type=1 (directive_code is not applicable) */
 } CF_Logical_IntHeader_t;
 
 /**
@@ -354,6 +383,12 @@ typedef struct CF_Logical_PduBuffer
      */
     CF_Logical_IntHeader_t int_header;
 
+    /**
+     * \brief Set by CF_CFDP_RecvPh() when the file data header in int_header.fd
+     * was decoded along with the PDU header, so it must not be decoded again.
+     */
+    bool fd_decoded;
+
     /**
      * \brief Some PDU types might have a CRC at the end.  If so, this
      * field reflects the value of that CRC.  Its presence/validity
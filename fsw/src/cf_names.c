@@ -0,0 +1,180 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application interned path name source file
+ *
+ *  The table is small and only searched when a record is created, so a
+ *  linear search is used.  Strings are compared by content, so the same
+ *  prefix used by many records is only stored once.
+ */
+
+#include "cfe.h"
+#include "cf_names.h"
+#include "cf_assert.h"
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_NameTable_Init(CF_NameTable_t *tab, CF_NameEntry_t *entries, uint16 num_entries)
+{
+    CF_Assert(num_entries < CF_NAME_HANDLE_INVALID);
+
+    memset(entries, 0, sizeof(*entries) * num_entries);
+    tab->entries     = entries;
+    tab->num_entries = num_entries;
+    tab->num_used    = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_NameHandle_t CF_NameTable_Intern(CF_NameTable_t *tab, const char *str, size_t len)
+{
+    CF_NameEntry_t *entry;
+    CF_NameHandle_t free_slot = CF_NAME_HANDLE_INVALID;
+    CF_NameHandle_t i;
+
+    if (len >= sizeof(entry->str))
+    {
+        return CF_NAME_HANDLE_INVALID;
+    }
+
+    for (i = 0; i < tab->num_entries; ++i)
+    {
+        entry = &tab->entries[i];
+        if (!entry->refs)
+        {
+            if (free_slot == CF_NAME_HANDLE_INVALID)
+            {
+                free_slot = i;
+            }
+        }
+        else if (!strncmp(entry->str, str, len) && !entry->str[len])
+        {
+            ++entry->refs;
+            return i;
+        }
+    }
+
+    if (free_slot != CF_NAME_HANDLE_INVALID)
+    {
+        entry = &tab->entries[free_slot];
+        memcpy(entry->str, str, len);
+        entry->str[len] = 0;
+        entry->refs     = 1;
+        ++tab->num_used;
+    }
+
+    return free_slot;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_NameTable_AddRef(CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    CF_Assert(handle < tab->num_entries && tab->entries[handle].refs);
+    ++tab->entries[handle].refs;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_NameTable_Release(CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    if (handle != CF_NAME_HANDLE_INVALID)
+    {
+        CF_Assert(handle < tab->num_entries && tab->entries[handle].refs);
+        if (!--tab->entries[handle].refs)
+        {
+            --tab->num_used;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const char *CF_NameTable_Get(const CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    if (handle == CF_NAME_HANDLE_INVALID)
+    {
+        return "";
+    }
+
+    CF_Assert(handle < tab->num_entries);
+    return tab->entries[handle].str;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_NameHandle_t CF_NameTable_InternPath(CF_NameTable_t *tab, const char *path, char *leaf, size_t leaf_size)
+{
+    const char *    slash  = strrchr(path, '/');
+    size_t          len    = strlen(path);
+    size_t          split  = slash ? (size_t)(slash - path) + 1 : 0;
+    CF_NameHandle_t handle = CF_NAME_HANDLE_INVALID;
+
+    /* a file name too long for the leaf is not split, that would take a table entry of its own */
+    if ((len - split) < leaf_size)
+    {
+        handle = CF_NameTable_Intern(tab, path, split);
+        if (handle != CF_NAME_HANDLE_INVALID)
+        {
+            memcpy(leaf, path + split, len - split);
+            leaf[len - split] = 0;
+        }
+    }
+
+    return handle;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_NameTable_BuildPath(const CF_NameTable_t *tab, CF_NameHandle_t prefix, const char *leaf, char *buf,
+                            size_t buf_size)
+{
+    snprintf(buf, buf_size, "%s%s", CF_NameTable_Get(tab, prefix), leaf);
+}
@@ -0,0 +1,165 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application interned path name header file
+ *
+ *  Records that need to remember a file path, but exist in large numbers,
+ *  keep only the last part of the name and a handle to a shared prefix.
+ *  The prefixes are held once each in a name table, with a reference count.
+ */
+
+#ifndef CF_NAMES_H
+#define CF_NAMES_H
+
+#include "common_types.h"
+#include "cf_extern_typedefs.h"
+
+/**
+ * @brief Handle to a string held in a name table
+ */
+typedef uint16 CF_NameHandle_t;
+
+/**
+ * @brief Value of a name handle that does not refer to any string
+ */
+#define CF_NAME_HANDLE_INVALID ((CF_NameHandle_t)0xFFFF)
+
+/**
+ * @brief One interned string
+ */
+typedef struct CF_NameEntry
+{
+    char   str[CF_FILENAME_MAX_LEN]; /**< \brief the string, always NULL terminated */
+    uint16 refs;                     /**< \brief number of holders, entry is free when 0 */
+} CF_NameEntry_t;
+
+/**
+ * @brief A table of interned strings
+ */
+typedef struct CF_NameTable
+{
+    CF_NameEntry_t *entries;     /**< \brief storage for the entries, owned by the caller */
+    uint16          num_entries; /**< \brief number of entries in the storage */
+    uint16          num_used;    /**< \brief number of entries with a non-zero reference count */
+} CF_NameTable_t;
+
+/************************************************************************/
+/** @brief Initialize a name table.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab and entries must not be NULL.  num_entries must be less than
+ *       CF_NAME_HANDLE_INVALID.
+ *
+ * @param tab          Name table to initialize
+ * @param entries      Storage for the entries
+ * @param num_entries  Number of entries in the storage
+ */
+void CF_NameTable_Init(CF_NameTable_t *tab, CF_NameEntry_t *entries, uint16 num_entries);
+
+/************************************************************************/
+/** @brief Get a reference to a string in a name table, adding it if needed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab and str must not be NULL.  Only the first len characters of str
+ *       are used, str does not need to be NULL terminated at len.  Every
+ *       successful call must be balanced with CF_NameTable_Release().
+ *
+ * @param tab  Name table
+ * @param str  String to intern
+ * @param len  Length of the string
+ *
+ * @returns Handle to the interned string
+ * @retval CF_NAME_HANDLE_INVALID if the string is too long or the table is full
+ */
+CF_NameHandle_t CF_NameTable_Intern(CF_NameTable_t *tab, const char *str, size_t len);
+
+/************************************************************************/
+/** @brief Add a reference to a string that is already held.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab must not be NULL.  handle must be a valid handle that is held.
+ *
+ * @param tab     Name table
+ * @param handle  Handle to the string
+ */
+void CF_NameTable_AddRef(CF_NameTable_t *tab, CF_NameHandle_t handle);
+
+/************************************************************************/
+/** @brief Drop a reference to a string, freeing the entry on the last one.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab must not be NULL.  Releasing CF_NAME_HANDLE_INVALID does nothing.
+ *
+ * @param tab     Name table
+ * @param handle  Handle to the string
+ */
+void CF_NameTable_Release(CF_NameTable_t *tab, CF_NameHandle_t handle);
+
+/************************************************************************/
+/** @brief Get the string for a handle.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab must not be NULL.
+ *
+ * @param tab     Name table
+ * @param handle  Handle to the string
+ *
+ * @returns Pointer to the NULL terminated string, an empty string for CF_NAME_HANDLE_INVALID
+ */
+const char *CF_NameTable_Get(const CF_NameTable_t *tab, CF_NameHandle_t handle);
+
+/************************************************************************/
+/** @brief Split a path into an interned prefix and a leaf that is copied out.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab, path and leaf must not be NULL, and path must be NULL terminated.
+ *       The path is split after the last slash.  This needs at most one free
+ *       table entry.
+ *
+ * @param tab        Name table
+ * @param path       Path to split
+ * @param leaf       Output buffer for the leaf
+ * @param leaf_size  Size of the leaf buffer, must be at least 1
+ *
+ * @returns Handle to the interned prefix
+ * @retval CF_NAME_HANDLE_INVALID if the part after the last slash does not fit in the leaf buffer, or the
+ *         prefix could not be interned.  leaf is not valid in that case.
+ */
+CF_NameHandle_t CF_NameTable_InternPath(CF_NameTable_t *tab, const char *path, char *leaf, size_t leaf_size);
+
+/************************************************************************/
+/** @brief Rebuild a path from an interned prefix and a leaf.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       tab, leaf and buf must not be NULL.  The result is truncated to fit
+ *       and is always NULL terminated.
+ *
+ * @param tab       Name table
+ * @param prefix    Handle to the prefix
+ * @param leaf      NULL terminated leaf
+ * @param buf       Output buffer
+ * @param buf_size  Size of the output buffer, must be at least 1
+ */
+void CF_NameTable_BuildPath(const CF_NameTable_t *tab, CF_NameHandle_t prefix, const char *leaf, char *buf,
+                            size_t buf_size);
+
+#endif /* !CF_NAMES_H */
@@ -0,0 +1,257 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application engine phase performance source file
+ *
+ *  Times come from the cFE time service, so the resolution is that of the
+ *  platform's subsecond clock.
+ */
+
+#include "cfe.h"
+#include "cf_verify.h"
+#include "cf_app.h"
+#include "cf_perfids.h"
+#include "cf_perf.h"
+#include "cf_assert.h"
+
+#include <string.h>
+
+/**
+ * @brief Performance log ID of each engine phase
+ */
+static const uint32 CF_PERF_PHASE_IDS[CF_PerfPhase_NUM] = {
+    [CF_PerfPhase_CYCLE]         = CF_PERF_ID_CYCLE_ENG,
+    [CF_PerfPhase_RECV]          = CF_PERF_ID_RECV,
+    [CF_PerfPhase_TICK_RX]       = CF_PERF_ID_TICK(CF_TickType_RX),
+    [CF_PerfPhase_TICK_TXW_NORM] = CF_PERF_ID_TICK(CF_TickType_TXW_NORM),
+    [CF_PerfPhase_TICK_TXW_NAK]  = CF_PERF_ID_TICK(CF_TickType_TXW_NAK),
+    [CF_PerfPhase_CYCLE_TX]      = CF_PERF_ID_CYCLE_TX,
+    [CF_PerfPhase_PLAYBACK]      = CF_PERF_ID_PLAYBACK,
+    [CF_PerfPhase_POLLING]       = CF_PERF_ID_POLLING,
+    [CF_PerfPhase_NAK]           = CF_PERF_ID_NAK,
+    [CF_PerfPhase_CRC]           = CF_PERF_ID_CRC,
+    [CF_PerfPhase_ENCODE]        = CF_PERF_ID_ENCODE,
+    [CF_PerfPhase_DECODE]        = CF_PERF_ID_DECODE,
+};
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_perf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Perf_Begin(CF_PerfMark_t *mark, CF_PerfPhase_t phase)
+{
+    CF_Assert(phase < CF_PerfPhase_NUM);
+
+    mark->phase = phase;
+    mark->timed = CF_AppData.perf.enabled;
+    if (mark->timed)
+    {
+        mark->start = CFE_TIME_GetTime();
+    }
+
+    CFE_ES_PerfLogEntry(CF_PERF_PHASE_IDS[phase]);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_perf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Perf_End(const CF_PerfMark_t *mark)
+{
+    CF_PerfPhaseStats_t *stats;
+    CFE_TIME_SysTime_t   elapsed;
+    uint32               usecs;
+
+    CFE_ES_PerfLogExit(CF_PERF_PHASE_IDS[mark->phase]);
+
+    if (mark->timed && CF_AppData.perf.enabled)
+    {
+        stats   = &CF_AppData.perf.phase[mark->phase];
+        elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), mark->start);
+
+        /* a phase never runs anywhere near an hour, saturate rather than wrap if it does */
+        if (elapsed.Seconds < 4000)
+        {
+            usecs = (elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(elapsed.Subseconds);
+        }
+        else
+        {
+            usecs = 0xFFFFFFFF;
+        }
+
+        if ((stats->count == 0) || (usecs < stats->min_usec))
+        {
+            stats->min_usec = usecs;
+        }
+        if (usecs > stats->max_usec)
+        {
+            stats->max_usec = usecs;
+        }
+
+        stats->total_usec += usecs;
+        ++stats->count;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_perf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Perf_RecordLatency(uint8 chan_num, CF_LatencyHist_t hist, uint8 priority, CFE_TIME_SysTime_t start)
+{
+    CFE_TIME_SysTime_t elapsed;
+    uint32             units;
+    uint8              prio_class;
+    uint8              bin;
+
+    CF_Assert(chan_num < CF_NUM_CHANNELS);
+    CF_Assert(hist < CF_LatencyHist_NUM);
+
+    if (CF_AppData.perf.enabled)
+    {
+        elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), start);
+
+        /* in units of the first bin, saturating well past the last bin */
+        if (elapsed.Seconds < 4000000)
+        {
+            units = ((elapsed.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(elapsed.Subseconds) / 1000)) /
+                    CF_LATENCY_HIST_BASE_MSEC;
+        }
+        else
+        {
+            units = 0xFFFFFFFF;
+        }
+
+        /* log2 bins: bin n holds units from 2^(n-1) up to 2^n */
+        bin = 0;
+        while ((units != 0) && (bin < (CF_LATENCY_HIST_BINS - 1)))
+        {
+            units >>= 1;
+            ++bin;
+        }
+
+        if (priority < (CF_LATENCY_PRIO_CLASSES - 1))
+        {
+            prio_class = priority;
+        }
+        else
+        {
+            prio_class = CF_LATENCY_PRIO_CLASSES - 1;
+        }
+
+        ++CF_AppData.perf.latency[chan_num][hist][prio_class].bins[bin];
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_perf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Perf_Reset(void)
+{
+    memset(CF_AppData.perf.phase, 0, sizeof(CF_AppData.perf.phase));
+    memset(CF_AppData.perf.latency, 0, sizeof(CF_AppData.perf.latency));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Perf_SendLatencyTlm(uint8 chan_num)
+{
+    CF_LatencyTlmPacket_t *LatencyPktPtr;
+    CFE_SB_Buffer_t *      BufPtr;
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(sizeof(*LatencyPktPtr));
+
+    if (BufPtr != NULL)
+    {
+        LatencyPktPtr = (void *)BufPtr;
+
+        CFE_MSG_Init(CFE_MSG_PTR(LatencyPktPtr->TelemetryHeader), CFE_SB_ValueToMsgId(CF_LATENCY_TLM_MID),
+                     sizeof(*LatencyPktPtr));
+
+        LatencyPktPtr->Payload.channel   = chan_num;
+        LatencyPktPtr->Payload.base_msec = CF_LATENCY_HIST_BASE_MSEC;
+        memset(LatencyPktPtr->Payload.spare, 0, sizeof(LatencyPktPtr->Payload.spare));
+        memcpy(LatencyPktPtr->Payload.hist, CF_AppData.perf.latency[chan_num], sizeof(LatencyPktPtr->Payload.hist));
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(LatencyPktPtr->TelemetryHeader));
+        CFE_SB_TransmitBuffer(BufPtr, true);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_perf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Perf_SendTlm(void)
+{
+    CF_PerfTlmPacket_t *       PerfPktPtr;
+    CFE_SB_Buffer_t *          BufPtr;
+    const CF_PerfPhaseStats_t *stats;
+    CF_PerfPhaseTlm_t *        tlm;
+    int                        i;
+
+    if (CF_AppData.perf.enabled)
+    {
+        BufPtr = CFE_SB_AllocateMessageBuffer(sizeof(*PerfPktPtr));
+
+        if (BufPtr != NULL)
+        {
+            PerfPktPtr = (void *)BufPtr;
+
+            CFE_MSG_Init(CFE_MSG_PTR(PerfPktPtr->TelemetryHeader), CFE_SB_ValueToMsgId(CF_PERF_TLM_MID),
+                         sizeof(*PerfPktPtr));
+
+            for (i = 0; i < CF_PerfPhase_NUM; ++i)
+            {
+                stats = &CF_AppData.perf.phase[i];
+                tlm   = &PerfPktPtr->Payload.phase[i];
+
+                tlm->count    = stats->count;
+                tlm->min_usec = stats->min_usec;
+                tlm->max_usec = stats->max_usec;
+                tlm->avg_usec = stats->count ? (uint32)(stats->total_usec / stats->count) : 0;
+            }
+
+            CFE_SB_TimeStampMsg(CFE_MSG_PTR(PerfPktPtr->TelemetryHeader));
+            CFE_SB_TransmitBuffer(BufPtr, true);
+        }
+
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            CF_Perf_SendLatencyTlm(i);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application engine phase performance header file
+ *
+ *  Each engine phase is bracketed by CF_Perf_Begin() and CF_Perf_End().
+ *  These always write the performance log markers of the phase, and when
+ *  the statistics are enabled by command also time the phase, so the
+ *  wakeup budget can be broken down from telemetry alone.
+ *
+ *  The same command enables the latency histograms, which record how long
+ *  transactions wait on each queue and take from initiation to the end.
+ */
+
+#ifndef CF_PERF_H
+#define CF_PERF_H
+
+#include "cf_cfdp_types.h"
+
+/************************************************************************/
+/** @brief Begin one run of an engine phase.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       mark must not be NULL.  phase must be less than CF_PerfPhase_NUM.
+ *
+ * @param mark   Run to begin, passed to CF_Perf_End() when the phase is done
+ * @param phase  Engine phase
+ */
+void CF_Perf_Begin(CF_PerfMark_t *mark, CF_PerfPhase_t phase);
+
+/************************************************************************/
+/** @brief End one run of an engine phase.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       mark must not be NULL and must have been passed to CF_Perf_Begin().
+ *       The run is only added to the statistics if they were enabled both
+ *       when it began and now.
+ *
+ * @param mark   Run to end
+ */
+void CF_Perf_End(const CF_PerfMark_t *mark);
+
+/************************************************************************/
+/** @brief Add a latency to a latency histogram.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan_num must be less than CF_NUM_CHANNELS and hist less than
+ *       CF_LatencyHist_NUM.  The latency is the time from start until now.
+ *       Does nothing while the statistics are disabled.
+ *
+ * @param chan_num  Channel of the transaction
+ * @param hist      Histogram to add to
+ * @param priority  Priority of the transaction
+ * @param start     Start time of the latency
+ */
+void CF_Perf_RecordLatency(uint8 chan_num, CF_LatencyHist_t hist, uint8 priority, CFE_TIME_SysTime_t start);
+
+/************************************************************************/
+/** @brief Clear the engine phase statistics and latency histograms.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       The enabled flag is not changed.
+ */
+void CF_Perf_Reset(void);
+
+/************************************************************************/
+/** @brief Send the engine phase statistics and latency packets.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       One latency packet is sent for each channel.  Does nothing while
+ *       the statistics are disabled.
+ */
+void CF_Perf_SendTlm(void);
+
+#endif /* !CF_PERF_H */
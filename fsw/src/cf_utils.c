@@ -29,8 +29,10 @@
 #include "cf_verify.h"
 #include "cf_cfdp.h"
 #include "cf_utils.h"
+#include "cf_history.h"
 #include "cf_events.h"
 #include "cf_perfids.h"
+#include "cf_perf.h"
 
 #include "cf_assert.h"
 
@@ -44,7 +46,6 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
 {
     CF_CListNode_t *  node;
     CF_Transaction_t *txn;
-    int               q_index; /* initialized below in if */
 
     CF_Assert(chan);
 
@@ -55,22 +56,15 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
 
         CF_CList_Remove_Ex(chan, CF_QueueIdx_FREE, &txn->cl_node);
 
-        /* now that a transaction is acquired, must also acquire a history slot to go along with it */
-        if (chan->qs[CF_QueueIdx_HIST_FREE])
-        {
-            q_index = CF_QueueIdx_HIST_FREE;
-        }
-        else
-        {
-            /* no free history, so take the oldest one from the channel's history queue */
-            CF_Assert(chan->qs[CF_QueueIdx_HIST]);
-            q_index = CF_QueueIdx_HIST;
-        }
-
-        txn->history      = container_of(chan->qs[q_index], CF_History_t, cl_node);
+        /* each transaction has its own history entry while active, it goes to the history ring when done */
+        txn->history = &CF_AppData.engine.histories[txn - CF_AppData.engine.transactions];
+        memset(txn->history, 0, sizeof(*txn->history));
         txn->history->dir = CF_Direction_NUM; /* start with no direction */
 
-        CF_CList_Remove_Ex(chan, q_index, &txn->history->cl_node);
+        /* the cold part is kept out of the transaction so ticks over the queues touch less memory */
+        txn->cold = &CF_AppData.engine.transaction_cold[txn - CF_AppData.engine.transactions];
+        memset(txn->cold, 0, sizeof(*txn->cold));
+        txn->cold->fd = OS_OBJECT_ID_UNDEFINED;
 
         return txn;
     }
@@ -80,18 +74,6 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
     }
 }
 
-/*----------------------------------------------------------------
- *
- * Application-scope internal function
- * See description in cf_utils.h for argument/return detail
- *
- *-----------------------------------------------------------------*/
-void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
-{
-    CF_CList_Remove_Ex(chan, CF_QueueIdx_HIST, &history->cl_node);
-    CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST_FREE, &history->cl_node);
-}
-
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -103,7 +85,6 @@ void CF_FreeTransaction(CF_Transaction_t *txn)
     uint8 chan = txn->chan_num;
     memset(txn, 0, sizeof(*txn));
     txn->flags.com.q_index = CF_QueueIdx_FREE;
-    txn->fd                = OS_OBJECT_ID_UNDEFINED;
     txn->chan_num          = chan;
     txn->state             = CF_TxnState_IDLE; /* NOTE: this is redundant as long as CF_TxnState_IDLE == 0 */
     CF_CList_InitNode(&txn->cl_node);
@@ -140,19 +121,28 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
                                                      CF_TransactionSeq_t transaction_sequence_number,
                                                      CF_EntityId_t       src_eid)
 {
-    /* need to find transaction by sequence number. It will either be the active transaction (front of Q_PEND),
-     * or on Q_TX or Q_RX. Once a transaction moves to history, then it's done.
+    /* need to find transaction by sequence number. It will either be on Q_TX or Q_RX. Files on Q_PEND
+     * do not have a transaction yet. Once a transaction moves to history, then it's done.
      *
      * Let's put CF_QueueIdx_RX up front, because most RX packets will be file data PDUs */
     CF_Traverse_TransSeqArg_t ctx    = {transaction_sequence_number, src_eid, NULL};
-    CF_CListNode_t *          ptrs[] = {chan->qs[CF_QueueIdx_RX], chan->qs[CF_QueueIdx_PEND], chan->qs[CF_QueueIdx_TXA],
-                              chan->qs[CF_QueueIdx_TXW]};
+    CF_CListNode_t *ptrs[] = {chan->qs[CF_QueueIdx_RX], chan->qs[CF_QueueIdx_TXA], chan->qs[CF_QueueIdx_TXW]};
     int                       i;
     CF_Transaction_t *        ret = NULL;
+    CF_CListIter_t            iter;
+    CF_CListNode_t *          node;
 
     for (i = 0; i < (sizeof(ptrs) / sizeof(ptrs[0])); ++i)
     {
-        CF_CList_Traverse(ptrs[i], (CF_CListFn_t)CF_FindTransactionBySequenceNumber_Impl, &ctx);
+        /* this runs for every received PDU, so the queues are walked inline instead of through a callback */
+        CF_CLIST_FOREACH(iter, node, ptrs[i])
+        {
+            if (CF_FindTransactionBySequenceNumber_Impl(node, &ctx))
+            {
+                break;
+            }
+        }
+
         if (ctx.txn)
         {
             ret = ctx.txn;
@@ -163,6 +153,42 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_CListTraverse_Status_t CF_FindPendingFileBySequenceNumber_Impl(CF_CListNode_t *node, void *context)
+{
+    CF_Traverse_PendingSeqArg_t *arg = (CF_Traverse_PendingSeqArg_t *)context;
+    CF_PendingFile_t *           pf  = container_of(node, CF_PendingFile_t, cl_node);
+
+    if (pf->seq_num == arg->transaction_sequence_number)
+    {
+        arg->pf = pf;
+        return CF_CLIST_EXIT;
+    }
+
+    return CF_CLIST_CONT;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_PendingFile_t *CF_FindPendingFileBySequenceNumber(CF_Channel_t *      chan,
+                                                     CF_TransactionSeq_t transaction_sequence_number)
+{
+    CF_Traverse_PendingSeqArg_t ctx = {transaction_sequence_number, NULL};
+
+    CF_CList_Traverse(chan->qs[CF_QueueIdx_PEND], CF_FindPendingFileBySequenceNumber_Impl, &ctx);
+
+    return ctx.pf;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -216,39 +242,56 @@ CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *histor
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg)
+CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg)
 {
-    CF_Traverse_WriteHistoryFileArg_t *context = arg;
-    CF_History_t *                     history = container_of(node, CF_History_t, cl_node);
+    CF_Traverse_WriteTxnFileArg_t *context = arg;
+    CF_Transaction_t *             txn     = container_of(node, CF_Transaction_t, cl_node);
 
-    /* if filter_dir is CF_Direction_NUM, this means both directions (all match) */
-    if (context->filter_dir == CF_Direction_NUM || history->dir == context->filter_dir)
+    if (CF_WriteHistoryEntryToFile(context->fd, txn->history) < 0)
     {
-        if (CF_WriteHistoryEntryToFile(context->fd, history) < 0)
-        {
-            /* failed */
-            context->error = true;
-            return CF_CLIST_EXIT;
-        }
-
-        ++context->counter;
+        /* failed */
+        context->error = true;
+        return CF_CLIST_EXIT;
     }
 
+    ++context->counter;
     return CF_CLIST_CONT;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * A pending file has no history entry yet, so this fills in what it
+ * would hold, with the path names rebuilt and an undefined status.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_PendingFileHistory(const CF_PendingFile_t *pf, CF_History_t *history)
+{
+    memset(history, 0, sizeof(*history));
+    history->dir      = CF_Direction_TX;
+    history->txn_stat = CF_TxnStatus_UNDEFINED;
+    history->src_eid  = CF_AppData.config_table->local_eid;
+    history->peer_eid = pf->dest_id;
+    history->seq_num  = pf->seq_num;
+    CF_PendingFileNames(pf, &history->fnames);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg)
+CF_CListTraverse_Status_t CF_Traverse_WritePendingQueueEntryToFile(CF_CListNode_t *node, void *arg)
 {
     CF_Traverse_WriteTxnFileArg_t *context = arg;
-    CF_Transaction_t *             txn     = container_of(node, CF_Transaction_t, cl_node);
+    CF_PendingFile_t *             pf      = container_of(node, CF_PendingFile_t, cl_node);
+    CF_History_t                   history;
 
-    if (CF_WriteHistoryEntryToFile(context->fd, txn->history) < 0)
+    CF_PendingFileHistory(pf, &history);
+
+    if (CF_WriteHistoryEntryToFile(context->fd, &history) < 0)
     {
         /* failed */
         context->error = true;
@@ -283,19 +326,354 @@ CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Que
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir)
+CFE_Status_t CF_WritePendingQueueDataToFile(osal_id_t fd, CF_Channel_t *chan)
 {
-    CF_Traverse_WriteHistoryFileArg_t arg;
+    CF_Traverse_WriteTxnFileArg_t arg;
 
-    arg.fd         = fd;
-    arg.filter_dir = dir;
-    arg.error      = false;
-    arg.counter    = 0;
+    arg.fd      = fd;
+    arg.error   = false;
+    arg.counter = 0;
 
-    CF_CList_Traverse(chan->qs[CF_QueueIdx_HIST], CF_Traverse_WriteHistoryQueueEntryToFile, &arg);
+    CF_CList_Traverse(chan->qs[CF_QueueIdx_PEND], CF_Traverse_WritePendingQueueEntryToFile, &arg);
     return arg.error;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir)
+{
+    CF_History_t history;
+    uint16       i;
+
+    for (i = 0; i < chan->history.count; ++i)
+    {
+        CF_HistoryRing_Get(&chan->history, i, &history);
+
+        /* if dir is CF_Direction_NUM, this means both directions (all match) */
+        if ((dir == CF_Direction_NUM || history.dir == dir) && CF_WriteHistoryEntryToFile(fd, &history) < 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WriteQueueFileHeader(osal_id_t fd, const CF_QueueDump_t *dump)
+{
+    CF_QueueFileHeader_t hdr;
+    CFE_Status_t         ret;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic        = CF_QUEUE_FILE_MAGIC;
+    hdr.version      = CF_QUEUE_FILE_VERSION;
+    hdr.record_size  = sizeof(CF_QueueFileEntry_t);
+    hdr.filename_len = CF_FILENAME_MAX_LEN;
+    hdr.eid_size     = sizeof(CF_EntityId_t);
+    hdr.seq_size     = sizeof(CF_TransactionSeq_t);
+    hdr.chan         = dump->chan;
+    hdr.type         = dump->type;
+    hdr.queue        = dump->queue;
+    hdr.num_records  = dump->num_records;
+
+    ret = CF_WrappedWrite(fd, &hdr, sizeof(hdr));
+    if (ret != sizeof(hdr))
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_WHIST_WRITE, CFE_EVS_EventType_ERROR,
+                          "CF: writing queue file header failed, expected %ld got %ld", (long)sizeof(hdr), (long)ret);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        ret = CFE_SUCCESS;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WriteQueueFileEntry(osal_id_t fd, CF_QueueIdx_t queue, const CF_History_t *history)
+{
+    CF_QueueFileEntry_t rec;
+    CFE_Status_t        ret;
+
+    memset(&rec, 0, sizeof(rec));
+    rec.queue     = queue;
+    rec.direction = history->dir;
+    rec.txn_stat  = history->txn_stat;
+    rec.src_eid   = history->src_eid;
+    rec.peer_eid  = history->peer_eid;
+    rec.seq_num   = history->seq_num;
+    strncpy(rec.src_filename, history->fnames.src_filename, sizeof(rec.src_filename) - 1);
+    strncpy(rec.dst_filename, history->fnames.dst_filename, sizeof(rec.dst_filename) - 1);
+
+    ret = CF_WrappedWrite(fd, &rec, sizeof(rec));
+    if (ret != sizeof(rec))
+    {
+        CFE_EVS_SendEvent(CF_EID_ERR_CMD_WHIST_WRITE, CFE_EVS_EventType_ERROR,
+                          "CF: writing queue file failed, expected %ld got %ld", (long)sizeof(rec), (long)ret);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        ret = CFE_SUCCESS;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if the current stage of a queue file is one the command asked for
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_QueueDumpStageSelected(const CF_QueueDump_t *dump)
+{
+    static const uint8 STAGE_TYPE[CF_QueueDumpStage_NUM]  = {CF_Type_up,   CF_Type_up,   CF_Type_down,
+                                                            CF_Type_down, CF_Type_down, CF_Type_down};
+    static const uint8 STAGE_QUEUE[CF_QueueDumpStage_NUM] = {CF_Queue_active, CF_Queue_history, CF_Queue_active,
+                                                             CF_Queue_active, CF_Queue_pend,    CF_Queue_history};
+
+    return ((dump->type == CF_Type_all) || (dump->type == STAGE_TYPE[dump->stage])) &&
+           ((dump->queue == CF_Queue_all) || (dump->queue == STAGE_QUEUE[dump->stage]));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes history records of one direction, from the dump position on.
+ * Records dropped from the ring since the last wakeup are skipped.  The
+ * number of records looked at, written or not, is stored in count.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_WriteQueueDumpHistory(CF_QueueDump_t *dump, const CF_HistoryRing_t *ring, CF_Direction_t dir,
+                                             uint32 max_entries, uint32 *count)
+{
+    CF_History_t history;
+    uint32       first = ring->num_added - ring->count;
+    CFE_Status_t ret   = CFE_SUCCESS;
+
+    *count = 0;
+
+    if (dump->position < first)
+    {
+        dump->position = first;
+    }
+
+    while ((ret == CFE_SUCCESS) && (*count < max_entries) && (dump->position < ring->num_added))
+    {
+        CF_HistoryRing_Get(ring, dump->position - first, &history);
+        ++dump->position;
+        ++*count;
+
+        if (history.dir == dir)
+        {
+            ret = CF_WriteQueueFileEntry(dump->fd, CF_QueueIdx_HIST, &history);
+            if (ret == CFE_SUCCESS)
+            {
+                ++dump->num_records;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes entries of one queue, from the node after the one the dump stopped
+ * at on.  Entries this dump already stamped, having written them further up
+ * the queue or on an earlier stage, are passed over.  The number of entries
+ * looked at, written or not, is stored in count.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_WriteQueueDumpList(CF_QueueDump_t *dump, CF_CListNode_t *head, CF_QueueIdx_t queue,
+                                          uint32 max_entries, uint32 *count)
+{
+    CF_History_t        history;
+    const CF_History_t *hist_ptr;
+    uint32 *            stamp;
+    CF_CListNode_t *    node = dump->resume ? dump->resume->next : head;
+    CFE_Status_t        ret  = CFE_SUCCESS;
+
+    *count = 0;
+
+    /* the list is circular, back at the head means there is nothing after the last node written */
+    if (dump->resume && (node == head))
+    {
+        node = NULL;
+    }
+
+    while ((ret == CFE_SUCCESS) && node && (*count < max_entries))
+    {
+        if (queue == CF_QueueIdx_PEND)
+        {
+            stamp = &container_of(node, CF_PendingFile_t, cl_node)->dump_stamp;
+        }
+        else
+        {
+            stamp = &container_of(node, CF_Transaction_t, cl_node)->cold->dump_stamp;
+        }
+
+        if (*stamp != dump->stamp)
+        {
+            if (queue == CF_QueueIdx_PEND)
+            {
+                CF_PendingFileHistory(container_of(node, CF_PendingFile_t, cl_node), &history);
+                hist_ptr = &history;
+            }
+            else
+            {
+                hist_ptr = container_of(node, CF_Transaction_t, cl_node)->history;
+            }
+
+            ret = CF_WriteQueueFileEntry(dump->fd, queue, hist_ptr);
+            if (ret == CFE_SUCCESS)
+            {
+                *stamp = dump->stamp;
+                ++dump->num_records;
+            }
+        }
+
+        dump->resume = node;
+        ++*count;
+        node = (node->next != head) ? node->next : NULL;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WriteQueueDumpEntries(CF_QueueDump_t *dump, uint32 max_entries)
+{
+    static const CF_QueueIdx_t STAGE_QIDX[CF_QueueDumpStage_NUM] = {
+        CF_QueueIdx_RX, CF_QueueIdx_HIST, CF_QueueIdx_TXA, CF_QueueIdx_TXW, CF_QueueIdx_PEND, CF_QueueIdx_HIST};
+
+    CF_Channel_t *chan = &CF_AppData.engine.channels[dump->chan];
+    CFE_Status_t  ret  = CFE_SUCCESS;
+    uint32        count;
+
+    while ((ret == CFE_SUCCESS) && max_entries && (dump->stage < CF_QueueDumpStage_NUM))
+    {
+        count = 0;
+
+        if (!CF_QueueDumpStageSelected(dump))
+        {
+            /* nothing to write for this stage */
+        }
+        else if (STAGE_QIDX[dump->stage] == CF_QueueIdx_HIST)
+        {
+            ret = CF_WriteQueueDumpHistory(
+                dump, &chan->history, (dump->stage == CF_QueueDumpStage_HIST_RX) ? CF_Direction_RX : CF_Direction_TX,
+                max_entries, &count);
+        }
+        else
+        {
+            ret = CF_WriteQueueDumpList(dump, chan->qs[STAGE_QIDX[dump->stage]], STAGE_QIDX[dump->stage],
+                                        max_entries, &count);
+        }
+
+        if ((ret == CFE_SUCCESS) && (count < max_entries))
+        {
+            /* stage is finished, a full batch means there may be more on the next wakeup */
+            ++dump->stage;
+            dump->position = 0;
+            dump->resume   = NULL;
+        }
+
+        max_entries -= count;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_ProcessQueueDump(void)
+{
+    static const uint16 STAGE_EID[CF_QueueDumpStage_NUM] = {
+        CF_EID_ERR_CMD_WQ_WRITEQ_RX, CF_EID_ERR_CMD_WQ_WRITEHIST_RX, CF_EID_ERR_CMD_WQ_WRITEQ_TX,
+        CF_EID_ERR_CMD_WQ_WRITEQ_TX, CF_EID_ERR_CMD_WQ_WRITEQ_PEND,  CF_EID_ERR_CMD_WQ_WRITEHIST_TX};
+
+    CF_QueueDump_t *dump = &CF_AppData.queue_dump;
+    CFE_Status_t    ret  = CFE_SUCCESS;
+    bool            done = false;
+
+    if (dump->busy)
+    {
+        ret  = CF_WriteQueueDumpEntries(dump, CF_QUEUE_DUMP_RECORDS_PER_WAKEUP);
+        done = (ret != CFE_SUCCESS) || (dump->stage == CF_QueueDumpStage_NUM);
+    }
+
+    if (done && (ret != CFE_SUCCESS))
+    {
+        CFE_EVS_SendEvent(STAGE_EID[dump->stage], CFE_EVS_EventType_ERROR,
+                          "CF: write queue failed to write stage %d of queue file", dump->stage);
+    }
+    else if (done)
+    {
+        /* all written, now the header can hold the record count */
+        if (CF_WrappedLseek(dump->fd, 0, OS_SEEK_SET) != 0)
+        {
+            CFE_EVS_SendEvent(CF_EID_ERR_CMD_WHIST_WRITE, CFE_EVS_EventType_ERROR,
+                              "CF: writing queue file failed to seek to header");
+            ret = CF_ERROR;
+        }
+        else
+        {
+            ret = CF_WriteQueueFileHeader(dump->fd, dump);
+        }
+
+        if (ret == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CF_EID_INF_CMD_WQ_DONE, CFE_EVS_EventType_INFORMATION,
+                              "CF: write queue file complete, %lu records", (unsigned long)dump->num_records);
+        }
+    }
+
+    /* the file is finished with, unless there is more to write on the next wakeup */
+    if (done)
+    {
+        if (ret != CFE_SUCCESS)
+        {
+            ++CF_AppData.hk.Payload.counters.err;
+        }
+
+        CF_WrappedClose(dump->fd);
+        dump->fd   = OS_OBJECT_ID_UNDEFINED;
+        dump->busy = false;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -345,7 +723,17 @@ void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
     else
     {
         CF_Traverse_PriorityArg_t arg = {NULL, txn->priority};
-        CF_CList_Traverse_R(chan->qs[queue], CF_PrioSearch, &arg);
+        CF_CListIter_t            iter;
+        CF_CListNode_t *          node;
+
+        CF_CLIST_FOREACH_R(iter, node, chan->qs[queue])
+        {
+            if (!CF_CListTraverse_Status_IS_CONTINUE(CF_PrioSearch(node, &arg)))
+            {
+                break;
+            }
+        }
+
         if (arg.txn)
         {
             CF_CList_InsertAfter_Ex(chan, queue, &arg.txn->cl_node, &txn->cl_node);
@@ -361,6 +749,214 @@ void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
         CF_CList_InsertBack_Ex(chan, queue, &txn->cl_node);
     }
     txn->flags.com.q_index = queue;
+    txn->cold->queue_time  = CFE_TIME_GetTime();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_RecordQueueLatency(const CF_Transaction_t *txn)
+{
+    /* the histograms of the transaction queues are in the same order as the queues */
+    if ((txn->flags.com.q_index >= CF_QueueIdx_TXA) && (txn->flags.com.q_index <= CF_QueueIdx_RX))
+    {
+        CF_Perf_RecordLatency(txn->chan_num, CF_LatencyHist_TXA + (txn->flags.com.q_index - CF_QueueIdx_TXA),
+                              txn->priority, txn->cold->queue_time);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_CListTraverse_Status_t CF_PendingPrioSearch(CF_CListNode_t *node, void *context)
+{
+    CF_PendingFile_t *                pf  = container_of(node, CF_PendingFile_t, cl_node);
+    CF_Traverse_PendingPriorityArg_t *arg = (CF_Traverse_PendingPriorityArg_t *)context;
+
+    if (pf->priority <= arg->priority)
+    {
+        /* same rule as CF_PrioSearch(), the new file goes after this one */
+        arg->pf = pf;
+        return CF_CLIST_EXIT;
+    }
+
+    return CF_CLIST_CONT;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_InsertSortPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_Traverse_PendingPriorityArg_t arg = {NULL, pf->priority};
+
+    /* the queue is walked in reverse, as most files are queued at the same or a lower priority */
+    CF_CList_Traverse_R(chan->qs[CF_QueueIdx_PEND], CF_PendingPrioSearch, &arg);
+    if (arg.pf)
+    {
+        CF_CList_InsertAfter_Ex(chan, CF_QueueIdx_PEND, &arg.pf->cl_node, &pf->cl_node);
+    }
+    else
+    {
+        CF_CList_InsertBack_Ex(chan, CF_QueueIdx_PEND, &pf->cl_node);
+    }
+
+    if (!pf->suspended)
+    {
+        CF_LinkPendingFileSource(chan, pf);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_CListNode_t **CF_PendingFileSource(CF_Channel_t *chan, const CF_PendingFile_t *pf)
+{
+    return pf->pb ? &pf->pb->pend : &chan->cmd_pend;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_PendingFileBefore(const CF_PendingFile_t *pf1, const CF_PendingFile_t *pf2)
+{
+    CF_TransactionSeq_t diff = pf2->seq_num - pf1->seq_num;
+    bool                before;
+
+    if (pf1->priority != pf2->priority)
+    {
+        before = pf1->priority < pf2->priority;
+    }
+    else
+    {
+        /* files of the same priority are in the order they were queued, which is that of their sequence numbers */
+        before = (diff != 0) && !(diff >> ((sizeof(diff) * 8) - 1));
+    }
+
+    return before;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_LinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_CListNode_t **head  = CF_PendingFileSource(chan, pf);
+    CF_CListNode_t * after = NULL;
+    CF_CListIter_t   iter;
+    CF_CListNode_t * node;
+
+    /* as for the queue, most files go at the end of their source */
+    CF_CLIST_FOREACH_R(iter, node, *head)
+    {
+        if (CF_PendingFileBefore(container_of(node, CF_PendingFile_t, src_node), pf))
+        {
+            after = node;
+            break;
+        }
+    }
+
+    if (after)
+    {
+        CF_CList_InsertAfter(head, after, &pf->src_node);
+    }
+    else
+    {
+        CF_CList_InsertFront(head, &pf->src_node);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_UnlinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    CF_CList_Remove(CF_PendingFileSource(chan, pf), &pf->src_node);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_RemovePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    if (!pf->suspended)
+    {
+        CF_UnlinkPendingFileSource(chan, pf);
+    }
+
+    CF_CList_Remove_Ex(chan, CF_QueueIdx_PEND, &pf->cl_node);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_PendingFileNames(const CF_PendingFile_t *pf, CF_TxnFilenames_t *fnames)
+{
+    const char *dst_leaf = pf->leaves;
+
+    if (!pf->same_leaf)
+    {
+        dst_leaf += strlen(pf->leaves) + 1;
+    }
+
+    CF_NameTable_BuildPath(&CF_AppData.engine.path_prefixes, pf->src_prefix, pf->leaves, fnames->src_filename,
+                           sizeof(fnames->src_filename));
+    CF_NameTable_BuildPath(&CF_AppData.engine.path_prefixes, pf->dst_prefix, dst_leaf, fnames->dst_filename,
+                           sizeof(fnames->dst_filename));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_CListTraverse_Status_t CF_TraversePendingFiles_Impl(CF_CListNode_t *node, void *arg)
+{
+    CF_TraversePending_Arg_t *traverse = arg;
+    CF_PendingFile_t *        pf       = container_of(node, CF_PendingFile_t, cl_node);
+    traverse->fn(traverse->chan, pf, traverse->context);
+    ++traverse->counter;
+    return CF_CLIST_CONT;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CF_TraversePendingFiles(CF_Channel_t *chan, CF_TraversePendingFiles_fn_t fn, void *context)
+{
+    CF_TraversePending_Arg_t args = {chan, fn, context, 0};
+    CF_CList_Traverse(chan->qs[CF_QueueIdx_PEND], CF_TraversePendingFiles_Impl, &args);
+    return args.counter;
 }
 
 /*----------------------------------------------------------------
@@ -388,7 +984,7 @@ int32 CF_TraverseAllTransactions(CF_Channel_t *chan, CF_TraverseAllTransactions_
 {
     CF_TraverseAll_Arg_t args = {fn, context, 0};
     CF_QueueIdx_t        queueidx;
-    for (queueidx = CF_QueueIdx_PEND; queueidx <= CF_QueueIdx_RX; ++queueidx)
+    for (queueidx = CF_QueueIdx_TXA; queueidx <= CF_QueueIdx_RX; ++queueidx)
         CF_CList_Traverse(chan->qs[queueidx], CF_TraverseAllTransactions_Impl, &args);
 
     return args.counter;
@@ -493,6 +1089,51 @@ CFE_Status_t CF_WrappedLseek(osal_id_t fd, off_t offset, int mode)
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WrappedSeek(osal_id_t fd, CF_FileSize_t offset)
+{
+    CFE_Status_t  ret;
+    CF_FileSize_t pos;
+    int32         step;
+
+    /* OS_lseek only takes a 32-bit offset, so get there from the start of the file in steps */
+    step = (offset > CF_SEEK_STEP_SIZE) ? CF_SEEK_STEP_SIZE : offset;
+
+    CFE_ES_PerfLogEntry(CF_PERF_ID_FSEEK);
+    ret = OS_lseek(fd, step, OS_SEEK_SET);
+    if (ret == step)
+    {
+        ret = CFE_SUCCESS;
+        pos = step;
+        while (ret == CFE_SUCCESS && pos < offset)
+        {
+            step = ((offset - pos) > CF_SEEK_STEP_SIZE) ? CF_SEEK_STEP_SIZE : (offset - pos);
+            pos += step;
+
+            /*
+             * past 2 GiB the position OS_lseek returns wraps in its int32 and
+             * may look negative, so only its low 32 bits are compared
+             */
+            if ((uint32)OS_lseek(fd, step, OS_SEEK_CUR) != (uint32)pos)
+            {
+                ret = CF_ERROR;
+            }
+        }
+    }
+    else if (ret >= 0)
+    {
+        ret = CF_ERROR;
+    }
+    CFE_ES_PerfLogExit(CF_PERF_ID_FSEEK);
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CF_TxnStatus_IsError
@@ -30,6 +30,11 @@
 #include "cf_app.h"
 #include "cf_assert.h"
 
+/**
+ * @brief Largest offset given to a single OS_lseek() call by CF_WrappedSeek()
+ */
+#define CF_SEEK_STEP_SIZE 0x40000000
+
 /**
  * @brief Argument structure for use with CList_Traverse()
  *
@@ -43,24 +48,6 @@ typedef struct CF_Traverse_TransSeqArg
     CF_Transaction_t *  txn; /**< \brief output transaction pointer */
 } CF_Traverse_TransSeqArg_t;
 
-/**
- * @brief Argument structure for use with CF_Traverse_WriteHistoryQueueEntryToFile()
- *
- * This is used for writing status files.  It contains a designated
- * file descriptor for output and counters.
- *
- * When traversing history, the list contains all entries, and may need additional
- * filtering for direction (TX/RX) depending on what information the user has requested.
- */
-typedef struct CF_Traverse_WriteHistoryFileArg
-{
-    osal_id_t      fd;
-    CF_Direction_t filter_dir;
-
-    bool   error;   /**< \brief Will be set to true if any write failed */
-    uint32 counter; /**< \brief Total number of entries written */
-} CF_Traverse_WriteHistoryFileArg_t;
-
 /**
  * @brief Argument structure for use with CF_Traverse_WriteTxnQueueEntryToFile()
  *
@@ -100,7 +87,7 @@ typedef struct CF_TraverseAll_Arg
 } CF_TraverseAll_Arg_t;
 
 /**
- * @brief Argument structure for use with CF_CList_Traverse_R()
+ * @brief Argument structure for use with CF_PrioSearch()
  *
  * This is for searching for transactions of a specific priority
  */
@@ -110,6 +97,78 @@ typedef struct CF_Traverse_PriorityArg
     uint8             priority; /**< \brief seeking this priority */
 } CF_Traverse_PriorityArg_t;
 
+/**
+ * @brief Argument structure for use with CF_FindPendingFileBySequenceNumber_Impl()
+ *
+ * Pending files are always sent by the local entity, so only the sequence number is matched
+ */
+typedef struct CF_Traverse_PendingSeqArg
+{
+    CF_TransactionSeq_t transaction_sequence_number;
+    CF_PendingFile_t *  pf; /**< \brief output pending file pointer */
+} CF_Traverse_PendingSeqArg_t;
+
+/**
+ * @brief Callback function type for use with CF_TraversePendingFiles()
+ *
+ * @param chan Pointer to the channel the file is pending on
+ * @param pf Pointer to current pending file being traversed
+ * @param context Opaque object passed from initial call
+ */
+typedef void (*CF_TraversePendingFiles_fn_t)(CF_Channel_t *chan, CF_PendingFile_t *pf, void *context);
+
+/**
+ * @brief Argument structure for use with CF_TraversePendingFiles()
+ */
+typedef struct CF_TraversePending_Arg
+{
+    CF_Channel_t *               chan;    /**< \brief channel the pending queue belongs to */
+    CF_TraversePendingFiles_fn_t fn;      /**< \brief internal callback to use for each pending file */
+    void *                       context; /**< \brief opaque object to pass to internal callback */
+    int32                        counter; /**< \brief Running tally of all nodes traversed */
+} CF_TraversePending_Arg_t;
+
+/**
+ * @brief Argument structure for use with CF_PendingPrioSearch()
+ *
+ * This is for searching for pending files of a specific priority
+ */
+typedef struct CF_Traverse_PendingPriorityArg
+{
+    CF_PendingFile_t *pf;       /**< \brief OUT: pending file to insert after */
+    uint8             priority; /**< \brief seeking this priority */
+} CF_Traverse_PendingPriorityArg_t;
+
+/************************************************************************/
+/** @brief Record the time a transaction spent on its current queue.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.  Only the TXA, TXW and RX queues are recorded,
+ *       in the latency histogram of the same name.
+ *
+ * @param txn  Pointer to the transaction object, about to leave its queue
+ */
+void CF_RecordQueueLatency(const CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Keep the binary queue file being written valid as a node leaves its queue.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Must be called before node is removed from the queue starting at
+ *       head.  If the queue file stopped at node, it now stops at the node
+ *       before it, or starts over at the head, which node was.
+ *
+ * @param head  First node of the queue node is on
+ * @param node  Node about to be removed from it
+ */
+static inline void CF_QueueDumpUnlink(const CF_CListNode_t *head, CF_CListNode_t *node)
+{
+    if (CF_AppData.queue_dump.resume == node)
+    {
+        CF_AppData.queue_dump.resume = (node == head) ? NULL : node->prev;
+    }
+}
+
 /* free a transaction from the queue it's on.
  * NOTE: this leaves the transaction in a bad state,
  * so it must be followed by placing the transaction on
@@ -122,6 +181,8 @@ typedef struct CF_Traverse_PriorityArg
 static inline void CF_DequeueTransaction(CF_Transaction_t *txn)
 {
     CF_Assert(txn && (txn->chan_num < CF_NUM_CHANNELS));
+    CF_RecordQueueLatency(txn);
+    CF_QueueDumpUnlink(CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_CList_Remove(&CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index];
@@ -130,16 +191,20 @@ static inline void CF_DequeueTransaction(CF_Transaction_t *txn)
 static inline void CF_MoveTransaction(CF_Transaction_t *txn, CF_QueueIdx_t queue)
 {
     CF_Assert(txn && (txn->chan_num < CF_NUM_CHANNELS));
+    CF_RecordQueueLatency(txn);
+    CF_QueueDumpUnlink(CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_CList_Remove(&CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index];
     CF_CList_InsertBack(&CF_AppData.engine.channels[txn->chan_num].qs[queue], &txn->cl_node);
     txn->flags.com.q_index = queue;
+    txn->cold->queue_time  = CFE_TIME_GetTime();
     ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index];
 }
 
 static inline void CF_CList_Remove_Ex(CF_Channel_t *chan, CF_QueueIdx_t queueidx, CF_CListNode_t *node)
 {
+    CF_QueueDumpUnlink(chan->qs[queueidx], node);
     CF_CList_Remove(&chan->qs[queueidx], node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx];
@@ -171,21 +236,6 @@ static inline void CF_CList_InsertBack_Ex(CF_Channel_t *chan, CF_QueueIdx_t queu
  */
 CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan);
 
-/************************************************************************/
-/** @brief Returns a history structure back to its unused state.
- *
- * @par Description
- *       There's nothing to do currently other than remove the history
- *       from its current queue and put it back on CF_QueueIdx_HIST_FREE.
- *
- * @par Assumptions, External Events, and Notes:
- *       chan must not be NULL. history must not be NULL.
- *
- * @param chan Pointer to the CF channel
- * @param history Pointer to the history entry
- */
-void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history);
-
 /************************************************************************/
 /** @brief Frees and resets a transaction and returns it for later use.
  *
@@ -200,7 +250,7 @@ void CF_FreeTransaction(CF_Transaction_t *txn);
 /** @brief Finds an active transaction by sequence number.
  *
  * @par Description
- *       This function traverses the active rx, pending, txa, and txw
+ *       This function traverses the active rx, txa, and txw
  *       transaction and looks for the requested transaction.
  *
  * @par Assumptions, External Events, and Notes:
@@ -232,6 +282,40 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
  */
 CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context);
 
+/************************************************************************/
+/** @brief Finds a pending file by sequence number.
+ *
+ * @par Description
+ *       Pending files have no transaction yet, so they are not found by
+ *       CF_FindTransactionBySequenceNumber().  They are always sent by the
+ *       local entity, so the caller must check the source entity ID.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL.
+ *
+ * @param chan Pointer to the CF channel
+ * @param transaction_sequence_number  Sequence number to find
+ *
+ * @returns Pointer to the pending file if found
+ * @retval  NULL if the pending file is not found
+ */
+CF_PendingFile_t *CF_FindPendingFileBySequenceNumber(CF_Channel_t *      chan,
+                                                     CF_TransactionSeq_t transaction_sequence_number);
+
+/************************************************************************/
+/** @brief List traversal function to check if the desired sequence number matches a pending file.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       context must not be NULL. node must not be NULL.
+ *
+ * @param node         Pointer to node currently being traversed
+ * @param context   Pointer to CF_Traverse_PendingSeqArg_t object
+ *
+ * @retval CF_CLIST_EXIT when it's found, which terminates list traversal
+ * @retval CF_CLIST_CONT when it isn't found, which causes list traversal to continue
+ */
+CF_CListTraverse_Status_t CF_FindPendingFileBySequenceNumber_Impl(CF_CListNode_t *node, void *context);
+
 /************************************************************************/
 /** @brief Write a single history to a file.
  *
@@ -269,7 +353,25 @@ CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *histor
 CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_QueueIdx_t queue);
 
 /************************************************************************/
-/** @brief Write a history-based queue's entries to a file.
+/** @brief Write the files on the pending queue to a file.
+ *
+ * @par Description
+ *       Each pending file is written in the same format as a transaction,
+ *       with its path names rebuilt and an undefined status.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL.
+ *
+ * @param fd Open File descriptor to write to
+ * @param chan  Pointer to associated CF channel object
+ *
+ * @retval 0 on success
+ * @retval 1 on error
+ */
+CFE_Status_t CF_WritePendingQueueDataToFile(osal_id_t fd, CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Write the entries of a channel history ring to a file.
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must not be NULL.
@@ -283,6 +385,65 @@ CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Que
  */
 CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir);
 
+/************************************************************************/
+/** @brief Write the header of a binary queue file.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       fd should be a valid file descriptor, open for writing.  dump must not be NULL.
+ *
+ * @param fd   Open File descriptor to write to
+ * @param dump Queue file state, giving the selection and the record count
+ *
+ * @retval CFE_SUCCESS on success
+ * @retval CF_ERROR on error
+ */
+CFE_Status_t CF_WriteQueueFileHeader(osal_id_t fd, const CF_QueueDump_t *dump);
+
+/************************************************************************/
+/** @brief Write a history entry to a binary queue file as one fixed size record.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       fd should be a valid file descriptor, open for writing.  history must not be NULL.
+ *
+ * @param fd      Open File descriptor to write to
+ * @param queue   Queue the entry is on
+ * @param history Pointer to CF history object to write
+ *
+ * @retval CFE_SUCCESS on success
+ * @retval CF_ERROR on error
+ */
+CFE_Status_t CF_WriteQueueFileEntry(osal_id_t fd, CF_QueueIdx_t queue, const CF_History_t *history);
+
+/************************************************************************/
+/** @brief Write the next entries of a binary queue file.
+ *
+ * @par Description
+ *       Works through the stages of the dump that match its selection,
+ *       looking at most at max_entries entries, written or passed over.
+ *       The stage is advanced to CF_QueueDumpStage_NUM once everything has
+ *       been written.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       dump must not be NULL and must have an open file.
+ *
+ * @param dump        Queue file state
+ * @param max_entries Maximum number of entries to look at
+ *
+ * @retval CFE_SUCCESS on success
+ * @retval CF_ERROR on error
+ */
+CFE_Status_t CF_WriteQueueDumpEntries(CF_QueueDump_t *dump, uint32 max_entries);
+
+/************************************************************************/
+/** @brief Advance the binary queue file being written, if any.
+ *
+ * @par Description
+ *       Called once per wakeup.  Writes the next batch of entries, and when
+ *       all are written, fills in the record count in the header and closes
+ *       the file.  The file is also closed if a write fails.
+ */
+void CF_ProcessQueueDump(void);
+
 /************************************************************************/
 /** @brief Insert a transaction into a priority sorted transaction queue.
  *
@@ -290,7 +451,8 @@ CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF
  *       This function works by walking the queue in reverse to find a
  *       transaction with a higher priority than the given transaction.
  *       The given transaction is then inserted after that one, since it
- *       would be the next lower priority.
+ *       would be the next lower priority.  The time it entered the queue is
+ *       stamped for the latency histograms.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL.
@@ -300,6 +462,113 @@ CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF
  */
 void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue);
 
+/************************************************************************/
+/** @brief Insert a pending file into the priority sorted pending queue.
+ *
+ * @par Description
+ *       Works the same way as CF_InsertSortPrio(), so files of the same
+ *       priority stay in the order they were queued.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. pf must not be NULL, and not on any list.
+ *
+ * @param chan  Channel of the pending queue
+ * @param pf    Pointer to the pending file
+ */
+void CF_InsertSortPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Check whether a pending file is ahead of another on the pending queue.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       pf1 and pf2 must not be NULL.  Both must have been queued in the
+ *       last half of the sequence number range.
+ *
+ * @param pf1  Pointer to the first pending file
+ * @param pf2  Pointer to the second pending file
+ *
+ * @returns true if pf1 is ahead of pf2
+ */
+bool CF_PendingFileBefore(const CF_PendingFile_t *pf1, const CF_PendingFile_t *pf2);
+
+/************************************************************************/
+/** @brief Put a pending file on the pending list of its source.
+ *
+ * @par Description
+ *       Besides the pending queue of the channel, each file that is not
+ *       suspended is on the list of its playback, or of the commanded files
+ *       of the channel.  The lists keep the order of the pending queue, so
+ *       the first file that can start is at the head of one of them.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. pf must not be NULL, and not on the list.
+ *
+ * @param chan  Channel of the pending queue
+ * @param pf    Pointer to the pending file
+ */
+void CF_LinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Take a pending file off the pending list of its source.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. pf must not be NULL, and on the list.
+ *
+ * @param chan  Channel of the pending queue
+ * @param pf    Pointer to the pending file
+ */
+void CF_UnlinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Take a pending file off the pending queue and the list of its source.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. pf must not be NULL, and on the pending queue.
+ *
+ * @param chan  Channel of the pending queue
+ * @param pf    Pointer to the pending file
+ */
+void CF_RemovePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf);
+
+/************************************************************************/
+/** @brief Rebuild the full path names of a pending file.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       pf and fnames must not be NULL.
+ *
+ * @param pf      Pointer to the pending file
+ * @param fnames  Output path names
+ */
+void CF_PendingFileNames(const CF_PendingFile_t *pf, CF_TxnFilenames_t *fnames);
+
+/************************************************************************/
+/** @brief Traverses all files on the pending queue and performs an operation on them.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. fn must be a valid function, and may remove
+ *       the file it is called with from the queue.
+ *
+ * @param chan    Channel to operate on
+ * @param fn      Callback to invoke for all traversed pending files
+ * @param context Opaque object to pass to all callbacks
+ *
+ * @returns Number of pending files traversed
+ */
+int32 CF_TraversePendingFiles(CF_Channel_t *chan, CF_TraversePendingFiles_fn_t fn, void *context);
+
+/************************************************************************/
+/** @brief List traversal function performs operation on every pending file.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       node must not be NULL. arg must not be NULL.
+ *
+ * @param node  Node being currently traversed
+ * @param arg   Pointer to CF_TraversePending_Arg_t from initial call
+ *
+ * @retval CF_CLIST_CONT for do not exit early (always continue)
+ */
+CF_CListTraverse_Status_t CF_TraversePendingFiles_Impl(CF_CListNode_t *node, void *arg);
+
 /************************************************************************/
 /** @brief Traverses all transactions on all active queues and performs an operation on them.
  *
@@ -344,26 +613,6 @@ int32 CF_TraverseAllTransactions_All_Channels(CF_TraverseAllTransactions_fn_t fn
  */
 CF_CListTraverse_Status_t CF_TraverseAllTransactions_Impl(CF_CListNode_t *node, void *arg);
 
-/************************************************************************/
-/** @brief Writes a human readable representation of a history queue entry to a file
- *
- * This function is a wrapper around CF_WriteHistoryEntryToFile() that can be used with
- * CF_Traverse() to write history queue entries to the file.
- *
- * This also implements a direction filter, so only matching entries are actually written
- * to the file.
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL. arg must not be NULL.
- *
- * @param node   Node being currently traversed
- * @param arg Pointer to CF_Traverse_WriteHistoryFileArg_t indicating the file information
- *
- * @retval CF_CLIST_CONT if everything is going well
- * @retval CF_CLIST_EXIT if a write error occurred, which means traversal should stop
- */
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg);
-
 /************************************************************************/
 /** @brief Writes a human readable representation of a transaction history entry to a file
  *
@@ -396,6 +645,37 @@ CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *n
  */
 CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context);
 
+/************************************************************************/
+/** @brief Searches for the first pending file with a lower priority than given.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       node must not be NULL. context must not be NULL.
+ *
+ * @param node    Node being currently traversed
+ * @param context Pointer to CF_Traverse_PendingPriorityArg_t object indicating the priority to search for
+ *
+ * @retval CF_CLIST_EXIT when it's found, which terminates list traversal
+ * @retval CF_CLIST_CONT when it isn't found, which causes list traversal to continue
+ */
+CF_CListTraverse_Status_t CF_PendingPrioSearch(CF_CListNode_t *node, void *context);
+
+/************************************************************************/
+/** @brief Writes a human readable representation of a pending file to a file
+ *
+ * This function is a wrapper around CF_WriteHistoryEntryToFile() that can be used with
+ * CF_Traverse() to write pending queue entries to the file.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       node must not be NULL. arg must not be NULL.
+ *
+ * @param node   Node being currently traversed
+ * @param arg Pointer to CF_Traverse_WriteTxnFileArg_t indicating the file information
+ *
+ * @retval CF_CLIST_CONT if everything is going well
+ * @retval CF_CLIST_EXIT if a write error occurred, which means traversal should stop
+ */
+CF_CListTraverse_Status_t CF_Traverse_WritePendingQueueEntryToFile(CF_CListNode_t *node, void *arg);
+
 /************************************************************************/
 /** @brief Wrap the filesystem open call with a perf counter.
  *
@@ -474,6 +754,22 @@ CFE_Status_t CF_WrappedWrite(osal_id_t fd, const void *buf, size_t write_size);
  */
 CFE_Status_t CF_WrappedLseek(osal_id_t fd, off_t offset, int mode);
 
+/************************************************************************/
+/** @brief Seek to an absolute offset in a file, which may be 4 GiB or more.
+ *
+ * @par Description
+ *       OS_lseek() only takes a 32-bit offset, so this seeks to the start
+ *       of the file plus at most CF_SEEK_STEP_SIZE, and then forward from
+ *       the current position in steps of at most CF_SEEK_STEP_SIZE.
+ *
+ * @param fd         File to seek
+ * @param offset     Offset from the start of the file
+ *
+ * @returns CFE_SUCCESS if the file is at the offset, an error code otherwise
+ * @retval CF_ERROR if a step of the seek did not land where it should
+ */
+CFE_Status_t CF_WrappedSeek(osal_id_t fd, CF_FileSize_t offset);
+
 /************************************************************************/
 /** @brief Converts the internal transaction status to a CFDP condition code
  *
@@ -39,12 +39,84 @@
 #error Must have at least one channel.
 #endif
 
-#if CF_NUM_HISTORIES > 65535
-#error refactor code for 32 bit CF_NUM_HISTORIES
+#if (CF_NUM_HISTORIES_PER_CHANNEL < 1) || (CF_NUM_HISTORIES_PER_CHANNEL > 65535)
+#error CF_NUM_HISTORIES_PER_CHANNEL must be between 1 and 65535
+#endif
+
+#if (CF_HISTORY_NAMES_SIZE_PER_CHANNEL < 256) || (CF_HISTORY_NAMES_SIZE_PER_CHANNEL > 65535)
+#error CF_HISTORY_NAMES_SIZE_PER_CHANNEL must be between 256 and 65535
+#endif
+
+#if (CF_NUM_HISTORY_PATH_PREFIXES < 1) || (CF_NUM_HISTORY_PATH_PREFIXES > 65534)
+#error CF_NUM_HISTORY_PATH_PREFIXES must be between 1 and 65534
+#endif
+
+#if (CF_NUM_PENDING_FILES_PER_CHANNEL < 1) || (CF_NUM_PENDING_FILES_PER_CHANNEL > 65535)
+#error CF_NUM_PENDING_FILES_PER_CHANNEL must be between 1 and 65535
+#endif
+
+#if (CF_NUM_PATH_PREFIXES < 2) || (CF_NUM_PATH_PREFIXES > 65534)
+#error CF_NUM_PATH_PREFIXES must be between 2 and 65534
+#endif
+
+#if (CF_QUEUE_DUMP_RECORDS_PER_WAKEUP < 1) || (CF_QUEUE_DUMP_RECORDS_PER_WAKEUP > 65535)
+#error CF_QUEUE_DUMP_RECORDS_PER_WAKEUP must be between 1 and 65535
+#endif
+
+#if (CF_TXN_TLM_MAX_ENTRIES < 1) || (CF_TXN_TLM_MAX_ENTRIES > 255)
+#error CF_TXN_TLM_MAX_ENTRIES must be between 1 and 255
+#endif
+
+#if (CF_TX_GROUP_MAX_DEST < 2) || (CF_TX_GROUP_MAX_DEST > 255)
+#error CF_TX_GROUP_MAX_DEST must be between 2 and 255
+#endif
+
+#if (CF_NUM_TX_GROUPS < 1) || (CF_NUM_TX_GROUPS > 255)
+#error CF_NUM_TX_GROUPS must be between 1 and 255
+#endif
+
+#if (CF_NUM_FEC_ENCODERS < 1) || (CF_NUM_FEC_ENCODERS > 255)
+#error CF_NUM_FEC_ENCODERS must be between 1 and 255
+#endif
+
+#if (CF_LATENCY_HIST_BINS < 2) || (CF_LATENCY_HIST_BINS > 32)
+#error CF_LATENCY_HIST_BINS must be between 2 and 32
+#endif
+
+#if CF_LATENCY_HIST_BASE_MSEC < 1
+#error CF_LATENCY_HIST_BASE_MSEC must be greater than 0
+#endif
+
+#if (CF_LATENCY_PRIO_CLASSES < 1) || (CF_LATENCY_PRIO_CLASSES > 256)
+#error CF_LATENCY_PRIO_CLASSES must be between 1 and 256
+#endif
+
+#if (CF_OUTGOING_BUF_POOL_DEPTH < 1) || (CF_OUTGOING_BUF_POOL_DEPTH > 255)
+#error CF_OUTGOING_BUF_POOL_DEPTH must be between 1 and 255
+#endif
+
+#if (CF_PDU_RX_BATCH_SIZE < 1) || (CF_PDU_RX_BATCH_SIZE > 255)
+#error CF_PDU_RX_BATCH_SIZE must be between 1 and 255
+#endif
+
+#if (CF_SHM_RING_DEPTH < 2) || ((CF_SHM_RING_DEPTH & (CF_SHM_RING_DEPTH - 1)) != 0)
+#error CF_SHM_RING_DEPTH must be a power of two
+#endif
+
+#if (CF_ENABLE_SHM_TRANSPORT != 0) && (CF_ENABLE_SHM_TRANSPORT != 1)
+#error CF_ENABLE_SHM_TRANSPORT must be 0 or 1
+#endif
+
+#if (CF_ENABLE_UDP_TRANSPORT != 0) && (CF_ENABLE_UDP_TRANSPORT != 1)
+#error CF_ENABLE_UDP_TRANSPORT must be 0 or 1
 #endif
 
 #if (CF_PERF_ID_PDURCVD(CF_NUM_CHANNELS - 1) >= CF_PERF_ID_PDUSENT(0))
 #error Collision between CF_PERF_ID_PDURCVD and CF_PERF_ID_PDUSENT given number of channels
 #endif
 
+#if (CF_PERF_ID_PDUSENT(CF_NUM_CHANNELS - 1) >= CF_PERF_ID_ENCODE)
+#error Collision between CF_PERF_ID_PDUSENT and CF_PERF_ID_ENCODE given number of channels
+#endif
+
 #endif /* !CF_VERIFY_H */
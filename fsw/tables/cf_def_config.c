@@ -51,14 +51,27 @@ CF_ConfigTable_t CF_config_table = {
               23,              /* destination entity id */
               "/cf/poll_dir",  /* source directory */
               "./poll_dir",    /* destination directory */
-              0                /* polling directory enable flag (1 = enabled) */
+              0,               /* polling directory enable flag (1 = enabled) */
+              0,               /* max files in transfer at once, 0 = CF_NUM_TRANSACTIONS_PER_PLAYBACK */
+              0                /* max files read ahead of the transfers, 0 = CF_NUM_TRANSACTIONS_PER_PLAYBACK */
           },
           {
               0 /* zero fill unused polling directory slots */
           }},
-         "",            /* throttle sem, empty string means no throttle */
-         1,             /* dequeue enable flag (1 = enabled) */
-         .move_dir = "" /* If not empty, will attempt move instead of delete on TX file complete */
+         "",                /* throttle sem, empty string means no throttle */
+         1,                 /* dequeue enable flag (1 = enabled) */
+         .move_dir       = "",          /* If not empty, will attempt move instead of delete on TX file complete */
+         .sem_wait_ms    = 0,           /* ms to block on throttle sem for a free slot, 0 means poll only */
+         .transport      = 0,           /* PDU transport: 0 = software bus, 1 = shared memory ring, 2 = UDP */
+         .rx_batch_sort  = 0,           /* group and sort received PDUs by transaction/offset before processing */
+         .checksum_type  = 0,           /* file checksum: 0 = modular, 2 = CRC32C, 3 = IEEE CRC32, 15 = null */
+         .pdu_crc        = 0,           /* append a CRC to each sent PDU */
+         .relay_eid      = 0,           /* relay received files to this entity as they arrive, 0 means no relay */
+         .relay_chan     = 0,           /* channel that sends the relayed files */
+         .fec_group_size = 0,           /* class 1 sends add a parity PDU per this many file data PDUs, 0 means none */
+         .udp_peer_addr  = "127.0.0.1", /* UDP transport: address PDUs are sent to */
+         .udp_local_port = 5250,        /* UDP transport: port PDUs are received on */
+         .udp_peer_port  = 5251         /* UDP transport: port PDUs are sent to */
      },
      {        /* channel 1 */
       5,      /* max number of outgoing messages per wakeup */
@@ -77,7 +90,18 @@ CF_ConfigTable_t CF_config_table = {
        }},
       "", /* throttle sem, empty string means no throttle */
       1,  /* dequeue enable flag (1 = enabled) */
-      .move_dir = ""}},
+      .move_dir       = "",
+      .sem_wait_ms    = 0,
+      .transport      = 0,
+      .rx_batch_sort  = 0,
+      .checksum_type  = 0,
+      .pdu_crc        = 0,
+      .relay_eid      = 0,
+      .relay_chan     = 0,
+      .fec_group_size = 0,
+      .udp_peer_addr  = "127.0.0.1",
+      .udp_local_port = 5252,
+      .udp_peer_port  = 5253}},
     480,       /* outgoing_file_chunk_size */
     "/cf/tmp", /* temporary file directory */
 };
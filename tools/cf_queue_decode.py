@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+#
+# NASA Docket No. GSC-18,447-1, and identified as "CFS CFDP (CF)
+# Application version 3.0.0"
+#
+# Copyright (c) 2019 United States Government as represented by the
+# Administrator of the National Aeronautics and Space Administration.
+# All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License. You may obtain
+# a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Print a binary queue file written by the CF write queue command.
+
+The file is a CF_QueueFileHeader_t followed by CF_QueueFileEntry_t records,
+in the byte order of the flight processor (see default_cf_msgdefs.h).  The
+byte order is taken from the magic number, and the field sizes from the
+header, so no mission configuration is needed.
+"""
+
+import argparse
+import struct
+import sys
+
+CF_QUEUE_FILE_MAGIC = 0x43465144
+CF_QUEUE_FILE_VERSION = 1
+
+HEADER_FORMAT = "IHHHBBBBBBI"
+
+QUEUE_NAMES = {0: "PEND", 1: "TXA", 2: "TXW", 3: "RX", 4: "HIST"}
+DIR_NAMES = {0: "RX", 1: "TX"}
+INT_CODES = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+
+class QueueFileError(Exception):
+    pass
+
+
+def align(offset, size):
+    return (offset + size - 1) // size * size
+
+
+def read_header(data):
+    hdr_size = struct.calcsize("<" + HEADER_FORMAT)
+    if len(data) < hdr_size:
+        raise QueueFileError("file too short for a header")
+
+    for order in ("<", ">"):
+        if struct.unpack_from(order + "I", data)[0] == CF_QUEUE_FILE_MAGIC:
+            break
+    else:
+        raise QueueFileError("not a CF queue file")
+
+    fields = struct.unpack_from(order + HEADER_FORMAT, data)
+    keys = ("magic", "version", "record_size", "filename_len", "eid_size", "seq_size", "chan", "type", "queue",
+            "spare", "num_records")
+    hdr = dict(zip(keys, fields))
+    hdr["order"] = order
+    hdr["size"] = hdr_size
+
+    if hdr["version"] != CF_QUEUE_FILE_VERSION:
+        raise QueueFileError("unsupported version %d" % hdr["version"])
+    if hdr["eid_size"] not in INT_CODES or hdr["seq_size"] not in INT_CODES:
+        raise QueueFileError("unsupported entity id or sequence number size")
+
+    return hdr
+
+
+def record_layout(hdr):
+    """Offsets of the record fields, laid out as a C compiler would."""
+    eid = hdr["eid_size"]
+    seq = hdr["seq_size"]
+
+    src_eid = align(4, eid)
+    peer_eid = src_eid + eid
+    seq_num = align(peer_eid + eid, seq)
+    src_filename = seq_num + seq
+    dst_filename = src_filename + hdr["filename_len"]
+
+    if dst_filename + hdr["filename_len"] > hdr["record_size"]:
+        raise QueueFileError("record size %d too small for its fields" % hdr["record_size"])
+
+    return src_eid, peer_eid, seq_num, src_filename, dst_filename
+
+
+def cstring(raw):
+    return raw.split(b"\0", 1)[0].decode("utf-8", "replace")
+
+
+def decode(data):
+    hdr = read_header(data)
+    order = hdr["order"]
+    src_eid, peer_eid, seq_num, src_filename, dst_filename = record_layout(hdr)
+    eid_fmt = order + INT_CODES[hdr["eid_size"]]
+    seq_fmt = order + INT_CODES[hdr["seq_size"]]
+    name_len = hdr["filename_len"]
+
+    records = []
+    offset = hdr["size"]
+    while offset + hdr["record_size"] <= len(data):
+        queue, direction, txn_stat = struct.unpack_from(order + "BBb", data, offset)
+        records.append({
+            "queue": QUEUE_NAMES.get(queue, str(queue)),
+            "dir": DIR_NAMES.get(direction, str(direction)),
+            "stat": txn_stat,
+            "src_eid": struct.unpack_from(eid_fmt, data, offset + src_eid)[0],
+            "peer_eid": struct.unpack_from(eid_fmt, data, offset + peer_eid)[0],
+            "seq_num": struct.unpack_from(seq_fmt, data, offset + seq_num)[0],
+            "src": cstring(data[offset + src_filename:offset + src_filename + name_len]),
+            "dst": cstring(data[offset + dst_filename:offset + dst_filename + name_len]),
+        })
+        offset += hdr["record_size"]
+
+    return hdr, records, len(data) - offset
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", help="binary queue file from CF_WRITE_QUEUE_CC")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as f:
+        data = f.read()
+
+    try:
+        hdr, records, leftover = decode(data)
+    except QueueFileError as err:
+        print("%s: %s" % (args.file, err), file=sys.stderr)
+        return 1
+
+    print("# %s-endian, chan %d, type %d, queue %d, %d records" %
+          ("little" if hdr["order"] == "<" else "big", hdr["chan"], hdr["type"], hdr["queue"], len(records)))
+    for rec in records:
+        print("%-4s SEQ (%d, %d)\tDIR: %s\tPEER %d\tSTAT: %d\tSRC: %s\tDST: %s" %
+              (rec["queue"], rec["src_eid"], rec["seq_num"], rec["dir"], rec["peer_eid"], rec["stat"], rec["src"],
+               rec["dst"]))
+
+    status = 0
+    if hdr["num_records"] != len(records):
+        # the count is only written once the app has finished the file
+        print("%s: header has %d records, found %d; file incomplete?" % (args.file, hdr["num_records"], len(records)),
+              file=sys.stderr)
+        status = 1
+    if leftover:
+        print("%s: %d trailing bytes" % (args.file, leftover), file=sys.stderr)
+        status = 1
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
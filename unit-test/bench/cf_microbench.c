@@ -0,0 +1,502 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Microbenchmarks of the CF primitives on the per-PDU path.
+ *
+ * Each benchmark runs a primitive on a workload shaped like what the engine
+ * sees in a transfer, and reports the wall clock time per operation.  The
+ * workloads are generated from a fixed seed so that runs on the same host
+ * can be compared.  The results are also checked, so that a primitive made
+ * faster but wrong does not go unnoticed.
+ *
+ * The number of repetitions can be scaled with the CF_BENCH_SCALE
+ * environment variable, in percent of the default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include "cf_app.h"
+#include "cf_cfdp.h"
+#include "cf_chunk.h"
+#include "cf_clist.h"
+#include "cf_codec.h"
+#include "cf_crc.h"
+
+/* file and segment sizes of the chunk workloads, a 16 MiB file in 1 KiB PDUs */
+#define CF_BENCH_FILE_SIZE    (16 * 1024 * 1024)
+#define CF_BENCH_SEGMENT_SIZE 1024
+#define CF_BENCH_NUM_SEGMENTS (CF_BENCH_FILE_SIZE / CF_BENCH_SEGMENT_SIZE)
+
+/* gap tracking capacity, in the range of the RX chunks per transaction */
+#define CF_BENCH_MAX_CHUNKS 128
+
+/* gaps requested per call, in the range of the segment requests in a NAK */
+#define CF_BENCH_MAX_GAPS 58
+
+/* file data following the header of an encoded PDU */
+#define CF_BENCH_FD_DATA_SIZE (CF_MAX_PDU_SIZE / 2)
+
+#define CF_BENCH_CRC_BUF_SIZE 4096
+
+#define CF_BENCH_QUEUE_LEN 10000
+
+/**
+ * @brief Timer of one benchmark
+ */
+typedef struct CF_BenchTimer
+{
+    struct timespec start;
+} CF_BenchTimer_t;
+
+typedef struct CF_BenchGapCount
+{
+    uint32 gaps;
+    uint32 bytes;
+} CF_BenchGapCount_t;
+
+typedef struct CF_BenchNode
+{
+    CF_CListNode_t node;
+    uint32         value;
+} CF_BenchNode_t;
+
+static uint32 CF_BenchScale = 100;
+static uint32 CF_BenchRandState;
+
+static CF_Chunk_t     CF_BenchChunkMem[CF_BENCH_MAX_CHUNKS];
+static uint8          CF_BenchCrcBuf[CF_BENCH_CRC_BUF_SIZE];
+static CF_BenchNode_t CF_BenchNodes[CF_BENCH_QUEUE_LEN];
+
+/* results are accumulated here so that the work cannot be optimized away */
+static volatile uint32 CF_BenchSink;
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Bench_Rand(void)
+{
+    uint32 x = CF_BenchRandState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    CF_BenchRandState = x;
+
+    return x;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Number of repetitions of a benchmark, after scaling.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Bench_Reps(uint32 dflt)
+{
+    uint32 reps = (uint32)(((uint64)dflt * CF_BenchScale) / 100);
+
+    return (reps > 0) ? reps : 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Bench_Start(CF_BenchTimer_t *timer)
+{
+    clock_gettime(CLOCK_MONOTONIC, &timer->start);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Report the time since CF_Bench_Start() divided over the given
+ * number of operations.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Bench_Stop(const CF_BenchTimer_t *timer, const char *name, uint64 ops)
+{
+    struct timespec stop;
+    double          nsec;
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    nsec = (double)(stop.tv_sec - timer->start.tv_sec) * 1e9 + (double)(stop.tv_nsec - timer->start.tv_nsec);
+
+    UtPrintf("%-40s %12llu ops %10.1f ns/op", name, (unsigned long long)ops, nsec / (double)ops);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Receive a whole file of segments into the chunk list, as the receiver
+ * of a class 2 transfer does: every segment has the given chance in 1/1000
+ * to be lost in the first pass, and is then filled in by a second pass as
+ * if retransmitted.
+ *
+ * Returns the number of CF_ChunkListAdd calls made.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Bench_ReceiveFile(CF_ChunkList_t *chunks, uint16 loss_permille, uint8 *lost)
+{
+    uint32 adds = 0;
+    uint32 i;
+
+    CF_ChunkListReset(chunks);
+
+    for (i = 0; i < CF_BENCH_NUM_SEGMENTS; ++i)
+    {
+        lost[i] = (CF_Bench_Rand() % 1000) < loss_permille;
+        if (!lost[i])
+        {
+            CF_ChunkListAdd(chunks, i * CF_BENCH_SEGMENT_SIZE, CF_BENCH_SEGMENT_SIZE);
+            ++adds;
+        }
+    }
+
+    for (i = 0; i < CF_BENCH_NUM_SEGMENTS; ++i)
+    {
+        if (lost[i])
+        {
+            CF_ChunkListAdd(chunks, i * CF_BENCH_SEGMENT_SIZE, CF_BENCH_SEGMENT_SIZE);
+            ++adds;
+        }
+    }
+
+    return adds;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Bench_CountGap(const CF_ChunkList_t *cs, const CF_Chunk_t *chunk, void *opaque)
+{
+    CF_BenchGapCount_t *count = opaque;
+
+    ++count->gaps;
+    count->bytes += chunk->size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_CListTraverse_Status_t CF_Bench_SumNode(CF_CListNode_t *node, void *context)
+{
+    uint32 *sum = context;
+
+    *sum += container_of(node, CF_BenchNode_t, node)->value;
+
+    return CF_CLIST_CONT;
+}
+
+/*******************************************************************************
+**
+**  Microbenchmarks
+**
+*******************************************************************************/
+
+void CF_Bench_Setup(void)
+{
+    const char *env = getenv("CF_BENCH_SCALE");
+    uint32      val;
+
+    UT_ResetState(0);
+
+    CF_BenchRandState = 0x2545F491;
+
+    if (env != NULL)
+    {
+        val = (uint32)strtoul(env, NULL, 0);
+        if (val > 0)
+        {
+            CF_BenchScale = val;
+        }
+    }
+}
+
+void CF_Bench_ChunkListAdd(void)
+{
+    static const uint16 LOSS_PERMILLE[] = {0, 10, 50};
+
+    CF_ChunkList_t  chunks;
+    CF_BenchTimer_t timer;
+    uint8 *         lost;
+    uint32          reps = CF_Bench_Reps(4);
+    uint64          adds;
+    uint32          r;
+    int             i;
+    char            name[64];
+
+    lost = malloc(CF_BENCH_NUM_SEGMENTS);
+    UtAssert_NOT_NULL(lost);
+
+    CF_ChunkListInit(&chunks, CF_BENCH_MAX_CHUNKS, CF_BenchChunkMem);
+
+    for (i = 0; i < (sizeof(LOSS_PERMILLE) / sizeof(LOSS_PERMILLE[0])); ++i)
+    {
+        adds = 0;
+        snprintf(name, sizeof(name), "CF_ChunkListAdd, %u/1000 loss", (unsigned int)LOSS_PERMILLE[i]);
+
+        CF_Bench_Start(&timer);
+        for (r = 0; r < reps; ++r)
+        {
+            adds += CF_Bench_ReceiveFile(&chunks, LOSS_PERMILLE[i], lost);
+        }
+        CF_Bench_Stop(&timer, name, adds);
+
+        /* every gap was filled, so the file must be a single chunk */
+        UtAssert_UINT32_EQ(chunks.count, 1);
+        UtAssert_UINT32_EQ(chunks.chunks[0].offset, 0);
+        UtAssert_UINT32_EQ(chunks.chunks[0].size, CF_BENCH_FILE_SIZE);
+    }
+
+    free(lost);
+}
+
+void CF_Bench_ComputeGaps(void)
+{
+    CF_ChunkList_t     chunks;
+    CF_BenchTimer_t    timer;
+    CF_BenchGapCount_t count;
+    uint32             reps = CF_Bench_Reps(200000);
+    uint32             expect_bytes;
+    uint32             r;
+    uint32             i;
+
+    CF_ChunkListInit(&chunks, CF_BENCH_MAX_CHUNKS, CF_BenchChunkMem);
+
+    /*
+     * a full list, as left by a lossy first pass: received runs of random
+     * length separated by lost runs of one to four segments
+     */
+    i = 0;
+    while (chunks.count < CF_BENCH_MAX_CHUNKS)
+    {
+        i += 1 + (CF_Bench_Rand() % 4);
+        CF_ChunkListAdd(&chunks, i * CF_BENCH_SEGMENT_SIZE, (1 + (CF_Bench_Rand() % 32)) * CF_BENCH_SEGMENT_SIZE);
+        i = (chunks.chunks[chunks.count - 1].offset + chunks.chunks[chunks.count - 1].size) / CF_BENCH_SEGMENT_SIZE;
+    }
+
+    expect_bytes = chunks.chunks[0].offset;
+    for (i = 1; i < CF_BENCH_MAX_GAPS; ++i)
+    {
+        expect_bytes += chunks.chunks[i].offset - (chunks.chunks[i - 1].offset + chunks.chunks[i - 1].size);
+    }
+
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        memset(&count, 0, sizeof(count));
+        CF_ChunkList_ComputeGaps(&chunks, CF_BENCH_MAX_GAPS, CF_BENCH_FILE_SIZE, 0, CF_Bench_CountGap, &count);
+        CF_BenchSink += count.bytes;
+    }
+    CF_Bench_Stop(&timer, "CF_ChunkList_ComputeGaps, 58 of 128", reps);
+
+    UtAssert_UINT32_EQ(count.gaps, CF_BENCH_MAX_GAPS);
+    UtAssert_UINT32_EQ(count.bytes, expect_bytes);
+}
+
+void CF_Bench_EncodeDecode(void)
+{
+    CF_EncoderState_t      enc;
+    CF_DecoderState_t      dec;
+    CF_Logical_PduBuffer_t ph;
+    CF_BenchTimer_t        timer;
+    uint8                  pdu[CF_MAX_PDU_SIZE];
+    CFE_Status_t           status = CF_ERROR;
+    uint32                 reps   = CF_Bench_Reps(2000000);
+    uint32                 r;
+
+    memset(pdu, 0, sizeof(pdu));
+
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        CF_CFDP_EncodeStart(&enc, pdu, &ph, 0, sizeof(pdu));
+
+        ph.pdu_header.version         = 1;
+        ph.pdu_header.pdu_type        = 1;
+        ph.pdu_header.eid_length      = 2;
+        ph.pdu_header.txn_seq_length  = 4;
+        ph.pdu_header.source_eid      = 23;
+        ph.pdu_header.destination_eid = 24;
+        ph.pdu_header.sequence_num    = r;
+        CF_CFDP_EncodeHeaderWithoutSize(&enc, &ph.pdu_header);
+
+        ph.int_header.fd.offset = r * CF_BENCH_SEGMENT_SIZE;
+        CF_CFDP_EncodeFileDataHeader(&enc, false, &ph.int_header.fd);
+
+        /* the file data itself is a plain copy and not part of the measurement */
+        ph.pdu_header.data_encoded_length =
+            CF_CODEC_GET_POSITION(&enc) - ph.pdu_header.header_encoded_length + CF_BENCH_FD_DATA_SIZE;
+        CF_CFDP_EncodeHeaderFinalSize(&enc, &ph.pdu_header);
+    }
+    CF_Bench_Stop(&timer, "CF_CFDP_EncodeFileDataHeader, with header", reps);
+
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&enc));
+
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        CF_CFDP_DecodeStart(&dec, pdu, &ph, 0, sizeof(pdu));
+        status = CF_CFDP_DecodeHeader(&dec, &ph.pdu_header);
+        CF_BenchSink += ph.pdu_header.sequence_num;
+    }
+    CF_Bench_Stop(&timer, "CF_CFDP_DecodeHeader", reps);
+
+    UtAssert_INT32_EQ(status, CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&dec));
+    UtAssert_UINT32_EQ(ph.pdu_header.pdu_type, 1);
+    UtAssert_UINT32_EQ(ph.pdu_header.source_eid, 23);
+    UtAssert_UINT32_EQ(ph.pdu_header.destination_eid, 24);
+    UtAssert_UINT32_EQ(ph.pdu_header.sequence_num, reps - 1);
+}
+
+void CF_Bench_CrcDigest(void)
+{
+    CF_Crc_t        crc;
+    CF_Crc_t        check;
+    CF_BenchTimer_t timer;
+    uint32          reps = CF_Bench_Reps(20000);
+    uint32          r;
+    uint32          i;
+
+    for (i = 0; i < CF_BENCH_CRC_BUF_SIZE; ++i)
+    {
+        CF_BenchCrcBuf[i] = (uint8)CF_Bench_Rand();
+    }
+
+    /* all but the first call start unaligned to the 4-byte word, as file data segments often do */
+    CF_CRC_Start(&crc);
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        CF_CRC_Digest(&crc, CF_BenchCrcBuf, CF_BENCH_CRC_BUF_SIZE - 1);
+    }
+    CF_Bench_Stop(&timer, "CF_CRC_Digest, 4 KiB", reps);
+    CF_CRC_Finalize(&crc);
+
+    /* the same stream digested in one byte steps must give the same result */
+    CF_CRC_Start(&check);
+    for (r = 0; r < reps; ++r)
+    {
+        for (i = 0; i < CF_BENCH_CRC_BUF_SIZE - 1; ++i)
+        {
+            CF_CRC_Digest(&check, &CF_BenchCrcBuf[i], 1);
+        }
+    }
+    CF_CRC_Finalize(&check);
+
+    UtAssert_UINT32_EQ(crc.result, check.result);
+}
+
+void CF_Bench_CListTraverse(void)
+{
+    CF_CListNode_t *head = NULL;
+    CF_BenchTimer_t timer;
+    uint32          reps = CF_Bench_Reps(2000);
+    uint32          sum;
+    uint32          r;
+    uint32          i;
+
+    for (i = 0; i < CF_BENCH_QUEUE_LEN; ++i)
+    {
+        CF_BenchNodes[i].value = i;
+        CF_CList_InitNode(&CF_BenchNodes[i].node);
+        CF_CList_InsertBack(&head, &CF_BenchNodes[i].node);
+    }
+
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        sum = 0;
+        CF_CList_Traverse(head, CF_Bench_SumNode, &sum);
+        CF_BenchSink += sum;
+    }
+    CF_Bench_Stop(&timer, "CF_CList_Traverse, per node of 10000", (uint64)reps * CF_BENCH_QUEUE_LEN);
+
+    UtAssert_UINT32_EQ(sum, (CF_BENCH_QUEUE_LEN * (CF_BENCH_QUEUE_LEN - 1)) / 2);
+}
+
+void CF_Bench_CListIter(void)
+{
+    CF_CListNode_t *head = NULL;
+    CF_CListNode_t *node;
+    CF_CListIter_t  iter;
+    CF_BenchTimer_t timer;
+    uint32          reps = CF_Bench_Reps(2000);
+    uint32          sum;
+    uint32          r;
+    uint32          i;
+
+    for (i = 0; i < CF_BENCH_QUEUE_LEN; ++i)
+    {
+        CF_BenchNodes[i].value = i;
+        CF_CList_InitNode(&CF_BenchNodes[i].node);
+        CF_CList_InsertBack(&head, &CF_BenchNodes[i].node);
+    }
+
+    CF_Bench_Start(&timer);
+    for (r = 0; r < reps; ++r)
+    {
+        sum = 0;
+        CF_CLIST_FOREACH(iter, node, head)
+        {
+            sum += container_of(node, CF_BenchNode_t, node)->value;
+        }
+        CF_BenchSink += sum;
+    }
+    CF_Bench_Stop(&timer, "CF_CLIST_FOREACH, per node of 10000", (uint64)reps * CF_BENCH_QUEUE_LEN);
+
+    UtAssert_UINT32_EQ(sum, (CF_BENCH_QUEUE_LEN * (CF_BENCH_QUEUE_LEN - 1)) / 2);
+}
+
+/*
+ * Register the benchmarks to be run.
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(CF_Bench_ChunkListAdd, CF_Bench_Setup, NULL, "CF_Bench_ChunkListAdd");
+    UtTest_Add(CF_Bench_ComputeGaps, CF_Bench_Setup, NULL, "CF_Bench_ComputeGaps");
+    UtTest_Add(CF_Bench_EncodeDecode, CF_Bench_Setup, NULL, "CF_Bench_EncodeDecode");
+    UtTest_Add(CF_Bench_CrcDigest, CF_Bench_Setup, NULL, "CF_Bench_CrcDigest");
+    UtTest_Add(CF_Bench_CListTraverse, CF_Bench_Setup, NULL, "CF_Bench_CListTraverse");
+    UtTest_Add(CF_Bench_CListIter, CF_Bench_Setup, NULL, "CF_Bench_CListIter");
+}
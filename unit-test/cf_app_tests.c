@@ -163,6 +163,8 @@ void cf_config_table_tests_set_table_to_nominal(void)
     table.rx_crc_calc_bytes_per_wakeup = Any_uint32_Except(0) << 10;
     /* all values less than sizeof(CF_CFDP_PduFileDataContent_t) are nominal */
     table.outgoing_file_chunk_size = Any_uint16_LessThan(sizeof(CF_CFDP_PduFileDataContent_t));
+    /* no blocking on the throttle sem is always nominal */
+    memset(table.chan, 0, sizeof(table.chan));
 }
 
 void Setup_cf_config_table_tests(void)
@@ -241,6 +243,127 @@ void Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArra
     UtAssert_INT32_EQ(result, CFE_STATUS_VALIDATION_FAILURE);
 }
 
+void Test_CF_ValidateConfigTable_FailBecauseSemWaitNotLessThanWakeupPeriod(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+    int32             result;
+    int               i;
+
+    /* 10 ticks per second is a 100ms wakeup, so blocking for 100ms is too long */
+    arg_table->ticks_per_second                      = 10;
+    arg_table->rx_crc_calc_bytes_per_wakeup          = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size              = sizeof(CF_CFDP_PduFileDataContent_t);
+    arg_table->chan[CF_NUM_CHANNELS - 1].sem_wait_ms = 100;
+
+    /* Act */
+    result = CF_ValidateConfigTable(arg_table);
+
+    /* Assert */
+    UtAssert_INT32_EQ(result, CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_SEM_WAIT);
+
+    /* just under the wakeup period is acceptable */
+    arg_table->chan[CF_NUM_CHANNELS - 1].sem_wait_ms = 99;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+
+    /* the waits of all channels add up to the wakeup period, though each one alone is shorter */
+    for (i = 0; i < CF_NUM_CHANNELS; ++i)
+    {
+        arg_table->chan[i].sem_wait_ms = 100 / CF_NUM_CHANNELS;
+    }
+    arg_table->chan[CF_NUM_CHANNELS - 1].sem_wait_ms += 100 % CF_NUM_CHANNELS;
+    UT_CF_ResetEventCapture();
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_SEM_WAIT);
+
+    /* and just under it together is acceptable */
+    --arg_table->chan[CF_NUM_CHANNELS - 1].sem_wait_ms;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+}
+
+void Test_CF_ValidateConfigTable_FailBecausePollDirLimitsTooLarge(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+    CF_PollDir_t *    pd        = &arg_table->chan[CF_NUM_CHANNELS - 1].polldir[CF_MAX_POLLING_DIR_PER_CHAN - 1];
+
+    arg_table->ticks_per_second             = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size     = sizeof(CF_CFDP_PduFileDataContent_t);
+
+    /* more files in transfer than the channel has transactions */
+    pd->max_active = CF_NUM_TRANSACTIONS_PER_CHANNEL + 1;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_POLLDIR_LIMITS);
+
+    /* more files read ahead than the channel has pending file records */
+    UT_CF_ResetEventCapture();
+    pd->max_active  = CF_NUM_TRANSACTIONS_PER_CHANNEL;
+    pd->max_pending = CF_NUM_PENDING_FILES_PER_CHANNEL + 1;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_POLLDIR_LIMITS);
+
+    /* both at the limit is acceptable */
+    pd->max_pending = CF_NUM_PENDING_FILES_PER_CHANNEL;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+}
+
+void Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+
+    arg_table->ticks_per_second                        = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup            = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size                = sizeof(CF_CFDP_PduFileDataContent_t);
+    arg_table->chan[CF_NUM_CHANNELS - 1].checksum_type = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CF_CRC_ValidateType), CF_NUM_CHANNELS, CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Act */
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+
+    /* Assert */
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_CHECKSUM_TYPE);
+    UtAssert_STUB_COUNT(CF_CRC_ValidateType, CF_NUM_CHANNELS);
+}
+
+void Test_CF_ValidateConfigTable_FailBecauseRelayChannelInvalid(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+
+    arg_table->ticks_per_second                     = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup         = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size             = sizeof(CF_CFDP_PduFileDataContent_t);
+    arg_table->chan[CF_NUM_CHANNELS - 1].relay_eid  = 1;
+    arg_table->chan[CF_NUM_CHANNELS - 1].relay_chan = CF_NUM_CHANNELS;
+
+    /* Act */
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+
+    /* Assert */
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_RELAY);
+}
+
+void Test_CF_ValidateConfigTable_FailBecauseFecGroupSizeTooLarge(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+
+    arg_table->ticks_per_second                         = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup             = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size                 = sizeof(CF_CFDP_PduFileDataContent_t);
+    arg_table->chan[CF_NUM_CHANNELS - 1].fec_group_size = CF_FEC_MAX_GROUP_SIZE + 1;
+
+    /* Act */
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+
+    /* Assert */
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_FEC);
+}
+
 void Test_CF_ValidateConfigTable_Success(void)
 {
     /* Arange */
@@ -613,6 +736,16 @@ void add_CF_ValidateConfigTable_tests(void)
     UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArray,
                Setup_cf_config_table_tests, CF_App_Tests_Teardown,
                "Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArray");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseSemWaitNotLessThanWakeupPeriod, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseSemWaitNotLessThanWakeupPeriod");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecausePollDirLimitsTooLarge, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecausePollDirLimitsTooLarge");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseRelayChannelInvalid, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseRelayChannelInvalid");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseFecGroupSizeTooLarge, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseFecGroupSizeTooLarge");
     UtTest_Add(Test_CF_ValidateConfigTable_Success, Setup_cf_config_table_tests, CF_App_Tests_Teardown,
                "Test_CF_ValidateConfigTable_Success");
 }
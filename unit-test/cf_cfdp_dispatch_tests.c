@@ -39,6 +39,7 @@ static void UT_CFDP_Dispatch_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical
     static CF_Logical_PduBuffer_t ut_pdu_buffer;
     static CF_History_t           ut_history;
     static CF_Transaction_t       ut_transaction;
+    static CF_TransactionCold_t   ut_transaction_cold;
     static CF_ConfigTable_t       ut_config_table;
 
     /*
@@ -49,11 +50,13 @@ static void UT_CFDP_Dispatch_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical
     memset(&ut_pdu_buffer, 0, sizeof(ut_pdu_buffer));
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
+    memset(&ut_transaction_cold, 0, sizeof(ut_transaction_cold));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.cold     = &ut_transaction_cold;
     CF_AppData.config_table = &ut_config_table;
 
     if (pdu_buffer_p)
@@ -49,6 +49,7 @@ static void UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuf
     static CF_Logical_PduBuffer_t ut_pdu_buffer;
     static CF_History_t           ut_history;
     static CF_Transaction_t       ut_transaction;
+    static CF_TransactionCold_t   ut_transaction_cold;
     static CF_ConfigTable_t       ut_config_table;
 
     /*
@@ -59,11 +60,13 @@ static void UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuf
     memset(&ut_pdu_buffer, 0, sizeof(ut_pdu_buffer));
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
+    memset(&ut_transaction_cold, 0, sizeof(ut_transaction_cold));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.cold     = &ut_transaction_cold;
     CF_AppData.config_table = &ut_config_table;
 
     if (pdu_buffer_p)
@@ -369,6 +372,7 @@ void Test_CF_CFDP_R_Init(void)
     UtAssert_VOIDCALL(CF_CFDP_R_Init(txn));
     UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_StartRelay, 1);
 
     /* failure of file open, class 1 */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
@@ -387,6 +391,23 @@ void Test_CF_CFDP_R_Init(void)
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_CREAT);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open, 2);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
+
+    /* unsupported checksum type in MD, class 1 */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
+    txn->state             = CF_TxnState_R1;
+    txn->history->txn_stat = CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE;
+    UtAssert_VOIDCALL(CF_CFDP_R_Init(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 2);
+
+    /* unsupported checksum type in MD, class 2 */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
+    txn->state             = CF_TxnState_R2;
+    txn->flags.rx.md_recv  = true;
+    txn->history->txn_stat = CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE;
+    UtAssert_VOIDCALL(CF_CFDP_R_Init(txn));
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_fin);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_StartRelay, 1);
 }
 
 void Test_CF_CFDP_R2_SetFinTxnStatus(void)
@@ -460,24 +481,30 @@ void Test_CF_CFDP_R_CheckCrc(void)
 
     /* CRC mismatch, class 1 */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
-    txn->state      = CF_TxnState_R1;
-    txn->crc.result = 0xdeadbeef;
+    txn->state            = CF_TxnState_R1;
+    txn->cold->crc.result = 0xdeadbeef;
     UtAssert_INT32_EQ(CF_CFDP_R_CheckCrc(txn, 0x1badc0de), 1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_CRC);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.crc_mismatch, 1);
 
     /* CRC mismatch, class 2 */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
-    txn->state      = CF_TxnState_R2;
-    txn->crc.result = 0xdeadbeef;
+    txn->state            = CF_TxnState_R2;
+    txn->cold->crc.result = 0xdeadbeef;
     UtAssert_INT32_EQ(CF_CFDP_R_CheckCrc(txn, 0x2badc0de), 1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_CRC);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.crc_mismatch, 2);
 
     /* CRC match */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
-    txn->crc.result = 0xc0ffee;
+    txn->cold->crc.result = 0xc0ffee;
     UtAssert_INT32_EQ(CF_CFDP_R_CheckCrc(txn, 0xc0ffee), 0);
+
+    /* null checksum always matches */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
+    txn->cold->crc.type   = CF_CRC_Type_NULL;
+    txn->cold->crc.result = 0;
+    UtAssert_INT32_EQ(CF_CFDP_R_CheckCrc(txn, 0x3badc0de), 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -553,7 +580,8 @@ void Test_CF_CFDP_R_ProcessFd(void)
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 100);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes, 100);
-    UtAssert_STUB_COUNT(CF_WrappedLseek, 0);
+    UtAssert_UINT32_EQ(txn->cold->progress.file_data_bytes, 100);
+    UtAssert_STUB_COUNT(CF_WrappedSeek, 0);
     UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
 
     /* call again, but for something at a different offset */
@@ -561,11 +589,10 @@ void Test_CF_CFDP_R_ProcessFd(void)
     fd           = &ph->int_header.fd;
     fd->data_len = 100;
     fd->offset   = 200;
-    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedLseek), fd->offset);
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes, 200);
-    UtAssert_STUB_COUNT(CF_WrappedLseek, 1);
+    UtAssert_STUB_COUNT(CF_WrappedSeek, 1);
     UtAssert_STUB_COUNT(CF_WrappedWrite, 2);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
 
@@ -581,13 +608,13 @@ void Test_CF_CFDP_R_ProcessFd(void)
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_WRITE);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 
-    /* call again, but with a failed lseek */
+    /* call again, but with a failed seek */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     fd                                 = &ph->int_header.fd;
     fd->data_len                       = 100;
     fd->offset                         = 200;
     txn->state_data.receive.cached_pos = 300;
-    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedLseek), -1);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedSeek), CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), -1);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_SEEK_FD);
@@ -650,11 +677,11 @@ void Test_CF_CFDP_R1_SubstateRecvEof(void)
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
-    eof             = &ph->int_header.eof;
-    eof->crc        = 0xf007ba11;
-    txn->crc.result = eof->crc;
-    eof->size       = 0xccc;
-    txn->fsize      = eof->size;
+    eof                   = &ph->int_header.eof;
+    eof->crc              = 0xf007ba11;
+    txn->cold->crc.result = eof->crc;
+    eof->size             = 0xccc;
+    txn->fsize            = eof->size;
     UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvEof(txn, ph));
     UtAssert_BOOL_TRUE(txn->keep);
     UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1);
@@ -667,9 +694,9 @@ void Test_CF_CFDP_R1_SubstateRecvEof(void)
 
     /* failure in CF_CFDP_R_CheckCrc */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
-    eof             = &ph->int_header.eof;
-    eof->crc        = 0xf007ba11;
-    txn->crc.result = ~eof->crc;
+    eof                   = &ph->int_header.eof;
+    eof->crc              = 0xf007ba11;
+    txn->cold->crc.result = ~eof->crc;
     UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvEof(txn, ph));
     UtAssert_BOOL_FALSE(txn->keep);
 }
@@ -685,11 +712,11 @@ void Test_CF_CFDP_R2_SubstateRecvEof(void)
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
-    eof             = &ph->int_header.eof;
-    eof->crc        = 0xf007ba11;
-    txn->crc.result = eof->crc;
-    eof->size       = 0xbbb;
-    txn->fsize      = 0xbbb;
+    eof                   = &ph->int_header.eof;
+    eof->crc              = 0xf007ba11;
+    txn->cold->crc.result = eof->crc;
+    eof->size             = 0xbbb;
+    txn->fsize            = 0xbbb;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvEof(txn, ph));
     UtAssert_BOOL_TRUE(txn->flags.rx.eof_recv);
     UtAssert_BOOL_TRUE(txn->flags.rx.send_ack);
@@ -742,6 +769,21 @@ void Test_CF_CFDP_R1_SubstateRecvFileData(void)
     UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
     UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
 
+    /* data received in order can be relayed */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    ph->int_header.fd.data_len = 50;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, 50);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 1);
+
+    /* data past a gap cannot */
+    ph->int_header.fd.offset = 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, 50);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 1);
+
     /* failure in CF_CFDP_RecvFd */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_RecvFd), 1, -1);
@@ -753,6 +795,136 @@ void Test_CF_CFDP_R1_SubstateRecvFileData(void)
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, -1);
     UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
     UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 2);
+
+    /* with parity, the checksum only takes data in file order */
+    UT_ResetState(UT_KEY(CF_CRC_Digest));
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.fec.params.group_size   = 4;
+    txn->state_data.receive.fec.params.segment_size = 50;
+    ph->int_header.fd.data_len                      = 50;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_FecDecoder_Add, 1);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, 50);
+
+    /* data past a gap is left for when the gap is rebuilt */
+    ph->int_header.fd.offset = 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_FecDecoder_Add, 2);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+
+    /* data overlapping what was received only adds the new part */
+    ph->int_header.fd.offset = 25;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 2);
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, 75);
+}
+
+static void UT_AltHandler_FecGetLost(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint8 *lost   = UT_Hook_GetArgValueByName(Context, "lost", uint8 *);
+    bool   retval = true;
+
+    *lost = *((const uint8 *)UserObj);
+    UT_Stub_SetReturnValue(FuncKey, retval);
+}
+
+void Test_CF_CFDP_R1_RecvParity(void)
+{
+    /* Test case for:
+     * void CF_CFDP_R1_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
+     */
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+    uint8                   parity[10];
+    uint8                   lost = 1;
+
+    memset(parity, 0, sizeof(parity));
+
+    /* nothing lost, or more than can be rebuilt */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UtAssert_STUB_COUNT(CF_FecDecoder_GetLost, 1);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* bad parity PDU */
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_RecvParity), 1, CF_SHORT_PDU_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UtAssert_STUB_COUNT(CF_FecDecoder_GetLost, 1);
+
+    /* parity shorter than the lost segment */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetHandlerFunction(UT_KEY(CF_FecDecoder_GetLost), UT_AltHandler_FecGetLost, &lost);
+    UT_SetDefaultReturnValue(UT_KEY(CF_Fec_SegmentLength), sizeof(parity));
+    ph->int_header.parity.data_ptr = parity;
+    ph->int_header.parity.data_len = sizeof(parity) - 1;
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* nominal, the other three segments are read back and the lost one is written */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.fec.params.group_size   = 4;
+    txn->state_data.receive.fec.params.segment_size = sizeof(parity);
+    txn->state_data.receive.relay_pos               = sizeof(parity);
+    ph->int_header.parity.data_ptr                  = parity;
+    ph->int_header.parity.data_len                  = sizeof(parity);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedRead), sizeof(parity));
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, sizeof(parity));
+    UT_SetDeferredRetcode(UT_KEY(CF_Fec_GroupEnd), 1, sizeof(parity) * 2);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UtAssert_STUB_COUNT(CF_Fec_Xor, 3);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+    UtAssert_UINT32_EQ(ph->int_header.fd.offset, sizeof(parity));
+    UtAssert_UINT32_EQ(ph->int_header.fd.data_len, sizeof(parity));
+    UtAssert_STUB_COUNT(CF_FecDecoder_Add, 1);
+    UT_CF_AssertEventID(CF_EID_DBG_CFDP_R_FEC_REBUILT);
+
+    /* the rest of the group is digested from the file */
+    UtAssert_STUB_COUNT(CF_WrappedRead, 4);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, sizeof(parity) * 2);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 0);
+
+    /* failure to read back a segment */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.fec.params.group_size   = 4;
+    txn->state_data.receive.fec.params.segment_size = sizeof(parity);
+    ph->int_header.parity.data_ptr                  = parity;
+    ph->int_header.parity.data_len                  = sizeof(parity);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, -1);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_READ);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1);
+
+    /* failure to seek */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.fec.params.group_size   = 4;
+    txn->state_data.receive.fec.params.segment_size = sizeof(parity);
+    txn->state_data.receive.cached_pos              = 1;
+    ph->int_header.parity.data_ptr                  = parity;
+    ph->int_header.parity.data_len                  = sizeof(parity);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeek), 1, -1);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_SEEK_CRC);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 2);
+
+    /* failure to write the rebuilt segment */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.fec.params.group_size   = 4;
+    txn->state_data.receive.fec.params.segment_size = sizeof(parity);
+    ph->int_header.parity.data_ptr                  = parity;
+    ph->int_header.parity.data_len                  = sizeof(parity);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, -1);
+    UtAssert_VOIDCALL(CF_CFDP_R1_RecvParity(txn, ph));
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_WRITE);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 3);
 }
 
 void Test_CF_CFDP_R2_SubstateRecvFileData(void)
@@ -762,6 +934,7 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
      */
     CF_Transaction_t *      txn;
     CF_Logical_PduBuffer_t *ph;
+    CF_Chunk_t              chunk;
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -770,13 +943,42 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
     UtAssert_STUB_COUNT(CF_ChunkListAdd, 1);
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
     UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 1);
+    UtAssert_ZERO(txn->cold->progress.retransmit_bytes);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 0);
+
+    /* the data from the start of the file grows, it can be relayed */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    memset(&chunk, 0, sizeof(chunk));
+    chunk.size = 200;
+    UT_SetHandlerFunction(UT_KEY(CF_ChunkList_GetFirstChunk), UT_AltHandler_GenericPointerReturn, &chunk);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_UINT32_EQ(txn->state_data.receive.relay_pos, 200);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 1);
+
+    /* the start of the file is missing, nothing can be relayed */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    chunk.offset = 100;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_ZERO(txn->state_data.receive.relay_pos);
+    UtAssert_STUB_COUNT(CF_CFDP_WakeRelay, 1);
+    UT_ResetState(UT_KEY(CF_ChunkList_GetFirstChunk));
+
+    /* data below the highest offset received fills a gap */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    ph->int_header.fd.offset   = 100;
+    ph->int_header.fd.data_len = 50;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 50);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_GetEnd), 1, 300);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_UINT32_EQ(txn->cold->progress.retransmit_bytes, 50);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);
 
     /* with fd_nak_sent flag */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
     txn->flags.rx.fd_nak_sent               = true;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
-    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 3);
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
 
     /* with rx.complete flag */
@@ -784,7 +986,7 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
     txn->flags.rx.complete                  = true;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
-    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);            /* does NOT increment here */
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 3);            /* does NOT increment here */
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
 
     /* failure in CF_CFDP_RecvFd (bad packet) */
@@ -920,9 +1122,27 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
 
+    /* null checksum does not read the file back */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
+    config->rx_crc_calc_bytes_per_wakeup = 100;
+    txn->fsize                           = 70;
+    txn->cold->crc.type                  = CF_CRC_Type_NULL;
+    UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
+    UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
+    UtAssert_BOOL_TRUE(txn->keep);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EndRelay, 0);
+
+    /* a relayed file that checks out releases the outbound right away */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
+    txn->cold->relay = txn; /* only needs to be set */
+    UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
+    UtAssert_BOOL_TRUE(txn->keep);
+    UtAssert_STUB_COUNT(CF_CFDP_EndRelay, 1);
+
     /* force a CRC mismatch */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
-    txn->crc.result                    = 0xabadf00d;
+    txn->cold->crc.result              = 0xabadf00d;
     txn->state_data.receive.r2.eof_crc = 0xdeadbeef;
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
@@ -951,7 +1171,6 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     txn->state_data.receive.cached_pos           = 20;
     config->rx_crc_calc_bytes_per_wakeup         = 100;
     txn->fsize                                   = 50;
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, txn->state_data.receive.r2.rx_crc_calc_bytes);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, txn->fsize - txn->state_data.receive.r2.rx_crc_calc_bytes);
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
@@ -967,13 +1186,13 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILE_SIZE_ERROR);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read, 1);
 
-    /* failure of lseek */
+    /* failure of seek */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
     txn->state_data.receive.r2.rx_crc_calc_bytes = 20;
     txn->state_data.receive.cached_pos           = 10;
     config->rx_crc_calc_bytes_per_wakeup         = 100;
     txn->fsize                                   = 50;
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeek), 1, CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), -1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_SEEK_CRC);
     UtAssert_BOOL_FALSE(txn->flags.com.crc_calc);
@@ -1050,6 +1269,7 @@ void Test_CF_CFDP_R2_RecvMd(void)
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 0);
     UtAssert_UINT32_EQ(txn->flags.rx.md_recv, 1);
     UtAssert_UINT32_EQ(txn->state_data.receive.r2.acknak_count, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_StartRelay, 1);
 
     /* md_recv already set */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -1072,6 +1292,15 @@ void Test_CF_CFDP_R2_RecvMd(void)
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_R_EOF_MD_SIZE);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILE_SIZE_ERROR);
 
+    /* unsupported checksum type, keeps the temp file and sends FIN */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->history->txn_stat = CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE;
+    UtAssert_VOIDCALL(CF_CFDP_R2_RecvMd(txn, ph));
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_fin);
+    UtAssert_UINT32_EQ(txn->flags.rx.md_recv, 0);
+    UtAssert_STUB_COUNT(OS_mv, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_StartRelay, 2);
+
     /* OS_mv failure */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(OS_mv), 1, CF_ERROR);
@@ -1136,6 +1365,7 @@ void UtTest_Setup(void)
                "CF_CFDP_R2_SubstateRecvEof");
     UtTest_Add(Test_CF_CFDP_R1_SubstateRecvFileData, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R1_SubstateRecvFileData");
+    UtTest_Add(Test_CF_CFDP_R1_RecvParity, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R1_RecvParity");
     UtTest_Add(Test_CF_CFDP_R2_SubstateRecvFileData, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R2_SubstateRecvFileData");
     UtTest_Add(Test_CF_CFDP_R2_GapCompute, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R2_GapCompute");
@@ -72,6 +72,7 @@ static void UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuf
     static CF_Logical_PduBuffer_t ut_pdu_buffer;
     static CF_History_t           ut_history;
     static CF_Transaction_t       ut_transaction;
+    static CF_TransactionCold_t   ut_transaction_cold;
     static CF_ConfigTable_t       ut_config_table;
 
     /*
@@ -82,11 +83,13 @@ static void UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuf
     memset(&ut_pdu_buffer, 0, sizeof(ut_pdu_buffer));
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
+    memset(&ut_transaction_cold, 0, sizeof(ut_transaction_cold));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.cold     = &ut_transaction_cold;
     ut_history.txn_stat     = CF_TxnStatus_UNDEFINED;
     CF_AppData.config_table = &ut_config_table;
 
@@ -351,6 +354,7 @@ void Test_CF_CFDP_S_SendEof(void)
      * CFE_Status_t CF_CFDP_S_SendEof(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    CF_TxGroup_t      group;
 
     /* nominal */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -365,6 +369,15 @@ void Test_CF_CFDP_S_SendEof(void)
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_SendEof), 1, CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_S_SendEof(txn), CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+
+    /* member of a transmit group, finalizes the checksum of the group */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&group, 0, sizeof(group));
+    group.crc.result = 0x1234;
+    txn->cold->group = &group;
+    UtAssert_INT32_EQ(CF_CFDP_S_SendEof(txn), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(txn->cold->crc.result, 0x1234);
+    UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
 }
 
 void Test_CF_CFDP_S1_SubstateSendEof(void)
@@ -373,6 +386,7 @@ void Test_CF_CFDP_S1_SubstateSendEof(void)
      * void CF_CFDP_S1_SubstateSendEof(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    CF_Transaction_t  rx;
 
     /* nominal, should reset */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -384,6 +398,16 @@ void Test_CF_CFDP_S1_SubstateSendEof(void)
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_SendEof), 1, CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
     UtAssert_VOIDCALL(CF_CFDP_S1_SubstateSendEof(txn));
     UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1); /* no increment */
+
+    /* relayed, the file is still being received so the EOF waits */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&rx, 0, sizeof(rx));
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index] = 10;
+    txn->cold->relay                                                               = &rx;
+    UtAssert_VOIDCALL(CF_CFDP_S1_SubstateSendEof(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_SendEof, 2);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1);
 }
 
 void Test_CF_CFDP_S2_SubstateSendEof(void)
@@ -392,6 +416,7 @@ void Test_CF_CFDP_S2_SubstateSendEof(void)
      * void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    CF_Transaction_t  rx;
 
     /* nominal, this dequeues a transaction so q_size must be nonzero */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -399,18 +424,37 @@ void Test_CF_CFDP_S2_SubstateSendEof(void)
     UtAssert_VOIDCALL(CF_CFDP_S2_SubstateSendEof(txn));
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_WAIT_FOR_EOF_ACK);
     UtAssert_BOOL_TRUE(txn->flags.com.ack_timer_armed);
+
+    /* relayed, the file is still being received so the EOF waits */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&rx, 0, sizeof(rx));
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index] = 10;
+    txn->state_data.send.sub_state                                                 = CF_TxSubState_EOF;
+    txn->cold->relay                                                               = &rx;
+    UtAssert_VOIDCALL(CF_CFDP_S2_SubstateSendEof(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_EOF);
+    UtAssert_BOOL_FALSE(txn->flags.com.ack_timer_armed);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 2);
+
+    /* unless it is canceled */
+    txn->flags.com.canceled = true;
+    UtAssert_VOIDCALL(CF_CFDP_S2_SubstateSendEof(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_WAIT_FOR_EOF_ACK);
 }
 
 void Test_CF_CFDP_S_SendFileData(void)
 {
     /* Test case for:
-     * int32 CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc);
+     * CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+     *                                     uint8 calc_crc);
      */
     CF_Transaction_t *txn;
     CF_ConfigTable_t *config;
+    CF_TxGroup_t      group;
+    CF_FecEncoder_t   fec;
     uint32            cumulative_read;
     uint32            read_size;
-    uint32            offset;
+    CF_FileSize_t     offset;
 
     cumulative_read = 0;
     offset          = 0;
@@ -429,6 +473,8 @@ void Test_CF_CFDP_S_SendFileData(void)
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, false), read_size);
     cumulative_read += read_size;
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
+    UtAssert_UINT32_EQ(txn->cold->progress.file_data_bytes, read_size);
+    UtAssert_UINT32_EQ(txn->cold->progress.retransmit_bytes, read_size);
 
     /* nominal, larger than PDU, no CRC */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -451,6 +497,8 @@ void Test_CF_CFDP_S_SendFileData(void)
     cumulative_read += config->outgoing_file_chunk_size;
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
     UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+    UtAssert_UINT32_EQ(txn->cold->progress.file_data_bytes, config->outgoing_file_chunk_size);
+    UtAssert_ZERO(txn->cold->progress.retransmit_bytes);
 
     /* read w/failure */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -462,26 +510,90 @@ void Test_CF_CFDP_S_SendFileData(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read, 1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_S_READ);
 
-    /* require lseek */
+    /* require seek */
     offset = 25;
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, offset);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
     config->outgoing_file_chunk_size = read_size;
     txn->fsize                       = 300;
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, true), read_size);
     cumulative_read += read_size;
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
+    UtAssert_STUB_COUNT(CF_WrappedSeek, 1);
 
-    /* lseek w/failure */
+    /* require seek past 4 GiB */
+    offset = 0x100000000;
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
+    config->outgoing_file_chunk_size = read_size;
+    txn->fsize                       = offset + 300;
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, true), read_size);
+    cumulative_read += read_size;
+    UtAssert_STUB_COUNT(CF_WrappedSeek, 1);
+    UtAssert_True(txn->state_data.send.cached_pos == offset + read_size, "cached_pos (%llx) == %llx",
+                  (unsigned long long)txn->state_data.send.cached_pos, (unsigned long long)(offset + read_size));
+
+    /* seek w/failure */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeek), 1, CF_ERROR);
     config->outgoing_file_chunk_size = read_size;
     txn->fsize                       = 300;
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, true), -1);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_S_SEEK_FD);
+
+    /* member of a transmit group, the data is in the group buffer so it is not read again */
+    UT_ResetState(UT_KEY(CF_WrappedRead));
+    UT_ResetState(UT_KEY(CF_WrappedSeek));
+    UT_ResetState(UT_KEY(CF_CRC_Digest));
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&group, 0, sizeof(group));
+    config->outgoing_file_chunk_size = read_size;
+    txn->fsize                       = 300;
+    txn->cold->group                 = &group;
+    group.buf_len                    = read_size;
+    group.cached_pos                 = read_size;
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, 0, read_size, true), read_size);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+    UtAssert_UINT32_EQ(group.crc_offset, read_size);
+
+    /* the group checksum only takes each part of the file once */
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, 0, read_size, true), read_size);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+
+    /* the next part is read through the file of the group, and kept in its buffer */
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, read_size, read_size, true), read_size);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+    UtAssert_STUB_COUNT(CF_WrappedSeek, 0);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 2);
+    UtAssert_UINT32_EQ(group.buf_offset, read_size);
+    UtAssert_UINT32_EQ(group.buf_len, read_size);
+    UtAssert_UINT32_EQ(group.cached_pos, read_size * 2);
+    UtAssert_ZERO(txn->state_data.send.cached_pos);
+
+    /* with parity, only the first pass over the file goes into the encoder */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&fec, 0, sizeof(fec));
+    config->outgoing_file_chunk_size = read_size;
+    txn->fsize                       = 300;
+    txn->state_data.send.fec         = &fec;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, 0, read_size, true), read_size);
+    UtAssert_STUB_COUNT(CF_FecEncoder_Add, 1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, 0, read_size, false), read_size);
+    UtAssert_STUB_COUNT(CF_FecEncoder_Add, 1);
+}
+
+static void UT_AltHandler_FecReady(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_FecEncoder_t *enc = UT_Hook_GetArgValueByName(Context, "enc", CF_FecEncoder_t *);
+
+    enc->ready = true;
 }
 
 void Test_CF_CFDP_S_SubstateSendFileData(void)
@@ -489,8 +601,13 @@ void Test_CF_CFDP_S_SubstateSendFileData(void)
     /* Test case for:
      * void CF_CFDP_S_SubstateSendFileData(CF_Transaction_t *txn);
      */
-    CF_Transaction_t *txn;
-    CF_ConfigTable_t *config;
+    CF_Transaction_t *   txn;
+    CF_ConfigTable_t *   config;
+    CF_TxGroup_t         group;
+    CF_Transaction_t     member;
+    CF_TransactionCold_t member_cold;
+    CF_Transaction_t     rx;
+    CF_FecEncoder_t      fec;
 
     /* nominal, zero bytes processed */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -522,6 +639,101 @@ void Test_CF_CFDP_S_SubstateSendFileData(void)
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_EOF);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
+
+    /* member of a transmit group, runs the members that are behind it right away */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&group, 0, sizeof(group));
+    memset(&member, 0, sizeof(member));
+    memset(&member_cold, 0, sizeof(member_cold));
+    member.cold                      = &member_cold;
+    config->outgoing_file_chunk_size = CF_MAX_PDU_SIZE / 2;
+    txn->state_data.send.sub_state   = CF_TxSubState_FILEDATA;
+    txn->fsize                       = CF_MAX_PDU_SIZE;
+    txn->cold->group                 = &group;
+    member.state_data.send.sub_state = CF_TxSubState_FILEDATA;
+    member.flags.com.q_index         = CF_QueueIdx_TXA;
+    member.state                     = CF_TxnState_S2;
+    member.cold->group               = &group;
+    group.members[0]                 = txn;
+    group.members[1]                 = &member;
+    group.num_members                = 2;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, config->outgoing_file_chunk_size);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_UINT32_EQ(txn->foffs, config->outgoing_file_chunk_size);
+    UtAssert_STUB_COUNT(CF_CFDP_S_DispatchTransmit, 1);
+    UtAssert_BOOL_FALSE(group.fanning_out);
+
+    /* a member that is ahead, or suspended, is left alone */
+    member.foffs = CF_MAX_PDU_SIZE;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, config->outgoing_file_chunk_size);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    member.foffs                   = 0;
+    member.flags.com.suspended     = true;
+    txn->foffs                     = 0;
+    txn->state_data.send.sub_state = CF_TxSubState_FILEDATA;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, config->outgoing_file_chunk_size);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_S_DispatchTransmit, 1);
+
+    /* relayed, only the data received so far is sent */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&rx, 0, sizeof(rx));
+    config->outgoing_file_chunk_size = CF_MAX_PDU_SIZE;
+    txn->state_data.send.sub_state   = CF_TxSubState_FILEDATA;
+    txn->fsize                       = CF_MAX_PDU_SIZE;
+    txn->cold->relay                 = &rx;
+    rx.state_data.receive.relay_pos  = CF_MAX_PDU_SIZE / 4;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, CF_MAX_PDU_SIZE / 4);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_UINT32_EQ(txn->foffs, CF_MAX_PDU_SIZE / 4);
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 0);
+
+    /* relayed, all of the data received so far was sent so it waits */
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index] = 10;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_UINT32_EQ(txn->foffs, CF_MAX_PDU_SIZE / 4);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+
+    /* with parity, file data stops at the end of the parity segment */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&fec, 0, sizeof(fec));
+    config->outgoing_file_chunk_size = CF_MAX_PDU_SIZE;
+    txn->state_data.send.sub_state   = CF_TxSubState_FILEDATA;
+    txn->state_data.send.fec         = &fec;
+    txn->fsize                       = CF_MAX_PDU_SIZE;
+    UT_SetDeferredRetcode(UT_KEY(CF_Fec_SegmentEnd), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, 100);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_UINT32_EQ(txn->foffs, 100);
+    UtAssert_STUB_COUNT(CF_CFDP_SendParity, 0);
+
+    /* the parity of a full group goes out before any more file data */
+    fec.ready = true;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_SendParity, 1);
+    UtAssert_STUB_COUNT(CF_FecEncoder_NextGroup, 1);
+    UtAssert_UINT32_EQ(txn->foffs, 100);
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+
+    /* no buffer for the parity, it is tried again */
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_SendParity), 1, CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_SendParity, 2);
+    UtAssert_STUB_COUNT(CF_FecEncoder_NextGroup, 1);
+
+    /* the end of the file waits for the parity of the last group */
+    fec.ready  = false;
+    txn->foffs = CF_MAX_PDU_SIZE - 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_Fec_SegmentEnd), 1, CF_MAX_PDU_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, 100);
+    UT_SetHandlerFunction(UT_KEY(CF_FecEncoder_Add), UT_AltHandler_FecReady, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_UINT32_EQ(txn->foffs, CF_MAX_PDU_SIZE);
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendFileData(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_SendParity, 3);
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_EOF);
 }
 
 void Test_CF_CFDP_S_CheckAndRespondNak(void)
@@ -624,6 +836,11 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
      * void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    CF_ConfigTable_t *config;
+    CF_TxGroup_t      group;
+    CF_Transaction_t  rx;
+    os_fstat_t        fstat;
+    int               i;
 
     /* with no setup, OS_FileOpenCheck returns SUCCESS (true) */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -633,10 +850,11 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
 
     /* file already open */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    OS_OpenCreate(&txn->fd, "ut", 0, 0); /* sets fd */
+    OS_OpenCreate(&txn->cold->fd, "ut", 0, 0); /* sets fd */
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_STUB_COUNT(CF_CRC_StartType, 1);
 
     /* this retval is sticky and applies for the rest of the test cases */
     UT_SetDefaultReturnValue(UT_KEY(OS_FileOpenCheck), OS_ERROR);
@@ -649,17 +867,17 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open, 2);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 
-    /* first CF_WrappedLseek fails */
+    /* OS_stat fails */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_ERROR);
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_S_SEEK_END);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 
-    /* second CF_WrappedLseek fails */
+    /* CF_WrappedLseek fails */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 2, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_S_SEEK_BEG);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 2);
@@ -683,6 +901,83 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+
+    /* everything works, the size of a file of 4 GiB or more is kept whole */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&fstat, 0, sizeof(fstat));
+    fstat.FileSize = 0x123456789;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_True(txn->fsize == 0x123456789, "txn->fsize (%llx) == 0x123456789", (unsigned long long)txn->fsize);
+
+    /* member of a transmit group, the first one opens the file of the group */
+    UT_ResetState(UT_KEY(CF_CRC_StartType));
+    UT_ResetState(UT_KEY(CF_WrappedOpenCreate));
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&group, 0, sizeof(group));
+    group.fd         = OS_OBJECT_ID_UNDEFINED;
+    group.cached_pos = 10;
+    txn->cold->group = &group;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(txn->cold->fd));
+    UtAssert_ZERO(group.cached_pos);
+    UtAssert_STUB_COUNT(CF_CRC_StartType, 2);
+
+    /* the others use the file as it is */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    group.fd         = OS_ObjectIdFromInteger(1);
+    group.fsize      = 0x123456789;
+    txn->cold->group = &group;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+    UtAssert_STUB_COUNT(CF_CRC_StartType, 3);
+    UtAssert_True(txn->fsize == 0x123456789, "txn->fsize (%llx) == 0x123456789", (unsigned long long)txn->fsize);
+
+    /* class 1 on a channel with parity takes a free encoder, segments are at most a file data PDU */
+    UT_ResetState(UT_KEY(CF_FecEncoder_Init));
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    CF_AppData.engine.fec_encoders[0].in_use   = true;
+    config->chan[txn->chan_num].fec_group_size = 8;
+    config->outgoing_file_chunk_size           = CF_MAX_PDU_SIZE;
+    txn->state                                 = CF_TxnState_S1;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_ADDRESS_EQ(txn->state_data.send.fec, &CF_AppData.engine.fec_encoders[1]);
+    UtAssert_BOOL_TRUE(CF_AppData.engine.fec_encoders[1].in_use);
+    UtAssert_STUB_COUNT(CF_FecEncoder_Init, 1);
+
+    /* no free encoder, the file is sent without parity */
+    for (i = 0; i < CF_NUM_FEC_ENCODERS; ++i)
+    {
+        CF_AppData.engine.fec_encoders[i].in_use = true;
+    }
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    config->chan[txn->chan_num].fec_group_size = 8;
+    txn->state                                 = CF_TxnState_S1;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_NULL(txn->state_data.send.fec);
+
+    /* class 2 never has parity */
+    CF_AppData.engine.fec_encoders[0].in_use = false;
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    config->chan[txn->chan_num].fec_group_size = 8;
+    txn->state                                 = CF_TxnState_S2;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_NULL(txn->state_data.send.fec);
+    UtAssert_STUB_COUNT(CF_FecEncoder_Init, 1);
+
+    /* relayed, the file is open for writing and its size comes from the inbound transaction */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&rx, 0, sizeof(rx));
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileOpenCheck), OS_SUCCESS);
+    rx.fsize         = 1000;
+    txn->cold->relay = &rx;
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_UINT32_EQ(txn->fsize, 1000);
 }
 
 void Test_CF_CFDP_S_SubstateSendFinAck(void)
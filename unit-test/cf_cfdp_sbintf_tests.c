@@ -22,6 +22,8 @@
 #include "cf_test_alt_handler.h"
 #include "cf_events.h"
 #include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_shmintf.h"
+#include "cf_cfdp_udpintf.h"
 #include "cf_cfdp_pdu.h"
 
 static union
@@ -44,6 +46,47 @@ static union
 **
 *******************************************************************************/
 
+/*
+ * Handler for transport receive batch stubs, fills the whole batch with the test receive buffer
+ */
+static void UT_AltHandler_FullReceiveBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **bufs      = UT_Hook_GetArgValueByName(Context, "bufs", CFE_SB_Buffer_t **);
+    uint32            max_count = UT_Hook_GetArgValueByName(Context, "max_count", uint32);
+    uint32            i;
+
+    for (i = 0; i < max_count; ++i)
+    {
+        bufs[i] = &UT_r_msg.sb_buf;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, max_count);
+}
+
+/*
+ * Handler for CFE_TIME_Subtract, returns the time given as the user object
+ */
+static void UT_AltHandler_CFE_TIME_Subtract(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *elapsed);
+}
+
+/*
+ * Hook for CF_CFDP_SendAck, checks the transaction it is given can be used to encode a PDU header
+ */
+static int32 UT_Hook_SendAck_CheckCold(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    CF_Transaction_t *txn     = UT_Hook_GetArgValueByName(Context, "txn", CF_Transaction_t *);
+    bool *            checked = UserObj;
+
+    *checked = (txn->cold != NULL) && (txn->cold->hdr_template.length == 0);
+
+    return StubRetcode;
+}
+
 static void UT_CFDP_SetupBasicRxState(CF_Logical_PduBuffer_t *pdu_buffer)
 {
     static CF_DecoderState_t ut_decoder;
@@ -79,7 +122,7 @@ static void UT_CFDP_SetupBasicTxState(CF_Logical_PduBuffer_t *pdu_buffer)
     static CF_EncoderState_t ut_encoder;
     static uint8             bytes[CF_CFDP_MAX_HEADER_SIZE];
 
-    CFE_SB_Buffer_t *bufptr;
+    CF_Channel_t *chan;
 
     memset(pdu_buffer, 0, sizeof(*pdu_buffer));
     memset(bytes, 0, sizeof(bytes));
@@ -91,9 +134,10 @@ static void UT_CFDP_SetupBasicTxState(CF_Logical_PduBuffer_t *pdu_buffer)
 
     pdu_buffer->penc = &ut_encoder;
 
-    /* setup for a potential call to CFE_SB_AllocateMessageBuffer() */
-    bufptr = &UT_s_msg.sb_buf;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &bufptr, sizeof(bufptr), true);
+    /* setup for a potential call to CF_CFDP_MsgOutGet(), which takes from the channel pool */
+    chan                 = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    chan->out_pool[0]    = &UT_s_msg.sb_buf;
+    chan->out_pool_count = 1;
 }
 
 static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffer_t **pdu_buffer_p,
@@ -104,9 +148,10 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
      * fake objects used to pass into CF app during unit tests.
      * These are declared static so they can be returned
      */
-    static CF_History_t     ut_history;
-    static CF_Transaction_t ut_transaction;
-    static CF_ConfigTable_t ut_config_table;
+    static CF_History_t         ut_history;
+    static CF_Transaction_t     ut_transaction;
+    static CF_TransactionCold_t ut_transaction_cold;
+    static CF_ConfigTable_t     ut_config_table;
 
     /*
      * always clear all objects, regardless of what was asked for.
@@ -115,13 +160,18 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
      */
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
+    memset(&ut_transaction_cold, 0, sizeof(ut_transaction_cold));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.cold     = &ut_transaction_cold;
     CF_AppData.config_table = &ut_config_table;
 
+    /* the channel uses the default software bus transport unless a test case changes it */
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_SB);
+
     if (pdu_buffer_p)
     {
         if (setup == UT_CF_Setup_TX)
@@ -219,6 +269,7 @@ void Test_CF_CFDP_ReceiveMessage(void)
     CF_Logical_PduBuffer_t *ph;
     CFE_MSG_Type_t          msg_type = CFE_MSG_Type_Tlm;
     size_t *                msg_size_buf;
+    bool                    cold_ok  = false;
 
     /* no-config - the max per wakeup will be 0, and this is a noop */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
@@ -283,10 +334,13 @@ void Test_CF_CFDP_ReceiveMessage(void)
     ph->pdu_header.source_eid     = config->local_eid;
     ph->fdirective.directive_code = CF_CFDP_FileDirective_FIN;
     chan->cur                     = txn;
+    UT_SetHookFunction(UT_KEY(CF_CFDP_SendAck), UT_Hook_SendAck_CheckCold, &cold_ok);
     UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.spurious, 1);
     UtAssert_STUB_COUNT(CF_CFDP_SendAck, 1);
-    UtAssert_NULL(chan->cur); /* cleared */
+    UtAssert_BOOL_TRUE(cold_ok); /* the temporary transaction has a cold part without a header template */
+    UtAssert_NULL(chan->cur);    /* cleared */
+    UT_SetHookFunction(UT_KEY(CF_CFDP_SendAck), NULL, NULL);
 
     /* FIN handling special case, but failure of CF_CFDP_RecvFin */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, &chan, NULL, &txn, &config);
@@ -325,6 +379,38 @@ void Test_CF_CFDP_ReceiveMessage(void)
     ph->pdu_header.destination_eid                                         = config->local_eid;
     UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_RX_DROPPED);
+
+    /* transport that returns full batches, limited by rx_max_messages_per_wakeup */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_RecvPh));
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_RecvPh), -1);
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_SHM_ReceiveBatch), UT_AltHandler_FullReceiveBatch, NULL);
+    chan->transport                                          = CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM);
+    config->chan[UT_CFDP_CHANNEL].rx_max_messages_per_wakeup = CF_PDU_RX_BATCH_SIZE + 1;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_SHM_ReceiveBatch, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, CF_PDU_RX_BATCH_SIZE + 1);
+
+    /* same, but each batch is staged and sorted first */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_RecvPh));
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_RecvPh), -1);
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_SHM_ReceiveBatch), UT_AltHandler_FullReceiveBatch, NULL);
+    chan->transport                                          = CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM);
+    config->chan[UT_CFDP_CHANNEL].rx_max_messages_per_wakeup = CF_PDU_RX_BATCH_SIZE + 1;
+    config->chan[UT_CFDP_CHANNEL].rx_batch_sort              = 1;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_SHM_ReceiveBatch, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, CF_PDU_RX_BATCH_SIZE + 1);
+
+    /* sorted, nothing received */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_RecvPh));
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    config->chan[UT_CFDP_CHANNEL].rx_max_messages_per_wakeup = 1;
+    config->chan[UT_CFDP_CHANNEL].rx_batch_sort              = 1;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, 0);
 }
 
 void Test_CF_CFDP_Send(void)
@@ -340,6 +426,14 @@ void Test_CF_CFDP_Send(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.sent.pdu, 1);
     UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_NULL(CF_AppData.engine.out.msg);
+
+    /* goes to the transport of the channel */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, NULL, NULL);
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_UDP);
+    UtAssert_VOIDCALL(CF_CFDP_Send(UT_CFDP_CHANNEL, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_UDP_Transmit, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
 }
 
 void Test_CF_CFDP_MsgOutGet(void)
@@ -347,9 +441,14 @@ void Test_CF_CFDP_MsgOutGet(void)
     /* Test case for:
         CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool silent)
      */
-    CF_Transaction_t *txn;
-    CF_ConfigTable_t *config;
-    CF_Channel_t *    chan;
+    CF_Transaction_t * txn;
+    CF_ConfigTable_t * config;
+    CF_Channel_t *     chan;
+    CFE_SB_Buffer_t *  bufptr;
+    CFE_TIME_SysTime_t waited;
+
+    memset(&waited, 0, sizeof(waited));
+    waited.Seconds = 1;
 
     /* nominal */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -376,6 +475,42 @@ void Test_CF_CFDP_MsgOutGet(void)
     UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_ERROR_TIMEOUT);
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0); /* polling only, nothing to time */
+
+    /* blocking sem wait configured, and it times out */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    chan->sem_id           = OS_ObjectIdFromInteger(123);
+    chan->sem_wait_left_ms = 5;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_ERROR_TIMEOUT);
+    UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_ZERO(chan->sem_wait_left_ms);
+    UtAssert_ADDRESS_EQ(chan->cur, txn);
+
+    /* already timed out this cycle, so this only polls, which succeeds */
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_ZERO(chan->sem_wait_left_ms);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 2);
+
+    /* blocking sem wait configured and TO frees a slot, the time waited comes out of the budget */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    chan->sem_id           = OS_ObjectIdFromInteger(123);
+    chan->sem_wait_left_ms = 5;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, 3000);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_UINT32_EQ(chan->sem_wait_left_ms, 2);
+
+    /* successful waits that together use up the budget, the rest of the cycle only polls */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, 2500);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_ZERO(chan->sem_wait_left_ms);
+
+    /* a wait measured at a second or more, as after a clock jump, also uses up the budget */
+    chan->sem_wait_left_ms = 5;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract, &waited);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_ZERO(chan->sem_wait_left_ms);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), NULL, NULL);
+    chan->sem_id = OS_OBJECT_ID_UNDEFINED;
 
     /* transaction is suspended */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -399,6 +534,388 @@ void Test_CF_CFDP_MsgOutGet(void)
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, true));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* pool is empty, buffer allocated directly from SB instead */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, NULL);
+    chan->out_pool_count     = 0;
+    chan->out_pool_exhausted = false;
+    bufptr                   = &UT_s_msg.sb_buf;
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &bufptr, sizeof(bufptr), true);
+    UT_ResetState(UT_KEY(CFE_MSG_Init));
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.out_pool_empty = 0;
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.out_pool_empty, 1);
+    UtAssert_BOOL_TRUE(chan->out_pool_exhausted);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_OUT_POOL_EMPTY);
+
+    /* pool still empty, the event is not repeated but the counter is */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &bufptr, sizeof(bufptr), true);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.out_pool_empty, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_CF_CFDP_MsgOutPoolFill(void)
+{
+    /* Test case for:
+     * void CF_CFDP_MsgOutPoolFill(CF_Channel_t *chan)
+     */
+    CF_Channel_t *   chan;
+    CFE_SB_Buffer_t *bufptr;
+
+    /* SB has no buffers to give, pool stays empty */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_MsgOutPoolFill(chan));
+    UtAssert_UINT32_EQ(chan->out_pool_count, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+
+    /* SB gives one buffer, which fills the last slot and re-arms the empty event */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->out_pool_count     = CF_OUTGOING_BUF_POOL_DEPTH - 1;
+    chan->out_pool_exhausted = true;
+    bufptr                   = &UT_s_msg.sb_buf;
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &bufptr, sizeof(bufptr), true);
+    UtAssert_VOIDCALL(CF_CFDP_MsgOutPoolFill(chan));
+    UtAssert_UINT32_EQ(chan->out_pool_count, CF_OUTGOING_BUF_POOL_DEPTH);
+    UtAssert_ADDRESS_EQ(chan->out_pool[CF_OUTGOING_BUF_POOL_DEPTH - 1], &UT_s_msg.sb_buf);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_BOOL_FALSE(chan->out_pool_exhausted);
+
+    /* already full, nothing to do */
+    UT_ResetState(UT_KEY(CFE_SB_AllocateMessageBuffer));
+    UtAssert_VOIDCALL(CF_CFDP_MsgOutPoolFill(chan));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+    UtAssert_UINT32_EQ(chan->out_pool_count, CF_OUTGOING_BUF_POOL_DEPTH);
+}
+
+void Test_CF_CFDP_MsgOutPoolDrain(void)
+{
+    /* Test case for:
+     * void CF_CFDP_MsgOutPoolDrain(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    /* empty pool, noop */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_MsgOutPoolDrain(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+
+    /* all pooled buffers are released */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->out_pool_exhausted = true;
+    UtAssert_VOIDCALL(CF_CFDP_MsgOutPoolDrain(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_UINT32_EQ(chan->out_pool_count, 0);
+    UtAssert_NULL(chan->out_pool[0]);
+    UtAssert_BOOL_FALSE(chan->out_pool_exhausted);
+}
+
+void Test_CF_CFDP_GetTransport(void)
+{
+    /* Test case for:
+     * const CF_CFDP_Transport_t *CF_CFDP_GetTransport(uint8 type)
+     */
+    const CF_CFDP_Transport_t *transport;
+
+    /* software bus */
+    UtAssert_NOT_NULL(transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_SB));
+    UtAssert_ADDRESS_EQ(transport->GetBuffer, CF_CFDP_SB_GetBuffer);
+
+    /* shared memory */
+    UtAssert_NOT_NULL(transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM));
+    UtAssert_ADDRESS_EQ(transport->GetBuffer, CF_CFDP_SHM_GetBuffer);
+
+    /* UDP */
+    UtAssert_NOT_NULL(transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_UDP));
+    UtAssert_ADDRESS_EQ(transport->GetBuffer, CF_CFDP_UDP_GetBuffer);
+
+    /* unknown */
+    UtAssert_NULL(CF_CFDP_GetTransport(CF_CFDP_TransportType_NUM));
+}
+
+void Test_CF_CFDP_TransportOpen(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_TransportOpen(CF_Channel_t *chan)
+     */
+    CF_Channel_t *    chan;
+    CF_ConfigTable_t *config;
+
+    /* software bus, which has no open but fills its pool */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, &config);
+    chan->transport                         = NULL;
+    config->chan[UT_CFDP_CHANNEL].transport = CF_CFDP_TransportType_SB;
+    UtAssert_INT32_EQ(CF_CFDP_TransportOpen(chan), CFE_SUCCESS);
+    UtAssert_ADDRESS_EQ(chan->transport, CF_CFDP_GetTransport(CF_CFDP_TransportType_SB));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+
+    /* shared memory */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, &config);
+    chan->transport                         = NULL;
+    config->chan[UT_CFDP_CHANNEL].transport = CF_CFDP_TransportType_SHM;
+    UtAssert_INT32_EQ(CF_CFDP_TransportOpen(chan), CFE_SUCCESS);
+    UtAssert_ADDRESS_EQ(chan->transport, CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM));
+    UtAssert_STUB_COUNT(CF_CFDP_SHM_Open, 1);
+
+    /* UDP fails to open */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, &config);
+    chan->transport                         = NULL;
+    config->chan[UT_CFDP_CHANNEL].transport = CF_CFDP_TransportType_UDP;
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_UDP_Open), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_TransportOpen(chan), OS_ERROR);
+    UtAssert_NULL(chan->transport);
+
+    /* unknown transport */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, &config);
+    chan->transport                         = NULL;
+    config->chan[UT_CFDP_CHANNEL].transport = CF_CFDP_TransportType_NUM;
+    UtAssert_INT32_EQ(CF_CFDP_TransportOpen(chan), CF_ERROR);
+    UtAssert_NULL(chan->transport);
+}
+
+void Test_CF_CFDP_TransportClose(void)
+{
+    /* Test case for:
+     * void CF_CFDP_TransportClose(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    /* never opened, noop */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->transport = NULL;
+    UtAssert_VOIDCALL(CF_CFDP_TransportClose(chan));
+
+    /* shared memory has nothing to close */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM);
+    UtAssert_VOIDCALL(CF_CFDP_TransportClose(chan));
+    UtAssert_NULL(chan->transport);
+
+    /* UDP */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_UDP);
+    UtAssert_VOIDCALL(CF_CFDP_TransportClose(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_UDP_Close, 1);
+    UtAssert_NULL(chan->transport);
+}
+
+void Test_CF_CFDP_TransportCycle(void)
+{
+    /* Test case for:
+     * void CF_CFDP_TransportCycle(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    /* never opened, noop */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->transport = NULL;
+    UtAssert_VOIDCALL(CF_CFDP_TransportCycle(chan));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+
+    /* shared memory has nothing to do */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->transport = CF_CFDP_GetTransport(CF_CFDP_TransportType_SHM);
+    UtAssert_VOIDCALL(CF_CFDP_TransportCycle(chan));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+
+    /* software bus tops up the pool */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_TransportCycle(chan));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+}
+
+void Test_CF_CFDP_SB_Transport(void)
+{
+    /* Test case for:
+     * void CF_CFDP_SB_ReleaseBuffer(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+     * void CF_CFDP_SB_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+     * uint32 CF_CFDP_SB_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+     */
+    CF_Channel_t *   chan;
+    CFE_SB_Buffer_t *bufs[2];
+
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_SB_ReleaseBuffer(chan, &UT_s_msg.sb_buf));
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_VOIDCALL(CF_CFDP_SB_Transmit(chan, &UT_s_msg.sb_buf));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+
+    /* SB only hands over one buffer at a time */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_UINT32_EQ(CF_CFDP_SB_ReceiveBatch(chan, bufs, 2), 1);
+    UtAssert_ADDRESS_EQ(bufs[0], &UT_r_msg.sb_buf);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+
+    /* nothing received */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(CF_CFDP_SB_ReceiveBatch(chan, bufs, 2), 0);
+
+    /* no room to receive into */
+    UtAssert_UINT32_EQ(CF_CFDP_SB_ReceiveBatch(chan, bufs, 0), 0);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+}
+
+void Test_CF_CFDP_ReceiveDecodeStart(void)
+{
+    /* Test case for:
+     * void CF_CFDP_ReceiveDecodeStart(const CFE_SB_Buffer_t *bufptr, CF_Logical_PduBuffer_t *ph)
+     */
+    CF_Logical_PduBuffer_t *ph;
+    CFE_MSG_Type_t          msg_type = CFE_MSG_Type_Tlm;
+
+    /* command encapsulation */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveDecodeStart(&UT_r_msg.sb_buf, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeStart, 1);
+
+    /* telemetry encapsulation, and a message too short to hold anything */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &msg_type, sizeof(msg_type), false);
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveDecodeStart(&UT_r_msg.sb_buf, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeStart, 2);
+}
+
+void Test_CF_CFDP_ReceiveSortedBatch(void)
+{
+    /* Test case for:
+     * uint32 CF_CFDP_ReceiveSortedBatch(CF_Channel_t *chan, uint32 max_count)
+     */
+    CF_Channel_t *chan;
+
+    /* software bus hands over one message per call, all are staged before any is processed */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_RecvPh), -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(CF_CFDP_ReceiveSortedBatch(chan, CF_PDU_RX_BATCH_SIZE), 2);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeHeader, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, 2);
+
+    /* stops at max_count */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, NULL);
+    UT_ResetState(UT_KEY(CF_CFDP_RecvPh));
+    UT_ResetState(UT_KEY(CFE_SB_ReceiveBuffer));
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_RecvPh), -1);
+    UtAssert_UINT32_EQ(CF_CFDP_ReceiveSortedBatch(chan, 1), 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, 1);
+
+    /* nothing received */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, NULL, NULL);
+    UT_ResetState(UT_KEY(CF_CFDP_RecvPh));
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(CF_CFDP_ReceiveSortedBatch(chan, CF_PDU_RX_BATCH_SIZE), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, 0);
+}
+
+void Test_CF_CFDP_RxBatchStage(void)
+{
+    /* Test case for:
+     * void CF_CFDP_RxBatchStage(CF_CFDP_RxBatchEntry_t *entry, const CFE_SB_Buffer_t *bufptr, CF_EncapBuffer_t *copy)
+     */
+    CF_Logical_PduBuffer_t *ph;
+    CF_CFDP_RxBatchEntry_t  entry;
+    CF_EncapBuffer_t        copy;
+    CF_EncapBuffer_t        big_msg;
+    CFE_MSG_Size_t          msg_size;
+
+    /* directive */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    UT_r_msg.bytes[0]           = 0xAB;
+    ph->pdu_header.source_eid   = 7;
+    ph->pdu_header.sequence_num = 9;
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchStage(&entry, &UT_r_msg.sb_buf, &copy));
+    UtAssert_ADDRESS_EQ(entry.bufptr, &copy.buf);
+    UtAssert_UINT8_EQ(copy.bytes[0], 0xAB);
+    UtAssert_BOOL_TRUE(entry.is_valid);
+    UtAssert_BOOL_FALSE(entry.is_fd);
+    UtAssert_UINT32_EQ(entry.source_eid, 7);
+    UtAssert_UINT32_EQ(entry.seq_num, 9);
+    UtAssert_UINT32_EQ(entry.offset, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeFileDataHeader, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+
+    /* file data */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    ph->pdu_header.pdu_type  = 1;
+    ph->int_header.fd.offset = 100;
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchStage(&entry, &UT_r_msg.sb_buf, &copy));
+    UtAssert_BOOL_TRUE(entry.is_valid);
+    UtAssert_BOOL_TRUE(entry.is_fd);
+    UtAssert_UINT32_EQ(entry.offset, 100);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeFileDataHeader, 1);
+
+    /* header does not decode */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodeHeader), 1, CF_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchStage(&entry, &UT_r_msg.sb_buf, &copy));
+    UtAssert_BOOL_FALSE(entry.is_valid);
+
+    /* PDU too short */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    ph->pdec->codec_state.is_valid = false;
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchStage(&entry, &UT_r_msg.sb_buf, &copy));
+    UtAssert_BOOL_FALSE(entry.is_valid);
+
+    /* message longer than the copy buffer is truncated */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, NULL);
+    msg_size = sizeof(big_msg) + 1;
+    memset(&big_msg, 0, sizeof(big_msg));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodeHeader), 1, CF_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchStage(&entry, &big_msg.buf, &copy));
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_BOOL_FALSE(entry.is_valid);
+}
+
+void Test_CF_CFDP_RxBatchSort(void)
+{
+    /* Test case for:
+     * void CF_CFDP_RxBatchSort(CF_CFDP_RxBatchEntry_t *entries, uint32 count)
+     */
+    CF_CFDP_RxBatchEntry_t entries[7];
+    CFE_SB_Buffer_t        bufs[7];
+    uint32                 i;
+
+    memset(entries, 0, sizeof(entries));
+    for (i = 0; i < 7; ++i)
+    {
+        entries[i].bufptr     = &bufs[i];
+        entries[i].is_valid   = true;
+        entries[i].is_fd      = true;
+        entries[i].source_eid = 1;
+        entries[i].seq_num    = 10; /* transaction A, unless changed below */
+    }
+
+    entries[0].offset   = 200;
+    entries[1].seq_num  = 20; /* transaction B */
+    entries[1].offset   = 50;
+    entries[2].offset   = 100;
+    entries[3].is_fd    = false; /* EOF of transaction A */
+    entries[4].offset   = 0;
+    entries[5].is_valid = false;
+    entries[6].seq_num  = 20;
+    entries[6].offset   = 10;
+
+    /* empty batch is fine */
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchSort(entries, 0));
+    UtAssert_ADDRESS_EQ(entries[0].bufptr, &bufs[0]);
+
+    /*
+     * Transaction A comes first as it was seen first.  The data before the EOF is
+     * sorted, the data after it stays after it.  Transaction B follows, sorted, and
+     * the undecodable message stays in a group of its own.
+     */
+    UtAssert_VOIDCALL(CF_CFDP_RxBatchSort(entries, 7));
+    UtAssert_ADDRESS_EQ(entries[0].bufptr, &bufs[2]);
+    UtAssert_ADDRESS_EQ(entries[1].bufptr, &bufs[0]);
+    UtAssert_ADDRESS_EQ(entries[2].bufptr, &bufs[3]);
+    UtAssert_ADDRESS_EQ(entries[3].bufptr, &bufs[4]);
+    UtAssert_ADDRESS_EQ(entries[4].bufptr, &bufs[6]);
+    UtAssert_ADDRESS_EQ(entries[5].bufptr, &bufs[1]);
+    UtAssert_ADDRESS_EQ(entries[6].bufptr, &bufs[5]);
 }
 
 /*******************************************************************************
@@ -410,7 +927,21 @@ void Test_CF_CFDP_MsgOutGet(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(Test_CF_CFDP_ReceiveMessage, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ReceiveMessage");
+    UtTest_Add(Test_CF_CFDP_ReceiveDecodeStart, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_ReceiveDecodeStart");
+    UtTest_Add(Test_CF_CFDP_ReceiveSortedBatch, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_ReceiveSortedBatch");
+    UtTest_Add(Test_CF_CFDP_RxBatchStage, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RxBatchStage");
+    UtTest_Add(Test_CF_CFDP_RxBatchSort, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RxBatchSort");
 
     UtTest_Add(Test_CF_CFDP_MsgOutGet, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_MsgOutGet");
+    UtTest_Add(Test_CF_CFDP_MsgOutPoolFill, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_MsgOutPoolFill");
+    UtTest_Add(Test_CF_CFDP_MsgOutPoolDrain, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_MsgOutPoolDrain");
     UtTest_Add(Test_CF_CFDP_Send, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_Send");
+
+    UtTest_Add(Test_CF_CFDP_GetTransport, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_GetTransport");
+    UtTest_Add(Test_CF_CFDP_TransportOpen, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TransportOpen");
+    UtTest_Add(Test_CF_CFDP_TransportClose, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TransportClose");
+    UtTest_Add(Test_CF_CFDP_TransportCycle, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TransportCycle");
+    UtTest_Add(Test_CF_CFDP_SB_Transport, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SB_Transport");
 }
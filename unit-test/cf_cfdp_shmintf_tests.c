@@ -0,0 +1,267 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_shmintf.h"
+
+/*******************************************************************************
+**
+**  cf_cfdp_shmintf_tests local utility functions
+**
+*******************************************************************************/
+
+static void UT_CFDP_SHM_SetupBasicTestState(CF_Channel_t **chan_p, CF_ConfigTable_t **config_table_p)
+{
+    static CF_ConfigTable_t ut_config_table;
+
+    memset(&ut_config_table, 0, sizeof(ut_config_table));
+    CF_AppData.config_table = &ut_config_table;
+
+    if (chan_p)
+    {
+        /* must be a member of the channel array, the channel number is found by pointer arithmetic */
+        *chan_p = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    }
+    if (config_table_p)
+    {
+        *config_table_p = &ut_config_table;
+    }
+}
+
+/*******************************************************************************
+**
+**  cf_cfdp_shmintf_tests Setup and Teardown
+**
+*******************************************************************************/
+
+void cf_cfdp_shmintf_tests_Setup(void)
+{
+    cf_tests_Setup();
+
+    /*
+     * Also clear the app global. No test case should depend on data
+     * previously left in here.
+     */
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+}
+
+void cf_cfdp_shmintf_tests_Teardown(void)
+{
+    cf_tests_Teardown();
+}
+
+/*******************************************************************************
+**
+**  Test cases
+**
+*******************************************************************************/
+
+void Test_CF_CFDP_ShmGetRing(void)
+{
+    /* Test case for:
+     * CF_ShmRing_t *CF_CFDP_ShmGetRing(uint8 chan_num, CF_Direction_t dir)
+     */
+
+    /* nominal */
+    UtAssert_ADDRESS_EQ(CF_CFDP_ShmGetRing(UT_CFDP_CHANNEL, CF_Direction_TX),
+                        &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX]);
+    UtAssert_ADDRESS_EQ(CF_CFDP_ShmGetRing(UT_CFDP_CHANNEL, CF_Direction_RX),
+                        &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX]);
+
+    /* out of range */
+    UtAssert_NULL(CF_CFDP_ShmGetRing(CF_NUM_CHANNELS, CF_Direction_TX));
+    UtAssert_NULL(CF_CFDP_ShmGetRing(UT_CFDP_CHANNEL, CF_Direction_NUM));
+}
+
+void Test_CF_CFDP_ShmRing(void)
+{
+    /* Test case for:
+     * CFE_SB_Buffer_t *CF_CFDP_ShmRingReserve(CF_ShmRing_t *ring)
+     * void CF_CFDP_ShmRingCommit(CF_ShmRing_t *ring)
+     * uint32 CF_CFDP_ShmRingPeek(CF_ShmRing_t *ring, CFE_SB_Buffer_t **bufs, uint32 max_count)
+     * void CF_CFDP_ShmRingRelease(CF_ShmRing_t *ring, uint32 count)
+     */
+    CF_ShmRing_t *   ring = &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX];
+    CFE_SB_Buffer_t *bufs[CF_SHM_RING_DEPTH];
+    CFE_SB_Buffer_t *bufptr;
+    uint32           i;
+
+    /* empty ring has nothing to peek */
+    UtAssert_UINT32_EQ(CF_CFDP_ShmRingPeek(ring, bufs, CF_SHM_RING_DEPTH), 0);
+
+    /* reserve without commit keeps returning the same slot */
+    UtAssert_ADDRESS_EQ(CF_CFDP_ShmRingReserve(ring), &ring->slots[0].buf);
+    UtAssert_ADDRESS_EQ(CF_CFDP_ShmRingReserve(ring), &ring->slots[0].buf);
+    UtAssert_UINT32_EQ(CF_CFDP_ShmRingPeek(ring, bufs, CF_SHM_RING_DEPTH), 0);
+
+    /* fill the ring completely */
+    for (i = 0; i < CF_SHM_RING_DEPTH; ++i)
+    {
+        UtAssert_ADDRESS_EQ(CF_CFDP_ShmRingReserve(ring), &ring->slots[i].buf);
+        UtAssert_VOIDCALL(CF_CFDP_ShmRingCommit(ring));
+    }
+
+    UtAssert_NULL(CF_CFDP_ShmRingReserve(ring));
+
+    /* peek is limited by max_count, and does not release anything */
+    UtAssert_UINT32_EQ(CF_CFDP_ShmRingPeek(ring, bufs, 2), 2);
+    UtAssert_ADDRESS_EQ(bufs[0], &ring->slots[0].buf);
+    UtAssert_ADDRESS_EQ(bufs[1], &ring->slots[1].buf);
+    UtAssert_NULL(CF_CFDP_ShmRingReserve(ring));
+
+    /* releasing frees the oldest slots for the producer, which then wraps around */
+    UtAssert_VOIDCALL(CF_CFDP_ShmRingRelease(ring, 2));
+    UtAssert_ADDRESS_EQ(CF_CFDP_ShmRingReserve(ring), &ring->slots[0].buf);
+    UtAssert_VOIDCALL(CF_CFDP_ShmRingCommit(ring));
+
+    UtAssert_UINT32_EQ(CF_CFDP_ShmRingPeek(ring, bufs, CF_SHM_RING_DEPTH), CF_SHM_RING_DEPTH - 1);
+    UtAssert_ADDRESS_EQ(bufs[0], &ring->slots[2].buf);
+    UtAssert_ADDRESS_EQ(bufs[CF_SHM_RING_DEPTH - 2], &ring->slots[0].buf);
+
+    /* indices keep working across the 32-bit wrap */
+    ring->head = 0xFFFFFFFF;
+    ring->tail = 0xFFFFFFFF;
+    bufptr     = CF_CFDP_ShmRingReserve(ring);
+    UtAssert_ADDRESS_EQ(bufptr, &ring->slots[CF_SHM_RING_DEPTH - 1].buf);
+    UtAssert_VOIDCALL(CF_CFDP_ShmRingCommit(ring));
+    UtAssert_UINT32_EQ(ring->head, 0);
+    UtAssert_UINT32_EQ(CF_CFDP_ShmRingPeek(ring, bufs, CF_SHM_RING_DEPTH), 1);
+    UtAssert_ADDRESS_EQ(bufs[0], bufptr);
+    UtAssert_VOIDCALL(CF_CFDP_ShmRingRelease(ring, 1));
+    UtAssert_UINT32_EQ(ring->tail, 0);
+}
+
+void Test_CF_CFDP_SHM_Open(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_SHM_Open(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    UT_CFDP_SHM_SetupBasicTestState(&chan, NULL);
+    CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX].head = 3;
+    CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX].tail = 2;
+    CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX].head = 5;
+    CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX].tail = 4;
+    chan->shm_rx_held                                                  = 1;
+
+    UtAssert_INT32_EQ(CF_CFDP_SHM_Open(chan), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX].head, 0);
+    UtAssert_UINT32_EQ(CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX].tail, 0);
+    UtAssert_UINT32_EQ(CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX].head, 0);
+    UtAssert_UINT32_EQ(CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX].tail, 0);
+    UtAssert_UINT32_EQ(chan->shm_rx_held, 0);
+}
+
+void Test_CF_CFDP_SHM_GetBuffer(void)
+{
+    /* Test case for:
+     * CFE_SB_Buffer_t *CF_CFDP_SHM_GetBuffer(CF_Channel_t *chan, bool silent)
+     */
+    CF_Channel_t *chan;
+    CF_ShmRing_t *ring = &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX];
+
+    /* nominal, the next TX slot with an initialized header */
+    UT_CFDP_SHM_SetupBasicTestState(&chan, NULL);
+    UtAssert_ADDRESS_EQ(CF_CFDP_SHM_GetBuffer(chan, false), &ring->slots[0].buf);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_UINT32_EQ(ring->head, 0); /* not published yet */
+
+    /* ring is full */
+    ring->head = CF_SHM_RING_DEPTH;
+    UtAssert_NULL(CF_CFDP_SHM_GetBuffer(chan, false));
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+}
+
+void Test_CF_CFDP_SHM_Transmit(void)
+{
+    /* Test case for:
+     * void CF_CFDP_SHM_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+     */
+    CF_Channel_t *   chan;
+    CF_ShmRing_t *   ring = &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_TX];
+    CFE_SB_Buffer_t *bufptr;
+
+    UT_CFDP_SHM_SetupBasicTestState(&chan, NULL);
+    UtAssert_NOT_NULL(bufptr = CF_CFDP_SHM_GetBuffer(chan, false));
+    UtAssert_VOIDCALL(CF_CFDP_SHM_Transmit(chan, bufptr));
+    UtAssert_UINT32_EQ(ring->head, 1);
+    UtAssert_UINT32_EQ(ring->tail, 0);
+}
+
+void Test_CF_CFDP_SHM_ReceiveBatch(void)
+{
+    /* Test case for:
+     * uint32 CF_CFDP_SHM_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+     */
+    CF_Channel_t *   chan;
+    CF_ShmRing_t *   ring = &CF_AppData.engine.shm_rings[UT_CFDP_CHANNEL][CF_Direction_RX];
+    CFE_SB_Buffer_t *bufs[2];
+    CFE_MSG_Size_t   msg_size;
+
+    /* nothing received */
+    UT_CFDP_SHM_SetupBasicTestState(&chan, NULL);
+    UtAssert_UINT32_EQ(CF_CFDP_SHM_ReceiveBatch(chan, bufs, 2), 0);
+    UtAssert_UINT32_EQ(chan->shm_rx_held, 0);
+
+    /* link published 3 messages, the first batch is limited by max_count and held */
+    ring->head = 3;
+    UtAssert_UINT32_EQ(CF_CFDP_SHM_ReceiveBatch(chan, bufs, 2), 2);
+    UtAssert_ADDRESS_EQ(bufs[0], &ring->slots[0].buf);
+    UtAssert_ADDRESS_EQ(bufs[1], &ring->slots[1].buf);
+    UtAssert_UINT32_EQ(ring->tail, 0);
+    UtAssert_UINT32_EQ(chan->shm_rx_held, 2);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+
+    /* the next batch releases the previous one, and a size larger than the slot is clamped */
+    msg_size = sizeof(CF_EncapBuffer_t) + 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UtAssert_UINT32_EQ(CF_CFDP_SHM_ReceiveBatch(chan, bufs, 2), 1);
+    UtAssert_ADDRESS_EQ(bufs[0], &ring->slots[2].buf);
+    UtAssert_UINT32_EQ(ring->tail, 2);
+    UtAssert_UINT32_EQ(chan->shm_rx_held, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+
+    /* and then nothing more */
+    UtAssert_UINT32_EQ(CF_CFDP_SHM_ReceiveBatch(chan, bufs, 2), 0);
+    UtAssert_UINT32_EQ(ring->tail, 3);
+    UtAssert_UINT32_EQ(chan->shm_rx_held, 0);
+}
+
+/*******************************************************************************
+**
+**  cf_cfdp_shmintf_tests UtTest_Setup
+**
+*******************************************************************************/
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CF_CFDP_ShmGetRing, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown,
+               "CF_CFDP_ShmGetRing");
+    UtTest_Add(Test_CF_CFDP_ShmRing, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown, "CF_CFDP_ShmRing");
+    UtTest_Add(Test_CF_CFDP_SHM_Open, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown, "CF_CFDP_SHM_Open");
+    UtTest_Add(Test_CF_CFDP_SHM_GetBuffer, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown,
+               "CF_CFDP_SHM_GetBuffer");
+    UtTest_Add(Test_CF_CFDP_SHM_Transmit, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown,
+               "CF_CFDP_SHM_Transmit");
+    UtTest_Add(Test_CF_CFDP_SHM_ReceiveBatch, cf_cfdp_shmintf_tests_Setup, cf_cfdp_shmintf_tests_Teardown,
+               "CF_CFDP_SHM_ReceiveBatch");
+}
@@ -22,10 +22,12 @@
 #include "cf_test_alt_handler.h"
 #include "cf_events.h"
 #include "cf_cfdp.h"
+#include "cf_cfdp_r.h"
 #include "cf_cfdp_s.h"
 #include "cf_cfdp_pdu.h"
 #include "cf_cfdp_sbintf.h"
 #include "cf_cfdp_dispatch.h"
+#include "cf_history.h"
 
 /*******************************************************************************
 **
@@ -74,6 +76,7 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     static CF_Logical_PduBuffer_t ut_pdu_buffer;
     static CF_History_t           ut_history;
     static CF_Transaction_t       ut_transaction;
+    static CF_TransactionCold_t   ut_transaction_cold;
     static CF_ConfigTable_t       ut_config_table;
 
     /*
@@ -84,11 +87,13 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     memset(&ut_pdu_buffer, 0, sizeof(ut_pdu_buffer));
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
+    memset(&ut_transaction_cold, 0, sizeof(ut_transaction_cold));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.cold     = &ut_transaction_cold;
     CF_AppData.config_table = &ut_config_table;
 
     if (pdu_buffer_p)
@@ -272,17 +277,40 @@ void Test_CF_CFDP_RecvPh(void)
     UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_SHORT_PDU_ERROR);
     UT_CF_AssertEventID(CF_EID_ERR_PDU_SHORT_HEADER);
 
-    /* decode error, large file bit set */
+    /* nominal, large file bit set */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
     ph->pdu_header.large_flag = true;
+    UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), 0);
+
+    /* nominal, with PDU CRC */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    ph->pdu_header.crc_flag = 1;
+    UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodePduCrc, 1);
+
+    /* decode error, PDU CRC does not match */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    ph->pdu_header.crc_flag = 1;
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodePduCrc), 1, CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_ERROR);
-    UT_CF_AssertEventID(CF_EID_ERR_PDU_LARGE_FILE);
+    UT_CF_AssertEventID(CF_EID_ERR_PDU_CRC);
 
     /* decode error, insufficient storage for EID or seq num */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodeHeader), 1, CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_ERROR);
     UT_CF_AssertEventID(CF_EID_ERR_PDU_TRUNCATION);
+    UtAssert_BOOL_FALSE(ph->fd_decoded);
+
+    /* nominal, file data decoded by the fast path */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    UT_ResetState(UT_KEY(CF_CFDP_DecodeHeader));
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu = 0;
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodeFileDataFast), 1, true);
+    UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeHeader, 0);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu, 1);
+    UtAssert_BOOL_TRUE(ph->fd_decoded);
 }
 
 void Test_CF_CFDP_RecvMd(void)
@@ -311,6 +339,22 @@ void Test_CF_CFDP_RecvMd(void)
                           sizeof(history->fnames.dst_filename));
     UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
                           sizeof(history->fnames.src_filename));
+    UtAssert_STUB_COUNT(CF_CRC_StartType, 1);
+    UtAssert_STUB_COUNT(CF_FecDecoder_Init, 1);
+    UT_CF_AssertEventID(CF_EID_INF_PDU_MD_RECVD);
+
+    /* unsupported checksum type is not a decode error, but sets the transaction status */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, &history, &txn, NULL);
+    md                           = &ph->int_header.md;
+    md->checksum_type            = 1;
+    md->dest_filename.length     = sizeof(dest) - 1;
+    md->dest_filename.data_ptr   = dest;
+    md->source_filename.length   = sizeof(src) - 1;
+    md->source_filename.data_ptr = src;
+    UT_SetDeferredRetcode(UT_KEY(CF_CRC_StartType), 1, CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CF_CFDP_RecvMd(txn, ph), 0);
+    UtAssert_INT32_EQ(history->txn_stat, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+    UT_CF_AssertEventID(CF_EID_ERR_PDU_MD_CHECKSUM_TYPE);
 
     /* decode errors: fixed part */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -345,10 +389,10 @@ void Test_CF_CFDP_RecvFd(void)
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     UtAssert_INT32_EQ(CF_CFDP_RecvFd(txn, ph), 0);
 
-    /* nominal call, with CRC */
+    /* nominal call, with CRC - already stripped when the header was received */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     ph->pdu_header.crc_flag    = 1;
-    ph->int_header.fd.data_len = 10 + sizeof(CF_CFDP_uint32_t);
+    ph->int_header.fd.data_len = 10;
     UtAssert_INT32_EQ(CF_CFDP_RecvFd(txn, ph), 0);
     UtAssert_UINT32_EQ(ph->int_header.fd.data_len, 10);
 
@@ -359,19 +403,19 @@ void Test_CF_CFDP_RecvFd(void)
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_PROTOCOL_ERROR);
     UT_CF_AssertEventID(CF_EID_ERR_PDU_FD_SHORT);
 
-    /* decode errors: CRC part */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
-    ph->pdu_header.crc_flag    = 1;
-    ph->int_header.fd.data_len = sizeof(CF_CFDP_uint32_t) - 1;
-    UtAssert_INT32_EQ(CF_CFDP_RecvFd(txn, ph), CF_SHORT_PDU_ERROR);
-    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(ph->pdec));
-
     /* with segment metadata (unimplemented) */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     ph->pdu_header.segment_meta_flag = 1;
     UtAssert_INT32_EQ(CF_CFDP_RecvFd(txn, ph), CF_ERROR);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_PROTOCOL_ERROR);
     UT_CF_AssertEventID(CF_EID_ERR_PDU_FD_UNSUPPORTED);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeFileDataHeader, 4);
+
+    /* file data header already decoded by the fast path of CF_CFDP_RecvPh() */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    ph->fd_decoded = true;
+    UtAssert_INT32_EQ(CF_CFDP_RecvFd(txn, ph), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeFileDataHeader, 4);
 }
 
 void Test_CF_CFDP_RecvEof(void)
@@ -394,6 +438,27 @@ void Test_CF_CFDP_RecvEof(void)
     UT_CF_AssertEventID(CF_EID_ERR_PDU_EOF_SHORT);
 }
 
+void Test_CF_CFDP_RecvParity(void)
+{
+    /* Test case for:
+     * int CF_CFDP_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+     */
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+
+    /* nominal call */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_RecvParity(txn, ph), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeParity, 1);
+
+    /* decode errors: fixed part */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    CF_CODEC_SET_DONE(ph->pdec);
+    UtAssert_INT32_EQ(CF_CFDP_RecvParity(txn, ph), CF_SHORT_PDU_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_PDU_PARITY_SHORT);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error, 1);
+}
+
 void Test_CF_CFDP_RecvAck(void)
 {
     /* Test case for:
@@ -488,6 +553,7 @@ void Test_CF_CFDP_RecvIdle(void)
     ph->pdu_header.txm_mode = 1; /* class 1 */
     UtAssert_VOIDCALL(CF_CFDP_RecvIdle(txn, ph));
     UtAssert_INT32_EQ(txn->state, CF_TxnState_DROP);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
 
     /* nominal call, file data, class 2 */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, &history, &txn, NULL);
@@ -567,6 +633,7 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
     UtAssert_UINT32_EQ(hdr->pdu_type, 0);
     UtAssert_UINT32_EQ(hdr->direction, 1);
     UtAssert_UINT32_EQ(hdr->txm_mode, 1);
+    UtAssert_UINT32_EQ(hdr->crc_flag, 0);
     UtAssert_UINT32_EQ(hdr->eid_length, 1);
     UtAssert_UINT32_EQ(hdr->txn_seq_length, 1);
     UtAssert_UINT32_EQ(hdr->source_eid, 3);
@@ -588,6 +655,61 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
     UtAssert_UINT32_EQ(hdr->source_eid, 7);
     UtAssert_UINT32_EQ(hdr->destination_eid, 6);
     UtAssert_UINT32_EQ(hdr->sequence_num, 44);
+
+    /* PDU CRC enabled on the channel */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->chan_num                                          = UT_CFDP_CHANNEL;
+    CF_AppData.config_table->chan[UT_CFDP_CHANNEL].pdu_crc = 1;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    UtAssert_UINT32_EQ(ph->pdu_header.crc_flag, 1);
+    UtAssert_UINT32_EQ(ph->pdu_header.large_flag, 0);
+
+    /* file of 4 GiB or more uses the large file PDU format */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->fsize = 0x100000000;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    UtAssert_UINT32_EQ(ph->pdu_header.large_flag, 1);
+
+    /* just under 4 GiB still fits the 32-bit fields */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->fsize = 0xFFFFFFFF;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    UtAssert_UINT32_EQ(ph->pdu_header.large_flag, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 0);
+
+    /* header template of the transaction matches, nothing is encoded again */
+    UT_ResetState(UT_KEY(CF_CFDP_GetValueEncodedSize));
+    UT_ResetState(UT_KEY(CF_CFDP_EncodeHeaderWithoutSize));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->cold->hdr_template.source_eid      = 3;
+    txn->cold->hdr_template.destination_eid = 2;
+    txn->cold->hdr_template.sequence_num    = 42;
+    txn->cold->hdr_template.eid_length      = 2;
+    txn->cold->hdr_template.txn_seq_length  = 4;
+    txn->cold->hdr_template.length          = 10;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    hdr = &ph->pdu_header;
+    UtAssert_UINT32_EQ(hdr->eid_length, 2);
+    UtAssert_UINT32_EQ(hdr->txn_seq_length, 4);
+    UtAssert_UINT32_EQ(hdr->source_eid, 3);
+    UtAssert_UINT32_EQ(hdr->destination_eid, 2);
+    UtAssert_UINT32_EQ(hdr->sequence_num, 42);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderWithoutSize, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_GetValueEncodedSize, 0);
+
+    /* header template does not match, each field checked in turn */
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 43, false));
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 5, false, 42, false));
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 5, 2, false, 42, false));
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderWithoutSize, 3);
+
+    /* header template not set */
+    txn->cold->hdr_template.length = 0;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderWithoutSize, 4);
 }
 
 void Test_CF_CFDP_SendMd(void)
@@ -600,6 +722,7 @@ void Test_CF_CFDP_SendMd(void)
     CF_Logical_PduBuffer_t *ph;
     CF_History_t *          history;
     CF_Logical_PduMd_t *    md;
+    CF_FecEncoder_t *       fec;
 
     /* setup without a tx message */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -609,10 +732,12 @@ void Test_CF_CFDP_SendMd(void)
     md = &ph->int_header.md;
     strncpy(history->fnames.dst_filename, "dst1", sizeof(history->fnames.dst_filename));
     strncpy(history->fnames.src_filename, "src1", sizeof(history->fnames.src_filename));
-    txn->state = CF_TxnState_S1;
-    txn->fsize = 1234;
+    txn->state          = CF_TxnState_S1;
+    txn->fsize          = 1234;
+    txn->cold->crc.type = CF_CRC_Type_CRC32C;
     UtAssert_INT32_EQ(CF_CFDP_SendMd(txn), CFE_SUCCESS);
     UtAssert_UINT32_EQ(md->size, txn->fsize);
+    UtAssert_UINT32_EQ(md->checksum_type, CF_CRC_Type_CRC32C);
     UtAssert_STRINGBUF_EQ(md->dest_filename.data_ptr, md->dest_filename.length, history->fnames.dst_filename,
                           sizeof(history->fnames.dst_filename));
     UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
@@ -630,6 +755,19 @@ void Test_CF_CFDP_SendMd(void)
     UtAssert_UINT32_EQ(md->dest_filename.length, sizeof(history->fnames.dst_filename));
     UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
                           sizeof(history->fnames.src_filename));
+    UtAssert_ZERO(md->fec.group_size);
+
+    /* Class 1 with parity */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, &history, &txn, NULL);
+    md                       = &ph->int_header.md;
+    fec                      = &CF_AppData.engine.fec_encoders[0];
+    fec->params.group_size   = 8;
+    fec->params.segment_size = 480;
+    txn->state               = CF_TxnState_S1;
+    txn->state_data.send.fec = fec;
+    UtAssert_INT32_EQ(CF_CFDP_SendMd(txn), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(md->fec.group_size, 8);
+    UtAssert_UINT32_EQ(md->fec.segment_size, 480);
 }
 
 void Test_CF_CFDP_SendFd(void)
@@ -683,6 +821,32 @@ void Test_CF_CFDP_SendEof(void)
     UtAssert_STUB_COUNT(CF_CFDP_Send, 2);
 }
 
+void Test_CF_CFDP_SendParity(void)
+{
+    /* Test case for:
+        CFE_Status_t CF_CFDP_SendParity(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, size_t len);
+     */
+
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+    CF_Logical_PduParity_t *parity;
+    const uint8             data[] = {1, 2, 3};
+
+    /* setup without a tx message */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_SendParity(txn, 0, data, sizeof(data)), CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+
+    /* nominal */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    parity = &ph->int_header.parity;
+    UtAssert_INT32_EQ(CF_CFDP_SendParity(txn, 960, data, sizeof(data)), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(parity->offset, 960);
+    UtAssert_ADDRESS_EQ(parity->data_ptr, data);
+    UtAssert_UINT32_EQ(parity->data_len, sizeof(data));
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeParity, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_Send, 1);
+}
+
 void Test_CF_CFDP_SendAck(void)
 {
     /* Test case for:
@@ -693,6 +857,9 @@ void Test_CF_CFDP_SendAck(void)
     CF_Transaction_t *      txn;
     CF_Logical_PduBuffer_t *ph;
     CF_Logical_PduAck_t *   ack;
+    CF_ConfigTable_t *      config;
+    CF_Transaction_t        t_finack;
+    CF_TransactionCold_t    t_finack_cold;
 
     /* setup without a tx message */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -735,6 +902,28 @@ void Test_CF_CFDP_SendAck(void)
     UtAssert_UINT32_EQ(ack->ack_subtype_code, 1);
     UtAssert_UINT32_EQ(ack->txn_status, CF_CFDP_AckTxnStatus_TERMINATED);
     UtAssert_UINT32_EQ(ack->cc, CF_CFDP_ConditionCode_FILESTORE_REJECTION);
+
+    /* the ACK of a FIN for a transaction that is already gone, from a temporary transaction set up
+     * as CF_CFDP_ReceivePdu() does, whose cold part has no header template */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, NULL, &config);
+    ack               = &ph->int_header.ack;
+    config->local_eid = 3;
+    memset(&t_finack, 0, sizeof(t_finack));
+    memset(&t_finack_cold, 0, sizeof(t_finack_cold));
+    t_finack.cold = &t_finack_cold;
+    CF_CFDP_InitTxnTxFile(&t_finack, CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 0);
+    UT_ResetState(UT_KEY(CF_CFDP_EncodeHeaderWithoutSize));
+    UT_ResetState(UT_KEY(CF_CFDP_EncodeHeaderFromTemplate));
+    UtAssert_INT32_EQ(CF_CFDP_SendAck(&t_finack, CF_CFDP_AckTxnStatus_UNRECOGNIZED, CF_CFDP_FileDirective_FIN,
+                                      CF_CFDP_ConditionCode_NO_ERROR, 300, 42),
+                      CFE_SUCCESS);
+    UtAssert_UINT32_EQ(ph->pdu_header.source_eid, 3);
+    UtAssert_UINT32_EQ(ph->pdu_header.destination_eid, 300);
+    UtAssert_UINT32_EQ(ph->pdu_header.sequence_num, 42);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderWithoutSize, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 0);
+    UtAssert_UINT32_EQ(ack->ack_directive_code, CF_CFDP_FileDirective_FIN);
+    UtAssert_UINT32_EQ(ack->txn_status, CF_CFDP_AckTxnStatus_UNRECOGNIZED);
 }
 
 void Test_CF_CFDP_SendFin(void)
@@ -856,6 +1045,9 @@ void Test_CF_CFDP_InitEngine(void)
     UtAssert_INT32_EQ(CF_CFDP_InitEngine(), 0);
     UtAssert_BOOL_TRUE(CF_AppData.engine.enabled);
     UtAssert_STUB_COUNT(CF_FreeTransaction, CF_NUM_TRANSACTIONS_PER_CHANNEL * CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_CFDP_TransportOpen, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_NameTable_Init, 2);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Init, CF_NUM_CHANNELS);
 
     /* nominal call, with sem */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
@@ -899,6 +1091,23 @@ void Test_CF_CFDP_InitEngine(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeLocal), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+
+    /* failure of CF_CFDP_TransportOpen */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_TransportOpen), 1, CF_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UT_CF_AssertEventID(CF_EID_ERR_INIT_TRANSPORT);
+    UtAssert_STUB_COUNT(CF_CFDP_TransportClose, 0);
+
+    /* failure on the last channel closes the transports of the channels before it */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_TransportOpen));
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_TransportOpen), CF_NUM_CHANNELS, CF_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UtAssert_STUB_COUNT(CF_CFDP_TransportOpen, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_CFDP_TransportClose, CF_NUM_CHANNELS - 1);
 }
 
 void Test_CF_CFDP_TxFile(void)
@@ -908,44 +1117,172 @@ void Test_CF_CFDP_TxFile(void)
                             CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 chan, uint8 priority, CF_EntityId_t dest_id);
 
      */
-    const char        src[]  = "tsrc";
-    const char        dest[] = "tdest";
-    CF_History_t *    history;
-    CF_Transaction_t *txn;
-    CF_Channel_t *    chan;
-    CF_ChunkWrapper_t chunk_wrap;
+    const char       src[]  = "tsrc";
+    const char       dest[] = "tdest";
+    char             long_name[CF_FILENAME_MAX_NAME + 1];
+    CF_Channel_t *   chan;
+    CF_PendingFile_t pf;
 
-    memset(&chunk_wrap, 0, sizeof(chunk_wrap));
+    memset(&pf, 0, sizeof(pf));
 
-    /* nominal call */
-    /* make sure call to CF_FindUnusedTransaction() returns this buffer */
-    /* Also need to set up for call to CF_CFDP_FindUnusedChunks which calls CF_CList_Pop */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
-    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
-    chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
-    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), 0);
-    UtAssert_STRINGBUF_EQ(dest, -1, history->fnames.dst_filename, sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(src, -1, history->fnames.src_filename, sizeof(history->fnames.src_filename));
-    UtAssert_UINT32_EQ(chan->num_cmd_tx, 1);
+    /* nominal call, the file is only queued and does not get a transaction yet */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 3, 7), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_NameTable_InternPath, 2);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_BOOL_FALSE(pf.same_leaf);
+    UtAssert_STRINGBUF_EQ(pf.leaves, sizeof(pf.leaves), src, -1);
+    UtAssert_STRINGBUF_EQ(&pf.leaves[sizeof(src)], sizeof(pf.leaves) - sizeof(src), dest, -1);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 1);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_NULL(pf.pb);
+    UtAssert_UINT32_EQ(pf.seq_num, 1);
+    UtAssert_UINT32_EQ(pf.cfdp_class, CF_CFDP_CLASS_2);
+    UtAssert_UINT32_EQ(pf.keep, 1);
+    UtAssert_UINT32_EQ(pf.priority, 3);
+    UtAssert_UINT32_EQ(pf.dest_id, 7);
+    UtAssert_BOOL_FALSE(pf.suspended);
+    UtAssert_ZERO(chan->num_cmd_tx);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
     UT_CF_AssertEventID(CF_EID_INF_CFDP_S_START_SEND);
 
-    /* same but for class 2 (for branch coverage) */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
-    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
-    chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
-    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 0, 1), 0);
-    UtAssert_STRINGBUF_EQ(dest, -1, history->fnames.dst_filename, sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(src, -1, history->fnames.src_filename, sizeof(history->fnames.src_filename));
-    UtAssert_UINT32_EQ(chan->num_cmd_tx, 2);
-    UT_CF_AssertEventID(CF_EID_INF_CFDP_S_START_SEND);
+    /* the same file name is only stored once */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UtAssert_INT32_EQ(CF_CFDP_TxFile("", "/dir/", CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 3, 7), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(pf.same_leaf);
+    UtAssert_STUB_COUNT(CF_NameTable_InternPath, 3);
+    UtAssert_STUB_COUNT(CF_NameTable_Intern, 1);
 
-    /* max TX */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
-    chan->num_cmd_tx = CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
-    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), -1);
-    UT_CF_AssertEventID(CF_EID_ERR_CFDP_MAX_CMD_TX);
+    /* no room for the destination leaf after the source one, the destination path is interned whole */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 2, CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 3, 7), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(pf.same_leaf);
+    UtAssert_STUB_COUNT(CF_NameTable_InternPath, 5);
+    UtAssert_STUB_COUNT(CF_NameTable_Intern, 2);
+    UtAssert_STRINGBUF_EQ(pf.leaves, sizeof(pf.leaves), src, -1);
+    UtAssert_ZERO(pf.leaves[sizeof(src)]);
+
+    /* no free pending file record */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = NULL;
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_SLOT);
+
+    /* no room left for the source prefix */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 1, CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_SLOT);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 3);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 3);
+
+    /* no room left for the destination prefix, the source one is given back */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 2, CF_NAME_HANDLE_INVALID);
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_Intern), 1, CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_SLOT);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 3);
+
+    /* the source file name does not fit in the record */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    memset(long_name, 'x', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = 0;
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 1, CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(long_name, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1),
+                      CF_NAME_TOO_LONG_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_NAME);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 3);
+}
+
+void Test_CF_CFDP_TxFileMulti(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_TxFileMulti(const char *src_filename, const char *dst_filename,
+     *                                  CF_CFDP_Class_t cfdp_class, uint8 keep, uint8 chan, uint8 priority,
+     *                                  const CF_EntityId_t *dest_ids, uint8 num_dest);
+     */
+    const char          src[]      = "tsrc";
+    const char          dest[]     = "tdest";
+    const CF_EntityId_t dest_ids[] = {3, 4};
+    CF_Channel_t *      chan;
+    CF_PendingFile_t    pf;
+    CF_TxGroup_t *      group = &CF_AppData.engine.tx_groups[0];
+    char                long_name[CF_FILENAME_MAX_NAME + 1];
+    int                 i;
+
+    memset(&pf, 0, sizeof(pf));
+
+    /* nominal call, one pending file per destination, all in the first group */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    UtAssert_INT32_EQ(CF_CFDP_TxFileMulti(src, dest, CF_CFDP_CLASS_2, 0, UT_CFDP_CHANNEL, 3, dest_ids, 2),
+                      CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+    UtAssert_ADDRESS_EQ(pf.group, group);
+    UtAssert_NULL(pf.pb);
+    UtAssert_UINT32_EQ(pf.dest_id, 4);
+    UtAssert_UINT32_EQ(group->num_refs, 2);
+    UtAssert_ZERO(group->num_members);
+    UtAssert_UINT32_EQ(group->chan_num, UT_CFDP_CHANNEL);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(group->fd));
+    UtAssert_STRINGBUF_EQ(group->src_filename, sizeof(group->src_filename), src, -1);
+
+    /* every group in use */
+    for (i = 0; i < CF_NUM_TX_GROUPS; ++i)
+    {
+        CF_AppData.engine.tx_groups[i].num_refs = 1;
+    }
+    UT_CF_ResetEventCapture();
+    UtAssert_INT32_EQ(CF_CFDP_TxFileMulti(src, dest, CF_CFDP_CLASS_2, 0, UT_CFDP_CHANNEL, 3, dest_ids, 2), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_GROUP_SLOT);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+
+    /* no free pending file record, the group stays free */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    group->num_refs = 0;
+    chan->pf_free   = NULL;
+    UtAssert_INT32_EQ(CF_CFDP_TxFileMulti(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, dest_ids, 2), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_SLOT);
+    UtAssert_ZERO(group->num_refs);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+
+    /* the file name does not fit in a record, nothing is queued */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    chan->pf_free = &pf.cl_node;
+    memset(long_name, 'x', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = 0;
+    UT_SetDefaultReturnValue(UT_KEY(CF_NameTable_InternPath), CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_TxFileMulti(long_name, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, dest_ids, 2),
+                      CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PENDING_NAME);
+    UtAssert_ZERO(group->num_refs);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+}
+
+static int32 Ut_Hook_NameTable_Intern_Capture(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                              const UT_StubContext_t *Context)
+{
+    char *      buf = UserObj;
+    const char *str = UT_Hook_GetArgValueByName(Context, "str", const char *);
+    size_t      len = UT_Hook_GetArgValueByName(Context, "len", size_t);
+
+    /* keep the first string */
+    if (CallCount == 1)
+    {
+        memcpy(buf, str, len);
+        buf[len] = 0;
+    }
+
+    return StubRetcode;
 }
 
 void Test_CF_CFDP_PlaybackDir(void)
@@ -953,29 +1290,58 @@ void Test_CF_CFDP_PlaybackDir(void)
     /* Test case for:
      * int32 CF_CFDP_PlaybackDir(const char *src_filename,
                                  const char *dst_filename, CF_CFDP_Class_t cfdp_class, uint8 keep,
-                                 uint8 chan, uint8 priority, uint16 dest_id);
+                                 uint8 chan, uint8 priority, uint16 dest_id, uint16 max_active,
+                                 uint16 max_pending);
      */
     const char     src[]  = "psrc";
     const char     dest[] = "pdest";
     CF_Playback_t *pb;
     CF_Channel_t * chan;
     uint8          i;
+    char           prefix[CF_FILENAME_MAX_LEN];
 
-    /* nominal call */
+    /* nominal call, the directories are interned with a trailing slash */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
     pb = &chan->playback[0];
     memset(pb, 0, sizeof(*pb));
-    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), 0);
-    UtAssert_STRINGBUF_EQ(dest, -1, pb->fnames.dst_filename, sizeof(pb->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(src, -1, pb->fnames.src_filename, sizeof(pb->fnames.src_filename));
+    memset(prefix, 0, sizeof(prefix));
+    UT_SetHookFunction(UT_KEY(CF_NameTable_Intern), Ut_Hook_NameTable_Intern_Capture, prefix);
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_Intern), 2, 4);
+    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1, 0, 0), 0);
+    UtAssert_STUB_COUNT(CF_NameTable_Intern, 2);
+    UtAssert_STRINGBUF_EQ(prefix, sizeof(prefix), "psrc/", -1);
+    UtAssert_UINT32_EQ(pb->src_prefix, 0);
+    UtAssert_UINT32_EQ(pb->dst_prefix, 4);
     UtAssert_BOOL_TRUE(pb->diropen);
     UtAssert_BOOL_TRUE(pb->busy);
+    UtAssert_ZERO(pb->num_pending);
+    UtAssert_UINT32_EQ(pb->max_active, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
+    UtAssert_UINT32_EQ(pb->max_pending, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
+
+    /* nominal call with limits set */
+    memset(pb, 0, sizeof(*pb));
+    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1, 20, 40), 0);
+    UtAssert_BOOL_TRUE(pb->busy);
+    UtAssert_UINT32_EQ(pb->max_active, 20);
+    UtAssert_UINT32_EQ(pb->max_pending, 40);
 
     /* OS_DirectoryOpen fail */
     memset(pb, 0, sizeof(*pb));
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryOpen), 1, OS_ERROR);
-    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), -1);
+    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1, 0, 0), -1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_OPENDIR);
+    UtAssert_STUB_COUNT(CF_NameTable_Intern, 4);
+
+    /* no room in the path prefix table, the one that was interned is released */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    memset(pb, 0, sizeof(*pb));
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_Intern), 2, CF_NAME_HANDLE_INVALID);
+    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1, 0, 0), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_PATH_PREFIXES);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_BOOL_FALSE(pb->diropen);
+    UtAssert_BOOL_FALSE(pb->busy);
 
     /* no non-busy entries */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
@@ -984,19 +1350,81 @@ void Test_CF_CFDP_PlaybackDir(void)
         pb       = &chan->playback[i];
         pb->busy = 1;
     }
-    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), -1);
+    UtAssert_INT32_EQ(CF_CFDP_PlaybackDir(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1, 0, 0), -1);
     UT_CF_AssertEventID(CF_EID_ERR_CFDP_DIR_SLOT);
 }
 
-static int32 Ut_Hook_CycleTx_SetRanOne(void *UserObj, int32 StubRetcode, uint32 CallCount,
-                                       const UT_StubContext_t *Context)
+void Test_CF_CFDP_TxManifest(void)
 {
-    CF_CFDP_CycleTx_args_t *args = UT_Hook_GetArgValueByName(Context, "context", CF_CFDP_CycleTx_args_t *);
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_TxManifest(const char *filename, uint8 keep, uint8 chan);
+     */
+    const char           fname[] = "manifest";
+    CF_Manifest_t *      mf;
+    CF_Channel_t *       chan;
+    CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL];
+    os_fstat_t           fstat;
 
-    if (CallCount == 1)
-    {
-        args->ran_one = 1;
-    }
+    /* nominal call */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    mf = &chan->manifest;
+    memset(&fstat, 0, sizeof(fstat));
+    fstat.FileSize       = 3 * sizeof(CF_TxManifestEntry_t);
+    hk->manifest_skipped = 4;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
+    UtAssert_INT32_EQ(CF_CFDP_TxManifest(fname, 1, UT_CFDP_CHANNEL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+    UtAssert_BOOL_TRUE(mf->fileopen);
+    UtAssert_BOOL_TRUE(mf->pb.busy);
+    UtAssert_UINT32_EQ(mf->pb.keep, 1);
+    UtAssert_ZERO(mf->pb.num_pending);
+    UtAssert_UINT32_EQ(mf->pb.max_pending, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
+    UtAssert_UINT32_EQ(hk->manifest_active, 1);
+    UtAssert_UINT32_EQ(hk->manifest_total, 3);
+    UtAssert_ZERO(hk->manifest_skipped);
+
+    /* a manifest is already in progress */
+    UtAssert_INT32_EQ(CF_CFDP_TxManifest(fname, 1, UT_CFDP_CHANNEL), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_MANIFEST_SLOT);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+
+    /* OS_stat fails, the total is unknown but the manifest is still started */
+    memset(mf, 0, sizeof(*mf));
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_TxManifest(fname, 0, UT_CFDP_CHANNEL), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(mf->pb.busy);
+    UtAssert_ZERO(hk->manifest_total);
+
+    /* CF_WrappedOpenCreate fails */
+    memset(mf, 0, sizeof(*mf));
+    hk->manifest_active = 0;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedOpenCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_TxManifest(fname, 0, UT_CFDP_CHANNEL), OS_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_MANIFEST_OPEN);
+    UtAssert_UINT32_EQ(hk->counters.fault.file_open, 1);
+    UtAssert_BOOL_FALSE(mf->fileopen);
+    UtAssert_BOOL_FALSE(mf->pb.busy);
+    UtAssert_ZERO(hk->manifest_active);
+}
+
+static int32 Ut_Hook_CycleTx_MoveOffTxa(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    CF_Transaction_t *txn = UT_Hook_GetArgValueByName(Context, "txn", CF_Transaction_t *);
+
+    /* the transaction sent its last PDU and went to wait for the FIN */
+    txn->flags.com.q_index = CF_QueueIdx_TXW;
+
+    return StubRetcode;
+}
+
+static int32 Ut_Hook_CycleTx_RemovePending(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                           const UT_StubContext_t *Context)
+{
+    CF_Channel_t *chan = UT_Hook_GetArgValueByName(Context, "chan", CF_Channel_t *);
+
+    /* the started file was the only commanded file pending */
+    chan->cmd_pend = NULL;
 
     return StubRetcode;
 }
@@ -1010,8 +1438,15 @@ void Test_CF_CFDP_CycleTx(void)
     CF_Transaction_t *txn;
     CF_ConfigTable_t *config;
     CF_Transaction_t  txn2;
+    CF_Transaction_t  txn3;
+    CF_PendingFile_t  pf;
+    CF_ChunkWrapper_t chunk_wrap;
+    CF_TxGroup_t      group;
 
     memset(&txn2, 0, sizeof(txn2));
+    memset(&txn3, 0, sizeof(txn3));
+    memset(&pf, 0, sizeof(pf));
+    memset(&chunk_wrap, 0, sizeof(chunk_wrap));
 
     /* need to set dequeue_enabled so it enters the actual logic */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
@@ -1020,20 +1455,490 @@ void Test_CF_CFDP_CycleTx(void)
     config->chan[UT_CFDP_CHANNEL].dequeue_enabled               = 1;
 
     /* nominal call, w/chan->cur non-null */
-    chan->cur = txn;
+    chan->cur      = txn;
+    chan->cmd_pend = &pf.src_node;
     UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 0);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
 
-    /* nominal call, w/chan->cur null, but queue empty */
+    /* nominal call, w/chan->cur null, but no free transaction so pending files are not looked at */
     UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+
+    /* nominal call, the suspended transaction at the front of the active queue is skipped for the next one */
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_CycleTx_MoveOffTxa, NULL);
+    txn3.flags.com.suspended   = 1;
+    txn3.cl_node.next          = &txn2.cl_node;
+    txn3.cl_node.prev          = &txn2.cl_node;
+    txn2.cl_node.next          = &txn3.cl_node;
+    txn2.cl_node.prev          = &txn3.cl_node;
+    txn2.state                 = CF_TxnState_S1;
+    txn2.flags.com.q_index     = CF_QueueIdx_TXA;
+    chan->qs[CF_QueueIdx_TXA]  = &txn3.cl_node;
+    chan->qs[CF_QueueIdx_FREE] = &txn2.cl_node;
+    UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 1);
+    UtAssert_UINT32_EQ(txn2.flags.com.q_index, CF_QueueIdx_TXW);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
 
-    /* nominal call, w/chan->cur null, queue not empty */
-    UT_ResetState(UT_KEY(CF_CList_Traverse));
-    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_CycleTx_SetRanOne, false);
-    chan->qs[CF_QueueIdx_PEND] = &txn2.cl_node;
+    /* nothing ran, and no pending file can start */
+    chan->qs[CF_QueueIdx_TXA] = NULL;
+    chan->cmd_pend            = NULL;
     UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 2);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+
+    /* a pending file gets a transaction, then nothing else can start */
+    UT_SetHookFunction(UT_KEY(CF_RemovePendingFile), Ut_Hook_CycleTx_RemovePending, NULL);
+    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
+    chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
+    chan->cmd_pend            = &pf.src_node;
+    UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 1);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+
+    /* a member of a transmit group starts the rest of its group along with it */
+    memset(&pf, 0, sizeof(pf));
+    memset(&group, 0, sizeof(group));
+    pf.group       = &group;
+    group.num_refs = 1;
+    chan->cmd_pend = &pf.src_node;
+    UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
+    UtAssert_ADDRESS_EQ(txn->cold->group, &group);
+    UtAssert_UINT32_EQ(group.num_members, 1);
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 2);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 2);
+}
+
+void Test_CF_CFDP_FindStartablePending(void)
+{
+    /* Test case for:
+     * CF_PendingFile_t *CF_CFDP_FindStartablePending(CF_Channel_t *chan, const CF_TxGroup_t *group)
+     */
+    CF_Channel_t *       chan;
+    CF_Transaction_t *   txn;
+    CF_PendingFile_t     pf;
+    CF_PendingFile_t     pf2;
+    CF_Playback_t *      pb;
+    CF_TxGroup_t         group;
+    CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL];
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&pf2, 0, sizeof(pf2));
+    memset(&group, 0, sizeof(group));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, NULL);
+    pb = &chan->playback[1];
+
+    /* nothing pending */
+    chan->qs[CF_QueueIdx_FREE] = &txn->cl_node;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* commanded file, but no free transaction */
+    chan->qs[CF_QueueIdx_FREE] = NULL;
+    chan->cmd_pend             = &pf.src_node;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* commanded file, nominal */
+    chan->qs[CF_QueueIdx_FREE] = &txn->cl_node;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf);
+
+    /* commanded file, but the commanded share is in use */
+    chan->num_cmd_tx = CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* playback file, within its share, but only the receive and commanded reserves are free */
+    chan->num_cmd_tx             = 0;
+    chan->cmd_pend               = NULL;
+    pb->pend                     = &pf2.src_node;
+    pb->max_active               = CF_NUM_TRANSACTIONS_PER_PLAYBACK + 1;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* playback file, within its share */
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + 1;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf2);
+
+    /* beyond its share, a playback only starts a file if no reserved transactions would be used */
+    pb->num_ts                   = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + 1;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf2);
+
+    /* the unused share of every other active playback is reserved too */
+    chan->playback[0].busy       = true;
+    chan->playback[0].max_active = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    chan->playback[0].num_ts     = 1;
+    chan->poll[0].pb.busy        = true;
+    chan->poll[0].pb.max_active  = 2;
+    chan->manifest.pb.busy       = true;
+    chan->manifest.pb.max_active = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    chan->manifest.pb.num_ts     = CF_NUM_TRANSACTIONS_PER_PLAYBACK + 1;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN +
+                                   CF_NUM_TRANSACTIONS_PER_PLAYBACK + 1;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN +
+                                   CF_NUM_TRANSACTIONS_PER_PLAYBACK + 2;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf2);
+
+    /* a playback does not reserve its own share */
+    chan->playback[0].busy       = false;
+    chan->poll[0].pb.busy        = false;
+    chan->manifest.pb.num_ts     = 0;
+    chan->manifest.pb.pend       = &pf2.src_node;
+    pb->pend                     = NULL;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + 1;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf2);
+    chan->manifest.pb.pend = NULL;
+    pb->pend               = &pf2.src_node;
+
+    /* playback at its concurrency limit */
+    pb->num_ts = pb->max_active;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* playback, but no free transaction */
+    pb->num_ts                 = 0;
+    chan->qs[CF_QueueIdx_FREE] = NULL;
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, NULL));
+
+    /* of the heads that can start, the one that comes first on the pending queue is chosen */
+    chan->qs[CF_QueueIdx_FREE] = &txn->cl_node;
+    chan->cmd_pend             = &pf.src_node;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf);
+    UT_SetDefaultReturnValue(UT_KEY(CF_PendingFileBefore), true);
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, NULL), &pf2);
+    UtAssert_STUB_COUNT(CF_PendingFileBefore, 2);
+
+    /* when starting the rest of a transmit group, only the commanded head of that group can start */
+    UtAssert_NULL(CF_CFDP_FindStartablePending(chan, &group));
+
+    pf.group = &group;
+    UtAssert_ADDRESS_EQ(CF_CFDP_FindStartablePending(chan, &group), &pf);
+    UtAssert_STUB_COUNT(CF_PendingFileBefore, 2);
+}
+
+void Test_CF_CFDP_StartPendingFile(void)
+{
+    /* Test case for:
+     * void CF_CFDP_StartPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+     */
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
+    CF_History_t *    history;
+    CF_ConfigTable_t *config;
+    CF_PendingFile_t  pf;
+    CF_Playback_t     pb;
+    CF_TxGroup_t      group;
+    CF_ChunkWrapper_t chunk_wrap;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&pb, 0, sizeof(pb));
+    memset(&group, 0, sizeof(group));
+    memset(&chunk_wrap, 0, sizeof(chunk_wrap));
+
+    /* commanded file */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, &config);
+    config->local_eid      = 6;
+    pf.seq_num             = 42;
+    pf.dest_id             = 9;
+    pf.cfdp_class          = CF_CFDP_CLASS_2;
+    pf.keep                = 1;
+    pf.priority            = 7;
+    pf.queued_time.Seconds = 1234;
+    chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
+    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
+    UtAssert_VOIDCALL(CF_CFDP_StartPendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_PendingFileNames, 1);
+    UtAssert_UINT32_EQ(history->dir, CF_Direction_TX);
+    UtAssert_UINT32_EQ(history->seq_num, 42);
+    UtAssert_UINT32_EQ(history->src_eid, 6);
+    UtAssert_UINT32_EQ(history->peer_eid, 9);
+    UtAssert_UINT32_EQ(txn->state, CF_TxnState_S2);
+    UtAssert_UINT32_EQ(txn->keep, 1);
+    UtAssert_UINT32_EQ(txn->priority, 7);
+    UtAssert_UINT32_EQ(txn->chan_num, UT_CFDP_CHANNEL);
+    UtAssert_ADDRESS_EQ(txn->chunks, &chunk_wrap);
+    UtAssert_NULL(txn->cold->pb);
+    UtAssert_BOOL_TRUE(txn->flags.tx.cmd_tx);
+    UtAssert_UINT32_EQ(chan->num_cmd_tx, 1);
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 1);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+    UtAssert_UINT32_EQ(txn->cold->init_time.Seconds, 1234);
+    UtAssert_STUB_COUNT(CF_Perf_RecordLatency, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
+
+    /* playback file, moves from the pending count to the active count of the playback */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, NULL);
+    pf.pb          = &pb;
+    pf.cfdp_class  = CF_CFDP_CLASS_1;
+    pb.num_pending = 1;
+    UtAssert_VOIDCALL(CF_CFDP_StartPendingFile(chan, &pf));
+    UtAssert_UINT32_EQ(txn->state, CF_TxnState_S1);
+    UtAssert_ADDRESS_EQ(txn->cold->pb, &pb);
+    UtAssert_BOOL_FALSE(txn->flags.tx.cmd_tx);
+    UtAssert_ZERO(pb.num_pending);
+    UtAssert_UINT32_EQ(pb.num_ts, 1);
+    UtAssert_UINT32_EQ(chan->num_cmd_tx, 1);
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 2);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 2);
+
+    /* member of a transmit group, joins the members of the group */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, NULL);
+    pf.pb          = NULL;
+    pf.group       = &group;
+    group.num_refs = 2;
+    UtAssert_VOIDCALL(CF_CFDP_StartPendingFile(chan, &pf));
+    UtAssert_ADDRESS_EQ(txn->cold->group, &group);
+    UtAssert_UINT32_EQ(group.num_members, 1);
+    UtAssert_ADDRESS_EQ(group.members[0], txn);
+    UtAssert_UINT32_EQ(group.num_refs, 2);
+}
+
+void Test_CF_CFDP_DropPendingFile(void)
+{
+    /* Test case for:
+     * void CF_CFDP_DropPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+     */
+    CF_Channel_t *   chan;
+    CF_PendingFile_t pf;
+    CF_Playback_t    pb;
+    CF_TxGroup_t     group;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&pb, 0, sizeof(pb));
+    memset(&group, 0, sizeof(group));
+
+    /* commanded file */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_DropPendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 1);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 0);
+
+    /* playback file, the playback no longer waits for it */
+    pf.pb          = &pb;
+    pb.num_pending = 1;
+    UtAssert_VOIDCALL(CF_CFDP_DropPendingFile(chan, &pf));
+    UtAssert_ZERO(pb.num_pending);
+    UtAssert_STUB_COUNT(CF_RemovePendingFile, 2);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 4);
+
+    /* member of a transmit group, other references remain */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    pf.pb          = NULL;
+    pf.group       = &group;
+    group.num_refs = 2;
+    group.fd       = OS_ObjectIdFromInteger(1);
+    UtAssert_VOIDCALL(CF_CFDP_DropPendingFile(chan, &pf));
+    UtAssert_UINT32_EQ(group.num_refs, 1);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
+
+    /* the last reference closes the shared file and disposes of it */
+    UtAssert_VOIDCALL(CF_CFDP_DropPendingFile(chan, &pf));
+    UtAssert_ZERO(group.num_refs);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(group.fd));
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+
+    /* a group that is kept, and never opened its file */
+    group.num_refs = 1;
+    group.keep     = 1;
+    UtAssert_VOIDCALL(CF_CFDP_DropPendingFile(chan, &pf));
+    UtAssert_ZERO(group.num_refs);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+}
+
+void Test_CF_CFDP_StartRelay(void)
+{
+    /* Test case for:
+     * void CF_CFDP_StartRelay(CF_Transaction_t *rx)
+     */
+    CF_Channel_t *       chan;
+    CF_Transaction_t *   txn;
+    CF_History_t *       history;
+    CF_ConfigTable_t *   config;
+    CF_ChannelConfig_t * cc;
+    CF_Transaction_t     rx;
+    CF_TransactionCold_t rx_cold;
+    CF_History_t         rx_history;
+    CF_ChunkWrapper_t    chunk_wrap;
+    CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL];
+
+    memset(&rx, 0, sizeof(rx));
+    memset(&rx_cold, 0, sizeof(rx_cold));
+    memset(&rx_history, 0, sizeof(rx_history));
+    memset(&chunk_wrap, 0, sizeof(chunk_wrap));
+    rx.cold            = &rx_cold;
+    rx.history         = &rx_history;
+    rx.chan_num        = UT_CFDP_CHANNEL;
+    rx.state           = CF_TxnState_R2;
+    rx_history.src_eid = 3;
+    strcpy(rx_history.fnames.src_filename, "sfile");
+    strcpy(rx_history.fnames.dst_filename, "dfile");
+
+    /* the channel does not relay */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, &config);
+    cc = &config->chan[UT_CFDP_CHANNEL];
+    UtAssert_VOIDCALL(CF_CFDP_StartRelay(&rx));
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_NULL(rx.cold->relay);
+
+    /* a file is not relayed back to its source */
+    cc->relay_eid = 3;
+    UtAssert_VOIDCALL(CF_CFDP_StartRelay(&rx));
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_NULL(rx.cold->relay);
+
+    /* no free transaction, the file is only stored */
+    cc->relay_eid  = 9;
+    cc->relay_chan = UT_CFDP_CHANNEL;
+    UtAssert_VOIDCALL(CF_CFDP_StartRelay(&rx));
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_NULL(rx.cold->relay);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_RELAY_SLOT);
+
+    /* the free transactions are all held back for receive and commanded files */
+    UT_CF_ResetEventCapture();
+    chan->qs[CF_QueueIdx_FREE]   = &txn->cl_node;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
+    UtAssert_VOIDCALL(CF_CFDP_StartRelay(&rx));
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_NULL(rx.cold->relay);
+    UT_CF_AssertEventID(CF_EID_ERR_CFDP_RELAY_SLOT);
+
+    /* nominal, the outbound sends the received file on to the next hop */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, &config);
+    cc                           = &config->chan[UT_CFDP_CHANNEL];
+    config->local_eid            = 6;
+    cc->relay_eid                = 9;
+    cc->relay_chan               = UT_CFDP_CHANNEL;
+    CF_AppData.engine.seq_num    = 41;
+    chan->cs[CF_Direction_TX]    = &chunk_wrap.cl_node;
+    chan->qs[CF_QueueIdx_FREE]   = &txn->cl_node;
+    hk->q_size[CF_QueueIdx_FREE] = CF_MAX_SIMULTANEOUS_RX + CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN + 1;
+    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
+    UtAssert_VOIDCALL(CF_CFDP_StartRelay(&rx));
+    UtAssert_STRINGBUF_EQ(history->fnames.src_filename, sizeof(history->fnames.src_filename), "dfile", -1);
+    UtAssert_STRINGBUF_EQ(history->fnames.dst_filename, sizeof(history->fnames.dst_filename), "dfile", -1);
+    UtAssert_UINT32_EQ(history->dir, CF_Direction_TX);
+    UtAssert_UINT32_EQ(history->seq_num, 42);
+    UtAssert_UINT32_EQ(history->src_eid, 6);
+    UtAssert_UINT32_EQ(history->peer_eid, 9);
+    UtAssert_UINT32_EQ(txn->state, CF_TxnState_S2);
+    UtAssert_UINT32_EQ(txn->keep, 1);
+    UtAssert_ADDRESS_EQ(txn->chunks, &chunk_wrap);
+    UtAssert_ADDRESS_EQ(txn->cold->relay, &rx);
+    UtAssert_ADDRESS_EQ(rx.cold->relay, txn);
+    UtAssert_BOOL_FALSE(txn->flags.tx.cmd_tx);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+    UT_CF_AssertEventID(CF_EID_INF_CFDP_RELAY_START);
+}
+
+void Test_CF_CFDP_WakeRelay(void)
+{
+    /* Test case for:
+     * void CF_CFDP_WakeRelay(CF_Transaction_t *rx)
+     */
+    CF_Channel_t *       chan;
+    CF_Transaction_t *   txn;
+    CF_Transaction_t     rx;
+    CF_TransactionCold_t rx_cold;
+
+    memset(&rx, 0, sizeof(rx));
+    memset(&rx_cold, 0, sizeof(rx_cold));
+    rx.cold = &rx_cold;
+
+    /* not relayed */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_WakeRelay(&rx));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 0);
+
+    /* the outbound is still sending, only its inactivity timer restarts */
+    rx.cold->relay                 = txn;
+    txn->cold->relay               = &rx;
+    txn->state                     = CF_TxnState_S2;
+    txn->flags.com.q_index         = CF_QueueIdx_TXA;
+    txn->state_data.send.sub_state = CF_TxSubState_FILEDATA;
+    UtAssert_VOIDCALL(CF_CFDP_WakeRelay(&rx));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 0);
+
+    /* the outbound waits for data, it goes back on the active queue */
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_TXW] = 1;
+    txn->flags.com.q_index                                                   = CF_QueueIdx_TXW;
+    chan->cur                                                                = txn;
+    UtAssert_VOIDCALL(CF_CFDP_WakeRelay(&rx));
+    UtAssert_NULL(chan->cur);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+
+    /* past its EOF, the outbound waits for the peer rather than for data */
+    txn->state_data.send.sub_state = CF_TxSubState_WAIT_FOR_EOF_ACK;
+    UtAssert_VOIDCALL(CF_CFDP_WakeRelay(&rx));
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+}
+
+void Test_CF_CFDP_EndRelay(void)
+{
+    /* Test case for:
+     * void CF_CFDP_EndRelay(CF_Transaction_t *txn)
+     */
+    CF_Transaction_t *   txn;
+    CF_Transaction_t     rx;
+    CF_TransactionCold_t rx_cold;
+    CF_History_t         rx_history;
+
+    memset(&rx, 0, sizeof(rx));
+    memset(&rx_cold, 0, sizeof(rx_cold));
+    memset(&rx_history, 0, sizeof(rx_history));
+    rx.cold    = &rx_cold;
+    rx.history = &rx_history;
+    rx.state   = CF_TxnState_R2;
+
+    /* the outbound ends first, the inbound goes on alone */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->state       = CF_TxnState_S2;
+    txn->cold->relay = &rx;
+    rx.cold->relay   = txn;
+    UtAssert_VOIDCALL(CF_CFDP_EndRelay(txn));
+    UtAssert_NULL(txn->cold->relay);
+    UtAssert_NULL(rx.cold->relay);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Cancel, 0);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 0);
+
+    /* the file was received, the waiting outbound resumes to send its EOF */
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_TXW] = 1;
+    txn->flags.com.q_index                                                    = CF_QueueIdx_TXW;
+    txn->state_data.send.sub_state                                            = CF_TxSubState_EOF;
+    txn->cold->relay                                                          = &rx;
+    rx.cold->relay                                                            = txn;
+    rx.keep                                                                   = 1;
+    UtAssert_VOIDCALL(CF_CFDP_EndRelay(&rx));
+    UtAssert_NULL(txn->cold->relay);
+    UtAssert_NULL(rx.cold->relay);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Cancel, 0);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 1);
+
+    /* the file was not received, the outbound is canceled */
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_TXW] = 1;
+    txn->flags.com.q_index                                                    = CF_QueueIdx_TXW;
+    txn->state_data.send.sub_state                                            = CF_TxSubState_FILEDATA;
+    txn->cold->relay                                                          = &rx;
+    rx.cold->relay                                                            = txn;
+    rx.keep                                                                   = 0;
+    UtAssert_VOIDCALL(CF_CFDP_EndRelay(&rx));
+    UtAssert_BOOL_TRUE(txn->flags.com.canceled);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Cancel, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPrio, 2);
 }
 
 static int32 Ut_Hook_StateHandler_SetQIndex(void *UserObj, int32 StubRetcode, uint32 CallCount,
@@ -1161,11 +2066,15 @@ void Test_CF_CFDP_ProcessPollingDirectories(void)
     UtAssert_BOOL_TRUE(poll->timer_set);
     UtAssert_STUB_COUNT(CF_Timer_Tick, 2);
 
-    /* call again timer should expire and start a playback */
+    /* call again timer should expire and start a playback, using the limits from the table */
+    pdcfg->max_active  = 12;
+    pdcfg->max_pending = 0;
     UT_SetDeferredRetcode(UT_KEY(CF_Timer_Expired), 1, true);
     UtAssert_VOIDCALL(CF_CFDP_ProcessPollingDirectories(chan));
     UtAssert_BOOL_FALSE(poll->timer_set);
     UtAssert_BOOL_TRUE(poll->pb.busy);
+    UtAssert_UINT32_EQ(poll->pb.max_active, 12);
+    UtAssert_UINT32_EQ(poll->pb.max_pending, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].poll_counter, 1);
 
     /* make an error occur in CF_CFDP_PlaybackDir_Initiate() */
@@ -1204,78 +2113,278 @@ void Test_CF_CFDP_ProcessPlaybackDirectory(void)
     /* Test case for:
      * void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
      */
-    CF_Transaction_t *txn;
-    CF_History_t *    history;
-    CF_Channel_t *    chan;
-    CF_ConfigTable_t *config;
-    CF_Playback_t     pb;
-    os_dirent_t       dirent[3];
-    CF_ChunkWrapper_t chunk_wrap;
+    CF_Channel_t *   chan;
+    CF_Playback_t    pb;
+    os_dirent_t      dirent[3];
+    CF_PendingFile_t pf;
 
-    memset(&chunk_wrap, 0, sizeof(chunk_wrap));
     memset(&pb, 0, sizeof(pb));
+    memset(&pf, 0, sizeof(pf));
     memset(dirent, 0, sizeof(dirent));
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, &config);
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
     CF_AppData.engine.enabled = 1;
 
-    /* diropen is true but num_ts is high so operations are restricted */
-    pb.busy    = 1;
-    pb.num_ts  = CF_NUM_TRANSACTIONS_PER_PLAYBACK + 1;
-    pb.diropen = true;
+    /* diropen is true but there are no pending file records, so the directory is not read */
+    pb.busy        = 1;
+    pb.diropen     = true;
+    pb.src_prefix  = 2;
+    pb.dst_prefix  = 3;
+    pb.dest_id     = 5;
+    pb.priority    = 4;
+    pb.cfdp_class  = CF_CFDP_CLASS_2;
+    pb.max_active  = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    pb.max_pending = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
     UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
     UtAssert_BOOL_TRUE(pb.busy);
     UtAssert_BOOL_TRUE(pb.diropen);
 
-    /*
-     * enter the loop, but error calling OS_DirectoryRead().
-     * This should end up calling OS_DirectoryClose().
-     */
-    pb.busy    = 1;
-    pb.diropen = true;
-    pb.num_ts  = 0;
-    OS_DirectoryOpen(&pb.dir_id, "ut");
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, OS_ERROR);
+    /* pending depth is used up, the directory is not read further */
+    chan->pf_free  = &pf.cl_node;
+    pb.num_pending = pb.max_pending;
     UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_BOOL_FALSE(pb.busy);
-    UtAssert_BOOL_FALSE(pb.diropen);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_BOOL_TRUE(pb.diropen);
 
     /* nominal, but path is "." or ".." ...
-     * this initially does not start a new transaction - those files are ignored.
-     * note that this does a while loop here, so have to prepare all the entries at once.
-     * After bypassing . and .. this will start a new transaction on pass 3.
-     *  - this calls CF_FindUnusedTransaction() so that must return non-NULL.
-     *  - this also calls CF_CFDP_FindUnusedChunks() and that pops an entry
+     * those files are ignored, note that this does a while loop here, so have to prepare all the
+     * entries at once.  After bypassing . and .. the valid file is queued on pass 3, without a
+     * transaction, and the directory prefixes only gain a reference.
      */
-    pb.busy    = 1;
-    pb.diropen = true;
-    pb.num_ts  = 0;
+    pb.num_pending = 0;
     strcpy(dirent[0].FileName, ".");  /* ignored */
     strcpy(dirent[1].FileName, ".."); /* ignored */
     strcpy(dirent[2].FileName, "ut"); /* valid file */
     OS_DirectoryOpen(&pb.dir_id, "ut");
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), dirent, sizeof(dirent), false);
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 4, OS_ERROR); /* end of dir */
-    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
-    chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &pf.cl_node);
     UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CF_NameTable_AddRef, 2);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 1);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 0);
     UtAssert_BOOL_TRUE(pb.busy);
     UtAssert_BOOL_FALSE(pb.diropen);
-    UtAssert_STRINGBUF_EQ(history->fnames.src_filename, sizeof(history->fnames.src_filename), "/ut", -1);
-    UtAssert_STRINGBUF_EQ(history->fnames.dst_filename, sizeof(history->fnames.dst_filename), "/ut", -1);
+    UtAssert_UINT32_EQ(pb.num_pending, 1);
+    UtAssert_ZERO(pb.num_ts);
+    UtAssert_ADDRESS_EQ(pf.pb, &pb);
+    UtAssert_UINT32_EQ(pf.src_prefix, 2);
+    UtAssert_UINT32_EQ(pf.dst_prefix, 3);
+    UtAssert_UINT32_EQ(pf.dest_id, 5);
+    UtAssert_UINT32_EQ(pf.priority, 4);
+    UtAssert_UINT32_EQ(pf.cfdp_class, CF_CFDP_CLASS_2);
+    UtAssert_UINT32_EQ(pf.seq_num, 1);
+    UtAssert_STRINGBUF_EQ(pf.leaves, sizeof(pf.leaves), "ut", -1);
+    UtAssert_BOOL_TRUE(pf.same_leaf);
     UT_CF_AssertEventID(CF_EID_INF_CFDP_S_START_SEND);
+
+    /* the directory is done, but a transfer is still in progress */
+    pb.num_pending = 0;
+    pb.num_ts      = 1;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_BOOL_TRUE(pb.busy);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 0);
+
+    /* all done, so the playback is no longer busy and gives up its prefixes */
+    pb.num_ts = 0;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_BOOL_FALSE(pb.busy);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+
+    /* already idle, nothing is released again */
+    UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+
+    /*
+     * enter the loop, but error calling OS_DirectoryRead().
+     * This should end up calling OS_DirectoryClose().
+     */
+    UT_ResetState(UT_KEY(OS_DirectoryRead));
+    pb.busy    = 1;
+    pb.diropen = true;
+    OS_DirectoryOpen(&pb.dir_id, "ut");
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 1, OS_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 1);
+    UtAssert_BOOL_FALSE(pb.busy);
+    UtAssert_BOOL_FALSE(pb.diropen);
+}
+
+static int32 Ut_Hook_WrappedRead_ManifestEntry(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                               const UT_StubContext_t *Context)
+{
+    void *buf = UT_Hook_GetArgValueByName(Context, "buf", void *);
+
+    memcpy(buf, UserObj, sizeof(CF_TxManifestEntry_t));
+
+    return StubRetcode;
+}
+
+void Test_CF_CFDP_ProcessManifest(void)
+{
+    /* Test case for:
+     * void CF_CFDP_ProcessManifest(CF_Channel_t *chan)
+     */
+    CF_Channel_t *       chan;
+    CF_Manifest_t *      mf;
+    CF_HkChannel_Data_t *hk = &CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL];
+    CF_TxManifestEntry_t rec;
+    CF_PendingFile_t     pf;
+    int                  i;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&rec, 0, sizeof(rec));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    mf = &chan->manifest;
+    memset(mf, 0, sizeof(*mf));
+
+    /* no manifest, nothing to do */
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_ZERO(hk->manifest_active);
+
+    /* valid records, limited by the pending depth */
+    mf->fileopen       = true;
+    mf->pb.busy        = 1;
+    mf->pb.keep        = 1;
+    mf->pb.max_active  = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    mf->pb.max_pending = 2;
+    chan->pf_free      = &pf.cl_node;
+    rec.cfdp_class     = CF_CFDP_CLASS_2;
+    rec.priority       = 3;
+    rec.dest_id        = 23;
+    strcpy(rec.src_filename, "src");
+    strcpy(rec.dst_filename, "dst");
+    UT_SetHookFunction(UT_KEY(CF_WrappedRead), Ut_Hook_WrappedRead_ManifestEntry, &rec);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedRead), sizeof(rec));
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 2);
+    UtAssert_STUB_COUNT(CF_NameTable_InternPath, 4);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 0);
+    UtAssert_UINT32_EQ(mf->pb.num_pending, 2);
+    UtAssert_ZERO(mf->pb.num_ts);
+    UtAssert_UINT32_EQ(hk->manifest_queued, 2);
+    UtAssert_ADDRESS_EQ(pf.pb, &mf->pb);
+    UtAssert_UINT32_EQ(pf.keep, 1);
+    UtAssert_UINT32_EQ(pf.priority, 3);
+    UtAssert_UINT32_EQ(pf.dest_id, 23);
+    UtAssert_UINT32_EQ(pf.cfdp_class, CF_CFDP_CLASS_2);
+    UtAssert_BOOL_TRUE(mf->fileopen);
+    UtAssert_UINT32_EQ(hk->manifest_active, 1);
+
+    /* pending depth used up, so nothing is read */
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 2);
+
+    /* no free pending file record, so nothing is read */
+    mf->pb.num_pending = 0;
+    chan->pf_free      = NULL;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 2);
+
+    /* no room left for the path prefixes, the record is read again later */
+    chan->pf_free = &pf.cl_node;
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 1, CF_NAME_HANDLE_INVALID);
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 3);
+    UtAssert_STUB_COUNT(CF_WrappedLseek, 1);
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+    UtAssert_UINT32_EQ(hk->manifest_queued, 2);
+    UtAssert_ZERO(hk->manifest_skipped);
+    UtAssert_BOOL_TRUE(mf->fileopen);
+
+    /* invalid records are skipped, limited by the number of reads per cycle */
+    mf->pb.max_pending = CF_NUM_TRANSACTIONS_PER_PLAYBACK;
+    for (i = 0; i < 4; ++i)
+    {
+        memset(&rec, 0, sizeof(rec));
+        switch (i)
+        {
+            case 0:
+                rec.cfdp_class = 10;
+                break;
+            case 1:
+                rec.cfdp_class = CF_CFDP_CLASS_1;
+                strcpy(rec.dst_filename, "dst");
+                break;
+            case 2:
+                rec.cfdp_class = CF_CFDP_CLASS_1;
+                strcpy(rec.src_filename, "src");
+                break;
+            default:
+                /* a file for this entity itself */
+                rec.cfdp_class = CF_CFDP_CLASS_1;
+                rec.dest_id    = CF_AppData.config_table->local_eid;
+                strcpy(rec.src_filename, "src");
+                strcpy(rec.dst_filename, "dst");
+                break;
+        }
+        hk->manifest_skipped = 0;
+        UT_ResetState(UT_KEY(CF_WrappedRead));
+        UT_SetHookFunction(UT_KEY(CF_WrappedRead), Ut_Hook_WrappedRead_ManifestEntry, &rec);
+        UT_SetDefaultReturnValue(UT_KEY(CF_WrappedRead), sizeof(rec));
+        UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+        UtAssert_STUB_COUNT(CF_WrappedRead, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
+        UtAssert_UINT32_EQ(hk->manifest_skipped, CF_NUM_TRANSACTIONS_PER_PLAYBACK);
+        UtAssert_ZERO(mf->pb.num_pending);
+        UtAssert_BOOL_TRUE(mf->fileopen);
+    }
+    UtAssert_STUB_COUNT(CF_InsertSortPendingFile, 2);
+
+    /* partial record, counted as a read fault and ends the manifest */
+    UT_ResetState(UT_KEY(CF_WrappedRead));
+    hk->manifest_skipped = 0;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, sizeof(rec) - 1);
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_UINT32_EQ(hk->counters.fault.file_read, 1);
+    UtAssert_UINT32_EQ(hk->manifest_skipped, 1);
+    UtAssert_BOOL_FALSE(mf->fileopen);
+    UtAssert_BOOL_FALSE(mf->pb.busy);
+    UtAssert_ZERO(hk->manifest_active);
+    UT_CF_AssertEventID(CF_EID_INF_CFDP_MANIFEST_DONE);
+
+    /* end of the manifest with transfers still in progress, stays busy until they finish */
+    UT_ResetState(UT_KEY(CF_WrappedRead));
+    UT_CF_ResetEventCapture();
+    mf->fileopen  = true;
+    mf->pb.busy   = 1;
+    mf->pb.num_ts = 1;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 2);
+    UtAssert_UINT32_EQ(hk->counters.fault.file_read, 1);
+    UtAssert_BOOL_FALSE(mf->fileopen);
+    UtAssert_BOOL_TRUE(mf->pb.busy);
+    UtAssert_UINT32_EQ(hk->manifest_active, 1);
+    UT_CF_AssertEventID(CF_EID_INF_CFDP_MANIFEST_DONE);
+
+    /* files still waiting on the pending queue also keep it busy */
+    mf->pb.num_ts      = 0;
+    mf->pb.num_pending = 1;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_BOOL_TRUE(mf->pb.busy);
+
+    mf->pb.num_pending = 0;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessManifest(chan));
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+    UtAssert_BOOL_FALSE(mf->pb.busy);
+    UtAssert_ZERO(hk->manifest_active);
 }
 
 static int32 Ut_Hook_TickTransactions_SetEarlyExit(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                                    const UT_StubContext_t *Context)
 {
-    CF_CFDP_Tick_args_t *args = UT_Hook_GetArgValueByName(Context, "context", CF_CFDP_Tick_args_t *);
+    CF_Transaction_t *txn = UT_Hook_GetArgValueByName(Context, "txn", CF_Transaction_t *);
 
-    /* set flag on the second call */
-    if ((CallCount & 1) == 1)
+    /* the first tick runs out of outgoing messages, so the channel picks up from it next time */
+    if (CallCount == 1)
     {
-        args->early_exit = 1;
+        CF_AppData.engine.channels[txn->chan_num].cur = txn;
     }
 
     return StubRetcode;
@@ -1284,12 +2393,12 @@ static int32 Ut_Hook_TickTransactions_SetEarlyExit(void *UserObj, int32 StubRetc
 static int32 Ut_Hook_TickTransactions_SetCont(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                               const UT_StubContext_t *Context)
 {
-    CF_CFDP_Tick_args_t *args = UT_Hook_GetArgValueByName(Context, "context", CF_CFDP_Tick_args_t *);
+    int *cont = UT_Hook_GetArgValueByName(Context, "cont", int *);
 
-    /* every other call do not set "cont" flag */
-    if ((CallCount & 1) == 0)
+    /* the first tick asks for the queue to be walked again */
+    if (CallCount == 1)
     {
-        args->cont = 1;
+        *cont = 1;
     }
 
     return StubRetcode;
@@ -1301,29 +2410,64 @@ void Test_CF_CFDP_TickTransactions(void)
         void CF_CFDP_TickTransactions(CF_Channel_t *chan);
      */
 
-    CF_Channel_t *chan;
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
+    CF_Transaction_t  rx;
 
-    /* nominal */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, NULL);
+    memset(&rx, 0, sizeof(rx));
+
+    /* nominal, nothing to tick */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_R_Tick, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick, 0);
+    UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_RX);
+
+    /* one transaction on each of RX and TXW, every tick type runs once */
+    txn->chan_num             = UT_CFDP_CHANNEL;
+    txn->cl_node.next         = &txn->cl_node;
+    txn->cl_node.prev         = &txn->cl_node;
+    rx.chan_num               = UT_CFDP_CHANNEL;
+    rx.cl_node.next           = &rx.cl_node;
+    rx.cl_node.prev           = &rx.cl_node;
+    chan->qs[CF_QueueIdx_RX]  = &rx.cl_node;
+    chan->qs[CF_QueueIdx_TXW] = &txn->cl_node;
     UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, CF_TickType_NUM_TYPES);
+    UtAssert_STUB_COUNT(CF_CFDP_R_Tick, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick_Nak, 1);
     UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_RX);
 
-    /* invoke "early exit" block via hook */
-    /* The flag is set on the second call, so this should increment tick_type */
-    UT_ResetState(UT_KEY(CF_CList_Traverse));
-    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_TickTransactions_SetEarlyExit, NULL);
+    /* out of messages during the TXW ticks, so the tick type is kept */
+    UT_ResetState(UT_KEY(CF_CFDP_S_Tick));
+    UT_SetHookFunction(UT_KEY(CF_CFDP_S_Tick), Ut_Hook_TickTransactions_SetEarlyExit, NULL);
     UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
     UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_TXW_NORM);
+    UtAssert_ADDRESS_EQ(chan->cur, txn);
+    UtAssert_STUB_COUNT(CF_CFDP_R_Tick, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick_Nak, 1);
 
     /* this should resume where it left from the last call,
      * and then reset the tick_type  */
     UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
     UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_RX);
+    UtAssert_NULL(chan->cur);
+    UtAssert_STUB_COUNT(CF_CFDP_R_Tick, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Tick_Nak, 2);
+
+    /* out of messages during the NAK responses, the next cycle starts again from RX */
+    UT_ResetState(UT_KEY(CF_CFDP_S_Tick_Nak));
+    UT_SetHookFunction(UT_KEY(CF_CFDP_S_Tick_Nak), Ut_Hook_TickTransactions_SetEarlyExit, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
+    UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_RX);
+    chan->cur = NULL;
 
-    UT_ResetState(UT_KEY(CF_CList_Traverse));
-    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_TickTransactions_SetCont, NULL);
+    /* a tick asks for the queue to be walked again */
+    UT_ResetState(UT_KEY(CF_CFDP_R_Tick));
+    UT_SetHookFunction(UT_KEY(CF_CFDP_R_Tick), Ut_Hook_TickTransactions_SetCont, NULL);
     UtAssert_VOIDCALL(CF_CFDP_TickTransactions(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_R_Tick, 2);
     UtAssert_UINT32_EQ(chan->tick_type, CF_TickType_RX);
 }
 
@@ -1342,9 +2486,14 @@ void Test_CF_CFDP_CycleEngine(void)
     CF_AppData.engine.enabled                                = 1;
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen = 1;
     UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
+    UtAssert_STUB_COUNT(CF_CFDP_TransportCycle, CF_NUM_CHANNELS);
 
-    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen = 0;
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen   = 0;
+    CF_AppData.config_table->chan[UT_CFDP_CHANNEL].sem_wait_ms = 5;
+    chan->sem_wait_left_ms                                     = 0;
     UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
+    UtAssert_STUB_COUNT(CF_CFDP_TransportCycle, 2 * CF_NUM_CHANNELS);
+    UtAssert_UINT32_EQ(chan->sem_wait_left_ms, 5);
 }
 
 void Test_CF_CFDP_ResetTransaction(void)
@@ -1353,10 +2502,13 @@ void Test_CF_CFDP_ResetTransaction(void)
      * void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, int keep_history)
      */
 
-    CF_Transaction_t *txn;
-    CF_History_t *    history;
-    CF_Channel_t *    chan;
-    CF_Playback_t     pb;
+    CF_Transaction_t *   txn;
+    CF_History_t *       history;
+    CF_Channel_t *       chan;
+    CF_Playback_t        pb;
+    CF_TxGroup_t         group;
+    CF_Transaction_t     txn2;
+    CF_TransactionCold_t txn2_cold;
 
     memset(&pb, 0, sizeof(pb));
 
@@ -1371,14 +2523,19 @@ void Test_CF_CFDP_ResetTransaction(void)
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[txn->flags.com.q_index] = 10;
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
     UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+    UtAssert_STUB_COUNT(CF_Perf_RecordLatency, 1);
 
+    /* only a kept history goes to the channel history ring */
     UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_HistoryRing_Add));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, &history, &txn, NULL);
-    txn->fd      = OS_ObjectIdFromInteger(1);
-    history->dir = CF_Direction_TX;
-    txn->state   = CF_TxnState_S1;
+    txn->cold->fd = OS_ObjectIdFromInteger(1);
+    history->dir  = CF_Direction_TX;
+    txn->state    = CF_TxnState_S1;
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
+    UtAssert_STUB_COUNT(CF_HistoryRing_Add, 1);
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 0));
+    UtAssert_STUB_COUNT(CF_HistoryRing_Add, 1);
     UtAssert_STUB_COUNT(CF_FreeTransaction, 2);
 
     /* Transmit with move_dir set, without '/' in filename */
@@ -1407,19 +2564,19 @@ void Test_CF_CFDP_ResetTransaction(void)
 
     UT_ResetState(UT_KEY(CF_FreeTransaction));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, &history, &txn, NULL);
-    txn->fd      = OS_ObjectIdFromInteger(1);
-    history->dir = CF_Direction_RX;
-    txn->state   = CF_TxnState_R1;
+    txn->cold->fd = OS_ObjectIdFromInteger(1);
+    history->dir  = CF_Direction_RX;
+    txn->state    = CF_TxnState_R1;
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 0));
     UtAssert_STUB_COUNT(CF_FreeTransaction, 2);
 
     UT_ResetState(UT_KEY(CF_FreeTransaction));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    txn->fd      = OS_ObjectIdFromInteger(1);
-    history->dir = CF_Direction_TX;
-    txn->keep    = 1;
-    txn->state   = CF_TxnState_S1;
+    txn->cold->fd = OS_ObjectIdFromInteger(1);
+    history->dir  = CF_Direction_TX;
+    txn->keep     = 1;
+    txn->state    = CF_TxnState_S1;
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 0));
     UtAssert_STUB_COUNT(CF_FreeTransaction, 2);
@@ -1432,7 +2589,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     UT_ResetState(UT_KEY(CF_FreeTransaction));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
     pb.num_ts            = 10;
-    txn->pb              = &pb;
+    txn->cold->pb        = &pb;
     chan->cur            = txn;
     txn->flags.tx.cmd_tx = 5;
     chan->num_cmd_tx     = 8;
@@ -1443,6 +2600,52 @@ void Test_CF_CFDP_ResetTransaction(void)
     UtAssert_UINT32_EQ(pb.num_ts, 9);
     UtAssert_UINT32_EQ(chan->num_cmd_tx, 7);
     UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+
+    /* member of a transmit group, leaves the group but the shared file stays open for the others */
+    UT_ResetState(UT_KEY(CF_WrappedClose));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, &history, &txn, NULL);
+    memset(&group, 0, sizeof(group));
+    group.fd          = OS_ObjectIdFromInteger(1);
+    group.num_refs    = 2;
+    group.num_members = 2;
+    group.members[0]  = txn;
+    group.members[1]  = &txn2;
+    txn->cold->group  = &group;
+    history->dir      = CF_Direction_TX;
+    txn->state        = CF_TxnState_S2;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
+    UtAssert_NULL(txn->cold->group);
+    UtAssert_UINT32_EQ(group.num_refs, 1);
+    UtAssert_UINT32_EQ(group.num_members, 1);
+    UtAssert_ADDRESS_EQ(group.members[0], &txn2);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
+
+    /* a class 1 send with parity gives back its encoder */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, &history, &txn, NULL);
+    CF_AppData.engine.fec_encoders[0].in_use = true;
+    txn->state_data.send.fec                 = &CF_AppData.engine.fec_encoders[0];
+    history->dir                             = CF_Direction_TX;
+    txn->state                               = CF_TxnState_S1;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
+    UtAssert_NULL(txn->state_data.send.fec);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.fec_encoders[0].in_use);
+
+    /* a relayed file that was not received, the outbound is unbound and canceled */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, &history, &txn, NULL);
+    memset(&txn2, 0, sizeof(txn2));
+    memset(&txn2_cold, 0, sizeof(txn2_cold));
+    txn2.cold              = &txn2_cold;
+    txn2.history           = history;
+    txn2.state             = CF_TxnState_S2;
+    txn2.flags.com.q_index = CF_QueueIdx_TXA;
+    txn2.cold->relay       = txn;
+    txn->cold->relay       = &txn2;
+    history->dir           = CF_Direction_RX;
+    txn->state             = CF_TxnState_R2;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, 1));
+    UtAssert_NULL(txn2.cold->relay);
+    UtAssert_BOOL_TRUE(txn2.flags.com.canceled);
+    UtAssert_STUB_COUNT(CF_CFDP_S_Cancel, 1);
 }
 
 void Test_CF_CFDP_SetTxnStatus(void)
@@ -1503,6 +2706,188 @@ void Test_CF_CFDP_SendEotPkt(void)
     UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
 }
 
+static void UT_AltHandler_CFE_TIME_Subtract(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *elapsed);
+}
+
+void Test_CF_CFDP_FillTxnTlmEntry(void)
+{
+    /* Test case for:
+     * void CF_CFDP_FillTxnTlmEntry(CF_Transaction_t *txn, CF_TxnTlm_Entry_t *entry, CFE_TIME_SysTime_t now);
+     */
+    CF_Transaction_t * txn;
+    CF_History_t *     history;
+    CF_ChunkWrapper_t  chunks;
+    CF_TxnTlm_Entry_t  entry;
+    CFE_TIME_SysTime_t now;
+    CFE_TIME_SysTime_t elapsed;
+
+    memset(&chunks, 0, sizeof(chunks));
+    memset(&now, 0, sizeof(now));
+    memset(&elapsed, 0, sizeof(elapsed));
+    now.Seconds = 1000;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract, &elapsed);
+
+    /* first report of a class 2 sender, rate is not known yet */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, &history, &txn, NULL);
+    history->seq_num                     = 12;
+    history->src_eid                     = 34;
+    history->peer_eid                    = 56;
+    history->dir                         = CF_Direction_TX;
+    txn->chunks                          = &chunks;
+    txn->state                           = CF_TxnState_S2;
+    txn->state_data.send.sub_state       = CF_TxSubState_FILEDATA;
+    txn->fsize                           = 1000;
+    txn->foffs                           = 400;
+    txn->flags.com.suspended             = true;
+    txn->cold->progress.file_data_bytes  = 500;
+    txn->cold->progress.retransmit_bytes = 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_TotalSize), 1, 60);
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.seq_num, 12);
+    UtAssert_UINT32_EQ(entry.src_eid, 34);
+    UtAssert_UINT32_EQ(entry.peer_eid, 56);
+    UtAssert_UINT32_EQ(entry.direction, CF_Direction_TX);
+    UtAssert_UINT32_EQ(entry.state, CF_TxnState_S2);
+    UtAssert_UINT32_EQ(entry.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_UINT32_EQ(entry.suspended, 1);
+    UtAssert_UINT32_EQ(entry.fsize, 1000);
+    UtAssert_UINT32_EQ(entry.progress_bytes, 400);
+    UtAssert_UINT32_EQ(entry.gap_bytes, 60);
+    UtAssert_UINT32_EQ(entry.retransmit_bytes, 100);
+    UtAssert_ZERO(entry.rate);
+    UtAssert_ZERO(entry.time_in_state);
+    UtAssert_BOOL_TRUE(txn->cold->progress.reported);
+    UtAssert_UINT32_EQ(txn->cold->progress.rate_bytes, 500);
+    UtAssert_UINT32_EQ(txn->cold->progress.state_time.Seconds, 1000);
+
+    /* next report two seconds later, same sub state */
+    txn->cold->progress.file_data_bytes += 2000;
+    elapsed.Seconds = 2;
+    now.Seconds     = 1002;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.rate, 1000);
+    UtAssert_UINT32_EQ(entry.time_in_state, 2);
+    UtAssert_UINT32_EQ(txn->cold->progress.state_time.Seconds, 1000);
+    UtAssert_UINT32_EQ(txn->cold->progress.rate_time.Seconds, 1002);
+
+    /* sub state changed, time in state restarts */
+    txn->state_data.send.sub_state = CF_TxSubState_EOF;
+    now.Seconds                    = 1004;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_ZERO(entry.rate);
+    UtAssert_UINT32_EQ(txn->cold->progress.state_time.Seconds, 1004);
+    UtAssert_UINT32_EQ(txn->cold->progress.sub_state, CF_TxSubState_EOF);
+
+    /* no time elapsed, rate is left at zero */
+    elapsed.Seconds = 0;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_ZERO(entry.rate);
+
+    /* class 2 receiver before EOF, only holes below the highest offset count */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks = &chunks;
+    txn->state  = CF_TxnState_R2;
+    txn->fsize  = 1000;
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_TotalSize), 1, 300);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_GetEnd), 1, 500);
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.progress_bytes, 300);
+    UtAssert_UINT32_EQ(entry.gap_bytes, 200);
+
+    /* class 2 receiver after EOF, everything not received is a gap */
+    txn->flags.rx.eof_recv = true;
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_TotalSize), 1, 300);
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.gap_bytes, 700);
+
+    /* class 2 receiver with all data */
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_TotalSize), 1, 1000);
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_ZERO(entry.gap_bytes);
+
+    /* class 1 sender */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->state = CF_TxnState_S1;
+    txn->foffs = 250;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.progress_bytes, 250);
+    UtAssert_ZERO(entry.gap_bytes);
+
+    /* sizes and counts of a file of 4 GiB or more are kept whole */
+    txn->fsize                          = 0x180000000;
+    txn->foffs                          = 0x140000000;
+    txn->cold->progress.file_data_bytes = 0x140000000;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_True(entry.fsize == 0x180000000, "fsize (%llx) == 0x180000000", (unsigned long long)entry.fsize);
+    UtAssert_True(entry.progress_bytes == 0x140000000, "progress_bytes (%llx) == 0x140000000",
+                  (unsigned long long)entry.progress_bytes);
+
+    /* class 1 receiver */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->state                          = CF_TxnState_R1;
+    txn->cold->progress.file_data_bytes = 150;
+    UtAssert_VOIDCALL(CF_CFDP_FillTxnTlmEntry(txn, &entry, now));
+    UtAssert_UINT32_EQ(entry.progress_bytes, 150);
+    UtAssert_ZERO(entry.gap_bytes);
+}
+
+void Test_CF_CFDP_AddTxnTlm(void)
+{
+    /* Test case for:
+     * CF_CListTraverse_Status_t CF_CFDP_AddTxnTlm(CF_CListNode_t *node, void *context);
+     */
+    CF_Transaction_t *    txn;
+    CF_CFDP_TxnTlm_args_t args;
+    CF_TxnTlmPacket_t     PktBuf;
+    CF_TxnTlmPacket_t *   PktBufPtr;
+
+    memset(&args, 0, sizeof(args));
+    args.chan = UT_CFDP_CHANNEL;
+
+    /* no buffer available, transaction is left out */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_AddTxnTlm(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_NULL(args.buf);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+
+    /* first entry starts a packet */
+    PktBufPtr = &PktBuf;
+    memset(PktBufPtr, 0xFF, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UtAssert_INT32_EQ(CF_CFDP_AddTxnTlm(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_ADDRESS_EQ(args.pkt, &PktBuf);
+    UtAssert_UINT32_EQ(PktBuf.Payload.channel, UT_CFDP_CHANNEL);
+    UtAssert_UINT32_EQ(PktBuf.Payload.num_txns, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+
+    /* last entry that fits sends the packet */
+    PktBuf.Payload.num_txns = CF_TXN_TLM_MAX_ENTRIES - 1;
+    UtAssert_INT32_EQ(CF_CFDP_AddTxnTlm(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_UINT32_EQ(PktBuf.Payload.num_txns, CF_TXN_TLM_MAX_ENTRIES);
+    UtAssert_NULL(args.buf);
+    UtAssert_NULL(args.pkt);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+}
+
+void Test_CF_CFDP_SendTxnTlm(void)
+{
+    /* Test case for:
+     * void CF_CFDP_SendTxnTlm(void);
+     */
+
+    /* nothing active, nothing sent */
+    UtAssert_VOIDCALL(CF_CFDP_SendTxnTlm());
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 3 * CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
 void Test_CF_CFDP_DisableEngine(void)
 {
     /* Test case for:
@@ -1513,6 +2898,7 @@ void Test_CF_CFDP_DisableEngine(void)
     CF_AppData.engine.enabled = 1;
     UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
     UtAssert_STUB_COUNT(CFE_SB_DeletePipe, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_CFDP_TransportClose, CF_NUM_CHANNELS);
     UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
 
     /* nominal call with playbacks and polls active */
@@ -1522,6 +2908,19 @@ void Test_CF_CFDP_DisableEngine(void)
     OS_DirectoryOpen(&CF_AppData.engine.channels[UT_CFDP_CHANNEL].poll[0].pb.dir_id, "ut");
     UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
     UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
+
+    /* nominal call with a manifest open */
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].manifest.fileopen     = true;
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].manifest_active = 1;
+    UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].manifest_active);
+
+    /* nominal call with a transmit group holding its shared file open */
+    CF_AppData.engine.tx_groups[0].num_refs = 1;
+    CF_AppData.engine.tx_groups[0].fd       = OS_ObjectIdFromInteger(1);
+    UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
+    UtAssert_STUB_COUNT(CF_WrappedClose, 2);
 }
 
 void Test_CF_CFDP_CloseFiles(void)
@@ -1537,7 +2936,7 @@ void Test_CF_CFDP_CloseFiles(void)
 
     /* nominal call, w/ file */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    txn->fd = OS_ObjectIdFromInteger(1);
+    txn->cold->fd = OS_ObjectIdFromInteger(1);
     UtAssert_INT32_EQ(CF_CFDP_CloseFiles(&txn->cl_node, NULL), CF_CLIST_CONT);
 }
 
@@ -1572,7 +2971,17 @@ void UtTest_Setup(void)
                "Test_CF_CFDP_ProcessPlaybackDirectory");
     UtTest_Add(Test_CF_CFDP_ProcessPollingDirectories, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "Test_CF_CFDP_ProcessPollingDirectories");
+    UtTest_Add(Test_CF_CFDP_ProcessManifest, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "Test_CF_CFDP_ProcessManifest");
     UtTest_Add(Test_CF_CFDP_CycleTx, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "Test_CF_CFDP_CycleTx");
+    UtTest_Add(Test_CF_CFDP_FindStartablePending, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_FindStartablePending");
+    UtTest_Add(Test_CF_CFDP_StartPendingFile, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_StartPendingFile");
+    UtTest_Add(Test_CF_CFDP_DropPendingFile, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DropPendingFile");
+    UtTest_Add(Test_CF_CFDP_StartRelay, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_StartRelay");
+    UtTest_Add(Test_CF_CFDP_WakeRelay, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_WakeRelay");
+    UtTest_Add(Test_CF_CFDP_EndRelay, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_EndRelay");
     UtTest_Add(Test_CF_CFDP_CycleTxFirstActive, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "Test_CF_CFDP_CycleTxFirstActive");
     UtTest_Add(Test_CF_CFDP_DoTick, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DoTick");
@@ -1580,6 +2989,9 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_ResetTransaction, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ResetTransaction");
     UtTest_Add(Test_CF_CFDP_SetTxnStatus, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SetTxnStatus");
     UtTest_Add(Test_CF_CFDP_SendEotPkt, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "Test_CF_CFDP_SendEotPkt");
+    UtTest_Add(Test_CF_CFDP_FillTxnTlmEntry, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_FillTxnTlmEntry");
+    UtTest_Add(Test_CF_CFDP_AddTxnTlm, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_AddTxnTlm");
+    UtTest_Add(Test_CF_CFDP_SendTxnTlm, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendTxnTlm");
     UtTest_Add(Test_CF_CFDP_CancelTransaction, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "CF_CFDP_CancelTransaction");
     UtTest_Add(Test_CF_CFDP_DisableEngine, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DisableEngine");
@@ -1587,7 +2999,9 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_CancelTransaction, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "CF_CFDP_CancelTransaction");
     UtTest_Add(Test_CF_CFDP_TxFile, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TxFile");
+    UtTest_Add(Test_CF_CFDP_TxFileMulti, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TxFileMulti");
     UtTest_Add(Test_CF_CFDP_PlaybackDir, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_PlaybackDir");
+    UtTest_Add(Test_CF_CFDP_TxManifest, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TxManifest");
     UtTest_Add(Test_CF_CFDP_ArmAckTimer, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ArmAckTimer");
 
     UtTest_Add(Test_CF_CFDP_CF_CFDP_EncodeStart, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
@@ -1601,6 +3015,7 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_RecvMd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvMd");
     UtTest_Add(Test_CF_CFDP_RecvFd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvFd");
     UtTest_Add(Test_CF_CFDP_RecvEof, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvEof");
+    UtTest_Add(Test_CF_CFDP_RecvParity, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvParity");
     UtTest_Add(Test_CF_CFDP_RecvAck, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvAck");
     UtTest_Add(Test_CF_CFDP_RecvFin, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvFin");
     UtTest_Add(Test_CF_CFDP_RecvNak, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvNak");
@@ -1611,6 +3026,7 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_SendMd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendMd");
     UtTest_Add(Test_CF_CFDP_SendFd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendFd");
     UtTest_Add(Test_CF_CFDP_SendEof, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendEof");
+    UtTest_Add(Test_CF_CFDP_SendParity, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendParity");
     UtTest_Add(Test_CF_CFDP_SendAck, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendAck");
     UtTest_Add(Test_CF_CFDP_SendFin, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendFin");
     UtTest_Add(Test_CF_CFDP_SendNak, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendNak");
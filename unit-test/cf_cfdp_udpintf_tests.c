@@ -0,0 +1,237 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_cfdp_sbintf.h"
+#include "cf_cfdp_udpintf.h"
+
+/*******************************************************************************
+**
+**  cf_cfdp_udpintf_tests local utility functions
+**
+*******************************************************************************/
+
+static void UT_CFDP_UDP_SetupBasicTestState(CF_Channel_t **chan_p)
+{
+    static CF_ConfigTable_t ut_config_table;
+
+    memset(&ut_config_table, 0, sizeof(ut_config_table));
+    CF_AppData.config_table = &ut_config_table;
+
+    /* must be a member of the channel array, the channel number is found by pointer arithmetic */
+    *chan_p = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+}
+
+/*
+ * Hook for OS_SocketAddrSetPort, keeps the ports in call order
+ */
+static int32 UT_Hook_OS_SocketAddrSetPort(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                          const UT_StubContext_t *Context)
+{
+    uint16 *ports = UserObj;
+
+    if (CallCount <= 2)
+    {
+        ports[CallCount - 1] = UT_Hook_GetArgValueByName(Context, "PortNum", uint16);
+    }
+
+    return StubRetcode;
+}
+
+/*******************************************************************************
+**
+**  cf_cfdp_udpintf_tests Setup and Teardown
+**
+*******************************************************************************/
+
+void cf_cfdp_udpintf_tests_Setup(void)
+{
+    cf_tests_Setup();
+
+    /*
+     * Also clear the app global. No test case should depend on data
+     * previously left in here.
+     */
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+}
+
+void cf_cfdp_udpintf_tests_Teardown(void)
+{
+    cf_tests_Teardown();
+}
+
+/*******************************************************************************
+**
+**  Test cases
+**
+*******************************************************************************/
+
+void Test_CF_CFDP_UDP_Open(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_UDP_Open(CF_Channel_t *chan)
+     */
+    CF_Channel_t *      chan;
+    CF_ChannelConfig_t *cc;
+    uint16              ports[2];
+
+    /* nominal, the peer then the local port come from the channel configuration */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    cc = &CF_AppData.config_table->chan[UT_CFDP_CHANNEL];
+    strncpy(cc->udp_peer_addr, "192.168.1.10", sizeof(cc->udp_peer_addr));
+    cc->udp_local_port = 6000;
+    cc->udp_peer_port  = 6001;
+    memset(ports, 0, sizeof(ports));
+    UT_SetHookFunction(UT_KEY(OS_SocketAddrSetPort), UT_Hook_OS_SocketAddrSetPort, ports);
+    UtAssert_INT32_EQ(CF_CFDP_UDP_Open(chan), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_SocketAddrFromString, 1);
+    UtAssert_STUB_COUNT(OS_SocketAddrSetPort, 2);
+    UtAssert_UINT32_EQ(ports[0], 6001);
+    UtAssert_UINT32_EQ(ports[1], 6000);
+    UtAssert_STUB_COUNT(OS_SocketBind, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* peer address is not valid, no socket is opened */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketAddrFromString), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_UDP_Open(chan), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_SocketOpen, 1);
+
+    /* socket cannot be opened */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketOpen), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_UDP_Open(chan), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_SocketBind, 1);
+
+    /* socket cannot be bound, so it is closed again */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketBind), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_UDP_Open(chan), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(chan->udp_sock));
+}
+
+void Test_CF_CFDP_UDP_Close(void)
+{
+    /* Test case for:
+     * void CF_CFDP_UDP_Close(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    /* never opened */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    chan->udp_sock = OS_OBJECT_ID_UNDEFINED;
+    UtAssert_VOIDCALL(CF_CFDP_UDP_Close(chan));
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* nominal */
+    chan->udp_sock = OS_ObjectIdFromInteger(1);
+    UtAssert_VOIDCALL(CF_CFDP_UDP_Close(chan));
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(chan->udp_sock));
+}
+
+void Test_CF_CFDP_UDP_GetBuffer(void)
+{
+    /* Test case for:
+     * CFE_SB_Buffer_t *CF_CFDP_UDP_GetBuffer(CF_Channel_t *chan, bool silent)
+     */
+    CF_Channel_t *chan;
+
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UtAssert_ADDRESS_EQ(CF_CFDP_UDP_GetBuffer(chan, false), &CF_AppData.engine.udp_tx_buf.buf);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+}
+
+void Test_CF_CFDP_UDP_Transmit(void)
+{
+    /* Test case for:
+     * void CF_CFDP_UDP_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+     */
+    CF_Channel_t * chan;
+    CFE_MSG_Size_t msg_size = 100;
+
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketSendTo), msg_size);
+    UtAssert_VOIDCALL(CF_CFDP_UDP_Transmit(chan, &CF_AppData.engine.udp_tx_buf.buf));
+    UtAssert_STUB_COUNT(OS_SocketSendTo, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.transport_send, 0);
+
+    /* send fails */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketSendTo), 1, OS_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_UDP_Transmit(chan, &CF_AppData.engine.udp_tx_buf.buf));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.transport_send, 1);
+
+    /* datagram is cut short */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketSendTo), 1, msg_size - 1);
+    UtAssert_VOIDCALL(CF_CFDP_UDP_Transmit(chan, &CF_AppData.engine.udp_tx_buf.buf));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.transport_send, 2);
+}
+
+void Test_CF_CFDP_UDP_ReceiveBatch(void)
+{
+    /* Test case for:
+     * uint32 CF_CFDP_UDP_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+     */
+    CF_Channel_t *   chan;
+    CFE_SB_Buffer_t *bufs[CF_PDU_RX_BATCH_SIZE + 1];
+
+    /* nothing pending */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UtAssert_UINT32_EQ(CF_CFDP_UDP_ReceiveBatch(chan, bufs, 2), 0);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 1);
+
+    /* one good datagram, then one too short for a header, then nothing */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketRecvFrom), 1, sizeof(CFE_MSG_CommandHeader_t) + 10);
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketRecvFrom), 1, 2);
+    UtAssert_UINT32_EQ(CF_CFDP_UDP_ReceiveBatch(chan, bufs, CF_PDU_RX_BATCH_SIZE), 1);
+    UtAssert_ADDRESS_EQ(bufs[0], &CF_AppData.engine.udp_rx_buf[0].buf);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 4);
+
+    /* batch cannot be larger than the receive buffers */
+    UT_CFDP_UDP_SetupBasicTestState(&chan);
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketRecvFrom), sizeof(CFE_MSG_CommandHeader_t));
+    UtAssert_UINT32_EQ(CF_CFDP_UDP_ReceiveBatch(chan, bufs, CF_PDU_RX_BATCH_SIZE + 1), CF_PDU_RX_BATCH_SIZE);
+    UtAssert_ADDRESS_EQ(bufs[CF_PDU_RX_BATCH_SIZE - 1], &CF_AppData.engine.udp_rx_buf[CF_PDU_RX_BATCH_SIZE - 1].buf);
+}
+
+/*******************************************************************************
+**
+**  cf_cfdp_udpintf_tests UtTest_Setup
+**
+*******************************************************************************/
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CF_CFDP_UDP_Open, cf_cfdp_udpintf_tests_Setup, cf_cfdp_udpintf_tests_Teardown, "CF_CFDP_UDP_Open");
+    UtTest_Add(Test_CF_CFDP_UDP_Close, cf_cfdp_udpintf_tests_Setup, cf_cfdp_udpintf_tests_Teardown,
+               "CF_CFDP_UDP_Close");
+    UtTest_Add(Test_CF_CFDP_UDP_GetBuffer, cf_cfdp_udpintf_tests_Setup, cf_cfdp_udpintf_tests_Teardown,
+               "CF_CFDP_UDP_GetBuffer");
+    UtTest_Add(Test_CF_CFDP_UDP_Transmit, cf_cfdp_udpintf_tests_Setup, cf_cfdp_udpintf_tests_Teardown,
+               "CF_CFDP_UDP_Transmit");
+    UtTest_Add(Test_CF_CFDP_UDP_ReceiveBatch, cf_cfdp_udpintf_tests_Setup, cf_cfdp_udpintf_tests_Teardown,
+               "CF_CFDP_UDP_ReceiveBatch");
+}
@@ -348,6 +348,27 @@ void Test_CF_Chunk_ComputeGaps(void)
     UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 3);
 }
 
+void Test_CF_Chunk_GetEndTotalSize(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[4];
+
+    /* Initialize list (note already tested) */
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+
+    /* Empty list */
+    UtAssert_UINT32_EQ(CF_ChunkList_GetEnd(&clist), 0);
+    UtAssert_UINT32_EQ(CF_ChunkList_TotalSize(&clist), 0);
+
+    /* Add three (already tested) */
+    CF_ChunkListAdd(&clist, 10, 5);
+    CF_ChunkListAdd(&clist, 0, 5);
+    CF_ChunkListAdd(&clist, 30, 20);
+
+    UtAssert_UINT32_EQ(CF_ChunkList_GetEnd(&clist), 50);
+    UtAssert_UINT32_EQ(CF_ChunkList_TotalSize(&clist), 30);
+}
+
 /* Add tests */
 void UtTest_Setup(void)
 {
@@ -355,5 +376,6 @@ void UtTest_Setup(void)
     TEST_CF_ADD(Test_CF_Chunk_CreateAddReset);
     TEST_CF_ADD(Test_CF_Chunk_Combine);
     TEST_CF_ADD(Test_CF_Chunk_GetRmFirst);
+    TEST_CF_ADD(Test_CF_Chunk_GetEndTotalSize);
     TEST_CF_ADD(Test_CF_Chunk_ComputeGaps);
 }
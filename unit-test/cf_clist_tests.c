@@ -323,6 +323,71 @@ void Test_CF_CList_Traverse_R(void)
     UtAssert_INT32_EQ(context, -2);
 }
 
+void Test_CF_CListIter(void)
+{
+    CF_CListNode_t  node[3];
+    CF_CListNode_t *head;
+    CF_CListNode_t *cur;
+    CF_CListIter_t  iter;
+    int             count;
+
+    memset(node, 0, sizeof(node));
+
+    /* Null list is not walked */
+    count = 0;
+    CF_CLIST_FOREACH(iter, cur, NULL)
+    {
+        ++count;
+    }
+    UtAssert_INT32_EQ(count, 0);
+    CF_CLIST_FOREACH_R(iter, cur, NULL)
+    {
+        ++count;
+    }
+    UtAssert_INT32_EQ(count, 0);
+
+    /* Three nodes, in order each way */
+    node[0].next = &node[1];
+    node[1].next = &node[2];
+    node[2].next = &node[0];
+    node[0].prev = &node[2];
+    node[1].prev = &node[0];
+    node[2].prev = &node[1];
+    head         = node;
+    CF_CLIST_FOREACH(iter, cur, head)
+    {
+        UtAssert_ADDRESS_EQ(cur, &node[count]);
+        ++count;
+    }
+    UtAssert_INT32_EQ(count, 3);
+    CF_CLIST_FOREACH_R(iter, cur, head)
+    {
+        --count;
+        UtAssert_ADDRESS_EQ(cur, &node[count]);
+    }
+    UtAssert_INT32_EQ(count, 0);
+
+    /* Every node removes itself, each is still visited once */
+    CF_CLIST_FOREACH(iter, cur, head)
+    {
+        ++count;
+        CF_CList_Remove(&head, cur);
+    }
+    UtAssert_INT32_EQ(count, 3);
+    UtAssert_NULL(head);
+
+    /* Break out early */
+    count        = 0;
+    node[0].next = &node[1];
+    node[1].next = &node[0];
+    CF_CLIST_FOREACH(iter, cur, node)
+    {
+        ++count;
+        break;
+    }
+    UtAssert_INT32_EQ(count, 1);
+}
+
 /* Add tests */
 void UtTest_Setup(void)
 {
@@ -334,4 +399,5 @@ void UtTest_Setup(void)
     TEST_CF_ADD(Test_CF_CList_InsertAfter);
     TEST_CF_ADD(Test_CF_CList_Traverse);
     TEST_CF_ADD(Test_CF_CList_Traverse_R);
+    TEST_CF_ADD(Test_CF_CListIter);
 }
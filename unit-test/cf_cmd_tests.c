@@ -20,6 +20,8 @@
 /* cf testing includes */
 #include "cf_test_utils.h"
 #include "cf_cmd.h"
+#include "cf_history.h"
+#include "cf_perf.h"
 #include "cf_events.h"
 #include "cf_test_alt_handler.h"
 
@@ -116,6 +118,11 @@ void Dummy_CF_TsnChanAction_fn_t(CF_Transaction_t *txn, void *context)
     UT_DEFAULT_IMPL(Dummy_CF_TsnChanAction_fn_t);
 }
 
+void Dummy_CF_TsnChanPendingAction_fn_t(CF_Channel_t *chan, CF_PendingFile_t *pf, void *context)
+{
+    UT_DEFAULT_IMPL(Dummy_CF_TsnChanPendingAction_fn_t);
+}
+
 /*******************************************************************************
 **
 **  CF_CmdNoop tests
@@ -508,6 +515,87 @@ void Test_CF_CmdTxFile(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 5);
 }
 
+/*******************************************************************************
+**
+**  CF_TxFileMultiCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_CmdTxFileMulti(void)
+{
+    /* Test case for:
+     * void CF_TxFileMultiCmd(CFE_SB_Buffer_t *msg);
+     */
+    CF_TxFileMultiCmd_t       utbuf;
+    CF_TxFileMulti_Payload_t *msg = &utbuf.Payload;
+
+    memset(&CF_AppData.hk.Payload.counters, 0, sizeof(CF_AppData.hk.Payload.counters));
+
+    /* nominal, two destinations */
+    memset(msg, 0, sizeof(*msg));
+    msg->cfdp_class  = CF_CFDP_CLASS_2;
+    msg->num_dest    = 2;
+    msg->dest_ids[0] = 3;
+    msg->dest_ids[1] = 4;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_INF_CMD_TX_FILE_MULTI);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_TxFileMulti, 1);
+
+    /* out of range arguments: bad class */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->num_dest   = 1;
+    msg->cfdp_class = 10;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 1);
+
+    /* out of range arguments: bad channel */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->num_dest = 1;
+    msg->chan_num = CF_NUM_CHANNELS;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 2);
+
+    /* out of range arguments: bad keep */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->num_dest = 1;
+    msg->keep     = 15;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 3);
+
+    /* out of range arguments: no destination */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 4);
+
+    /* out of range arguments: more destinations than a group holds */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->num_dest = CF_TX_GROUP_MAX_DEST + 1;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 5);
+    UtAssert_STUB_COUNT(CF_CFDP_TxFileMulti, 1);
+
+    /* CF_CFDP_TxFileMulti fails */
+    UT_CF_ResetEventCapture();
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_TxFileMulti), CF_ERROR);
+    memset(msg, 0, sizeof(*msg));
+    msg->num_dest = CF_TX_GROUP_MAX_DEST;
+    UtAssert_VOIDCALL(CF_TxFileMultiCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_TX_FILE_MULTI);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 6);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 1);
+}
+
 /*******************************************************************************
 **
 **  CF_CmdPlaybackDir tests
@@ -519,8 +607,9 @@ void Test_CF_CmdPlaybackDir(void)
     /* Test case for:
      * void CF_PlaybackDirCmd(CFE_SB_Buffer_t *msg);
      */
-    CF_PlaybackDirCmd_t  utbuf;
-    CF_TxFile_Payload_t *msg = &utbuf.Payload;
+    CF_PlaybackDirCmd_t           utbuf;
+    CF_PlaybackDir_Payload_t *    msg = &utbuf.Payload;
+    CF_CFDP_PlaybackDir_context_t context;
 
     memset(&CF_AppData.hk.Payload.counters, 0, sizeof(CF_AppData.hk.Payload.counters));
 
@@ -530,10 +619,21 @@ void Test_CF_CmdPlaybackDir(void)
     UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 1);
 
+    /* nominal, limits at their maximum are passed through */
     memset(msg, 0, sizeof(*msg));
-    msg->cfdp_class = CF_CFDP_CLASS_2;
+    memset(&context, 0, sizeof(context));
+    UT_SetDataBuffer(UT_KEY(CF_CFDP_PlaybackDir), &context, sizeof(context), false);
+    msg->max_active  = CF_NUM_TRANSACTIONS_PER_CHANNEL;
+    msg->max_pending = CF_NUM_PENDING_FILES_PER_CHANNEL;
     UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 2);
+    UtAssert_UINT32_EQ(context.max_active, CF_NUM_TRANSACTIONS_PER_CHANNEL);
+    UtAssert_UINT32_EQ(context.max_pending, CF_NUM_PENDING_FILES_PER_CHANNEL);
+
+    memset(msg, 0, sizeof(*msg));
+    msg->cfdp_class = CF_CFDP_CLASS_2;
+    UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 3);
 
     /* out of range arguments: bad class */
     memset(msg, 0, sizeof(*msg));
@@ -565,13 +665,80 @@ void Test_CF_CmdPlaybackDir(void)
     UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 4);
 
+    /* out of range arguments: more files in transfer than the channel has transactions */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->max_active = CF_NUM_TRANSACTIONS_PER_CHANNEL + 1;
+    UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 5);
+
+    /* out of range arguments: more files read ahead than the channel has pending file records */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->max_pending = CF_NUM_PENDING_FILES_PER_CHANNEL + 1;
+    UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 6);
+
     /* CF_CFDP_PlaybackDir fails*/
     UT_CF_ResetEventCapture();
     UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_PlaybackDir), -1);
     memset(msg, 0, sizeof(*msg));
     UtAssert_VOIDCALL(CF_PlaybackDirCmd(&utbuf));
     UT_CF_AssertEventID(CF_EID_ERR_CMD_PLAYBACK_DIR);
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 5);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 7);
+}
+
+/*******************************************************************************
+**
+**  CF_TxManifestCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_CmdTxManifest(void)
+{
+    /* Test case for:
+     * void CF_TxManifestCmd(CFE_SB_Buffer_t *msg);
+     */
+    CF_TxManifestCmd_t       utbuf;
+    CF_TxManifest_Payload_t *msg = &utbuf.Payload;
+
+    memset(&CF_AppData.hk.Payload.counters, 0, sizeof(CF_AppData.hk.Payload.counters));
+
+    /* nominal, all zero should pass checks, just calls CF_CFDP_TxManifest */
+    memset(msg, 0, sizeof(*msg));
+    strcpy(msg->filename, "manifest");
+    UtAssert_VOIDCALL(CF_TxManifestCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_INF_CMD_TX_MANIFEST);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_TxManifest, 1);
+
+    /* out of range arguments: bad channel */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->chan_num = CF_NUM_CHANNELS;
+    UtAssert_VOIDCALL(CF_TxManifestCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 1);
+
+    /* out of range arguments: bad keep */
+    UT_CF_ResetEventCapture();
+    memset(msg, 0, sizeof(*msg));
+    msg->keep = 15;
+    UtAssert_VOIDCALL(CF_TxManifestCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_BAD_PARAM);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_TxManifest, 1);
+
+    /* CF_CFDP_TxManifest fails */
+    UT_CF_ResetEventCapture();
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_TxManifest), CF_ERROR);
+    memset(msg, 0, sizeof(*msg));
+    UtAssert_VOIDCALL(CF_TxManifestCmd(&utbuf));
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_TX_MANIFEST);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 3);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, 1);
 }
 
 /*******************************************************************************
@@ -1043,13 +1210,20 @@ void Test_CF_TsnChanAction_SendEvent_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionNotF
     void *                    arg_context = &context;
     int                       i           = 0;
 
+    CF_ConfigTable_t          config_table;
+
     CF_FindTransactionBySequenceNumber_context_t contexts_CF_CFDP_FTBSN[CF_NUM_CHANNELS];
 
     memset(&utbuf, 0, sizeof(utbuf));
     AnyRandomStringOfLettersOfLengthCopy(cmdstr, 10);
     memcpy((char *)arg_cmdstr, &cmdstr, 10);
 
+    memset(&config_table, 0, sizeof(config_table));
+    CF_AppData.config_table = &config_table;
+    config_table.local_eid  = 1;
+
     arg_cmd->chan = CF_COMPOUND_KEY;
+    arg_cmd->eid  = 2;
 
     /* Arrange unstubbable: CF_FindTransactionBySequenceNumberAllChannels */
     /* set non-matching transactions */
@@ -1062,7 +1236,7 @@ void Test_CF_TsnChanAction_SendEvent_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionNotF
                      sizeof(contexts_CF_CFDP_FTBSN), false);
 
     /* Act */
-    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, arg_context), -1);
+    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, Dummy_CF_TsnChanPendingAction_fn_t, arg_context), -1);
 
     UT_GetStubCount(UT_KEY(Dummy_CF_TsnChanAction_fn_t));
 
@@ -1105,7 +1279,7 @@ void Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionFoundRun_fn_An
                      false);
 
     /* Act */
-    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, arg_context), 1);
+    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, Dummy_CF_TsnChanPendingAction_fn_t, arg_context), 1);
 
     UT_GetStubCount(UT_KEY(Dummy_CF_TsnChanAction_fn_t));
 
@@ -1116,6 +1290,40 @@ void Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionFoundRun_fn_An
     UtAssert_ADDRESS_EQ(context_CF_TsnChanAction_fn_t.context, arg_context);
 }
 
+void Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_PendingFile(void)
+{
+    /* Arrange */
+    CF_Transaction_Payload_t cmd;
+    CF_ConfigTable_t         config_table;
+    CF_PendingFile_t         pf;
+
+    memset(&cmd, 0, sizeof(cmd));
+    memset(&config_table, 0, sizeof(config_table));
+    CF_AppData.config_table = &config_table;
+    config_table.local_eid  = 1;
+
+    cmd.chan = CF_COMPOUND_KEY;
+    cmd.eid  = 1;
+
+    /* not found on any pending queue */
+    UtAssert_INT32_EQ(CF_TsnChanAction(&cmd, "", Dummy_CF_TsnChanAction_fn_t, Dummy_CF_TsnChanPendingAction_fn_t,
+                                       NULL),
+                      -1);
+    UtAssert_STUB_COUNT(CF_FindPendingFileBySequenceNumber, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(Dummy_CF_TsnChanPendingAction_fn_t, 0);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_TRANS_NOT_FOUND);
+
+    /* found on the pending queue of the first channel */
+    UT_CF_ResetEventCapture();
+    UT_SetDefaultReturnValue(UT_KEY(CF_FindPendingFileBySequenceNumber), (UT_IntReturn_t)&pf);
+    UtAssert_INT32_EQ(CF_TsnChanAction(&cmd, "", Dummy_CF_TsnChanAction_fn_t, Dummy_CF_TsnChanPendingAction_fn_t,
+                                       NULL),
+                      1);
+    UtAssert_STUB_COUNT(Dummy_CF_TsnChanPendingAction_fn_t, 1);
+    UtAssert_STUB_COUNT(Dummy_CF_TsnChanAction_fn_t, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void Test_CF_TsnChanAction_cmd_chan_Eq_CF_ALL_CHANNELS_Return_CF_TraverseAllTransactions_All_Channels(void)
 {
     /* Arrange */
@@ -1141,7 +1349,7 @@ void Test_CF_TsnChanAction_cmd_chan_Eq_CF_ALL_CHANNELS_Return_CF_TraverseAllTran
                      false);
 
     /* Act */
-    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, arg_context), expected_result);
+    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, Dummy_CF_TsnChanPendingAction_fn_t, arg_context), expected_result);
 
     /* Assert */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
@@ -1156,13 +1364,15 @@ void Test_CF_TsnChanAction_cmd_chan_IsASingleChannel(void)
     memset(&cmd, 0, sizeof(cmd));
 
     UT_SetDefaultReturnValue(UT_KEY(CF_TraverseAllTransactions), result);
+    UT_SetDefaultReturnValue(UT_KEY(CF_TraversePendingFiles), result);
 
     /* Act */
-    UtAssert_INT32_EQ(CF_TsnChanAction(&cmd, NULL, NULL, NULL), result);
+    UtAssert_INT32_EQ(CF_TsnChanAction(&cmd, NULL, NULL, NULL, NULL), result + result);
 
     /* Assert */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     UtAssert_STUB_COUNT(CF_TraverseAllTransactions, 1);
+    UtAssert_STUB_COUNT(CF_TraversePendingFiles, 1);
 }
 
 void Test_CF_TsnChanAction_cmd_FailBecause_cmd_chan_IsInvalid(void)
@@ -1179,7 +1389,7 @@ void Test_CF_TsnChanAction_cmd_FailBecause_cmd_chan_IsInvalid(void)
     arg_cmd->chan = Any_uint8_BetweenExcludeMax(CF_NUM_CHANNELS, CF_COMPOUND_KEY);
 
     /* Act */
-    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, arg_context), -1);
+    UtAssert_INT32_EQ(CF_TsnChanAction(arg_cmd, arg_cmdstr, arg_fn, Dummy_CF_TsnChanPendingAction_fn_t, arg_context), -1);
 
     /* Assert */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1239,6 +1449,43 @@ void Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action
                   arg_t->flags.com.suspended, arg_context->action);
 }
 
+/*******************************************************************************
+**
+**  CF_DoSuspRes_Pending tests
+**
+*******************************************************************************/
+
+void Test_CF_DoSuspRes_Pending(void)
+{
+    /* Arrange */
+    CF_PendingFile_t           pf;
+    CF_ChanAction_SuspResArg_t context;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&context, 0, sizeof(context));
+
+    /* suspend a file that is not suspended */
+    context.action = 1;
+    UtAssert_VOIDCALL(CF_DoSuspRes_Pending(NULL, &pf, &context));
+    UtAssert_BOOL_TRUE(pf.suspended);
+    UtAssert_ZERO(context.same);
+    UtAssert_STUB_COUNT(CF_UnlinkPendingFileSource, 1);
+
+    /* suspend it again */
+    UtAssert_VOIDCALL(CF_DoSuspRes_Pending(NULL, &pf, &context));
+    UtAssert_BOOL_TRUE(pf.suspended);
+    UtAssert_UINT32_EQ(context.same, 1);
+    UtAssert_STUB_COUNT(CF_UnlinkPendingFileSource, 1);
+
+    /* resume it */
+    context.same   = 0;
+    context.action = 0;
+    UtAssert_VOIDCALL(CF_DoSuspRes_Pending(NULL, &pf, &context));
+    UtAssert_BOOL_FALSE(pf.suspended);
+    UtAssert_ZERO(context.same);
+    UtAssert_STUB_COUNT(CF_LinkPendingFileSource, 1);
+}
+
 /*******************************************************************************
 **
 **  CF_DoSuspRes tests
@@ -1390,6 +1637,25 @@ void Test_CF_CmdCancel_Txn_Call_CF_CFDP_CancelTransaction_WithGiven_t(void)
     UtAssert_ADDRESS_EQ(context_CF_CFDP_CancelTransaction, arg_t);
 }
 
+/*******************************************************************************
+**
+**  CF_CmdDrop_Pending tests
+**
+*******************************************************************************/
+
+void Test_CF_CmdDrop_Pending(void)
+{
+    /* Arrange */
+    CF_PendingFile_t pf;
+    CF_Channel_t *   chan = &CF_AppData.engine.channels[0];
+
+    /* Act */
+    UtAssert_VOIDCALL(CF_CmdDrop_Pending(chan, &pf, NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CFDP_DropPendingFile, 1);
+}
+
 /*******************************************************************************
 **
 **  CF_CmdCancel tests
@@ -1969,66 +2235,6 @@ void Test_CF_CmdDisablePolldir_FailWhenActionFail(void)
     UT_CF_AssertEventID(CF_EID_ERR_CMD_DISABLE_POLLDIR);
 }
 
-/*******************************************************************************
-**
-**  CF_PurgeHistory tests
-**
-*******************************************************************************/
-
-void Test_CF_PurgeHistory_Call_CF_CFDP_ResetHistory_AndReturn_CLIST_CONT(void)
-{
-    /* Arrange */
-    CF_History_t                   history;
-    CF_CListNode_t *               arg_n = &history.cl_node;
-    CF_Channel_t                   chan;
-    CF_Channel_t *                 arg_c = &chan;
-    CF_CListTraverse_Status_t      local_result;
-    CF_CFDP_ResetHistory_context_t context_CF_CFDP_ResetHistory;
-
-    UT_SetDataBuffer(UT_KEY(CF_ResetHistory), &context_CF_CFDP_ResetHistory, sizeof(context_CF_CFDP_ResetHistory),
-                     false);
-
-    /* Act */
-    local_result = CF_PurgeHistory(arg_n, arg_c);
-
-    /* Assert */
-    UtAssert_ADDRESS_EQ(context_CF_CFDP_ResetHistory.chan, arg_c);
-    UtAssert_ADDRESS_EQ(context_CF_CFDP_ResetHistory.history, &history);
-    UtAssert_True(local_result == CF_CLIST_CONT, "CF_PurgeHistory returned %d and should be %d (CF_CLIST_CONT)",
-                  local_result, CF_CLIST_CONT);
-}
-
-/*******************************************************************************
-**
-**  CF_PurgeTransaction tests
-**
-*******************************************************************************/
-
-void Test_CF_PurgeTransaction_Call_CF_CFDP_ResetTransaction_AndReturn_CLIST_CONT(void)
-{
-    /* Arrange */
-    CF_Transaction_t                   txn;
-    CF_CListNode_t *                   arg_n = &txn.cl_node;
-    int                                ignored;
-    void *                             arg_ignored = &ignored;
-    CF_CListTraverse_Status_t          local_result;
-    CF_CFDP_ResetTransaction_context_t context_CF_CFDP_ResetTransaction;
-
-    UT_SetDataBuffer(UT_KEY(CF_CFDP_ResetTransaction), &context_CF_CFDP_ResetTransaction,
-                     sizeof(context_CF_CFDP_ResetTransaction), false);
-
-    /* Act */
-    local_result = CF_PurgeTransaction(arg_n, arg_ignored);
-
-    /* Assert */
-    UtAssert_ADDRESS_EQ(context_CF_CFDP_ResetTransaction.txn, &txn);
-    UtAssert_True(context_CF_CFDP_ResetTransaction.keep_history == 0,
-                  "CF_CFDP_ResetTransaction received keep_history %u and should be 0 (constant)",
-                  context_CF_CFDP_ResetTransaction.keep_history);
-    UtAssert_True(local_result == CF_CLIST_CONT, "CF_PurgeHistory returned %d and should be %d (CF_CLIST_CONT)",
-                  local_result, CF_CLIST_CONT);
-}
-
 /*******************************************************************************
 **
 **  CF_DoPurgeQueue tests
@@ -2038,120 +2244,66 @@ void Test_CF_PurgeTransaction_Call_CF_CFDP_ResetTransaction_AndReturn_CLIST_CONT
 void Test_CF_DoPurgeQueue_PendOnly(void)
 {
     /* Arrange */
-    uint8                               arg_chan_num = Any_cf_channel();
-    CF_UnionArgs_Payload_t              utbuf;
-    CF_UnionArgs_Payload_t *            data   = &utbuf;
-    CF_ChanAction_MsgArg_t              msgarg = {data};
-    CF_Channel_t *                      chan;
-    CF_CListNode_t                      start;
-    CF_CListNode_t *                    expected_start = &start;
-    CF_ChanAction_Status_t              local_result;
-    CF_CList_Traverse_POINTER_context_t context_CF_CList_Traverse;
+    uint8                   arg_chan_num = Any_cf_channel();
+    CF_UnionArgs_Payload_t  utbuf;
+    CF_UnionArgs_Payload_t *data   = &utbuf;
+    CF_ChanAction_MsgArg_t  msgarg = {data};
+    CF_ChanAction_Status_t  local_result;
 
     memset(&utbuf, 0, sizeof(utbuf));
 
     data->byte[1] = 0; /* pend */
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_POINTER,
-                          &context_CF_CList_Traverse);
-
-    chan                       = &CF_AppData.engine.channels[arg_chan_num];
-    chan->qs[CF_QueueIdx_PEND] = expected_start;
 
     /* Act */
     local_result = CF_DoPurgeQueue(arg_chan_num, &msgarg);
 
-    UT_GetStubCount(UT_KEY(CF_CList_Traverse));
-
     /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse.start, expected_start);
-    UtAssert_True(context_CF_CList_Traverse.fn == CF_PurgeTransaction,
-                  "context_CF_CList_Traverse.fn ==  CF_PurgeTransaction");
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse.context, NULL);
+    UtAssert_STUB_COUNT(CF_TraversePendingFiles, 1);
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 0);
     UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
 void Test_CF_DoPurgeQueue_HistoryOnly(void)
 {
     /* Arrange */
-    uint8                               arg_chan_num = Any_cf_channel();
-    CF_UnionArgs_Payload_t              utbuf;
-    CF_UnionArgs_Payload_t *            data   = &utbuf;
-    CF_ChanAction_MsgArg_t              msgarg = {data};
-    CF_Channel_t *                      chan;
-    CF_CListNode_t                      start;
-    CF_CListNode_t *                    expected_start = &start;
-    CF_ChanAction_Status_t              local_result;
-    CF_CList_Traverse_POINTER_context_t context_CF_CList_Traverse;
+    uint8                   arg_chan_num = Any_cf_channel();
+    CF_UnionArgs_Payload_t  utbuf;
+    CF_UnionArgs_Payload_t *data   = &utbuf;
+    CF_ChanAction_MsgArg_t  msgarg = {data};
+    CF_ChanAction_Status_t  local_result;
 
     memset(&utbuf, 0, sizeof(utbuf));
 
     data->byte[1] = 1; /* history */
 
-    /* set correct context type for CF_CList_Traverse stub */
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_POINTER,
-                          &context_CF_CList_Traverse);
-
-    chan                       = &CF_AppData.engine.channels[arg_chan_num];
-    chan->qs[CF_QueueIdx_HIST] = expected_start;
-
     /* Act */
     local_result = CF_DoPurgeQueue(arg_chan_num, &msgarg);
 
-    UT_GetStubCount(UT_KEY(CF_CList_Traverse));
-
     /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse.start, expected_start);
-    UtAssert_True(context_CF_CList_Traverse.fn == (CF_CListFn_t)CF_PurgeHistory,
-                  "context_CF_CList_Traverse.fn ==  (CF_CListFn_t )CF_PurgeHistory");
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse.context, chan);
+    UtAssert_STUB_COUNT(CF_TraversePendingFiles, 0);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Clear, 1);
     UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
 void Test_CF_DoPurgeQueue_Both(void)
 {
     /* Arrange */
-    uint8                               arg_chan_num = Any_cf_channel();
-    CF_UnionArgs_Payload_t              utbuf;
-    CF_UnionArgs_Payload_t *            data   = &utbuf;
-    CF_ChanAction_MsgArg_t              msgarg = {data};
-    CF_Channel_t *                      chan;
-    CF_CListNode_t                      pend_start;
-    CF_CListNode_t *                    expected_pend_start = &pend_start;
-    CF_CListNode_t                      history_start;
-    CF_CListNode_t *                    expected_history_start = &history_start;
-    CF_ChanAction_Status_t              local_result;
-    CF_CList_Traverse_POINTER_context_t context_CF_CList_Traverse[2];
+    uint8                   arg_chan_num = Any_cf_channel();
+    CF_UnionArgs_Payload_t  utbuf;
+    CF_UnionArgs_Payload_t *data   = &utbuf;
+    CF_ChanAction_MsgArg_t  msgarg = {data};
+    CF_ChanAction_Status_t  local_result;
 
     memset(&utbuf, 0, sizeof(utbuf));
 
     data->byte[1] = 2; /* both */
 
-    /* set correct context type for CF_CList_Traverse stub */
-    /* this must use data buffer hack to pass multiple contexts */
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_POINTER, NULL);
-    UT_SetDataBuffer(UT_KEY(CF_CList_Traverse), context_CF_CList_Traverse, sizeof(context_CF_CList_Traverse), false);
-
-    chan                       = &CF_AppData.engine.channels[arg_chan_num];
-    chan->qs[CF_QueueIdx_PEND] = expected_pend_start;
-    chan->qs[CF_QueueIdx_HIST] = expected_history_start;
-
     /* Act */
     local_result = CF_DoPurgeQueue(arg_chan_num, &msgarg);
 
-    UT_GetStubCount(UT_KEY(CF_CList_Traverse));
-
     /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 2);
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse[0].start, expected_pend_start);
-    UtAssert_True(context_CF_CList_Traverse[0].fn == CF_PurgeTransaction,
-                  "context_CF_CList_Traverse[0].fn ==  CF_PurgeTransaction");
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse[0].context, NULL);
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse[1].start, expected_history_start);
-    UtAssert_True(context_CF_CList_Traverse[1].fn == (CF_CListFn_t)CF_PurgeHistory,
-                  "context_CF_CList_Traverse[1].fn ==  (CF_CListFn_t )CF_PurgeHistory");
-    UtAssert_ADDRESS_EQ(context_CF_CList_Traverse[1].context, chan);
+    UtAssert_STUB_COUNT(CF_TraversePendingFiles, 1);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Clear, 1);
     UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
@@ -2694,11 +2846,10 @@ void Test_CF_CmdWriteQueue_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDow
     CF_WriteQueueCmd_t       utbuf;
     CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
 
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile = Any_int32_Except(0);
-    int32                                context_CF_WrappedClose_fd;
-    uint16                               initial_hk_err_counter = Any_uint16();
+    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
+    int32                          forced_return_CF_WritePendingQueueDataToFile = Any_int32_Except(0);
+    int32                          context_CF_WrappedClose_fd;
+    uint16                         initial_hk_err_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
@@ -2717,10 +2868,8 @@ void Test_CF_CmdWriteQueue_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDow
     UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
                      false);
 
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
+    /* invalid result from CF_WritePendingQueueDataToFile */
+    UT_SetDefaultReturnValue(UT_KEY(CF_WritePendingQueueDataToFile), forced_return_CF_WritePendingQueueDataToFile);
 
     UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
 
@@ -2730,7 +2879,8 @@ void Test_CF_CmdWriteQueue_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDow
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UT_CF_AssertEventID(CF_EID_ERR_CMD_WQ_WRITEQ_PEND);
     UtAssert_STUB_COUNT(CF_WrappedClose, 1);
@@ -2829,7 +2979,8 @@ void Test_CF_CmdWriteQueue_Success_type_AllAnd_q_All(void)
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 4);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 3);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UT_CF_AssertEventID(CF_EID_INF_CMD_WQ);
@@ -2935,8 +3086,7 @@ void Test_CF_CmdWriteQueue_Success_type_AllAnd_q_Pend(void)
     CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
 
     CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
+    uint16                         initial_hk_cmd_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
@@ -2955,16 +3105,14 @@ void Test_CF_CmdWriteQueue_Success_type_AllAnd_q_Pend(void)
     UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
                      false);
 
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
     CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
 
     /* Act */
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UT_CF_AssertEventID(CF_EID_INF_CMD_WQ);
@@ -3150,7 +3298,8 @@ void Test_CF_CmdWriteQueue_Success_type_DownAnd_q_All(void)
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 3);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 2);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UT_CF_AssertEventID(CF_EID_INF_CMD_WQ);
@@ -3256,8 +3405,7 @@ void Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Pend(void)
     CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
 
     CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
+    uint16                         initial_hk_cmd_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
@@ -3276,16 +3424,14 @@ void Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Pend(void)
     UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
                      false);
 
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
     CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
 
     /* Act */
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 1);
     UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UT_CF_AssertEventID(CF_EID_INF_CMD_WQ);
@@ -3294,6 +3440,136 @@ void Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Pend(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
 }
 
+void Test_CF_CmdWriteQueue_InvalidFormat_SendEventAndRejectCommand(void)
+{
+    /* Arrange */
+    CF_WriteQueueCmd_t       utbuf;
+    CF_WriteQueue_Payload_t *wq                     = &utbuf.Payload;
+    uint16                   initial_hk_err_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_all;
+    wq->queue  = CF_Queue_all;
+    wq->format = CF_QueueFileFormat_binary + 1;
+
+    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+
+    /* Act */
+    CF_WriteQueueCmd(&utbuf);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WQ_ARGS);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+}
+
+void Test_CF_CmdWriteQueue_Binary_Busy_SendEventAndRejectCommand(void)
+{
+    /* Arrange */
+    CF_WriteQueueCmd_t       utbuf;
+    CF_WriteQueue_Payload_t *wq                     = &utbuf.Payload;
+    uint16                   initial_hk_err_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_all;
+    wq->queue  = CF_Queue_all;
+    wq->format = CF_QueueFileFormat_binary;
+
+    CF_AppData.queue_dump.busy         = true;
+    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+
+    /* Act */
+    CF_WriteQueueCmd(&utbuf);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WQ_BUSY);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+}
+
+void Test_CF_CmdWriteQueue_Binary_HeaderFails_CloseAndRejectCommand(void)
+{
+    /* Arrange */
+    CF_WriteQueueCmd_t             utbuf;
+    CF_WriteQueue_Payload_t *      wq = &utbuf.Payload;
+    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
+    uint16                         initial_hk_err_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_all;
+    wq->queue  = CF_Queue_all;
+    wq->format = CF_QueueFileFormat_binary;
+
+    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
+    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
+                     false);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WriteQueueFileHeader), CF_ERROR);
+
+    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+
+    /* Act */
+    CF_WriteQueueCmd(&utbuf);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_WriteQueueFileHeader, 1);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_BOOL_FALSE(CF_AppData.queue_dump.busy);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+}
+
+void Test_CF_CmdWriteQueue_Binary_Success_StartDump(void)
+{
+    /* Arrange */
+    CF_WriteQueueCmd_t             utbuf;
+    CF_WriteQueue_Payload_t *      wq = &utbuf.Payload;
+    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
+    uint16                         initial_hk_cmd_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_down;
+    wq->queue  = CF_Queue_history;
+    wq->format = CF_QueueFileFormat_binary;
+
+    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
+    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
+                     false);
+
+    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
+
+    /* the stamp of the previous file is the last one before the count wraps */
+    CF_AppData.queue_dump.stamp = 0xFFFFFFFF;
+
+    /* Act */
+    CF_WriteQueueCmd(&utbuf);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_WriteQueueFileHeader, 1);
+    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WritePendingQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
+    UtAssert_BOOL_TRUE(CF_AppData.queue_dump.busy);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.chan, wq->chan);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.type, CF_Type_down);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.queue, CF_Queue_history);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.stage, CF_QueueDumpStage_RX);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.num_records, 0);
+    UtAssert_UINT32_EQ(CF_AppData.queue_dump.stamp, 1); /* 0 is never a stamp */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UT_CF_AssertEventID(CF_EID_INF_CMD_WQ);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
+}
+
 /*******************************************************************************
 **
 **  CF_CmdValidateChunkSize tests
@@ -3690,6 +3966,67 @@ void Test_CF_CmdDisableEngine_WhenEngineDisabledAndIncrementErrCounterThenFail(v
                   CF_AppData.hk.Payload.counters.err, initial_hk_err_counter);
 }
 
+/*******************************************************************************
+**
+**  CF_EnablePerfStatsCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_EnablePerfStatsCmd(void)
+{
+    /* Arrange */
+    CF_EnablePerfStatsCmd_t utbuf;
+    uint16                  initial_hk_cmd_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
+
+    /* Act */
+    UtAssert_INT32_EQ(CF_EnablePerfStatsCmd(&utbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_BOOL_TRUE(CF_AppData.perf.enabled);
+    UtAssert_STUB_COUNT(CF_Perf_Reset, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UT_CF_AssertEventID(CF_EID_INF_CMD_ENABLE_PERF_STATS);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
+
+    /* already enabled, statistics are cleared again */
+    UtAssert_INT32_EQ(CF_EnablePerfStatsCmd(&utbuf), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(CF_AppData.perf.enabled);
+    UtAssert_STUB_COUNT(CF_Perf_Reset, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 2) & 0xFFFF);
+}
+
+/*******************************************************************************
+**
+**  CF_DisablePerfStatsCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_DisablePerfStatsCmd(void)
+{
+    /* Arrange */
+    CF_DisablePerfStatsCmd_t utbuf;
+    uint16                   initial_hk_cmd_counter = Any_uint16();
+
+    memset(&utbuf, 0, sizeof(utbuf));
+
+    CF_AppData.perf.enabled            = true;
+    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
+
+    /* Act */
+    UtAssert_INT32_EQ(CF_DisablePerfStatsCmd(&utbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_BOOL_FALSE(CF_AppData.perf.enabled);
+    UtAssert_STUB_COUNT(CF_Perf_Reset, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UT_CF_AssertEventID(CF_EID_INF_CMD_DISABLE_PERF_STATS);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
+}
+
 /*******************************************************************************
 **
 **  CF_SendHkCmd tests - full coverage
@@ -3698,13 +4035,21 @@ void Test_CF_CmdDisableEngine_WhenEngineDisabledAndIncrementErrCounterThenFail(v
 
 void Test_CF_SendHkCmd(void)
 {
+    /* Arrange */
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].history.num_records = 10;
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].history.count       = 3;
+
     /* Act */
     CF_SendHkCmd(NULL);
 
     /* Assert */
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST], 3);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST_FREE], 7);
     UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
     UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_SendTxnTlm, 1);
+    UtAssert_STUB_COUNT(CF_Perf_SendTlm, 1);
 }
 
 /*******************************************************************************
@@ -3722,7 +4067,10 @@ void Test_CF_WakeupCmd(void)
     CF_WakeupCmd(NULL);
 
     /* Assert */
+    UtAssert_STUB_COUNT(CF_Perf_Begin, 1);
     UtAssert_STUB_COUNT(CF_CFDP_CycleEngine, 1);
+    UtAssert_STUB_COUNT(CF_Perf_End, 1);
+    UtAssert_STUB_COUNT(CF_ProcessQueueDump, 1);
 }
 
 /*******************************************************************************
@@ -3765,11 +4113,21 @@ void add_CF_CmdTxFile_tests(void)
     UtTest_Add(Test_CF_CmdTxFile, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "CF_CmdTxFile");
 }
 
+void add_CF_CmdTxFileMulti_tests(void)
+{
+    UtTest_Add(Test_CF_CmdTxFileMulti, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "CF_CmdTxFileMulti");
+}
+
 void add_CF_CmdPlaybackDir_tests(void)
 {
     UtTest_Add(Test_CF_CmdPlaybackDir, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "CF_CmdPlaybackDir");
 }
 
+void add_CF_CmdTxManifest_tests(void)
+{
+    UtTest_Add(Test_CF_CmdTxManifest, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "CF_CmdTxManifest");
+}
+
 void add_CF_DoChanAction_tests(void)
 {
     UtTest_Add(Test_CF_DoChanAction_CF_ALL_CHANNELS_WhenAny_fn_returns_1_Return_1, cf_cmd_tests_Setup,
@@ -3828,6 +4186,8 @@ void add_CF_TsnChanAction_tests(void)
     UtTest_Add(Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionFoundRun_fn_AndReturn_CFE_SUCCESS,
                cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
                "Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_TransactionFoundRun_fn_AndReturn_CFE_SUCCESS");
+    UtTest_Add(Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_PendingFile, cf_cmd_tests_Setup,
+               cf_cmd_tests_Teardown, "Test_CF_TsnChanAction_cmd_chan_Eq_CF_COMPOUND_KEY_PendingFile");
     UtTest_Add(Test_CF_TsnChanAction_cmd_chan_Eq_CF_ALL_CHANNELS_Return_CF_TraverseAllTransactions_All_Channels,
                cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
                "Test_CF_TsnChanAction_cmd_chan_Eq_CF_ALL_CHANNELS_Return_CF_TraverseAllTransactions_All_Channels");
@@ -3845,6 +4205,11 @@ void add_CF_DoSuspRes_Txn_tests(void)
                cf_cmd_tests_Teardown, "Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action");
 }
 
+void add_CF_DoSuspRes_Pending_tests(void)
+{
+    UtTest_Add(Test_CF_DoSuspRes_Pending, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "Test_CF_DoSuspRes_Pending");
+}
+
 void add_CF_DoSuspRes_tests(void)
 {
     UtTest_Add(Test_CF_DoSuspRes, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "CF_DoSuspRes");
@@ -3868,6 +4233,11 @@ void add_CF_CmdCancel_Txn_tests(void)
                cf_cmd_tests_Teardown, "Test_CF_CmdCancel_Txn_Call_CF_CFDP_CancelTransaction_WithGiven_t");
 }
 
+void add_CF_CmdDrop_Pending_tests(void)
+{
+    UtTest_Add(Test_CF_CmdDrop_Pending, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "Test_CF_CmdDrop_Pending");
+}
+
 void add_CF_CmdCancel_tests(void)
 {
     UtTest_Add(Test_CF_CmdCancel_Failure, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "Test_CF_CmdCancel_Failure");
@@ -3940,18 +4310,6 @@ void add_CF_CmdDisablePolldir_tests(void)
                "Test_CF_CmdDisablePolldir_FailWhenActionFail");
 }
 
-void add_CF_PurgeHistory_tests(void)
-{
-    UtTest_Add(Test_CF_PurgeHistory_Call_CF_CFDP_ResetHistory_AndReturn_CLIST_CONT, cf_cmd_tests_Setup,
-               cf_cmd_tests_Teardown, "Test_CF_PurgeHistory_Call_CF_CFDP_ResetHistory_AndReturn_CLIST_CONT");
-}
-
-void add_CF_PurgeTransaction_tests(void)
-{
-    UtTest_Add(Test_CF_PurgeTransaction_Call_CF_CFDP_ResetTransaction_AndReturn_CLIST_CONT, cf_cmd_tests_Setup,
-               cf_cmd_tests_Teardown, "Test_CF_PurgeTransaction_Call_CF_CFDP_ResetTransaction_AndReturn_CLIST_CONT");
-}
-
 void add_CF_DoPurgeQueue_tests(void)
 {
     UtTest_Add(Test_CF_DoPurgeQueue_PendOnly, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
@@ -4051,6 +4409,14 @@ void add_CF_CmdWriteQueue_tests(void)
                "Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Active");
     UtTest_Add(Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Pend, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
                "Test_CF_CmdWriteQueue_Success_type_DownAnd_q_Pend");
+    UtTest_Add(Test_CF_CmdWriteQueue_InvalidFormat_SendEventAndRejectCommand, cf_cmd_tests_Setup,
+               cf_cmd_tests_Teardown, "Test_CF_CmdWriteQueue_InvalidFormat_SendEventAndRejectCommand");
+    UtTest_Add(Test_CF_CmdWriteQueue_Binary_Busy_SendEventAndRejectCommand, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
+               "Test_CF_CmdWriteQueue_Binary_Busy_SendEventAndRejectCommand");
+    UtTest_Add(Test_CF_CmdWriteQueue_Binary_HeaderFails_CloseAndRejectCommand, cf_cmd_tests_Setup,
+               cf_cmd_tests_Teardown, "Test_CF_CmdWriteQueue_Binary_HeaderFails_CloseAndRejectCommand");
+    UtTest_Add(Test_CF_CmdWriteQueue_Binary_Success_StartDump, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
+               "Test_CF_CmdWriteQueue_Binary_Success_StartDump");
 }
 
 void add_CF_CmdValidateChunkSize_tests(void)
@@ -4115,6 +4481,17 @@ void add_CF_CmdDisableEngine_tests(void)
                cf_cmd_tests_Teardown, "Test_CF_CmdDisableEngine_WhenEngineDisabledAndIncrementErrCounterThenFail");
 }
 
+void add_CF_EnablePerfStatsCmd_tests(void)
+{
+    UtTest_Add(Test_CF_EnablePerfStatsCmd, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "Test_CF_EnablePerfStatsCmd");
+}
+
+void add_CF_DisablePerfStatsCmd_tests(void)
+{
+    UtTest_Add(Test_CF_DisablePerfStatsCmd, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
+               "Test_CF_DisablePerfStatsCmd");
+}
+
 void add_CF_SendHkCmd_tests(void)
 {
     UtTest_Add(Test_CF_SendHkCmd, cf_cmd_tests_Setup, cf_cmd_tests_Teardown, "Test_CF_SendHkCmd");
@@ -4141,8 +4518,12 @@ void UtTest_Setup(void)
 
     add_CF_CmdTxFile_tests();
 
+    add_CF_CmdTxFileMulti_tests();
+
     add_CF_CmdPlaybackDir_tests();
 
+    add_CF_CmdTxManifest_tests();
+
     add_CF_DoChanAction_tests();
 
     add_CF_DoFreezeThaw_tests();
@@ -4157,6 +4538,8 @@ void UtTest_Setup(void)
 
     add_CF_DoSuspRes_Txn_tests();
 
+    add_CF_DoSuspRes_Pending_tests();
+
     add_CF_DoSuspRes_tests();
 
     add_CF_CmdSuspend_tests();
@@ -4165,6 +4548,8 @@ void UtTest_Setup(void)
 
     add_CF_CmdCancel_Txn_tests();
 
+    add_CF_CmdDrop_Pending_tests();
+
     add_CF_CmdCancel_tests();
 
     add_CF_CmdAbandon_Txn_tests();
@@ -4183,9 +4568,7 @@ void UtTest_Setup(void)
 
     add_CF_CmdDisablePolldir_tests();
 
-    add_CF_PurgeHistory_tests();
 
-    add_CF_PurgeTransaction_tests();
 
     add_CF_DoPurgeQueue_tests();
 
@@ -4207,6 +4590,10 @@ void UtTest_Setup(void)
 
     add_CF_CmdDisableEngine_tests();
 
+    add_CF_EnablePerfStatsCmd_tests();
+
+    add_CF_DisablePerfStatsCmd_tests();
+
     add_CF_SendHkCmd_tests();
 
     add_CF_WakeupCmd_tests();
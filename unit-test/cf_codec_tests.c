@@ -139,6 +139,28 @@ void Test_CF_CFDP_EncodeHeaderWithoutSize(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* with PDU CRC, room for it is held back */
+    in.crc_flag = 1;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(bytes[0], 0x3e);
+    UtAssert_UINT32_EQ(CF_CODEC_GET_REMAIN(&state), sizeof(bytes) - sizeof(expected) - sizeof(CF_CFDP_uint16_t));
+
+    /* with PDU CRC, but no room for it */
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(expected) + 1);
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* large file, the rest of the PDU uses 64-bit file sizes */
+    in.crc_flag   = 0;
+    in.large_flag = 1;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(bytes[0], 0x3d);
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
 }
 
 void Test_CF_CFDP_EncodeHeaderFinalSize(void)
@@ -148,7 +170,7 @@ void Test_CF_CFDP_EncodeHeaderFinalSize(void)
      */
     CF_EncoderState_t      state;
     CF_Logical_PduHeader_t in;
-    uint8                  bytes[10];
+    uint8                  bytes[12];
     const uint8            expected[] = {0xEE, 0x12, 0x34, 0xEE};
 
     memset(&in, 0, sizeof(in));
@@ -173,6 +195,116 @@ void Test_CF_CFDP_EncodeHeaderFinalSize(void)
     /* also a noop, but gets full branch coverage */
     CF_CFDP_EncodeHeaderFinalSize(&state, &in);
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* with PDU CRC, appended in the space held back by CF_CFDP_EncodeHeaderWithoutSize() */
+    memcpy(bytes, "1xx456789", 9);
+    in.crc_flag            = 1;
+    in.data_encoded_length = 0x3233;
+    UT_CF_SetupEncodeState(&state, bytes, 9);
+    state.codec_state.next_offset = 9;
+    CF_CFDP_EncodeHeaderFinalSize(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), 11);
+    UtAssert_MemCmp(bytes, "123456789\x29\xb1", 11, "Encoded Bytes with CRC-16/CCITT check value");
+}
+
+void Test_CF_CFDP_EncodeHeaderTemplate(void)
+{
+    /* Test for:
+     * void CF_CFDP_EncodeHeaderTemplate(CF_PduHeaderTemplate_t *tmpl, CF_EntityId_t src_eid, CF_EntityId_t dst_eid,
+     *                                   CF_TransactionSeq_t tsn);
+     */
+    CF_PduHeaderTemplate_t tmpl;
+    const uint8            expected_dst[] = {0x00, 0x00, 0x00, 0x10, 0x00, 0x44, 0x55, 0x12, 0x34};
+    const uint8            expected_src[] = {0x00, 0x00, 0x00, 0x11, 0x12, 0x34, 0x01, 0x23, 0x00, 0x44};
+
+    /* the destination EID sets the width of both */
+    memset(&tmpl, 0xEE, sizeof(tmpl));
+    CF_CFDP_EncodeHeaderTemplate(&tmpl, 0x44, 0x1234, 0x55);
+    UtAssert_UINT32_EQ(tmpl.source_eid, 0x44);
+    UtAssert_UINT32_EQ(tmpl.destination_eid, 0x1234);
+    UtAssert_UINT32_EQ(tmpl.sequence_num, 0x55);
+    UtAssert_UINT32_EQ(tmpl.eid_length, 2);
+    UtAssert_UINT32_EQ(tmpl.txn_seq_length, 1);
+    UtAssert_UINT32_EQ(tmpl.length, sizeof(expected_dst));
+    UtAssert_MemCmp(tmpl.bytes, expected_dst, sizeof(expected_dst), "Encoded Bytes");
+
+    /* the source EID sets the width of both */
+    CF_CFDP_EncodeHeaderTemplate(&tmpl, 0x1234, 0x44, 0x123);
+    UtAssert_UINT32_EQ(tmpl.eid_length, 2);
+    UtAssert_UINT32_EQ(tmpl.txn_seq_length, 2);
+    UtAssert_UINT32_EQ(tmpl.length, sizeof(expected_src));
+    UtAssert_MemCmp(tmpl.bytes, expected_src, sizeof(expected_src), "Encoded Bytes");
+}
+
+void Test_CF_CFDP_EncodeHeaderFromTemplate(void)
+{
+    /* Test for:
+     * void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+     *                                       const CF_PduHeaderTemplate_t *tmpl);
+     */
+    CF_EncoderState_t      state;
+    CF_Logical_PduHeader_t in;
+    CF_PduHeaderTemplate_t tmpl;
+    uint8                  bytes[16];
+    uint8                  ref_bytes[16];
+    size_t                 ref_remain;
+
+    CF_CFDP_EncodeHeaderTemplate(&tmpl, 0x44, 0x1234, 0x55);
+
+    memset(&in, 0, sizeof(in));
+    in.version         = 1;
+    in.direction       = 1;
+    in.pdu_type        = 1;
+    in.txm_mode        = 1;
+    in.eid_length      = tmpl.eid_length;
+    in.txn_seq_length  = tmpl.txn_seq_length;
+    in.source_eid      = 0x44;
+    in.sequence_num    = 0x55;
+    in.destination_eid = 0x1234;
+
+    /* fill with nonzero bytes so it is evident what was set */
+    memset(bytes, 0xEE, sizeof(bytes));
+
+    /* call w/zero state should be noop */
+    UT_CF_SetupEncodeState(&state, bytes, 0);
+    CF_CFDP_EncodeHeaderFromTemplate(&state, &in, &tmpl);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(bytes, 0xEE, sizeof(bytes), "Bytes unchanged");
+
+    /* nominal, same as encoding the header in full, apart from the length which is not set yet */
+    memset(ref_bytes, 0, sizeof(ref_bytes));
+    memset(bytes, 0, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, ref_bytes, sizeof(ref_bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    in.header_encoded_length = 0;
+    CF_CFDP_EncodeHeaderFromTemplate(&state, &in, &tmpl);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), tmpl.length);
+    UtAssert_UINT32_EQ(in.header_encoded_length, tmpl.length);
+    UtAssert_MemCmp(bytes, ref_bytes, sizeof(bytes), "Encoded Bytes");
+
+    /* with PDU CRC and large file flags, room for the CRC is held back */
+    in.crc_flag   = 1;
+    in.large_flag = 1;
+    memset(ref_bytes, 0, sizeof(ref_bytes));
+    memset(bytes, 0, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, ref_bytes, sizeof(ref_bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    ref_remain = CF_CODEC_GET_REMAIN(&state);
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeHeaderFromTemplate(&state, &in, &tmpl);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(bytes[0], 0x3f);
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
+    UtAssert_UINT32_EQ(CF_CODEC_GET_REMAIN(&state), ref_remain);
+    UtAssert_MemCmp(bytes, ref_bytes, sizeof(bytes), "Encoded Bytes");
+
+    /* with PDU CRC, but no room for it */
+    UT_CF_SetupEncodeState(&state, bytes, tmpl.length + 1);
+    CF_CFDP_EncodeHeaderFromTemplate(&state, &in, &tmpl);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
 void Test_CF_CFDP_EncodeFileDirectiveHeader(void)
@@ -331,8 +463,10 @@ void Test_CF_CFDP_EncodeSegmentRequest(void)
      */
     CF_EncoderState_t           state;
     CF_Logical_SegmentRequest_t in;
-    uint8                       bytes[10];
-    const uint8                 expected[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    uint8                       bytes[20];
+    const uint8                 expected[]       = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    const uint8                 expected_large[] = {0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x33, 0x44,
+                                    0x00, 0x00, 0x00, 0x02, 0x55, 0x66, 0x77, 0x88};
 
     memset(&in, 0, sizeof(in));
     in.offset_start = 0x11223344;
@@ -354,6 +488,17 @@ void Test_CF_CFDP_EncodeSegmentRequest(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* large file, offsets past 4 GiB */
+    in.offset_start = 0x111223344;
+    in.offset_end   = 0x255667788;
+    memset(bytes, 0xEE, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeSegmentRequest(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
 }
 
 void Test_CF_CFDP_EncodeAllTlv(void)
@@ -446,8 +591,10 @@ void Test_CF_CFDP_EncodeMd(void)
      */
     CF_EncoderState_t  state;
     CF_Logical_PduMd_t in;
-    uint8              bytes[20];
-    const uint8        expected[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    uint8              bytes[30];
+    const uint8        expected[]     = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    const uint8        expected_fec[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's',  'r',  'c',  0x04, 'd',  'e',
+                                  's',  't',  0x02, 0x08, 'C',  'F',  'E',  'C',  0x01, 0x04, 0x01, 0xE0};
 
     memset(&in, 0, sizeof(in));
     in.size                     = 0x1234;
@@ -472,6 +619,20 @@ void Test_CF_CFDP_EncodeMd(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* with forward error correction, as a message to user */
+    in.fec.group_size   = 4;
+    in.fec.segment_size = 480;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeMd(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_fec));
+    UtAssert_MemCmp(bytes, expected_fec, sizeof(expected_fec), "Encoded Bytes");
+
+    /* no room for the message */
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(expected));
+    CF_CFDP_EncodeMd(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
 void Test_CF_CFDP_EncodeFileDataHeader(void)
@@ -484,7 +645,8 @@ void Test_CF_CFDP_EncodeFileDataHeader(void)
     CF_Logical_PduFileDataHeader_t in;
     uint8                          bytes[20];
     const uint8                    expected_basic[] = {0x00, 0x00, 0x00, 0x13};
-    const uint8 expected_meta[] = {0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13};
+    const uint8 expected_meta[]  = {0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13};
+    const uint8 expected_large[] = {0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13};
 
     memset(&in, 0, sizeof(in));
     in.offset   = 0x13;
@@ -519,6 +681,16 @@ void Test_CF_CFDP_EncodeFileDataHeader(void)
     UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_meta));
     UtAssert_MemCmp(bytes, expected_meta, sizeof(expected_meta), "Encoded Bytes");
+
+    /* large file, no metadata */
+    in.offset = 0x100000013;
+    memset(bytes, 0xEE, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeFileDataHeader(&state, false, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
 }
 
 void Test_CF_CFDP_EncodeEof(void)
@@ -529,7 +701,9 @@ void Test_CF_CFDP_EncodeEof(void)
     CF_EncoderState_t   state;
     CF_Logical_PduEof_t in;
     uint8               bytes[20];
-    const uint8         expected[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
+    const uint8         expected[]       = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
+    const uint8         expected_large[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00,
+                                    0x01, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
 
     memset(&in, 0, sizeof(in));
     in.crc                      = 0x12345678;
@@ -556,6 +730,16 @@ void Test_CF_CFDP_EncodeEof(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* large file, size of 4 GiB or more */
+    in.size = 0x100004567;
+    memset(bytes, 0xEE, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeEof(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
 }
 
 void Test_CF_CFDP_EncodeFin(void)
@@ -663,6 +847,44 @@ void Test_CF_CFDP_EncodeNak(void)
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
 }
 
+void Test_CF_CFDP_EncodeParity(void)
+{
+    /* Test for:
+     * void CF_CFDP_EncodeParity(CF_EncoderState_t *state, CF_Logical_PduParity_t *plpar);
+     */
+    CF_EncoderState_t      state;
+    CF_Logical_PduParity_t in;
+    uint8                  bytes[10];
+    const uint8            expected[] = {0x00, 0x00, 0x12, 0x34, 'x', 'o', 'r'};
+
+    memset(&in, 0, sizeof(in));
+    in.offset   = 0x1234;
+    in.data_len = 3;
+    in.data_ptr = "xor";
+
+    /* fill with nonzero bytes so it is evident what was set */
+    memset(bytes, 0xEE, sizeof(bytes));
+
+    /* call w/zero state should be noop */
+    UT_CF_SetupEncodeState(&state, bytes, 0);
+    CF_CFDP_EncodeParity(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(bytes, 0xEE, sizeof(bytes), "Bytes unchanged");
+
+    /* setup nominal */
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeParity(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
+    UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
+    UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* no room for the parity */
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(expected) - 1);
+    CF_CFDP_EncodeParity(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+}
+
 void Test_CF_CFDP_EncodeCrc(void)
 {
     /* Test for:
@@ -694,6 +916,33 @@ void Test_CF_CFDP_EncodeCrc(void)
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
 }
 
+void Test_CF_CFDP_EncodeCrc16(void)
+{
+    /* Test for:
+     * void CF_CFDP_EncodeCrc16(CF_EncoderState_t *state, uint16 crc);
+     */
+    CF_EncoderState_t state;
+    uint8             bytes[10];
+    const uint8       expected[] = {0x29, 0xb1};
+
+    /* fill with nonzero bytes so it is evident what was set */
+    memset(bytes, 0xEE, sizeof(bytes));
+
+    /* call w/zero state should be noop */
+    UT_CF_SetupEncodeState(&state, bytes, 0);
+    CF_CFDP_EncodeCrc16(&state, 0x29b1);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(bytes, 0xEE, sizeof(bytes), "Bytes unchanged");
+
+    /* setup nominal */
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeCrc16(&state, 0x29b1);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
+    UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
+    UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+}
+
 void Test_CF_DecodeIntegerInSize(void)
 {
     /* Test for:
@@ -736,6 +985,7 @@ void Test_CF_CFDP_DecodeHeader(void)
     const uint8            bytes[]   = {0x3c, 0x01, 0x02, 0x00, 0x44, 0x55, 0x66};
     const uint8            bad_eid[] = {0x3c, 0x01, 0x02, 0x73, 0x44, 0x55, 0x66};
     const uint8            bad_tsn[] = {0x3c, 0x01, 0x02, 0x37, 0x44, 0x55, 0x66};
+    const uint8            large[]   = {0x3d, 0x01, 0x02, 0x00, 0x44, 0x55, 0x66};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -762,6 +1012,14 @@ void Test_CF_CFDP_DecodeHeader(void)
     UtAssert_UINT32_EQ(out.sequence_num, 0x55);
     UtAssert_UINT32_EQ(out.destination_eid, 0x66);
     UtAssert_UINT32_EQ(out.header_encoded_length, sizeof(bytes));
+    UtAssert_UINT32_EQ(out.large_flag, 0);
+    UtAssert_BOOL_FALSE(state.codec_state.large_file);
+
+    /* large file, the rest of the PDU uses 64-bit file sizes */
+    UT_CF_SetupDecodeState(&state, large, sizeof(large));
+    UtAssert_INT32_EQ(CF_CFDP_DecodeHeader(&state, &out), 0);
+    UtAssert_UINT32_EQ(out.large_flag, 1);
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
 
     /*
      * Check for EID that would be truncated
@@ -886,7 +1144,9 @@ void Test_CF_CFDP_DecodeSegmentRequest(void)
      */
     CF_DecoderState_t           state;
     CF_Logical_SegmentRequest_t out;
-    const uint8                 bytes[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    const uint8                 bytes[]       = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    const uint8                 bytes_large[] = {0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x33, 0x44,
+                                 0x00, 0x00, 0x00, 0x02, 0x55, 0x66, 0x77, 0x88};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -904,6 +1164,25 @@ void Test_CF_CFDP_DecodeSegmentRequest(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes));
     UtAssert_UINT32_EQ(out.offset_start, 0x11223344);
     UtAssert_UINT32_EQ(out.offset_end, 0x55667788);
+
+    /* large file, offsets past 4 GiB */
+    UT_CF_SetupDecodeState(&state, bytes_large, sizeof(bytes_large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeSegmentRequest(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes_large));
+    UtAssert_True(out.offset_start == 0x111223344, "offset_start (%llx) == 0x111223344",
+                  (unsigned long long)out.offset_start);
+    UtAssert_True(out.offset_end == 0x255667788, "offset_end (%llx) == 0x255667788",
+                  (unsigned long long)out.offset_end);
+
+    /* large file, but only 32-bit fields present */
+    memset(&out, 0xEE, sizeof(out));
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeSegmentRequest(&state, &out);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(&out, 0xEE, sizeof(out), "Bytes unchanged");
 }
 
 void Test_CF_CFDP_DecodeAllTlv(void)
@@ -1017,6 +1296,9 @@ void Test_CF_CFDP_DecodeMd(void)
     CF_Logical_PduMd_t out;
     const uint8        bytes[]     = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
     const uint8        bad_input[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    const uint8        bytes_fec[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's',  'r',  'c',  0x04, 'd',  'e',
+                               's',  't',  0x06, 0x01, 0xaa, 0x02, 0x08, 'C',  'F',  'E',  'C',  0x01,
+                               0x04, 0x01, 0xE0, 0x02, 0x08, 'X',  'F',  'E',  'C',  0x01, 0x08, 0x00, 0x10};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1037,11 +1319,26 @@ void Test_CF_CFDP_DecodeMd(void)
     UtAssert_UINT32_EQ(out.source_filename.length, 3);
     UtAssert_ADDRESS_EQ(out.dest_filename.data_ptr, &bytes[10]);
     UtAssert_UINT32_EQ(out.dest_filename.length, 4);
+    UtAssert_ZERO(out.fec.group_size);
 
     /* The bad input has a long length that would go beyond the end */
     UT_CF_SetupDecodeState(&state, bad_input, sizeof(bad_input));
     CF_CFDP_DecodeMd(&state, &out);
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* forward error correction among other options, a message with another tag is skipped */
+    UT_CF_SetupDecodeState(&state, bytes_fec, sizeof(bytes_fec));
+    CF_CFDP_DecodeMd(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes_fec));
+    UtAssert_UINT32_EQ(out.dest_filename.length, 4);
+    UtAssert_UINT32_EQ(out.fec.group_size, 4);
+    UtAssert_UINT32_EQ(out.fec.segment_size, 480);
+
+    /* an option cut short fails the whole PDU */
+    UT_CF_SetupDecodeState(&state, bytes_fec, sizeof(bytes_fec) - 1);
+    CF_CFDP_DecodeMd(&state, &out);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
 void Test_CF_CFDP_DecodeFileDataHeader(void)
@@ -1056,6 +1353,7 @@ void Test_CF_CFDP_DecodeFileDataHeader(void)
     const uint8 bytes_meta[]  = {0x41, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x13, 0xcc};
     const uint8 bad_input_1[] = {0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x13, 0xcc};
     const uint8 bad_input_2[] = {0x41, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    const uint8 bytes_large[] = {0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0xdd};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1097,6 +1395,111 @@ void Test_CF_CFDP_DecodeFileDataHeader(void)
     UT_CF_SetupDecodeState(&state, bad_input_2, sizeof(bad_input_2));
     CF_CFDP_DecodeFileDataHeader(&state, true, &out);
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* large file, no metadata */
+    UT_CF_SetupDecodeState(&state, bytes_large, sizeof(bytes_large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeFileDataHeader(&state, false, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_True(out.offset == 0x100000013, "offset (%llx) == 0x100000013", (unsigned long long)out.offset);
+    UtAssert_UINT32_EQ(out.data_len, 1);
+    UtAssert_ADDRESS_EQ(out.data_ptr, &bytes_large[8]);
+}
+
+void Test_CF_CFDP_DecodeFileDataFast(void)
+{
+    /* Test for:
+     * bool CF_CFDP_DecodeFileDataFast(CF_DecoderState_t *state, CF_Logical_PduHeader_t *plh,
+     *                                 CF_Logical_PduFileDataHeader_t *plfd);
+     */
+    CF_DecoderState_t              state;
+    CF_Logical_PduHeader_t         hdr;
+    CF_Logical_PduFileDataHeader_t out;
+    const uint8 bytes_1[]   = {0x30, 0x00, 0x07, 0x00, 0x44, 0x55, 0x66, 0x00, 0x00, 0x01, 0x02, 0xdd, 0xee};
+    const uint8 bytes_2[]   = {0x31, 0x00, 0x07, 0x11, 0x00, 0x44, 0x55, 0x66, 0x12, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00,
+                             0x00, 0x00, 0x02, 0xdd};
+    const uint8 bytes_4[]   = {0x30, 0x00, 0x07, 0x33, 0x00, 0x00, 0x00, 0x44, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00,
+                             0x66, 0x00, 0x00, 0x00, 0x09, 0xdd};
+    const uint8 bytes_3[]   = {0x30, 0x00, 0x07, 0x22, 0x00, 0x00, 0x44, 0x00, 0x00, 0x55, 0x00, 0x00, 0x66, 0x00, 0x00,
+                             0x00, 0x09};
+    const uint8 bytes_crc[] = {0x32, 0x00, 0x07, 0x00, 0x44, 0x55, 0x66, 0x00, 0x00, 0x01, 0x02, 0xdd, 0xee};
+    const uint8 bytes_seg[] = {0x30, 0x00, 0x07, 0x08, 0x44, 0x55, 0x66, 0x00, 0x00, 0x01, 0x02, 0xdd, 0xee};
+    const uint8 bytes_dir[] = {0x20, 0x00, 0x07, 0x00, 0x44, 0x55, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+    /* fill with nonzero bytes so it is evident what was set */
+    memset(&hdr, 0xEE, sizeof(hdr));
+    memset(&out, 0xEE, sizeof(out));
+
+    /* decoder in error state, or too short for the fixed header */
+    UT_CF_SetupDecodeState(&state, bytes_1, sizeof(bytes_1));
+    CF_CODEC_SET_DONE(&state);
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UT_CF_SetupDecodeState(&state, bytes_1, 3);
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
+
+    /* nominal, 1 byte EID/TSN */
+    UT_CF_SetupDecodeState(&state, bytes_1, sizeof(bytes_1));
+    UtAssert_BOOL_TRUE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes_1));
+    UtAssert_UINT32_EQ(hdr.version, 1);
+    UtAssert_UINT32_EQ(hdr.pdu_type, 1);
+    UtAssert_UINT32_EQ(hdr.large_flag, 0);
+    UtAssert_UINT32_EQ(hdr.data_encoded_length, 7);
+    UtAssert_UINT32_EQ(hdr.eid_length, 1);
+    UtAssert_UINT32_EQ(hdr.txn_seq_length, 1);
+    UtAssert_UINT32_EQ(hdr.source_eid, 0x44);
+    UtAssert_UINT32_EQ(hdr.sequence_num, 0x55);
+    UtAssert_UINT32_EQ(hdr.destination_eid, 0x66);
+    UtAssert_UINT32_EQ(hdr.header_encoded_length, 7);
+    UtAssert_UINT32_EQ(out.continuation_state, 0);
+    UtAssert_UINT32_EQ(out.segment_list.num_segments, 0);
+    UtAssert_UINT32_EQ(out.offset, 0x102);
+    UtAssert_UINT32_EQ(out.data_len, 2);
+    UtAssert_ADDRESS_EQ(out.data_ptr, &bytes_1[11]);
+
+    /* 2 byte EID/TSN, large file */
+    UT_CF_SetupDecodeState(&state, bytes_2, sizeof(bytes_2));
+    UtAssert_BOOL_TRUE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
+    UtAssert_UINT32_EQ(hdr.large_flag, 1);
+    UtAssert_UINT32_EQ(hdr.source_eid, 0x44);
+    UtAssert_UINT32_EQ(hdr.sequence_num, 0x5566);
+    UtAssert_UINT32_EQ(hdr.destination_eid, 0x1234);
+    UtAssert_UINT32_EQ(hdr.header_encoded_length, 10);
+    UtAssert_True(out.offset == 0x100000002, "offset (%llx) == 0x100000002", (unsigned long long)out.offset);
+    UtAssert_UINT32_EQ(out.data_len, 1);
+    UtAssert_ADDRESS_EQ(out.data_ptr, &bytes_2[18]);
+
+    /* 4 byte EID/TSN */
+    UT_CF_SetupDecodeState(&state, bytes_4, sizeof(bytes_4));
+    UtAssert_BOOL_TRUE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_UINT32_EQ(hdr.source_eid, 0x44);
+    UtAssert_UINT32_EQ(hdr.sequence_num, 0x01020304);
+    UtAssert_UINT32_EQ(hdr.destination_eid, 0x66);
+    UtAssert_UINT32_EQ(hdr.header_encoded_length, 16);
+    UtAssert_UINT32_EQ(out.offset, 9);
+    UtAssert_UINT32_EQ(out.data_len, 1);
+
+    /* no room for the offset, left to the full decode */
+    UT_CF_SetupDecodeState(&state, bytes_1, 10);
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
+
+    /* each of the kinds of PDU left to the full decode */
+    UT_CF_SetupDecodeState(&state, bytes_3, sizeof(bytes_3));
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
+    UT_CF_SetupDecodeState(&state, bytes_crc, sizeof(bytes_crc));
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
+    UT_CF_SetupDecodeState(&state, bytes_seg, sizeof(bytes_seg));
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
+    UT_CF_SetupDecodeState(&state, bytes_dir, sizeof(bytes_dir));
+    UtAssert_BOOL_FALSE(CF_CFDP_DecodeFileDataFast(&state, &hdr, &out));
+    UtAssert_ZERO(CF_CODEC_GET_POSITION(&state));
 }
 
 void Test_CF_CFDP_DecodeEof(void)
@@ -1106,8 +1509,9 @@ void Test_CF_CFDP_DecodeEof(void)
      */
     CF_DecoderState_t   state;
     CF_Logical_PduEof_t out;
-    const uint8         bytes[]     = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
-    const uint8         bad_input[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x06, 0xaa, 0xbb};
+    const uint8         bytes[]       = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
+    const uint8         bad_input[]   = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x06, 0xaa, 0xbb};
+    const uint8         bytes_large[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x45, 0x67};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1135,6 +1539,15 @@ void Test_CF_CFDP_DecodeEof(void)
     UT_CF_SetupDecodeState(&state, bad_input, sizeof(bad_input));
     CF_CFDP_DecodeEof(&state, &out);
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* large file, size of 4 GiB or more */
+    UT_CF_SetupDecodeState(&state, bytes_large, sizeof(bytes_large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeEof(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes_large));
+    UtAssert_UINT32_EQ(out.crc, 0x12345678);
+    UtAssert_True(out.size == 0x100004567, "size (%llx) == 0x100004567", (unsigned long long)out.size);
 }
 
 void Test_CF_CFDP_DecodeFin(void)
@@ -1227,6 +1640,40 @@ void Test_CF_CFDP_DecodeNak(void)
     UtAssert_UINT32_EQ(out.segment_list.segments[1].offset_end, 0x8);
 }
 
+void Test_CF_CFDP_DecodeParity(void)
+{
+    /* Test for:
+     * void CF_CFDP_DecodeParity(CF_DecoderState_t *state, CF_Logical_PduParity_t *plpar);
+     */
+    CF_DecoderState_t      state;
+    CF_Logical_PduParity_t out;
+    const uint8            bytes[] = {0x00, 0x00, 0x12, 0x34, 'x', 'o', 'r'};
+
+    /* fill with nonzero bytes so it is evident what was set */
+    memset(&out, 0xEE, sizeof(out));
+
+    /* call w/zero state should be noop */
+    UT_CF_SetupDecodeState(&state, bytes, 0);
+    CF_CFDP_DecodeParity(&state, &out);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(&out, 0xEE, sizeof(out), "Bytes unchanged");
+
+    /* setup nominal, the parity is the rest of the PDU */
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_DecodeParity(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes));
+    UtAssert_UINT32_EQ(out.offset, 0x1234);
+    UtAssert_UINT32_EQ(out.data_len, 3);
+    UtAssert_ADDRESS_EQ(out.data_ptr, &bytes[4]);
+
+    /* offset only, no parity */
+    UT_CF_SetupDecodeState(&state, bytes, 4);
+    CF_CFDP_DecodeParity(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_ZERO(out.data_len);
+}
+
 void Test_CF_CFDP_DecodeCrc(void)
 {
     /* Test for:
@@ -1253,6 +1700,99 @@ void Test_CF_CFDP_DecodeCrc(void)
     UtAssert_UINT32_EQ(out, 0xdeadbeef);
 }
 
+void Test_CF_CFDP_DecodePduCrc(void)
+{
+    /* Test for:
+     * CFE_Status_t CF_CFDP_DecodePduCrc(CF_DecoderState_t *state, const CF_Logical_PduHeader_t *plh);
+     */
+    CF_DecoderState_t      state;
+    CF_Logical_PduHeader_t plh;
+    uint8                  bytes[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', 0x29, 0xb1, 0xEE};
+
+    memset(&plh, 0, sizeof(plh));
+    plh.header_encoded_length = 4;
+    plh.data_encoded_length   = 7;
+
+    /* nominal, the CRC and trailing bytes are no longer decoded */
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.next_offset = plh.header_encoded_length;
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&state, &plh), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_SIZE(&state), 9);
+    UtAssert_UINT32_EQ(CF_CODEC_GET_REMAIN(&state), 5);
+
+    /* corrupted */
+    bytes[5] ^= 0x10;
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&state, &plh), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    bytes[5] ^= 0x10;
+
+    /* shorter than the header says */
+    UT_CF_SetupDecodeState(&state, bytes, 10);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&state, &plh), CF_SHORT_PDU_ERROR);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* too short to hold a CRC */
+    plh.data_encoded_length = 1;
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&state, &plh), CF_SHORT_PDU_ERROR);
+
+    /* decoder already in error */
+    plh.data_encoded_length = 7;
+    UT_CF_SetupDecodeState(&state, bytes, 0);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&state, &plh), CF_SHORT_PDU_ERROR);
+}
+
+void Test_CF_CFDP_PduCrcRoundTrip(void)
+{
+    /* Test for the PDU CRC across:
+     * CF_CFDP_EncodeHeaderWithoutSize(), CF_CFDP_EncodeHeaderFinalSize(),
+     * CF_CFDP_DecodeHeader() and CF_CFDP_DecodePduCrc()
+     */
+    CF_EncoderState_t      enc;
+    CF_DecoderState_t      dec;
+    CF_Logical_PduHeader_t in;
+    CF_Logical_PduHeader_t out;
+    uint8                  bytes[32];
+    uint8 *                data;
+
+    memset(&in, 0, sizeof(in));
+    memset(&out, 0, sizeof(out));
+    memset(bytes, 0xEE, sizeof(bytes));
+    in.version         = 1;
+    in.pdu_type        = 1;
+    in.crc_flag        = 1;
+    in.txn_seq_length  = 1;
+    in.eid_length      = 1;
+    in.source_eid      = 0x44;
+    in.sequence_num    = 0x55;
+    in.destination_eid = 0x66;
+
+    /* a file data PDU takes all the space left, which must exclude the CRC */
+    UT_CF_SetupEncodeState(&enc, bytes, sizeof(bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&enc, &in);
+    data = CF_CFDP_DoEncodeChunk(&enc, CF_CODEC_GET_REMAIN(&enc));
+    UtAssert_NOT_NULL(data);
+    memset(data, 0xA5, sizeof(bytes) - in.header_encoded_length - sizeof(CF_CFDP_uint16_t));
+    in.data_encoded_length = sizeof(bytes) - in.header_encoded_length;
+    CF_CFDP_EncodeHeaderFinalSize(&enc, &in);
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&enc), sizeof(bytes));
+
+    UT_CF_SetupDecodeState(&dec, bytes, sizeof(bytes));
+    UtAssert_INT32_EQ(CF_CFDP_DecodeHeader(&dec, &out), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(out.crc_flag, 1);
+    UtAssert_UINT32_EQ(out.data_encoded_length, in.data_encoded_length);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&dec, &out), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CF_CODEC_GET_REMAIN(&dec), sizeof(bytes) - in.header_encoded_length - sizeof(CF_CFDP_uint16_t));
+
+    /* any single bit flip is caught */
+    bytes[sizeof(bytes) / 2] ^= 0x01;
+    UT_CF_SetupDecodeState(&dec, bytes, sizeof(bytes));
+    UtAssert_INT32_EQ(CF_CFDP_DecodeHeader(&dec, &out), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePduCrc(&dec, &out), CF_ERROR);
+}
+
 /*******************************************************************************
 **
 **  cf_codec_tests UtTest_Add groups
@@ -1264,6 +1804,8 @@ void Add_CF_Encode_tests(void)
     UtTest_Add(Test_CF_EncodeIntegerInSize, NULL, NULL, "CF_EncodeIntegerInSize");
     UtTest_Add(Test_CF_CFDP_EncodeHeaderWithoutSize, NULL, NULL, "CF_CFDP_EncodeHeaderWithoutSize");
     UtTest_Add(Test_CF_CFDP_EncodeHeaderFinalSize, NULL, NULL, "CF_CFDP_EncodeHeaderFinalSize");
+    UtTest_Add(Test_CF_CFDP_EncodeHeaderTemplate, NULL, NULL, "CF_CFDP_EncodeHeaderTemplate");
+    UtTest_Add(Test_CF_CFDP_EncodeHeaderFromTemplate, NULL, NULL, "CF_CFDP_EncodeHeaderFromTemplate");
     UtTest_Add(Test_CF_CFDP_EncodeFileDirectiveHeader, NULL, NULL, "CF_CFDP_EncodeFileDirectiveHeader");
     UtTest_Add(Test_CF_CFDP_EncodeLV, NULL, NULL, "CF_CFDP_EncodeLV");
     UtTest_Add(Test_CF_CFDP_EncodeTLV, NULL, NULL, "CF_CFDP_EncodeTLV");
@@ -1276,7 +1818,9 @@ void Add_CF_Encode_tests(void)
     UtTest_Add(Test_CF_CFDP_EncodeFin, NULL, NULL, "CF_CFDP_EncodeFin");
     UtTest_Add(Test_CF_CFDP_EncodeAck, NULL, NULL, "CF_CFDP_EncodeAck");
     UtTest_Add(Test_CF_CFDP_EncodeNak, NULL, NULL, "CF_CFDP_EncodeNak");
+    UtTest_Add(Test_CF_CFDP_EncodeParity, NULL, NULL, "CF_CFDP_EncodeParity");
     UtTest_Add(Test_CF_CFDP_EncodeCrc, NULL, NULL, "CF_CFDP_EncodeCrc");
+    UtTest_Add(Test_CF_CFDP_EncodeCrc16, NULL, NULL, "CF_CFDP_EncodeCrc16");
 }
 
 void Add_CF_Decode_tests(void)
@@ -1291,11 +1835,15 @@ void Add_CF_Decode_tests(void)
     UtTest_Add(Test_CF_CFDP_DecodeAllSegments, NULL, NULL, "CF_CFDP_DecodeAllSegments");
     UtTest_Add(Test_CF_CFDP_DecodeMd, NULL, NULL, "CF_CFDP_DecodeMd");
     UtTest_Add(Test_CF_CFDP_DecodeFileDataHeader, NULL, NULL, "CF_CFDP_DecodeFileDataHeader");
+    UtTest_Add(Test_CF_CFDP_DecodeFileDataFast, NULL, NULL, "CF_CFDP_DecodeFileDataFast");
     UtTest_Add(Test_CF_CFDP_DecodeEof, NULL, NULL, "CF_CFDP_DecodeEof");
     UtTest_Add(Test_CF_CFDP_DecodeFin, NULL, NULL, "CF_CFDP_DecodeFin");
     UtTest_Add(Test_CF_CFDP_DecodeAck, NULL, NULL, "CF_CFDP_DecodeAck");
     UtTest_Add(Test_CF_CFDP_DecodeNak, NULL, NULL, "CF_CFDP_DecodeNak");
+    UtTest_Add(Test_CF_CFDP_DecodeParity, NULL, NULL, "CF_CFDP_DecodeParity");
     UtTest_Add(Test_CF_CFDP_DecodeCrc, NULL, NULL, "CF_CFDP_DecodeCrc");
+    UtTest_Add(Test_CF_CFDP_DecodePduCrc, NULL, NULL, "CF_CFDP_DecodePduCrc");
+    UtTest_Add(Test_CF_CFDP_PduCrcRoundTrip, NULL, NULL, "CF_CFDP_PduCrcRoundTrip");
 }
 
 /*******************************************************************************
@@ -57,6 +57,113 @@ void Test_CF_CRC_Digest(void)
     UtAssert_UINT32_EQ(crc.index, 1);
 }
 
+void Test_CF_CRC_Digest_Split(void)
+{
+    CF_Crc_t crc;
+    CF_Crc_t expect;
+    uint8    data[71];
+    size_t   split;
+    size_t   i;
+
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)(0xA5 ^ (i * 37));
+    }
+
+    /* Reference is one byte at a time, which never takes the word or vector path */
+    CF_CRC_Start(&expect);
+    for (i = 1; i < sizeof(data); ++i)
+    {
+        CF_CRC_Digest(&expect, &data[i], 1);
+    }
+
+    /* Any split of an unaligned buffer must give the same state, including a partial word */
+    for (split = 0; split < sizeof(data); ++split)
+    {
+        CF_CRC_Start(&crc);
+        UtAssert_VOIDCALL(CF_CRC_Digest(&crc, &data[1], split));
+        UtAssert_VOIDCALL(CF_CRC_Digest(&crc, &data[1 + split], sizeof(data) - 1 - split));
+        UtAssert_UINT32_EQ(crc.working, expect.working);
+        UtAssert_UINT32_EQ(crc.result, expect.result);
+        UtAssert_UINT32_EQ(crc.index, expect.index);
+    }
+}
+
+void Test_CF_CRC_StartType(void)
+{
+    CF_Crc_t crc;
+
+    memset(&crc, 0xFF, sizeof(crc));
+
+    /* Modular matches CF_CRC_Start */
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, CF_CRC_Type_MODULAR), CFE_SUCCESS);
+    UtAssert_ZERO(crc.working);
+    UtAssert_ZERO(crc.result);
+    UtAssert_ZERO(crc.index);
+    UtAssert_UINT32_EQ(crc.type, CF_CRC_Type_MODULAR);
+
+    /* CRC types start with an inverted register */
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, CF_CRC_Type_CRC32), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(crc.working, 0xFFFFFFFF);
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, CF_CRC_Type_CRC32C), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(crc.working, 0xFFFFFFFF);
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, CF_CRC_Type_NULL), CFE_SUCCESS);
+
+    /* Unsupported types are kept, but digest nothing */
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, 1), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(crc.type, 1);
+    UtAssert_VOIDCALL(CF_CRC_Digest(&crc, (const uint8 *)"1234", 4));
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_ZERO(crc.result);
+    UtAssert_INT32_EQ(CF_CRC_StartType(&crc, CF_CRC_Type_NUM), CFE_STATUS_NOT_IMPLEMENTED);
+}
+
+void Test_CF_CRC_ValidateType(void)
+{
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(CF_CRC_Type_MODULAR), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(CF_CRC_Type_CRC32C), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(CF_CRC_Type_CRC32), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(CF_CRC_Type_NULL), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(1), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CF_CRC_ValidateType(CF_CRC_Type_NUM), CFE_STATUS_NOT_IMPLEMENTED);
+}
+
+void Test_CF_CRC_Crc32(void)
+{
+    static const uint8 check[] = "123456789";
+    CF_Crc_t           crc;
+    uint8              type;
+    uint32             expect;
+    size_t             split;
+
+    /* The standard check values, over any split, and continuing after a finalize */
+    for (type = CF_CRC_Type_CRC32C; type <= CF_CRC_Type_CRC32; ++type)
+    {
+        expect = (type == CF_CRC_Type_CRC32) ? 0xCBF43926 : 0xE3069283;
+
+        for (split = 0; split < (sizeof(check) - 1); ++split)
+        {
+            CF_CRC_StartType(&crc, type);
+            UtAssert_VOIDCALL(CF_CRC_Digest(&crc, check, split));
+            UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+            UtAssert_VOIDCALL(CF_CRC_Digest(&crc, &check[split], sizeof(check) - 1 - split));
+            UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+            UtAssert_UINT32_EQ(crc.result, expect);
+        }
+    }
+}
+
+void Test_CF_CRC_Null(void)
+{
+    CF_Crc_t crc;
+    uint8    data[] = {1, 2, 3, 4, 5};
+
+    CF_CRC_StartType(&crc, CF_CRC_Type_NULL);
+    UtAssert_VOIDCALL(CF_CRC_Digest(&crc, data, sizeof(data)));
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_ZERO(crc.result);
+}
+
 void Test_CF_CRC_Finalize(void)
 {
     CF_Crc_t crc;
@@ -85,5 +192,10 @@ void UtTest_Setup(void)
 {
     TEST_CF_ADD(Test_CF_CRC_Start);
     TEST_CF_ADD(Test_CF_CRC_Digest);
+    TEST_CF_ADD(Test_CF_CRC_Digest_Split);
     TEST_CF_ADD(Test_CF_CRC_Finalize);
+    TEST_CF_ADD(Test_CF_CRC_StartType);
+    TEST_CF_ADD(Test_CF_CRC_ValidateType);
+    TEST_CF_ADD(Test_CF_CRC_Crc32);
+    TEST_CF_ADD(Test_CF_CRC_Null);
 }
@@ -0,0 +1,264 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_fec.h"
+
+/* groups of 4 segments of 10 bytes */
+static const CF_Logical_FecParams_t UT_CF_FEC_PARAMS = {4, 10};
+
+void Test_CF_Fec_Xor(void)
+{
+    uint8 dst[] = {0x00, 0xFF, 0x5A, 0x12};
+    uint8 src[] = {0xFF, 0xFF, 0xA5, 0x34};
+
+    UtAssert_VOIDCALL(CF_Fec_Xor(dst, src, 0));
+    UtAssert_UINT8_EQ(dst[0], 0x00);
+
+    UtAssert_VOIDCALL(CF_Fec_Xor(dst, src, sizeof(dst)));
+    UtAssert_UINT8_EQ(dst[0], 0xFF);
+    UtAssert_UINT8_EQ(dst[1], 0x00);
+    UtAssert_UINT8_EQ(dst[2], 0xFF);
+    UtAssert_UINT8_EQ(dst[3], 0x26);
+}
+
+void Test_CF_Fec_SegmentEnd(void)
+{
+    UtAssert_UINT32_EQ(CF_Fec_SegmentEnd(&UT_CF_FEC_PARAMS, 0), 10);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentEnd(&UT_CF_FEC_PARAMS, 9), 10);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentEnd(&UT_CF_FEC_PARAMS, 10), 20);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentEnd(&UT_CF_FEC_PARAMS, 45), 50);
+}
+
+void Test_CF_Fec_GroupEnd(void)
+{
+    UtAssert_UINT32_EQ(CF_Fec_GroupEnd(&UT_CF_FEC_PARAMS, 0, 100), 40);
+    UtAssert_UINT32_EQ(CF_Fec_GroupEnd(&UT_CF_FEC_PARAMS, 40, 100), 80);
+
+    /* last group is cut short at the end of the file */
+    UtAssert_UINT32_EQ(CF_Fec_GroupEnd(&UT_CF_FEC_PARAMS, 80, 100), 100);
+}
+
+void Test_CF_Fec_SegmentLength(void)
+{
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 0, 0, 100), 10);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 80, 1, 100), 10);
+
+    /* short last segment, and segments past the end of the file */
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 80, 0, 95), 10);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 80, 1, 95), 5);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 80, 2, 95), 0);
+    UtAssert_UINT32_EQ(CF_Fec_SegmentLength(&UT_CF_FEC_PARAMS, 80, 3, 95), 0);
+}
+
+void Test_CF_FecEncoder_Init(void)
+{
+    CF_FecEncoder_t enc;
+
+    memset(&enc, 0xFF, sizeof(enc));
+    enc.in_use = true;
+
+    UtAssert_VOIDCALL(CF_FecEncoder_Init(&enc, &UT_CF_FEC_PARAMS));
+    UtAssert_UINT8_EQ(enc.params.group_size, 4);
+    UtAssert_UINT16_EQ(enc.params.segment_size, 10);
+    UtAssert_ZERO(enc.group_offset);
+    UtAssert_ZERO(enc.parity_len);
+    UtAssert_BOOL_FALSE(enc.ready);
+    UtAssert_ZERO(enc.parity[0]);
+    UtAssert_ZERO(enc.parity[sizeof(enc.parity) - 1]);
+
+    /* ownership is up to the caller */
+    UtAssert_BOOL_TRUE(enc.in_use);
+}
+
+void Test_CF_FecEncoder_Add(void)
+{
+    CF_FecEncoder_t enc;
+    uint8           data[10];
+
+    memset(data, 0x0F, sizeof(data));
+    memset(&enc, 0, sizeof(enc));
+    CF_FecEncoder_Init(&enc, &UT_CF_FEC_PARAMS);
+
+    /* first half of segment 0, then segment 1 whole */
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 0, data, 5, 100));
+    UtAssert_UINT32_EQ(enc.parity_len, 5);
+    UtAssert_UINT8_EQ(enc.parity[0], 0x0F);
+    UtAssert_UINT8_EQ(enc.parity[5], 0x00);
+    memset(data, 0xF0, sizeof(data));
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 10, data, 10, 100));
+    UtAssert_UINT32_EQ(enc.parity_len, 10);
+    UtAssert_UINT8_EQ(enc.parity[0], 0xFF);
+    UtAssert_UINT8_EQ(enc.parity[9], 0xF0);
+    UtAssert_BOOL_FALSE(enc.ready);
+
+    /* data outside the group, or across a segment boundary, is ignored */
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 40, data, 10, 100));
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 25, data, 10, 100));
+    UtAssert_UINT8_EQ(enc.parity[0], 0xFF);
+    UtAssert_BOOL_FALSE(enc.ready);
+
+    /* the end of the group makes the parity ready */
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 30, data, 10, 100));
+    UtAssert_UINT8_EQ(enc.parity[0], 0x0F);
+    UtAssert_BOOL_TRUE(enc.ready);
+
+    /* a group cut short by the end of the file */
+    CF_FecEncoder_Init(&enc, &UT_CF_FEC_PARAMS);
+    enc.group_offset = 80;
+    UtAssert_VOIDCALL(CF_FecEncoder_Add(&enc, 90, data, 5, 95));
+    UtAssert_UINT32_EQ(enc.parity_len, 5);
+    UtAssert_BOOL_TRUE(enc.ready);
+}
+
+void Test_CF_FecEncoder_NextGroup(void)
+{
+    CF_FecEncoder_t enc;
+
+    memset(&enc, 0, sizeof(enc));
+    CF_FecEncoder_Init(&enc, &UT_CF_FEC_PARAMS);
+    enc.parity_len = 10;
+    enc.ready      = true;
+    enc.parity[3]  = 0x55;
+
+    UtAssert_VOIDCALL(CF_FecEncoder_NextGroup(&enc));
+    UtAssert_UINT32_EQ(enc.group_offset, 40);
+    UtAssert_ZERO(enc.parity_len);
+    UtAssert_BOOL_FALSE(enc.ready);
+    UtAssert_ZERO(enc.parity[3]);
+}
+
+void Test_CF_FecDecoder_Init(void)
+{
+    CF_FecDecoder_t        dec;
+    CF_Logical_FecParams_t params;
+
+    memset(&dec, 0xFF, sizeof(dec));
+    UtAssert_VOIDCALL(CF_FecDecoder_Init(&dec, &UT_CF_FEC_PARAMS));
+    UtAssert_UINT8_EQ(dec.params.group_size, 4);
+    UtAssert_UINT16_EQ(dec.params.segment_size, 10);
+    UtAssert_ZERO(dec.group_offset);
+    UtAssert_ZERO(dec.recv_mask);
+
+    /* parameters the decoder cannot handle leave it disabled */
+    params            = UT_CF_FEC_PARAMS;
+    params.group_size = 0;
+    UtAssert_VOIDCALL(CF_FecDecoder_Init(&dec, &params));
+    UtAssert_ZERO(dec.params.group_size);
+
+    params.group_size = CF_FEC_MAX_GROUP_SIZE + 1;
+    UtAssert_VOIDCALL(CF_FecDecoder_Init(&dec, &params));
+    UtAssert_ZERO(dec.params.group_size);
+
+    params              = UT_CF_FEC_PARAMS;
+    params.segment_size = 0;
+    UtAssert_VOIDCALL(CF_FecDecoder_Init(&dec, &params));
+    UtAssert_ZERO(dec.params.group_size);
+
+    params.segment_size = CF_FEC_MAX_SEGMENT_SIZE + 1;
+    UtAssert_VOIDCALL(CF_FecDecoder_Init(&dec, &params));
+    UtAssert_ZERO(dec.params.group_size);
+}
+
+void Test_CF_FecDecoder_Add(void)
+{
+    CF_FecDecoder_t dec;
+
+    /* disabled decoder does nothing */
+    memset(&dec, 0, sizeof(dec));
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 0, 10, 100));
+    UtAssert_ZERO(dec.recv_mask);
+
+    CF_FecDecoder_Init(&dec, &UT_CF_FEC_PARAMS);
+
+    /* whole segment, and a part that does not complete one */
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 0, 10, 100));
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x1);
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 10, 5, 100));
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x1);
+
+    /* data spanning two segments only counts the one it covers */
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 15, 15, 100));
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x5);
+
+    /* a later group starts over, and an earlier one is ignored */
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 50, 10, 100));
+    UtAssert_UINT32_EQ(dec.group_offset, 40);
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x2);
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 30, 10, 100));
+    UtAssert_UINT32_EQ(dec.group_offset, 40);
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x2);
+
+    /* short last segment at the end of the file */
+    UtAssert_VOIDCALL(CF_FecDecoder_Add(&dec, 90, 5, 95));
+    UtAssert_UINT32_EQ(dec.group_offset, 80);
+    UtAssert_UINT32_EQ(dec.recv_mask, 0x2);
+}
+
+void Test_CF_FecDecoder_GetLost(void)
+{
+    CF_FecDecoder_t dec;
+    uint8           lost = 0xFF;
+
+    /* disabled decoder */
+    memset(&dec, 0, sizeof(dec));
+    UtAssert_BOOL_FALSE(CF_FecDecoder_GetLost(&dec, 0, 100, &lost));
+
+    CF_FecDecoder_Init(&dec, &UT_CF_FEC_PARAMS);
+    CF_FecDecoder_Add(&dec, 0, 20, 100);
+    CF_FecDecoder_Add(&dec, 30, 10, 100);
+
+    /* exactly one segment missing */
+    UtAssert_BOOL_TRUE(CF_FecDecoder_GetLost(&dec, 0, 100, &lost));
+    UtAssert_UINT8_EQ(lost, 2);
+
+    /* unaligned offset */
+    UtAssert_BOOL_FALSE(CF_FecDecoder_GetLost(&dec, 10, 100, &lost));
+
+    /* nothing known of a later group, so more than one is missing */
+    UtAssert_BOOL_FALSE(CF_FecDecoder_GetLost(&dec, 40, 100, &lost));
+
+    /* nothing missing */
+    CF_FecDecoder_Add(&dec, 20, 10, 100);
+    UtAssert_BOOL_FALSE(CF_FecDecoder_GetLost(&dec, 0, 100, &lost));
+
+    /* an earlier group is gone */
+    CF_FecDecoder_Add(&dec, 40, 10, 100);
+    UtAssert_BOOL_FALSE(CF_FecDecoder_GetLost(&dec, 0, 100, &lost));
+
+    /* a later group of one segment, past the end of the rest of the file */
+    lost = 0xFF;
+    UtAssert_BOOL_TRUE(CF_FecDecoder_GetLost(&dec, 80, 85, &lost));
+    UtAssert_UINT8_EQ(lost, 0);
+}
+
+void UtTest_Setup(void)
+{
+    TEST_CF_ADD(Test_CF_Fec_Xor);
+    TEST_CF_ADD(Test_CF_Fec_SegmentEnd);
+    TEST_CF_ADD(Test_CF_Fec_GroupEnd);
+    TEST_CF_ADD(Test_CF_Fec_SegmentLength);
+    TEST_CF_ADD(Test_CF_FecEncoder_Init);
+    TEST_CF_ADD(Test_CF_FecEncoder_Add);
+    TEST_CF_ADD(Test_CF_FecEncoder_NextGroup);
+    TEST_CF_ADD(Test_CF_FecDecoder_Init);
+    TEST_CF_ADD(Test_CF_FecDecoder_Add);
+    TEST_CF_ADD(Test_CF_FecDecoder_GetLost);
+}
@@ -0,0 +1,313 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_history.h"
+
+/*******************************************************************************
+**
+**  cf_history_tests local data
+**
+*******************************************************************************/
+
+#define UT_CF_NUM_RECORDS 4
+#define UT_CF_NAMES_SIZE  (CF_FILENAME_MAX_LEN * 2)
+#define UT_CF_LOCAL_EID   23
+
+static CF_HistoryRecord_t UT_CF_HistoryRecords[UT_CF_NUM_RECORDS];
+static char               UT_CF_HistoryNames[UT_CF_NAMES_SIZE];
+static CF_NameTable_t     UT_CF_HistoryPrefixes;
+static CF_HistoryRing_t   UT_CF_History;
+static CF_ConfigTable_t   UT_CF_ConfigTable;
+
+/*******************************************************************************
+**
+**  cf_history_tests Setup and Teardown
+**
+*******************************************************************************/
+
+void cf_history_tests_Setup(void)
+{
+    cf_tests_Setup();
+
+    memset(&UT_CF_ConfigTable, 0, sizeof(UT_CF_ConfigTable));
+    UT_CF_ConfigTable.local_eid = UT_CF_LOCAL_EID;
+    CF_AppData.config_table     = &UT_CF_ConfigTable;
+
+    CF_HistoryRing_Init(&UT_CF_History, UT_CF_HistoryRecords, UT_CF_NUM_RECORDS, UT_CF_HistoryNames,
+                        UT_CF_NAMES_SIZE, &UT_CF_HistoryPrefixes);
+}
+
+void cf_history_tests_Teardown(void)
+{
+    cf_tests_Teardown();
+}
+
+/*******************************************************************************
+**
+**  cf_history_tests local helpers
+**
+*******************************************************************************/
+
+static void UT_CF_History_Add(CF_Direction_t dir, CF_TransactionSeq_t seq_num, const char *src, const char *dst)
+{
+    CF_History_t history;
+
+    memset(&history, 0, sizeof(history));
+    history.dir      = dir;
+    history.seq_num  = seq_num;
+    history.peer_eid = 45;
+    history.txn_stat = CF_TxnStatus_FILESTORE_REJECTION;
+    snprintf(history.fnames.src_filename, sizeof(history.fnames.src_filename), "%s", src);
+    snprintf(history.fnames.dst_filename, sizeof(history.fnames.dst_filename), "%s", dst);
+
+    CF_HistoryRing_Add(&UT_CF_History, &history);
+}
+
+/*******************************************************************************
+**
+**  CF_HistoryRing_Init tests
+**
+*******************************************************************************/
+
+void Test_CF_HistoryRing_Init(void)
+{
+    /* Arrange */
+    UT_CF_History.count = 3;
+
+    /* Act */
+    CF_HistoryRing_Init(&UT_CF_History, UT_CF_HistoryRecords, UT_CF_NUM_RECORDS, UT_CF_HistoryNames,
+                        UT_CF_NAMES_SIZE, &UT_CF_HistoryPrefixes);
+
+    /* Assert */
+    UtAssert_ADDRESS_EQ(UT_CF_History.records, UT_CF_HistoryRecords);
+    UtAssert_ADDRESS_EQ(UT_CF_History.names, UT_CF_HistoryNames);
+    UtAssert_ADDRESS_EQ(UT_CF_History.prefixes, &UT_CF_HistoryPrefixes);
+    UtAssert_UINT32_EQ(UT_CF_History.num_records, UT_CF_NUM_RECORDS);
+    UtAssert_UINT32_EQ(UT_CF_History.names_size, UT_CF_NAMES_SIZE);
+    UtAssert_ZERO(UT_CF_History.count);
+    UtAssert_ZERO(UT_CF_History.names_head);
+}
+
+/*******************************************************************************
+**
+**  CF_HistoryRing_Add and CF_HistoryRing_Get tests
+**
+*******************************************************************************/
+
+void Test_CF_HistoryRing_Add_SameLeaf(void)
+{
+    /* Arrange */
+    CF_History_t history;
+
+    /* Act */
+    UT_CF_History_Add(CF_Direction_TX, 10, "/src/file1", "/dst/file1");
+
+    /* Assert - the destination leaf is not stored twice */
+    UtAssert_UINT32_EQ(UT_CF_History.count, 1);
+    UtAssert_UINT32_EQ(UT_CF_History.names_head, 6);
+    UtAssert_STRINGBUF_EQ(UT_CF_HistoryNames, sizeof(UT_CF_HistoryNames), "file1", -1);
+    UtAssert_BOOL_TRUE(UT_CF_HistoryRecords[0].flags & CF_HISTORY_FLAG_SAME_LEAF);
+    UtAssert_STUB_COUNT(CF_NameTable_InternPath, 2);
+
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_INT32_EQ(history.dir, CF_Direction_TX);
+    UtAssert_INT32_EQ(history.txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
+    UtAssert_UINT32_EQ(history.seq_num, 10);
+    UtAssert_UINT32_EQ(history.peer_eid, 45);
+    UtAssert_UINT32_EQ(history.src_eid, UT_CF_LOCAL_EID);
+    UtAssert_STRINGBUF_EQ(history.fnames.src_filename, sizeof(history.fnames.src_filename), "file1", -1);
+    UtAssert_STRINGBUF_EQ(history.fnames.dst_filename, sizeof(history.fnames.dst_filename), "file1", -1);
+    UtAssert_STUB_COUNT(CF_NameTable_BuildPath, 2);
+}
+
+void Test_CF_HistoryRing_Add_DifferentLeaf(void)
+{
+    /* Arrange */
+    CF_History_t history;
+
+    /* Act */
+    UT_CF_History_Add(CF_Direction_RX, 11, "/src/a", "/dst/bc");
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_CF_History.names_head, 5);
+    UtAssert_BOOL_FALSE(UT_CF_HistoryRecords[0].flags & CF_HISTORY_FLAG_SAME_LEAF);
+
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_INT32_EQ(history.dir, CF_Direction_RX);
+    UtAssert_UINT32_EQ(history.src_eid, 45);
+    UtAssert_STRINGBUF_EQ(history.fnames.src_filename, sizeof(history.fnames.src_filename), "a", -1);
+    UtAssert_STRINGBUF_EQ(history.fnames.dst_filename, sizeof(history.fnames.dst_filename), "bc", -1);
+}
+
+void Test_CF_HistoryRing_Add_PrefixTableFull(void)
+{
+    /* Arrange */
+    CF_History_t history;
+
+    UT_SetDeferredRetcode(UT_KEY(CF_NameTable_InternPath), 1, CF_NAME_HANDLE_INVALID);
+
+    /* Act */
+    UT_CF_History_Add(CF_Direction_TX, 12, "/src/file", "/dst/file");
+
+    /* Assert - the whole source name is kept instead */
+    UtAssert_UINT32_EQ(UT_CF_HistoryRecords[0].src_prefix, CF_NAME_HANDLE_INVALID);
+    UtAssert_BOOL_FALSE(UT_CF_HistoryRecords[0].flags & CF_HISTORY_FLAG_SAME_LEAF);
+
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_STRINGBUF_EQ(history.fnames.src_filename, sizeof(history.fnames.src_filename), "/src/file", -1);
+    UtAssert_STRINGBUF_EQ(history.fnames.dst_filename, sizeof(history.fnames.dst_filename), "file", -1);
+}
+
+void Test_CF_HistoryRing_Add_RecordsFull(void)
+{
+    /* Arrange */
+    CF_History_t history;
+    int          i;
+
+    for (i = 0; i < UT_CF_NUM_RECORDS; ++i)
+    {
+        UT_CF_History_Add(CF_Direction_TX, i, "/a/f", "/b/f");
+    }
+
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 0);
+
+    /* Act */
+    UT_CF_History_Add(CF_Direction_TX, UT_CF_NUM_RECORDS, "/a/f", "/b/f");
+
+    /* Assert - the oldest entry is dropped */
+    UtAssert_UINT32_EQ(UT_CF_History.count, UT_CF_NUM_RECORDS);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 2);
+
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_UINT32_EQ(history.seq_num, 1);
+    CF_HistoryRing_Get(&UT_CF_History, UT_CF_NUM_RECORDS - 1, &history);
+    UtAssert_UINT32_EQ(history.seq_num, UT_CF_NUM_RECORDS);
+}
+
+void Test_CF_HistoryRing_Add_NamesFull(void)
+{
+    /* Arrange */
+    char         path[CF_FILENAME_MAX_LEN];
+    CF_History_t history;
+    uint16       len;
+
+    /* each entry takes a third of the arena, less a few bytes */
+    len = (UT_CF_NAMES_SIZE / 3) - 1;
+    memset(path, 0, sizeof(path));
+    path[0] = '/';
+    memset(&path[1], 'x', len - 1);
+
+    UT_CF_History_Add(CF_Direction_TX, 1, path, path);
+    UT_CF_History_Add(CF_Direction_TX, 2, path, path);
+    UT_CF_History_Add(CF_Direction_TX, 3, path, path);
+    UtAssert_UINT32_EQ(UT_CF_History.names_head, 3 * len);
+
+    /* Act - no room at the end, so the next one wraps around over the oldest */
+    UT_CF_History_Add(CF_Direction_TX, 4, path, path);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_CF_History.count, 3);
+    UtAssert_UINT32_EQ(UT_CF_History.names_head, len);
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_UINT32_EQ(history.seq_num, 2);
+
+    /* Act - the space after the newest is in use by the oldest */
+    UT_CF_History_Add(CF_Direction_TX, 5, path, path);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_CF_History.count, 3);
+    UtAssert_UINT32_EQ(UT_CF_History.names_head, 2 * len);
+    CF_HistoryRing_Get(&UT_CF_History, 0, &history);
+    UtAssert_UINT32_EQ(history.seq_num, 3);
+    CF_HistoryRing_Get(&UT_CF_History, 2, &history);
+    UtAssert_UINT32_EQ(history.seq_num, 5);
+    UtAssert_STRINGBUF_EQ(history.fnames.src_filename, sizeof(history.fnames.src_filename), &path[1], -1);
+}
+
+/*******************************************************************************
+**
+**  CF_HistoryRing_Clear tests
+**
+*******************************************************************************/
+
+void Test_CF_HistoryRing_Clear(void)
+{
+    /* Arrange */
+    UT_CF_History_Add(CF_Direction_TX, 1, "/a/f", "/b/f");
+    UT_CF_History_Add(CF_Direction_RX, 2, "/a/g", "/b/g");
+
+    /* Act */
+    CF_HistoryRing_Clear(&UT_CF_History);
+
+    /* Assert */
+    UtAssert_ZERO(UT_CF_History.count);
+    UtAssert_ZERO(UT_CF_History.names_head);
+    UtAssert_STUB_COUNT(CF_NameTable_Release, 4);
+}
+
+/*******************************************************************************
+**
+**  cf_history_tests UtTest_Add groups
+**
+*******************************************************************************/
+
+void add_CF_HistoryRing_Init_tests(void)
+{
+    UtTest_Add(Test_CF_HistoryRing_Init, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Init");
+}
+
+void add_CF_HistoryRing_Add_tests(void)
+{
+    UtTest_Add(Test_CF_HistoryRing_Add_SameLeaf, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Add_SameLeaf");
+    UtTest_Add(Test_CF_HistoryRing_Add_DifferentLeaf, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Add_DifferentLeaf");
+    UtTest_Add(Test_CF_HistoryRing_Add_PrefixTableFull, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Add_PrefixTableFull");
+    UtTest_Add(Test_CF_HistoryRing_Add_RecordsFull, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Add_RecordsFull");
+    UtTest_Add(Test_CF_HistoryRing_Add_NamesFull, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Add_NamesFull");
+}
+
+void add_CF_HistoryRing_Clear_tests(void)
+{
+    UtTest_Add(Test_CF_HistoryRing_Clear, cf_history_tests_Setup, cf_history_tests_Teardown,
+               "Test_CF_HistoryRing_Clear");
+}
+
+/*******************************************************************************
+**
+**  cf_history_tests test UtTest_Setup
+**
+*******************************************************************************/
+
+void UtTest_Setup(void)
+{
+    TestUtil_InitializeRandomSeed();
+
+    add_CF_HistoryRing_Init_tests();
+
+    add_CF_HistoryRing_Add_tests();
+
+    add_CF_HistoryRing_Clear_tests();
+}
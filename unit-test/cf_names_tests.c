@@ -0,0 +1,369 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_names.h"
+
+/*******************************************************************************
+**
+**  cf_names_tests local data
+**
+*******************************************************************************/
+
+#define UT_CF_NUM_NAMES 3
+
+static CF_NameEntry_t UT_CF_NameMem[UT_CF_NUM_NAMES];
+static CF_NameTable_t UT_CF_Names;
+
+/*******************************************************************************
+**
+**  cf_names_tests Setup and Teardown
+**
+*******************************************************************************/
+
+void cf_names_tests_Setup(void)
+{
+    cf_tests_Setup();
+
+    CF_NameTable_Init(&UT_CF_Names, UT_CF_NameMem, UT_CF_NUM_NAMES);
+}
+
+void cf_names_tests_Teardown(void)
+{
+    cf_tests_Teardown();
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_Init tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_Init(void)
+{
+    /* Arrange */
+    UT_CF_NameMem[1].refs = 5;
+    UT_CF_Names.num_used  = 2;
+
+    /* Act */
+    CF_NameTable_Init(&UT_CF_Names, UT_CF_NameMem, UT_CF_NUM_NAMES);
+
+    /* Assert */
+    UtAssert_ADDRESS_EQ(UT_CF_Names.entries, UT_CF_NameMem);
+    UtAssert_UINT32_EQ(UT_CF_Names.num_entries, UT_CF_NUM_NAMES);
+    UtAssert_ZERO(UT_CF_Names.num_used);
+    UtAssert_ZERO(UT_CF_NameMem[1].refs);
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_Intern tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_Intern_NewAndDuplicate(void)
+{
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/cf/a/xyz", 6), 0);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/cf/b/", 6), 1);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/cf/a/", 6), 0);
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(UT_CF_NameMem[0].str, sizeof(UT_CF_NameMem[0].str), "/cf/a/", -1);
+    UtAssert_UINT32_EQ(UT_CF_NameMem[0].refs, 2);
+    UtAssert_UINT32_EQ(UT_CF_NameMem[1].refs, 1);
+    UtAssert_UINT32_EQ(UT_CF_Names.num_used, 2);
+}
+
+void Test_CF_NameTable_Intern_PrefixOfExisting(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/cf/ab/", 7), 0);
+
+    /* Act - a shorter string that matches the start of an entry is a different string */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/cf/a", 5), 1);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_CF_NameMem[0].refs, 1);
+    UtAssert_UINT32_EQ(UT_CF_NameMem[1].refs, 1);
+}
+
+void Test_CF_NameTable_Intern_ReusesFreedEntry(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/b/", 3), 1);
+    CF_NameTable_Release(&UT_CF_Names, 0);
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/c/", 3), 0);
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(UT_CF_NameMem[0].str, sizeof(UT_CF_NameMem[0].str), "/c/", -1);
+    UtAssert_UINT32_EQ(UT_CF_Names.num_used, 2);
+}
+
+void Test_CF_NameTable_Intern_Full(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/b/", 3), 1);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/c/", 3), 2);
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/d/", 3), CF_NAME_HANDLE_INVALID);
+
+    /* Assert - an existing string can still be referenced */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/b/", 3), 1);
+    UtAssert_UINT32_EQ(UT_CF_Names.num_used, UT_CF_NUM_NAMES);
+}
+
+void Test_CF_NameTable_Intern_TooLong(void)
+{
+    /* Arrange */
+    char str[sizeof(UT_CF_NameMem[0].str)];
+
+    memset(str, 'x', sizeof(str));
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, str, sizeof(str)), CF_NAME_HANDLE_INVALID);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, str, sizeof(str) - 1), 0);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(strlen(UT_CF_NameMem[0].str), sizeof(str) - 1);
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_AddRef and CF_NameTable_Release tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_AddRef_Release(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+
+    /* Act */
+    CF_NameTable_AddRef(&UT_CF_Names, 0);
+    UtAssert_UINT32_EQ(UT_CF_NameMem[0].refs, 2);
+    CF_NameTable_Release(&UT_CF_Names, 0);
+    UtAssert_UINT32_EQ(UT_CF_Names.num_used, 1);
+    CF_NameTable_Release(&UT_CF_Names, 0);
+
+    /* Assert */
+    UtAssert_ZERO(UT_CF_NameMem[0].refs);
+    UtAssert_ZERO(UT_CF_Names.num_used);
+}
+
+void Test_CF_NameTable_Release_Invalid(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+
+    /* Act */
+    CF_NameTable_Release(&UT_CF_Names, CF_NAME_HANDLE_INVALID);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_CF_Names.num_used, 1);
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_Get tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_Get(void)
+{
+    /* Arrange */
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+
+    /* Act */
+    UtAssert_STRINGBUF_EQ(CF_NameTable_Get(&UT_CF_Names, 0), -1, "/a/", -1);
+    UtAssert_STRINGBUF_EQ(CF_NameTable_Get(&UT_CF_Names, CF_NAME_HANDLE_INVALID), -1, "", -1);
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_InternPath tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_InternPath_SplitAtSlash(void)
+{
+    /* Arrange */
+    char leaf[20];
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/cf/dir/file.dat", leaf, sizeof(leaf)), 0);
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(leaf, sizeof(leaf), "file.dat", -1);
+    UtAssert_STRINGBUF_EQ(UT_CF_NameMem[0].str, sizeof(UT_CF_NameMem[0].str), "/cf/dir/", -1);
+}
+
+void Test_CF_NameTable_InternPath_NoSlash(void)
+{
+    /* Arrange */
+    char leaf[20];
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "file.dat", leaf, sizeof(leaf)), 0);
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(leaf, sizeof(leaf), "file.dat", -1);
+    UtAssert_STRINGBUF_EQ(UT_CF_NameMem[0].str, sizeof(UT_CF_NameMem[0].str), "", -1);
+}
+
+void Test_CF_NameTable_InternPath_LongLeaf(void)
+{
+    /* Arrange */
+    char leaf[8];
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/cf/long_file_name", leaf, sizeof(leaf)),
+                       CF_NAME_HANDLE_INVALID);
+
+    /* Assert - the name is not split, so no table entry is taken */
+    UtAssert_ZERO(UT_CF_Names.num_used);
+
+    /* a leaf that just fits */
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/cf/1234567", leaf, sizeof(leaf)), 0);
+    UtAssert_STRINGBUF_EQ(leaf, sizeof(leaf), "1234567", -1);
+}
+
+void Test_CF_NameTable_InternPath_Full(void)
+{
+    /* Arrange */
+    char leaf[20];
+
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/a/", 3), 0);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/b/", 3), 1);
+    UtAssert_UINT32_EQ(CF_NameTable_Intern(&UT_CF_Names, "/c/", 3), 2);
+
+    /* Act */
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/d/file", leaf, sizeof(leaf)), CF_NAME_HANDLE_INVALID);
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/b/file", leaf, sizeof(leaf)), 1);
+}
+
+/*******************************************************************************
+**
+**  CF_NameTable_BuildPath tests
+**
+*******************************************************************************/
+
+void Test_CF_NameTable_BuildPath(void)
+{
+    /* Arrange */
+    char leaf[20];
+    char path[32];
+
+    UtAssert_UINT32_EQ(CF_NameTable_InternPath(&UT_CF_Names, "/cf/dir/file.dat", leaf, sizeof(leaf)), 0);
+
+    /* Act */
+    CF_NameTable_BuildPath(&UT_CF_Names, 0, leaf, path, sizeof(path));
+    UtAssert_STRINGBUF_EQ(path, sizeof(path), "/cf/dir/file.dat", -1);
+
+    CF_NameTable_BuildPath(&UT_CF_Names, 0, leaf, path, 8);
+    UtAssert_STRINGBUF_EQ(path, sizeof(path), "/cf/dir", -1);
+
+    CF_NameTable_BuildPath(&UT_CF_Names, CF_NAME_HANDLE_INVALID, leaf, path, sizeof(path));
+    UtAssert_STRINGBUF_EQ(path, sizeof(path), "file.dat", -1);
+}
+
+/*******************************************************************************
+**
+**  cf_names_tests UtTest_Add groups
+**
+*******************************************************************************/
+
+void add_CF_NameTable_Init_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_Init, cf_names_tests_Setup, cf_names_tests_Teardown, "Test_CF_NameTable_Init");
+}
+
+void add_CF_NameTable_Intern_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_Intern_NewAndDuplicate, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Intern_NewAndDuplicate");
+    UtTest_Add(Test_CF_NameTable_Intern_PrefixOfExisting, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Intern_PrefixOfExisting");
+    UtTest_Add(Test_CF_NameTable_Intern_ReusesFreedEntry, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Intern_ReusesFreedEntry");
+    UtTest_Add(Test_CF_NameTable_Intern_Full, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Intern_Full");
+    UtTest_Add(Test_CF_NameTable_Intern_TooLong, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Intern_TooLong");
+}
+
+void add_CF_NameTable_AddRef_Release_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_AddRef_Release, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_AddRef_Release");
+    UtTest_Add(Test_CF_NameTable_Release_Invalid, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_Release_Invalid");
+}
+
+void add_CF_NameTable_Get_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_Get, cf_names_tests_Setup, cf_names_tests_Teardown, "Test_CF_NameTable_Get");
+}
+
+void add_CF_NameTable_InternPath_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_InternPath_SplitAtSlash, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_InternPath_SplitAtSlash");
+    UtTest_Add(Test_CF_NameTable_InternPath_NoSlash, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_InternPath_NoSlash");
+    UtTest_Add(Test_CF_NameTable_InternPath_LongLeaf, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_InternPath_LongLeaf");
+    UtTest_Add(Test_CF_NameTable_InternPath_Full, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_InternPath_Full");
+}
+
+void add_CF_NameTable_BuildPath_tests(void)
+{
+    UtTest_Add(Test_CF_NameTable_BuildPath, cf_names_tests_Setup, cf_names_tests_Teardown,
+               "Test_CF_NameTable_BuildPath");
+}
+
+/*******************************************************************************
+**
+**  cf_names_tests test UtTest_Setup
+**
+*******************************************************************************/
+
+void UtTest_Setup(void)
+{
+    TestUtil_InitializeRandomSeed();
+
+    add_CF_NameTable_Init_tests();
+
+    add_CF_NameTable_Intern_tests();
+
+    add_CF_NameTable_AddRef_Release_tests();
+
+    add_CF_NameTable_Get_tests();
+
+    add_CF_NameTable_InternPath_tests();
+
+    add_CF_NameTable_BuildPath_tests();
+}
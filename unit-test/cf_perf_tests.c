@@ -0,0 +1,311 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_perf.h"
+
+/*******************************************************************************
+**
+**  cf_perf_tests Setup and Teardown
+**
+*******************************************************************************/
+
+void cf_perf_tests_Setup(void)
+{
+    cf_tests_Setup();
+}
+
+void cf_perf_tests_Teardown(void)
+{
+    cf_tests_Teardown();
+}
+
+/*******************************************************************************
+**
+**  cf_perf_tests local helpers
+**
+*******************************************************************************/
+
+static void UT_AltHandler_CFE_TIME_Subtract(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *elapsed);
+}
+
+/* time one run of a phase that took the given number of seconds plus the
+ * microseconds returned from CFE_TIME_Sub2MicroSecs */
+static void UT_CF_Perf_Run(CF_PerfPhase_t phase, uint32 seconds, uint32 usecs)
+{
+    CF_PerfMark_t      mark;
+    CFE_TIME_SysTime_t elapsed;
+
+    memset(&elapsed, 0, sizeof(elapsed));
+    elapsed.Seconds = seconds;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract, &elapsed);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, usecs);
+
+    CF_Perf_Begin(&mark, phase);
+    CF_Perf_End(&mark);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), NULL, NULL);
+}
+
+/*******************************************************************************
+**
+**  CF_Perf_Begin and CF_Perf_End tests
+**
+*******************************************************************************/
+
+void Test_CF_Perf_BeginEnd_Disabled(void)
+{
+    /* Test case for:
+     * void CF_Perf_Begin(CF_PerfMark_t *mark, CF_PerfPhase_t phase);
+     * void CF_Perf_End(const CF_PerfMark_t *mark);
+     */
+    CF_PerfMark_t mark;
+
+    /* log markers only, nothing timed */
+    UtAssert_VOIDCALL(CF_Perf_Begin(&mark, CF_PerfPhase_NAK));
+    UtAssert_INT32_EQ(mark.phase, CF_PerfPhase_NAK);
+    UtAssert_BOOL_FALSE(mark.timed);
+    UtAssert_VOIDCALL(CF_Perf_End(&mark));
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_NAK].count, 0);
+
+    /* enabled while the phase ran, the run is not counted */
+    CF_AppData.perf.enabled = true;
+    UtAssert_VOIDCALL(CF_Perf_End(&mark));
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_NAK].count, 0);
+
+    /* disabled while the phase ran, the run is not counted */
+    UtAssert_VOIDCALL(CF_Perf_Begin(&mark, CF_PerfPhase_NAK));
+    UtAssert_BOOL_TRUE(mark.timed);
+    CF_AppData.perf.enabled = false;
+    UtAssert_VOIDCALL(CF_Perf_End(&mark));
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_NAK].count, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+}
+
+void Test_CF_Perf_BeginEnd_Enabled(void)
+{
+    /* Test case for:
+     * void CF_Perf_Begin(CF_PerfMark_t *mark, CF_PerfPhase_t phase);
+     * void CF_Perf_End(const CF_PerfMark_t *mark);
+     */
+    const CF_PerfPhaseStats_t *stats = &CF_AppData.perf.phase[CF_PerfPhase_CRC];
+
+    CF_AppData.perf.enabled = true;
+
+    /* first run sets both min and max */
+    UT_CF_Perf_Run(CF_PerfPhase_CRC, 0, 300);
+    UtAssert_UINT32_EQ(stats->count, 1);
+    UtAssert_UINT32_EQ(stats->min_usec, 300);
+    UtAssert_UINT32_EQ(stats->max_usec, 300);
+    UtAssert_UINT32_EQ(stats->total_usec, 300);
+
+    /* shorter run */
+    UT_CF_Perf_Run(CF_PerfPhase_CRC, 0, 100);
+    UtAssert_UINT32_EQ(stats->count, 2);
+    UtAssert_UINT32_EQ(stats->min_usec, 100);
+    UtAssert_UINT32_EQ(stats->max_usec, 300);
+
+    /* longer run, seconds included */
+    UT_CF_Perf_Run(CF_PerfPhase_CRC, 2, 500);
+    UtAssert_UINT32_EQ(stats->count, 3);
+    UtAssert_UINT32_EQ(stats->min_usec, 100);
+    UtAssert_UINT32_EQ(stats->max_usec, 2000500);
+    UtAssert_UINT32_EQ(stats->total_usec, 2000900);
+
+    /* absurdly long run saturates */
+    UT_CF_Perf_Run(CF_PerfPhase_CRC, 5000, 0);
+    UtAssert_UINT32_EQ(stats->count, 4);
+    UtAssert_UINT32_EQ(stats->max_usec, 0xFFFFFFFF);
+
+    /* other phases untouched */
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_NAK].count, 0);
+}
+
+/*******************************************************************************
+**
+**  CF_Perf_RecordLatency tests
+**
+*******************************************************************************/
+
+void Test_CF_Perf_RecordLatency(void)
+{
+    /* Test case for:
+     * void CF_Perf_RecordLatency(uint8 chan_num, CF_LatencyHist_t hist, uint8 priority, CFE_TIME_SysTime_t start);
+     */
+    const CF_LatencyHistTlm_t *prio0 = &CF_AppData.perf.latency[UT_CFDP_CHANNEL][CF_LatencyHist_TXW][0];
+    const CF_LatencyHistTlm_t *last =
+        &CF_AppData.perf.latency[UT_CFDP_CHANNEL][CF_LatencyHist_TXW][CF_LATENCY_PRIO_CLASSES - 1];
+    CFE_TIME_SysTime_t start;
+    CFE_TIME_SysTime_t elapsed;
+
+    memset(&start, 0, sizeof(start));
+    memset(&elapsed, 0, sizeof(elapsed));
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract, &elapsed);
+
+    /* disabled, nothing recorded */
+    UtAssert_VOIDCALL(CF_Perf_RecordLatency(UT_CFDP_CHANNEL, CF_LatencyHist_TXW, 0, start));
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_ZERO(prio0->bins[0]);
+
+    CF_AppData.perf.enabled = true;
+
+    /* below the base time goes to bin 0 */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, (CF_LATENCY_HIST_BASE_MSEC * 1000) - 1);
+    UtAssert_VOIDCALL(CF_Perf_RecordLatency(UT_CFDP_CHANNEL, CF_LatencyHist_TXW, 0, start));
+    UtAssert_UINT32_EQ(prio0->bins[0], 1);
+
+    /* three times the base time goes to bin 2 */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, CF_LATENCY_HIST_BASE_MSEC * 3000);
+    UtAssert_VOIDCALL(CF_Perf_RecordLatency(UT_CFDP_CHANNEL, CF_LatencyHist_TXW, 0, start));
+    UtAssert_UINT32_EQ(prio0->bins[2], 1);
+
+    /* very long latency of a low priority goes to the last bin of the last class */
+    elapsed.Seconds = 0xFFFFFFFF;
+    UtAssert_VOIDCALL(CF_Perf_RecordLatency(UT_CFDP_CHANNEL, CF_LatencyHist_TXW, 255, start));
+    UtAssert_UINT32_EQ(last->bins[CF_LATENCY_HIST_BINS - 1], 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 3);
+}
+
+/*******************************************************************************
+**
+**  CF_Perf_Reset tests
+**
+*******************************************************************************/
+
+void Test_CF_Perf_Reset(void)
+{
+    /* Test case for:
+     * void CF_Perf_Reset(void);
+     */
+
+    CF_AppData.perf.enabled = true;
+    UT_CF_Perf_Run(CF_PerfPhase_RECV, 0, 10);
+    CF_AppData.perf.latency[UT_CFDP_CHANNEL][CF_LatencyHist_TOTAL][0].bins[1] = 5;
+    UtAssert_VOIDCALL(CF_Perf_Reset());
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_RECV].count, 0);
+    UtAssert_UINT32_EQ(CF_AppData.perf.phase[CF_PerfPhase_RECV].max_usec, 0);
+    UtAssert_ZERO(CF_AppData.perf.latency[UT_CFDP_CHANNEL][CF_LatencyHist_TOTAL][0].bins[1]);
+    UtAssert_BOOL_TRUE(CF_AppData.perf.enabled);
+}
+
+/*******************************************************************************
+**
+**  CF_Perf_SendTlm tests
+**
+*******************************************************************************/
+
+void Test_CF_Perf_SendTlm(void)
+{
+    /* Test case for:
+     * void CF_Perf_SendTlm(void);
+     */
+    CF_PerfTlmPacket_t    PktBuf;
+    CF_LatencyTlmPacket_t LatencyPktBuf;
+    CFE_SB_Buffer_t *     PktBufPtrs[2];
+
+    /* disabled, nothing sent */
+    UtAssert_VOIDCALL(CF_Perf_SendTlm());
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+
+    /* no buffer available, for the statistics nor the latency of each channel */
+    CF_AppData.perf.enabled = true;
+    UtAssert_VOIDCALL(CF_Perf_SendTlm());
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1 + CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+
+    /* nominal, buffers for the statistics and the first channel */
+    UT_CF_Perf_Run(CF_PerfPhase_DECODE, 0, 10);
+    UT_CF_Perf_Run(CF_PerfPhase_DECODE, 0, 31);
+    CF_AppData.perf.latency[0][CF_LatencyHist_PEND][1].bins[3] = 7;
+    memset(&PktBuf, 0xFF, sizeof(PktBuf));
+    memset(&LatencyPktBuf, 0xFF, sizeof(LatencyPktBuf));
+    PktBufPtrs[0] = (CFE_SB_Buffer_t *)&PktBuf;
+    PktBufPtrs[1] = (CFE_SB_Buffer_t *)&LatencyPktBuf;
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), PktBufPtrs, sizeof(PktBufPtrs), true);
+    UtAssert_VOIDCALL(CF_Perf_SendTlm());
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_DECODE].count, 2);
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_DECODE].min_usec, 10);
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_DECODE].avg_usec, 20);
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_DECODE].max_usec, 31);
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_CYCLE].count, 0);
+    UtAssert_UINT32_EQ(PktBuf.Payload.phase[CF_PerfPhase_CYCLE].avg_usec, 0);
+    UtAssert_UINT32_EQ(LatencyPktBuf.Payload.channel, 0);
+    UtAssert_UINT32_EQ(LatencyPktBuf.Payload.base_msec, CF_LATENCY_HIST_BASE_MSEC);
+    UtAssert_UINT32_EQ(LatencyPktBuf.Payload.hist[CF_LatencyHist_PEND][1].bins[3], 7);
+    UtAssert_ZERO(LatencyPktBuf.Payload.hist[CF_LatencyHist_PEND][1].bins[2]);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+}
+
+/*******************************************************************************
+**
+**  cf_perf_tests UtTest_Add groups
+**
+*******************************************************************************/
+
+void add_CF_Perf_BeginEnd_tests(void)
+{
+    UtTest_Add(Test_CF_Perf_BeginEnd_Disabled, cf_perf_tests_Setup, cf_perf_tests_Teardown,
+               "Test_CF_Perf_BeginEnd_Disabled");
+    UtTest_Add(Test_CF_Perf_BeginEnd_Enabled, cf_perf_tests_Setup, cf_perf_tests_Teardown,
+               "Test_CF_Perf_BeginEnd_Enabled");
+}
+
+void add_CF_Perf_RecordLatency_tests(void)
+{
+    UtTest_Add(Test_CF_Perf_RecordLatency, cf_perf_tests_Setup, cf_perf_tests_Teardown, "Test_CF_Perf_RecordLatency");
+}
+
+void add_CF_Perf_Reset_tests(void)
+{
+    UtTest_Add(Test_CF_Perf_Reset, cf_perf_tests_Setup, cf_perf_tests_Teardown, "Test_CF_Perf_Reset");
+}
+
+void add_CF_Perf_SendTlm_tests(void)
+{
+    UtTest_Add(Test_CF_Perf_SendTlm, cf_perf_tests_Setup, cf_perf_tests_Teardown, "Test_CF_Perf_SendTlm");
+}
+
+/*******************************************************************************
+**
+**  cf_perf_tests test UtTest_Setup
+**
+*******************************************************************************/
+
+void UtTest_Setup(void)
+{
+    TestUtil_InitializeRandomSeed();
+
+    add_CF_Perf_BeginEnd_tests();
+
+    add_CF_Perf_RecordLatency_tests();
+
+    add_CF_Perf_Reset_tests();
+
+    add_CF_Perf_SendTlm_tests();
+}
@@ -21,6 +21,7 @@
 #include "cf_test_utils.h"
 #include "cf_test_alt_handler.h"
 #include "cf_utils.h"
+#include "cf_history.h"
 #include "cf_events.h"
 
 /* A value that may be passed to stubs accepting osal_id_t values */
@@ -102,14 +103,48 @@ static void UT_Callback_CF_TraverseAllTransactions(CF_Transaction_t *txn, void *
 
 /*----------------------------------------------------------------
  *
- * A simple handler that just sets the "txn" output in the state object
+ * A simple handler that just sets the "pf" output in the state object
  *
  *-----------------------------------------------------------------*/
-static void UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn(void *UserObj, UT_EntryKey_t FuncKey,
-                                                          const UT_StubContext_t *Context)
+static void UT_AltHandler_CF_CList_Traverse_PendingSeqArg_SetPf(void *UserObj, UT_EntryKey_t FuncKey,
+                                                                const UT_StubContext_t *Context)
 {
-    CF_Traverse_TransSeqArg_t *arg = UT_Hook_GetArgValueByName(Context, "context", CF_Traverse_TransSeqArg_t *);
-    arg->txn                       = UserObj;
+    CF_Traverse_PendingSeqArg_t *arg = UT_Hook_GetArgValueByName(Context, "context", CF_Traverse_PendingSeqArg_t *);
+    arg->pf                          = UserObj;
+}
+
+/*----------------------------------------------------------------
+ *
+ * A simple handler that just sets the "pf" output in the priority search object
+ *
+ *-----------------------------------------------------------------*/
+static void UT_AltHandler_CF_CList_Traverse_R_PendingPrio_SetPf(void *UserObj, UT_EntryKey_t FuncKey,
+                                                                const UT_StubContext_t *Context)
+{
+    CF_Traverse_PendingPriorityArg_t *arg =
+        UT_Hook_GetArgValueByName(Context, "context", CF_Traverse_PendingPriorityArg_t *);
+    arg->pf = UserObj;
+}
+
+/*----------------------------------------------------------------
+ *
+ * A simple handler that copies the history entry in UserObj to the output
+ *
+ *-----------------------------------------------------------------*/
+static void UT_AltHandler_CF_HistoryRing_Get(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_History_t *history = UT_Hook_GetArgValueByName(Context, "history", CF_History_t *);
+    *history              = *((const CF_History_t *)UserObj);
+}
+
+/*----------------------------------------------------------------
+ *
+ * A UT-specific callback that can be used with CF_TraversePendingFiles
+ *
+ *-----------------------------------------------------------------*/
+static void UT_Callback_CF_TraversePendingFiles(CF_Channel_t *chan, CF_PendingFile_t *pf, void *context)
+{
+    UT_DEFAULT_IMPL(UT_Callback_CF_TraversePendingFiles);
 }
 
 /*******************************************************************************
@@ -118,51 +153,38 @@ static void UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn(void *UserObj, UT_Entr
 **
 *******************************************************************************/
 
-void Test_CF_ResetHistory(void)
-{
-    /* Test case for:
-     * void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
-     */
-    CF_History_t history;
-
-    memset(&history, 0, sizeof(history));
-
-    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST] = 4;
-
-    /* nominal call */
-    UtAssert_VOIDCALL(CF_ResetHistory(&CF_AppData.engine.channels[UT_CFDP_CHANNEL], &history));
-}
-
 void Test_CF_FindUnusedTransaction(void)
 {
     /* Test case for:
      * CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
      */
-    CF_Channel_t *   chan;
-    CF_Transaction_t txn;
-    CF_History_t     hist;
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
 
-    memset(&hist, 0, sizeof(hist));
-    memset(&txn, 0, sizeof(txn));
     memset(&CF_AppData, 0, sizeof(CF_AppData));
     chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
-    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_FREE]      = 2;
-    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST_FREE] = 1;
-    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST]      = 1;
+    txn  = &CF_AppData.engine.transactions[1];
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_FREE] = 1;
 
     UtAssert_NULL(CF_FindUnusedTransaction(chan));
 
-    chan->qs[CF_QueueIdx_FREE]      = &txn.cl_node;
-    chan->qs[CF_QueueIdx_HIST_FREE] = &hist.cl_node;
-    chan->qs[CF_QueueIdx_HIST]      = NULL;
-    UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), &txn);
-    UtAssert_ADDRESS_EQ(txn.history, &hist);
-
-    chan->qs[CF_QueueIdx_FREE]      = &txn.cl_node;
-    chan->qs[CF_QueueIdx_HIST_FREE] = NULL;
-    chan->qs[CF_QueueIdx_HIST]      = &hist.cl_node;
-    UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), &txn);
-    UtAssert_ADDRESS_EQ(txn.history, &hist);
+    /* the history entry that goes with the transaction is reset */
+    CF_AppData.engine.histories[1].txn_stat = CF_TxnStatus_FILESTORE_REJECTION;
+    CF_AppData.engine.histories[1].dir      = CF_Direction_TX;
+    chan->qs[CF_QueueIdx_FREE]              = &txn->cl_node;
+    UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), txn);
+    UtAssert_ADDRESS_EQ(txn->history, &CF_AppData.engine.histories[1]);
+    UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_NO_ERROR);
+    UtAssert_INT32_EQ(txn->history->dir, CF_Direction_NUM);
+
+    /* as is the cold part */
+    CF_AppData.engine.transaction_cold[1].progress.file_data_bytes             = 100;
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_FREE] = 1;
+    chan->qs[CF_QueueIdx_FREE]                                                 = &txn->cl_node;
+    UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), txn);
+    UtAssert_ADDRESS_EQ(txn->cold, &CF_AppData.engine.transaction_cold[1]);
+    UtAssert_ZERO(txn->cold->progress.file_data_bytes);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(txn->cold->fd));
 }
 
 void Test_CF_FreeTransaction(void)
@@ -238,16 +260,75 @@ void Test_CF_FindTransactionBySequenceNumber(void)
 
     CF_Transaction_t *txn;
     CF_Channel_t *    chan;
+    CF_History_t      hist[2];
 
     memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(hist, 0, sizeof(hist));
     chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
 
+    /* all 3 queues are empty */
     UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 12, 34));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 4); /* this checks 4 different queues */
 
-    txn = &CF_AppData.engine.transactions[UT_CFDP_CHANNEL];
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn, txn);
-    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12, 34), txn);
+    /* two transactions on the TXW queue, the second one matches */
+    txn                       = &CF_AppData.engine.transactions[0];
+    txn[0].history            = &hist[0];
+    txn[1].history            = &hist[1];
+    hist[0].src_eid           = 34;
+    hist[0].seq_num           = 11;
+    hist[1].src_eid           = 34;
+    hist[1].seq_num           = 12;
+    txn[0].cl_node.next       = &txn[1].cl_node;
+    txn[0].cl_node.prev       = &txn[1].cl_node;
+    txn[1].cl_node.next       = &txn[0].cl_node;
+    txn[1].cl_node.prev       = &txn[0].cl_node;
+    chan->qs[CF_QueueIdx_TXW] = &txn[0].cl_node;
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12, 34), &txn[1]);
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 11, 34), &txn[0]);
+
+    /* same sequence number from another entity */
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 12, 35));
+}
+
+void Test_CF_FindPendingFileBySequenceNumber_Impl(void)
+{
+    /* Test case for:
+     * CF_CListTraverse_Status_t CF_FindPendingFileBySequenceNumber_Impl(CF_CListNode_t *node, void *context)
+     */
+    CF_PendingFile_t            pf;
+    CF_Traverse_PendingSeqArg_t ctxt;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&ctxt, 0, sizeof(ctxt));
+
+    /* nominal, non-matching sequence number */
+    pf.seq_num                       = 12;
+    ctxt.transaction_sequence_number = 13;
+    UtAssert_INT32_EQ(CF_FindPendingFileBySequenceNumber_Impl(&pf.cl_node, &ctxt), CF_CLIST_CONT);
+    UtAssert_NULL(ctxt.pf);
+
+    /* matching sequence number */
+    ctxt.transaction_sequence_number = 12;
+    UtAssert_INT32_EQ(CF_FindPendingFileBySequenceNumber_Impl(&pf.cl_node, &ctxt), CF_CLIST_EXIT);
+    UtAssert_ADDRESS_EQ(ctxt.pf, &pf);
+}
+
+void Test_CF_FindPendingFileBySequenceNumber(void)
+{
+    /* Test case for:
+     * CF_PendingFile_t *CF_FindPendingFileBySequenceNumber(CF_Channel_t *chan, CF_TransactionSeq_t
+     * transaction_sequence_number)
+     */
+    CF_PendingFile_t pf;
+    CF_Channel_t *   chan;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    UtAssert_NULL(CF_FindPendingFileBySequenceNumber(chan, 12));
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 1); /* only the pending queue */
+
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_PendingSeqArg_SetPf, &pf);
+    UtAssert_ADDRESS_EQ(CF_FindPendingFileBySequenceNumber(chan, 12), &pf);
 }
 
 /* CF_DequeueTransaction tests */
@@ -292,6 +373,7 @@ void Test_cf_move_transaction_Call_CF_CList_InsertBack_AndSet_q_index_ToGiven_q(
 {
     /* Arrange */
     CF_Transaction_t              txn;
+    CF_TransactionCold_t          cold;
     CF_Transaction_t *            arg_t    = &txn;
     uint8                         chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
     CF_CListNode_t **             expected_remove_head;
@@ -305,6 +387,7 @@ void Test_cf_move_transaction_Call_CF_CList_InsertBack_AndSet_q_index_ToGiven_q(
     memset(&txn, 0, sizeof(txn));
 
     arg_t->chan_num = chan_num;
+    arg_t->cold     = &cold;
 
     UT_SetDataBuffer(UT_KEY(CF_CList_Remove), &context_clist_remove, sizeof(context_clist_remove), false);
 
@@ -332,6 +415,7 @@ void Test_cf_move_transaction_Call_CF_CList_InsertBack_AndSet_q_index_ToGiven_q(
     UtAssert_True(arg_t->flags.com.q_index == arg_q,
                   "txn->flags.com.q_index set to %u and should equal passed in q value %u", arg_t->flags.com.q_index,
                   arg_q);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
 }
 
 /* CF_CList_Remove_Ex tests */
@@ -443,79 +527,66 @@ void Test_CF_CList_InsertBack_Ex_Call_CF_CList_InsertBack_AndIncrement_q_size(vo
 
 /*******************************************************************************
 **
-**  CF_Traverse_WriteHistoryQueueEntryToFile tests
+**  CF_Traverse_WriteTxnQueueEntryToFile tests
 **
 *******************************************************************************/
 
-void Test_CF_Traverse_WriteHistoryQueueEntryToFile(void)
+void Test_CF_Traverse_WriteTxnQueueEntryToFile(void)
 {
     /* Test case for:
-     * int CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg);
+     * int CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg);
      */
-    CF_History_t                      hist;
-    CF_Traverse_WriteHistoryFileArg_t args;
+    CF_Transaction_t              txn;
+    CF_History_t                  hist;
+    CF_Traverse_WriteTxnFileArg_t args;
 
+    memset(&txn, 0, sizeof(txn));
     memset(&hist, 0, sizeof(hist));
     memset(&args, 0, sizeof(args));
+    txn.history = &hist;
 
     /* nominal, if everything works, should continue */
-    hist.dir        = CF_Direction_TX;
-    args.filter_dir = CF_Direction_TX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
+    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_CONT);
     UtAssert_UINT32_EQ(args.counter, 1);
     UtAssert_BOOL_FALSE(args.error);
 
-    /* filter disabled (anything goes) */
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_NUM;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 2);
-    UtAssert_BOOL_FALSE(args.error);
-
-    /* filter no match (does not write) */
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_TX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 2); /* no increment */
-    UtAssert_BOOL_FALSE(args.error);
-
     /* Setup for failure */
     UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_RX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_EXIT);
-    UtAssert_UINT32_EQ(args.counter, 2); /* no increment */
+    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_EXIT);
+    UtAssert_UINT32_EQ(args.counter, 1); /* no increment */
     UtAssert_BOOL_TRUE(args.error);
 }
 
 /*******************************************************************************
 **
-**  CF_Traverse_WriteTxnQueueEntryToFile tests
+**  CF_Traverse_WritePendingQueueEntryToFile tests
 **
 *******************************************************************************/
 
-void Test_CF_Traverse_WriteTxnQueueEntryToFile(void)
+void Test_CF_Traverse_WritePendingQueueEntryToFile(void)
 {
     /* Test case for:
-     * int CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg);
+     * CF_CListTraverse_Status_t CF_Traverse_WritePendingQueueEntryToFile(CF_CListNode_t *node, void *arg);
      */
-    CF_Transaction_t              txn;
-    CF_History_t                  hist;
+    CF_PendingFile_t              pf;
+    CF_ConfigTable_t              config_table;
     CF_Traverse_WriteTxnFileArg_t args;
 
-    memset(&txn, 0, sizeof(txn));
-    memset(&hist, 0, sizeof(hist));
+    memset(&pf, 0, sizeof(pf));
+    memset(&config_table, 0, sizeof(config_table));
     memset(&args, 0, sizeof(args));
-    txn.history = &hist;
+    CF_AppData.config_table = &config_table;
+    memcpy(pf.leaves, "sf\0df", 6);
 
     /* nominal, if everything works, should continue */
-    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_CONT);
+    UtAssert_INT32_EQ(CF_Traverse_WritePendingQueueEntryToFile(&pf.cl_node, &args), CF_CLIST_CONT);
     UtAssert_UINT32_EQ(args.counter, 1);
     UtAssert_BOOL_FALSE(args.error);
+    UtAssert_STUB_COUNT(CF_NameTable_BuildPath, 2);
 
     /* Setup for failure */
     UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_EXIT);
+    UtAssert_INT32_EQ(CF_Traverse_WritePendingQueueEntryToFile(&pf.cl_node, &args), CF_CLIST_EXIT);
     UtAssert_UINT32_EQ(args.counter, 1); /* no increment */
     UtAssert_BOOL_TRUE(args.error);
 }
@@ -579,11 +650,11 @@ void Test_CF_WriteTxnQueueDataToFile(void)
 
 /*******************************************************************************
 **
-**  CF_WriteHistoryQueueDataToFile tests
+**  CF_WritePendingQueueDataToFile tests
 **
 *******************************************************************************/
 
-void Test_CF_WriteHistoryQueueDataToFile(void)
+void Test_CF_WritePendingQueueDataToFile(void)
 {
     /* Arrange */
     osal_id_t      arg_fd = OS_ObjectIdFromInteger(1);
@@ -592,16 +663,351 @@ void Test_CF_WriteHistoryQueueDataToFile(void)
 
     memset(&node, 0, sizeof(node));
     memset(&ch, 0, sizeof(ch));
-    ch.qs[CF_QueueIdx_HIST] = &node;
+    ch.qs[CF_QueueIdx_PEND] = &node;
 
     /* Act */
     /* with no configuration, this should return no error (0) */
-    UtAssert_INT32_EQ(CF_WriteHistoryQueueDataToFile(arg_fd, &ch, CF_QueueIdx_HIST), 0);
+    UtAssert_INT32_EQ(CF_WritePendingQueueDataToFile(arg_fd, &ch), 0);
 
     /* Assert */
     UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
 }
 
+/*******************************************************************************
+**
+**  CF_WriteHistoryQueueDataToFile tests
+**
+*******************************************************************************/
+
+void Test_CF_WriteHistoryQueueDataToFile(void)
+{
+    /* Arrange */
+    osal_id_t    arg_fd = OS_ObjectIdFromInteger(1);
+    CF_Channel_t ch;
+    CF_History_t hist;
+
+    memset(&ch, 0, sizeof(ch));
+    memset(&hist, 0, sizeof(hist));
+    hist.dir         = CF_Direction_TX;
+    ch.history.count = 2;
+    UT_SetHandlerFunction(UT_KEY(CF_HistoryRing_Get), UT_AltHandler_CF_HistoryRing_Get, &hist);
+
+    /* Act */
+    /* all directions, each entry is written as three lines */
+    UtAssert_INT32_EQ(CF_WriteHistoryQueueDataToFile(arg_fd, &ch, CF_Direction_NUM), 0);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 2);
+    UtAssert_STUB_COUNT(OS_write, 6);
+
+    /* filter no match (does not write) */
+    UtAssert_INT32_EQ(CF_WriteHistoryQueueDataToFile(arg_fd, &ch, CF_Direction_RX), 0);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 4);
+    UtAssert_STUB_COUNT(OS_write, 6);
+
+    /* write failure stops at the first entry */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+    UtAssert_INT32_EQ(CF_WriteHistoryQueueDataToFile(arg_fd, &ch, CF_Direction_TX), 1);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 5);
+}
+
+/*******************************************************************************
+**
+**  CF_WriteQueueFileHeader tests
+**
+*******************************************************************************/
+
+void Test_CF_WriteQueueFileHeader(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_WriteQueueFileHeader(osal_id_t fd, const CF_QueueDump_t *dump);
+     */
+    osal_id_t      arg_fd = OS_ObjectIdFromInteger(1);
+    CF_QueueDump_t dump;
+
+    memset(&dump, 0, sizeof(dump));
+
+    /* nominal */
+    UtAssert_INT32_EQ(CF_WriteQueueFileHeader(arg_fd, &dump), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* short write */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 2);
+    UtAssert_INT32_EQ(CF_WriteQueueFileHeader(arg_fd, &dump), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WHIST_WRITE);
+}
+
+/*******************************************************************************
+**
+**  CF_WriteQueueFileEntry tests
+**
+*******************************************************************************/
+
+void Test_CF_WriteQueueFileEntry(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_WriteQueueFileEntry(osal_id_t fd, CF_QueueIdx_t queue, const CF_History_t *history);
+     */
+    osal_id_t    arg_fd = OS_ObjectIdFromInteger(1);
+    CF_History_t history;
+
+    memset(&history, 0, sizeof(history));
+    strcpy(history.fnames.src_filename, "sf");
+    strcpy(history.fnames.dst_filename, "df");
+
+    /* nominal, one record per entry */
+    UtAssert_INT32_EQ(CF_WriteQueueFileEntry(arg_fd, CF_QueueIdx_TXA, &history), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* unsuccessful write */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+    UtAssert_INT32_EQ(CF_WriteQueueFileEntry(arg_fd, CF_QueueIdx_TXA, &history), CF_ERROR);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WHIST_WRITE);
+}
+
+/*******************************************************************************
+**
+**  CF_WriteQueueDumpEntries tests
+**
+*******************************************************************************/
+
+void Test_CF_WriteQueueDumpEntries_AllStages(void)
+{
+    /* Arrange */
+    CF_QueueDump_t dump;
+
+    memset(&dump, 0, sizeof(dump));
+    dump.type  = CF_Type_all;
+    dump.queue = CF_Queue_all;
+    dump.stage = CF_QueueDumpStage_RX;
+
+    /* Act */
+    /* with empty queues and history, every stage finishes in one call */
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 10), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(dump.stage, CF_QueueDumpStage_NUM);
+    UtAssert_UINT32_EQ(dump.num_records, 0);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    /* only the selected stages are visited */
+    memset(&dump, 0, sizeof(dump));
+    dump.type  = CF_Type_up;
+    dump.queue = CF_Queue_active;
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 10), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(dump.stage, CF_QueueDumpStage_NUM);
+}
+
+void Test_CF_WriteQueueDumpEntries_Queue(void)
+{
+    /* Arrange */
+    CF_QueueDump_t *     dump = &CF_AppData.queue_dump;
+    CF_Channel_t *       chan = &CF_AppData.engine.channels[0];
+    CF_Transaction_t     txn[3];
+    CF_TransactionCold_t cold[3];
+    CF_History_t         hist;
+    CF_PendingFile_t     pf;
+    CF_ConfigTable_t     config_table;
+    int                  i;
+
+    memset(txn, 0, sizeof(txn));
+    memset(cold, 0, sizeof(cold));
+    memset(&hist, 0, sizeof(hist));
+    memset(&pf, 0, sizeof(pf));
+    memset(&config_table, 0, sizeof(config_table));
+    CF_AppData.config_table = &config_table;
+    dump->type  = CF_Type_down;
+    dump->queue = CF_Queue_active;
+    dump->stage = CF_QueueDumpStage_RX;
+    dump->stamp = 1;
+    for (i = 0; i < 3; ++i)
+    {
+        txn[i].history      = &hist;
+        txn[i].cold         = &cold[i];
+        txn[i].cl_node.next = &txn[(i + 1) % 3].cl_node;
+        txn[i].cl_node.prev = &txn[(i + 2) % 3].cl_node;
+    }
+    chan->qs[CF_QueueIdx_TXA] = &txn[0].cl_node;
+
+    /* Act */
+    /* a full batch stops after the last node written */
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(dump, 2), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(dump->stage, CF_QueueDumpStage_TXA);
+    UtAssert_ADDRESS_EQ(dump->resume, &txn[1].cl_node);
+    UtAssert_UINT32_EQ(dump->num_records, 2);
+    UtAssert_UINT32_EQ(cold[0].dump_stamp, 1);
+    UtAssert_UINT32_EQ(cold[1].dump_stamp, 1);
+    UtAssert_UINT32_EQ(cold[2].dump_stamp, 0);
+    UtAssert_STUB_COUNT(OS_write, 2);
+
+    /* the last node written moves to the end of the queue, the dump stops at the one before it instead */
+    CF_QueueDumpUnlink(chan->qs[CF_QueueIdx_TXA], &txn[1].cl_node);
+    UtAssert_ADDRESS_EQ(dump->resume, &txn[0].cl_node);
+    txn[0].cl_node.next = &txn[2].cl_node;
+    txn[2].cl_node.prev = &txn[0].cl_node;
+    txn[2].cl_node.next = &txn[1].cl_node;
+    txn[1].cl_node.prev = &txn[2].cl_node;
+    txn[1].cl_node.next = &txn[0].cl_node;
+    txn[0].cl_node.prev = &txn[1].cl_node;
+
+    /* and it is not written twice */
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(dump, 5), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(dump->stage, CF_QueueDumpStage_NUM);
+    UtAssert_ADDRESS_EQ(dump->resume, NULL);
+    UtAssert_UINT32_EQ(dump->num_records, 3);
+    UtAssert_UINT32_EQ(cold[2].dump_stamp, 1);
+    UtAssert_STUB_COUNT(OS_write, 3);
+
+    /* the head leaving its queue starts the stage over, other nodes do not move the dump */
+    dump->resume = &txn[0].cl_node;
+    CF_QueueDumpUnlink(chan->qs[CF_QueueIdx_TXA], &txn[2].cl_node);
+    UtAssert_ADDRESS_EQ(dump->resume, &txn[0].cl_node);
+    CF_QueueDumpUnlink(chan->qs[CF_QueueIdx_TXA], &txn[0].cl_node);
+    UtAssert_ADDRESS_EQ(dump->resume, NULL);
+
+    /* pending files get their names rebuilt, and a write failure stops the stage */
+    memset(dump, 0, sizeof(*dump));
+    chan->qs[CF_QueueIdx_TXA]  = NULL;
+    chan->qs[CF_QueueIdx_PEND] = &pf.cl_node;
+    pf.cl_node.next            = &pf.cl_node;
+    pf.cl_node.prev            = &pf.cl_node;
+    dump->type                 = CF_Type_down;
+    dump->queue                = CF_Queue_pend;
+    dump->stamp                = 2;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(dump, 5), CF_ERROR);
+    UtAssert_UINT32_EQ(dump->stage, CF_QueueDumpStage_PEND);
+    UtAssert_UINT32_EQ(dump->num_records, 0);
+    UtAssert_UINT32_EQ(pf.dump_stamp, 0);
+    UtAssert_STUB_COUNT(CF_NameTable_BuildPath, 2);
+}
+
+void Test_CF_WriteQueueDumpEntries_History(void)
+{
+    /* Arrange */
+    CF_QueueDump_t    dump;
+    CF_HistoryRing_t *ring = &CF_AppData.engine.channels[0].history;
+    CF_History_t      hist;
+
+    memset(&dump, 0, sizeof(dump));
+    memset(&hist, 0, sizeof(hist));
+    dump.type       = CF_Type_down;
+    dump.queue      = CF_Queue_history;
+    dump.stage      = CF_QueueDumpStage_RX;
+    hist.dir        = CF_Direction_TX;
+    ring->count     = 3;
+    ring->num_added = 3;
+    UT_SetHandlerFunction(UT_KEY(CF_HistoryRing_Get), UT_AltHandler_CF_HistoryRing_Get, &hist);
+
+    /* Act */
+    /* a full batch leaves the stage open for the next wakeup */
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 2), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(dump.stage, CF_QueueDumpStage_HIST_TX);
+    UtAssert_UINT32_EQ(dump.position, 2);
+    UtAssert_UINT32_EQ(dump.num_records, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+
+    /* two records dropped and two added since, so continue from the oldest still held */
+    ring->num_added = 5;
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 5), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(dump.stage, CF_QueueDumpStage_NUM);
+    UtAssert_UINT32_EQ(dump.num_records, 5);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 5);
+
+    /* entries of the other direction are looked at but not written */
+    memset(&dump, 0, sizeof(dump));
+    dump.type  = CF_Type_up;
+    dump.queue = CF_Queue_history;
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 5), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(dump.num_records, 0);
+    UtAssert_STUB_COUNT(CF_HistoryRing_Get, 8);
+
+    /* write failure */
+    memset(&dump, 0, sizeof(dump));
+    dump.type  = CF_Type_down;
+    dump.queue = CF_Queue_history;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+    UtAssert_INT32_EQ(CF_WriteQueueDumpEntries(&dump, 5), CF_ERROR);
+    UtAssert_UINT32_EQ(dump.stage, CF_QueueDumpStage_HIST_TX);
+}
+
+/*******************************************************************************
+**
+**  CF_ProcessQueueDump tests
+**
+*******************************************************************************/
+
+void Test_CF_ProcessQueueDump(void)
+{
+    /* Arrange */
+    CF_QueueDump_t *  dump = &CF_AppData.queue_dump;
+    CF_HistoryRing_t *ring = &CF_AppData.engine.channels[0].history;
+    CF_History_t      hist;
+
+    memset(&hist, 0, sizeof(hist));
+    UT_SetHandlerFunction(UT_KEY(CF_HistoryRing_Get), UT_AltHandler_CF_HistoryRing_Get, &hist);
+
+    /* Act */
+    /* nothing in progress */
+    CF_ProcessQueueDump();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* more history than one wakeup writes, file stays open */
+    dump->busy      = true;
+    dump->type      = CF_Type_up;
+    dump->queue     = CF_Queue_history;
+    ring->count     = CF_QUEUE_DUMP_RECORDS_PER_WAKEUP + 1;
+    ring->num_added = ring->count;
+    CF_ProcessQueueDump();
+    UtAssert_STUB_COUNT(OS_write, CF_QUEUE_DUMP_RECORDS_PER_WAKEUP);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_BOOL_TRUE(dump->busy);
+
+    /* last entry written, header rewritten with the count */
+    CF_ProcessQueueDump();
+    UtAssert_STUB_COUNT(OS_write, CF_QUEUE_DUMP_RECORDS_PER_WAKEUP + 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(dump->busy);
+    UtAssert_UINT32_EQ(dump->num_records, CF_QUEUE_DUMP_RECORDS_PER_WAKEUP + 1);
+    UT_CF_AssertEventID(CF_EID_INF_CMD_WQ_DONE);
+
+    /* seek to the header fails */
+    UT_CF_ResetEventCapture();
+    memset(dump, 0, sizeof(*dump));
+    dump->busy  = true;
+    dump->stage = CF_QueueDumpStage_NUM;
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, -1);
+    CF_ProcessQueueDump();
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_BOOL_FALSE(dump->busy);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 1);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WHIST_WRITE);
+
+    /* entry write fails */
+    UT_CF_ResetEventCapture();
+    memset(dump, 0, sizeof(*dump));
+    dump->busy  = true;
+    dump->type  = CF_Type_up;
+    dump->queue = CF_Queue_history;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+    CF_ProcessQueueDump();
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_BOOL_FALSE(dump->busy);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 2);
+    UT_CF_AssertEventID(CF_EID_ERR_CMD_WQ_WRITEHIST_RX);
+}
+
 /*******************************************************************************
 **
 **  CF_PrioSearch tests
@@ -682,18 +1088,20 @@ void Test_CF_PrioSearch_When_t_PrioIsLessThanContextPrio_Set_context_t_To_t_AndR
 void Test_CF_InsertSortPrio_Call_CF_CList_InsertBack_Ex_ListIsEmpty_AndSet_q_index_To_q(void)
 {
     /* Arrange */
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_Channel_t *    chan;
-    CF_CListNode_t ** expected_insert_back_head;
-    CF_CListNode_t *  expected_insert_back_node;
+    CF_Transaction_t     txn;
+    CF_TransactionCold_t cold;
+    CF_Transaction_t *   arg_t = &txn;
+    CF_QueueIdx_t        arg_q = Any_cf_queue_index_t();
+    CF_Channel_t *       chan;
+    CF_CListNode_t **    expected_insert_back_head;
+    CF_CListNode_t *     expected_insert_back_node;
 
     CF_CList_InsertBack_context_t context_clist_insert_back;
 
     /* txn settings to bypass CF_Assert */
     txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
     txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
+    txn.cold     = &cold;
 
     UT_SetDataBuffer(UT_KEY(CF_CList_InsertBack), &context_clist_insert_back, sizeof(context_clist_insert_back), false);
 
@@ -715,63 +1123,48 @@ void Test_CF_InsertSortPrio_Call_CF_CList_InsertBack_Ex_ListIsEmpty_AndSet_q_ind
     UtAssert_True(arg_t->flags.com.q_index == arg_q,
                   "arg_t->flags.com.q_index set to %d and should be %d (CF_QueueIdx_t queue)", arg_t->flags.com.q_index,
                   arg_q);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
 }
 
 void Test_CF_InsertSortPrio_Call_CF_CList_InsertAfter_Ex_AndSet_q_index_To_q(void)
 {
     /* Arrange */
-    CF_Transaction_t  p_t;
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_CListNode_t *  qs;
-    CF_Channel_t *    chan;
-    CF_CListNode_t *  expected_end;
-    CF_CListFn_t      expected_fn;
-    CF_CListNode_t ** expected_insert_after_head;
-    CF_CListNode_t ** expected_insert_after_start;
-    CF_CListNode_t ** expected_insert_after_after;
+    CF_Transaction_t     p_t;
+    CF_Transaction_t     txn;
+    CF_TransactionCold_t cold;
+    CF_Transaction_t *   arg_t = &txn;
+    CF_QueueIdx_t        arg_q = Any_cf_queue_index_t();
+    CF_Channel_t *       chan;
 
-    CF_CList_Traverse_R_context_t  context_cf_clist_traverse_r;
     CF_CList_InsertAfter_context_t context_CF_CList_InsertAfter;
 
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse_R), UT_AltHandler_CF_CList_Traverse_R_PRIO,
-                          &context_cf_clist_traverse_r);
+    memset(&p_t, 0, sizeof(p_t));
 
     /* txn settings to bypass CF_Assert */
     txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
     txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
+    txn.cold     = &cold;
+    txn.priority = 2;
 
-    /* setting (&CF_AppData.engine.channels[arg_t->chan_num])->qs[arg_q] to
-     * &qs makes the list NOT empty */
-    chan            = &CF_AppData.engine.channels[arg_t->chan_num];
-    chan->qs[arg_q] = (CF_CListNode_t *)&qs;
-
-    /* setup CF_Traverse_PriorityArg_t altered value */
-    context_cf_clist_traverse_r.context_t = &p_t;
+    /* the queue holds one transaction that goes ahead of txn */
+    p_t.priority     = 2;
+    p_t.cl_node.next = &p_t.cl_node;
+    p_t.cl_node.prev = &p_t.cl_node;
+    chan             = &CF_AppData.engine.channels[arg_t->chan_num];
+    chan->qs[arg_q]  = &p_t.cl_node;
 
     /* Arrange for CF_CList_InsertAfter_Ex */
     UT_SetDataBuffer(UT_KEY(CF_CList_InsertAfter), &context_CF_CList_InsertAfter, sizeof(context_CF_CList_InsertAfter),
                      false);
 
-    /* set expected values */
-    expected_end                = chan->qs[arg_q];
-    expected_fn                 = CF_PrioSearch;
-    expected_insert_after_head  = (CF_CListNode_t **)&chan->qs[arg_q];
-    expected_insert_after_start = (CF_CListNode_t **)&p_t.cl_node;
-    expected_insert_after_after = (CF_CListNode_t **)&arg_t->cl_node;
-
     /* Act */
     CF_InsertSortPrio(arg_t, arg_q);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse_R, 1);
-    UtAssert_ADDRESS_EQ(context_cf_clist_traverse_r.end, expected_end);
-    UtAssert_True(context_cf_clist_traverse_r.fn == expected_fn, "context_cf_clist_traverse_r.fn ==  expected_fn");
     UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.head, (CF_CListNode_t **)expected_insert_after_head);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.start, (CF_CListNode_t *)expected_insert_after_start);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.after, (CF_CListNode_t *)expected_insert_after_after);
+    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.head, &chan->qs[arg_q]);
+    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.start, &p_t.cl_node);
+    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.after, &arg_t->cl_node);
     UtAssert_True(arg_t->flags.com.q_index == arg_q, "txn->flags.com.q_index is %u and should be %u (q)",
                   arg_t->flags.com.q_index, arg_q);
 }
@@ -779,39 +1172,32 @@ void Test_CF_InsertSortPrio_Call_CF_CList_InsertAfter_Ex_AndSet_q_index_To_q(voi
 void Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex(void)
 {
     /* Arrange */
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_CListNode_t *  qs;
-    CF_Channel_t *    chan;
-    CF_CListNode_t *  expected_end;
-    CF_CListFn_t      expected_fn;
-    CF_CListNode_t ** expected_insert_back_head;
-    CF_CListNode_t *  expected_insert_back_node;
+    CF_Transaction_t     p_t[2];
+    CF_Transaction_t     txn;
+    CF_TransactionCold_t cold;
+    CF_Transaction_t *   arg_t = &txn;
+    CF_QueueIdx_t        arg_q = Any_cf_queue_index_t();
+    CF_Channel_t *       chan;
 
-    CF_CList_Traverse_R_context_t context_cf_clist_traverse_r;
     CF_CList_InsertBack_context_t context_clist_insert_back;
 
-    UT_SetDataBuffer(UT_KEY(CF_CList_Traverse_R), &context_cf_clist_traverse_r, sizeof(context_cf_clist_traverse_r),
-                     false);
+    memset(p_t, 0, sizeof(p_t));
 
     /* txn settings to bypass CF_Assert */
     txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
     txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
-
-    /* setting (&CF_AppData.engine.channels[arg_t->chan_num])->qs[arg_q] to
-     * &qs makes the list NOT empty */
-    chan            = &CF_AppData.engine.channels[arg_t->chan_num];
-    chan->qs[arg_q] = (CF_CListNode_t *)&qs;
-
-    /* setup CF_Traverse_PriorityArg_t altered value */
-    context_cf_clist_traverse_r.context_t = NULL;
-
-    /* set expected values */
-    expected_end              = chan->qs[arg_q];
-    expected_fn               = CF_PrioSearch;
-    expected_insert_back_head = &chan->qs[arg_q];
-    expected_insert_back_node = &arg_t->cl_node;
+    txn.cold     = &cold;
+    txn.priority = 1;
+
+    /* the queue holds two transactions, both of which txn goes ahead of */
+    p_t[0].priority     = 2;
+    p_t[1].priority     = 3;
+    p_t[0].cl_node.next = &p_t[1].cl_node;
+    p_t[0].cl_node.prev = &p_t[1].cl_node;
+    p_t[1].cl_node.next = &p_t[0].cl_node;
+    p_t[1].cl_node.prev = &p_t[0].cl_node;
+    chan                = &CF_AppData.engine.channels[arg_t->chan_num];
+    chan->qs[arg_q]     = &p_t[0].cl_node;
 
     /* Arrange for CF_CList_InsertBack_Ex */
     UT_SetDataBuffer(UT_KEY(CF_CList_InsertBack), &context_clist_insert_back, sizeof(context_clist_insert_back), false);
@@ -820,17 +1206,314 @@ void Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex(void)
     CF_InsertSortPrio(arg_t, arg_q);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse_R, 1);
-    UtAssert_ADDRESS_EQ(context_cf_clist_traverse_r.end, expected_end);
-    UtAssert_True(context_cf_clist_traverse_r.fn == expected_fn, "context_cf_clist_traverse_r.fn ==  expected_fn");
     UtAssert_STUB_COUNT(CF_CList_InsertAfter, 0);
     UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.head, expected_insert_back_head);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.node, expected_insert_back_node);
+    UtAssert_ADDRESS_EQ(context_clist_insert_back.head, &chan->qs[arg_q]);
+    UtAssert_ADDRESS_EQ(context_clist_insert_back.node, &arg_t->cl_node);
     UtAssert_True(arg_t->flags.com.q_index == arg_q, "txn->flags.com.q_index is %u and should be %u (q)",
                   arg_t->flags.com.q_index, arg_q);
 }
 
+/*******************************************************************************
+**
+**  CF_PendingPrioSearch tests
+**
+*******************************************************************************/
+
+void Test_CF_PendingPrioSearch(void)
+{
+    /* Test case for:
+     * CF_CListTraverse_Status_t CF_PendingPrioSearch(CF_CListNode_t *node, void *context)
+     */
+    CF_PendingFile_t                 pf;
+    CF_Traverse_PendingPriorityArg_t args;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&args, 0, sizeof(args));
+
+    /* a file with a greater priority value keeps the search going */
+    pf.priority   = 5;
+    args.priority = 4;
+    UtAssert_INT32_EQ(CF_PendingPrioSearch(&pf.cl_node, &args), CF_CLIST_CONT);
+    UtAssert_NULL(args.pf);
+
+    /* the same priority stops it, the new file goes after this one */
+    args.priority = 5;
+    UtAssert_INT32_EQ(CF_PendingPrioSearch(&pf.cl_node, &args), CF_CLIST_EXIT);
+    UtAssert_ADDRESS_EQ(args.pf, &pf);
+
+    /* as does a lower priority value */
+    args.pf       = NULL;
+    args.priority = 6;
+    UtAssert_INT32_EQ(CF_PendingPrioSearch(&pf.cl_node, &args), CF_CLIST_EXIT);
+    UtAssert_ADDRESS_EQ(args.pf, &pf);
+}
+
+/*******************************************************************************
+**
+**  CF_RecordQueueLatency tests
+**
+*******************************************************************************/
+
+void Test_CF_RecordQueueLatency(void)
+{
+    /* Test case for:
+     * void CF_RecordQueueLatency(const CF_Transaction_t *txn)
+     */
+    CF_Transaction_t     txn;
+    CF_TransactionCold_t cold;
+
+    memset(&txn, 0, sizeof(txn));
+    memset(&cold, 0, sizeof(cold));
+    txn.chan_num = UT_CFDP_CHANNEL;
+    txn.priority = 3;
+    txn.cold     = &cold;
+
+    /* pending and free queues are not transaction queues */
+    txn.flags.com.q_index = CF_QueueIdx_PEND;
+    UtAssert_VOIDCALL(CF_RecordQueueLatency(&txn));
+    txn.flags.com.q_index = CF_QueueIdx_FREE;
+    UtAssert_VOIDCALL(CF_RecordQueueLatency(&txn));
+    UtAssert_STUB_COUNT(CF_Perf_RecordLatency, 0);
+
+    /* transaction queues are recorded */
+    txn.flags.com.q_index = CF_QueueIdx_TXA;
+    UtAssert_VOIDCALL(CF_RecordQueueLatency(&txn));
+    UtAssert_STUB_COUNT(CF_Perf_RecordLatency, 1);
+
+    txn.flags.com.q_index = CF_QueueIdx_RX;
+    UtAssert_VOIDCALL(CF_RecordQueueLatency(&txn));
+    UtAssert_STUB_COUNT(CF_Perf_RecordLatency, 2);
+}
+
+/*******************************************************************************
+**
+**  CF_InsertSortPendingFile tests
+**
+*******************************************************************************/
+
+void Test_CF_InsertSortPendingFile(void)
+{
+    /* Test case for:
+     * void CF_InsertSortPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+     */
+    CF_PendingFile_t pf;
+    CF_PendingFile_t prev;
+    CF_Channel_t *   chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&prev, 0, sizeof(prev));
+
+    /* nothing to insert after, goes to the back */
+    UtAssert_VOIDCALL(CF_InsertSortPendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_Traverse_R, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 0);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 1);
+
+    /* the search found a file to insert after */
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse_R), UT_AltHandler_CF_CList_Traverse_R_PendingPrio_SetPf, &prev);
+    UtAssert_VOIDCALL(CF_InsertSortPendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 2);
+
+    /* both times it also went on the list of its source, a suspended file does not */
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 2);
+    pf.suspended = true;
+    UtAssert_VOIDCALL(CF_InsertSortPendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 3);
+}
+
+/*******************************************************************************
+**
+**  CF_PendingFileBefore tests
+**
+*******************************************************************************/
+
+void Test_CF_PendingFileBefore(void)
+{
+    /* Test case for:
+     * bool CF_PendingFileBefore(const CF_PendingFile_t *pf1, const CF_PendingFile_t *pf2)
+     */
+    CF_PendingFile_t pf1;
+    CF_PendingFile_t pf2;
+
+    memset(&pf1, 0, sizeof(pf1));
+    memset(&pf2, 0, sizeof(pf2));
+
+    /* priority comes first, regardless of the order they were queued in */
+    pf1.priority = 1;
+    pf1.seq_num  = 10;
+    pf2.priority = 2;
+    pf2.seq_num  = 5;
+    UtAssert_BOOL_TRUE(CF_PendingFileBefore(&pf1, &pf2));
+    UtAssert_BOOL_FALSE(CF_PendingFileBefore(&pf2, &pf1));
+
+    /* same priority, in the order they were queued */
+    pf2.priority = 1;
+    UtAssert_BOOL_TRUE(CF_PendingFileBefore(&pf2, &pf1));
+    UtAssert_BOOL_FALSE(CF_PendingFileBefore(&pf1, &pf2));
+    UtAssert_BOOL_FALSE(CF_PendingFileBefore(&pf1, &pf1));
+
+    /* across a wrap of the sequence number */
+    pf1.seq_num = ~(CF_TransactionSeq_t)0;
+    pf2.seq_num = 1;
+    UtAssert_BOOL_TRUE(CF_PendingFileBefore(&pf1, &pf2));
+    UtAssert_BOOL_FALSE(CF_PendingFileBefore(&pf2, &pf1));
+}
+
+/*******************************************************************************
+**
+**  CF_LinkPendingFileSource tests
+**
+*******************************************************************************/
+
+void Test_CF_LinkPendingFileSource(void)
+{
+    /* Test case for:
+     * void CF_LinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf)
+     */
+    CF_PendingFile_t pf;
+    CF_PendingFile_t first;
+    CF_PendingFile_t last;
+    CF_Playback_t    pb;
+    CF_Channel_t *   chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&first, 0, sizeof(first));
+    memset(&last, 0, sizeof(last));
+    memset(&pb, 0, sizeof(pb));
+    first.seq_num       = 1;
+    last.seq_num        = 3;
+    first.src_node.next = &last.src_node;
+    first.src_node.prev = &last.src_node;
+    last.src_node.next  = &first.src_node;
+    last.src_node.prev  = &first.src_node;
+    pb.pend             = &first.src_node;
+
+    /* empty source list */
+    chan->cmd_pend = NULL;
+    UtAssert_VOIDCALL(CF_LinkPendingFileSource(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 1);
+
+    /* goes after the last file queued before it */
+    chan->cmd_pend = &first.src_node;
+    pf.seq_num     = 2;
+    UtAssert_VOIDCALL(CF_LinkPendingFileSource(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 1);
+
+    /* a higher priority file goes to the front of its playback list */
+    pf.pb          = &pb;
+    first.priority = 1;
+    last.priority  = 1;
+    UtAssert_VOIDCALL(CF_LinkPendingFileSource(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 2);
+}
+
+/*******************************************************************************
+**
+**  CF_RemovePendingFile tests
+**
+*******************************************************************************/
+
+void Test_CF_RemovePendingFile(void)
+{
+    /* Test case for:
+     * void CF_RemovePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+     */
+    CF_PendingFile_t pf;
+    CF_Channel_t *   chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    memset(&pf, 0, sizeof(pf));
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND] = 2;
+
+    /* taken off its source list and the pending queue */
+    UtAssert_VOIDCALL(CF_RemovePendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 1);
+
+    /* a suspended file is only on the pending queue */
+    pf.suspended = true;
+    UtAssert_VOIDCALL(CF_RemovePendingFile(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 3);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND]);
+
+    /* unlinking alone leaves the pending queue as it is */
+    UtAssert_VOIDCALL(CF_UnlinkPendingFileSource(chan, &pf));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 4);
+}
+
+/*******************************************************************************
+**
+**  CF_PendingFileNames tests
+**
+*******************************************************************************/
+
+void Test_CF_PendingFileNames(void)
+{
+    /* Test case for:
+     * void CF_PendingFileNames(const CF_PendingFile_t *pf, CF_TxnFilenames_t *fnames)
+     */
+    CF_PendingFile_t  pf;
+    CF_TxnFilenames_t fnames;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&fnames, 0, sizeof(fnames));
+    memcpy(pf.leaves, "sf\0df", 6);
+
+    /* the destination leaf follows the source one */
+    UtAssert_VOIDCALL(CF_PendingFileNames(&pf, &fnames));
+    UtAssert_STRINGBUF_EQ(fnames.src_filename, sizeof(fnames.src_filename), "sf", -1);
+    UtAssert_STRINGBUF_EQ(fnames.dst_filename, sizeof(fnames.dst_filename), "df", -1);
+
+    /* the same leaf is used for both */
+    pf.same_leaf = true;
+    UtAssert_VOIDCALL(CF_PendingFileNames(&pf, &fnames));
+    UtAssert_STRINGBUF_EQ(fnames.src_filename, sizeof(fnames.src_filename), "sf", -1);
+    UtAssert_STRINGBUF_EQ(fnames.dst_filename, sizeof(fnames.dst_filename), "sf", -1);
+    UtAssert_STUB_COUNT(CF_NameTable_BuildPath, 4);
+}
+
+/*******************************************************************************
+**
+**  CF_TraversePendingFiles tests
+**
+*******************************************************************************/
+
+void Test_CF_TraversePendingFiles_Impl(void)
+{
+    /* Test case for:
+     * CF_CListTraverse_Status_t CF_TraversePendingFiles_Impl(CF_CListNode_t *node, void *arg)
+     */
+    CF_PendingFile_t         pf;
+    CF_TraversePending_Arg_t args;
+
+    memset(&pf, 0, sizeof(pf));
+    memset(&args, 0, sizeof(args));
+    args.fn      = UT_Callback_CF_TraversePendingFiles;
+    args.counter = 3;
+
+    UtAssert_INT32_EQ(CF_TraversePendingFiles_Impl(&pf.cl_node, &args), CF_CLIST_CONT);
+    UtAssert_STUB_COUNT(UT_Callback_CF_TraversePendingFiles, 1);
+    UtAssert_INT32_EQ(args.counter, 4);
+}
+
+void Test_CF_TraversePendingFiles(void)
+{
+    /* Test case for:
+     * int32 CF_TraversePendingFiles(CF_Channel_t *chan, CF_TraversePendingFiles_fn_t fn, void *context)
+     */
+    CF_Channel_t *chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    /* the stub does not call back, so nothing is counted */
+    UtAssert_INT32_EQ(CF_TraversePendingFiles(chan, UT_Callback_CF_TraversePendingFiles, NULL), 0);
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
+}
+
 /*******************************************************************************
 **
 **  CF_TraverseAllTransactions_Impl tests
@@ -889,7 +1572,7 @@ void Test_CF_TraverseAllTransactions_CallOtherFunction_CF_Q_RX_TimesAndReturn_ar
     CF_Channel_t *  arg_c;
     int             context;
     void *          arg_context    = &context;
-    uint8           expected_count = CF_QueueIdx_RX - CF_QueueIdx_PEND + 1;
+    uint8           expected_count = CF_QueueIdx_RX - CF_QueueIdx_TXA + 1;
     CF_CListNode_t *expected_qs_nodes[expected_count];
     int             i = 0;
 
@@ -898,7 +1581,7 @@ void Test_CF_TraverseAllTransactions_CallOtherFunction_CF_Q_RX_TimesAndReturn_ar
 
     for (i = 0; i < expected_count; ++i)
     {
-        chan.qs[i] = (CF_CListNode_t *)&expected_qs_nodes[i];
+        chan.qs[CF_QueueIdx_TXA + i] = (CF_CListNode_t *)&expected_qs_nodes[i];
     }
 
     /* set context */
@@ -941,7 +1624,7 @@ void Test_CF_TraverseAllTransactions_All_Channels_ReturnTotalTraversals(void)
     /* Arrange */
     int   context;
     void *arg_context       = &context;
-    uint8 per_channel_count = CF_QueueIdx_RX - CF_QueueIdx_PEND + 1;
+    uint8 per_channel_count = CF_QueueIdx_RX - CF_QueueIdx_TXA + 1;
     int   expected_result   = per_channel_count * CF_NUM_CHANNELS;
 
     CF_TraverseAllTransactions_fn_t arg_fn = NULL;
@@ -1071,6 +1754,67 @@ void Test_CF_WrappedLseek_Call_OS_lseek_WithGivenArgumentsAndReturnItsReturnValu
     UtAssert_INT32_EQ(CF_WrappedLseek(UT_CF_OS_OBJID, test_offset, test_mode), expected_result);
 }
 
+/*******************************************************************************
+**
+**  CF_WrappedSeek tests
+**
+*******************************************************************************/
+
+void Test_CF_WrappedSeek(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_WrappedSeek(osal_id_t fd, CF_FileSize_t offset);
+     */
+
+    /* nominal, offset within a single step */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 100), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /* nominal, start of file */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 0), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /*
+     * nominal, offset past 4 GiB takes further steps from the current position,
+     * the positions past 2 GiB come back wrapped to negative and then past zero
+     */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, CF_SEEK_STEP_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, (int32)(2 * (uint32)CF_SEEK_STEP_SIZE));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, (int32)(3 * (uint32)CF_SEEK_STEP_SIZE));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 10);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, (4 * (CF_FileSize_t)CF_SEEK_STEP_SIZE) + 10), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_lseek, 5);
+
+    /* first step fails, the OSAL error is passed back */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 100), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /* first step lands elsewhere */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 50);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 100), CF_ERROR);
+
+    /* a later step fails */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, CF_SEEK_STEP_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 3 * (CF_FileSize_t)CF_SEEK_STEP_SIZE), CF_ERROR);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+
+    /* a later step lands elsewhere */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, CF_SEEK_STEP_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, (int32)(2 * (uint32)CF_SEEK_STEP_SIZE) + 1);
+    UtAssert_INT32_EQ(CF_WrappedSeek(UT_CF_OS_OBJID, 3 * (CF_FileSize_t)CF_SEEK_STEP_SIZE), CF_ERROR);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+}
+
 void Test_CF_TxnStatus_IsError(void)
 {
     /* Test function for:
@@ -1150,7 +1894,6 @@ void Test_CF_TxnStatus_From_ConditionCode(void)
 
 void add_cf_utils_h_tests(void)
 {
-    UtTest_Add(Test_CF_ResetHistory, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_ResetHistory");
     UtTest_Add(Test_CF_FindUnusedTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindUnusedTransaction");
     UtTest_Add(Test_CF_FreeTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_FreeTransaction");
@@ -1158,6 +1901,10 @@ void add_cf_utils_h_tests(void)
                "CF_FindTransactionBySequenceNumber_Impl");
     UtTest_Add(Test_CF_FindTransactionBySequenceNumber, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindTransactionBySequenceNumber");
+    UtTest_Add(Test_CF_FindPendingFileBySequenceNumber_Impl, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_FindPendingFileBySequenceNumber_Impl");
+    UtTest_Add(Test_CF_FindPendingFileBySequenceNumber, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_FindPendingFileBySequenceNumber");
 
     /* CF_DequeueTransaction tests */
     UtTest_Add(Test_cf_dequeue_transaction_Call_CF_CList_Remove_AndDecrement_q_size, cf_utils_tests_Setup,
@@ -1191,30 +1938,51 @@ void add_cf_utils_h_tests(void)
                "CF_TxnStatus_From_ConditionCode");
 }
 
-void add_CF_Traverse_WriteHistoryToFile_tests(void)
-{
-    UtTest_Add(Test_CF_Traverse_WriteHistoryQueueEntryToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "CF_Traverse_WriteHistoryQueueEntryToFile");
-}
-
 void add_CF_Traverse_WriteAllTxnToFile_tests(void)
 {
     UtTest_Add(Test_CF_Traverse_WriteTxnQueueEntryToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_Traverse_WriteTxnQueueEntryToFile");
 }
 
+void add_CF_Traverse_WritePendingToFile_tests(void)
+{
+    UtTest_Add(Test_CF_Traverse_WritePendingQueueEntryToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_Traverse_WritePendingQueueEntryToFile");
+}
+
 void add_CF_WriteTxnQueueDataToFile_tests(void)
 {
     UtTest_Add(Test_CF_WriteTxnQueueDataToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "Test_CF_WriteTxnQueueDataToFile");
 }
 
+void add_CF_WritePendingQueueDataToFile_tests(void)
+{
+    UtTest_Add(Test_CF_WritePendingQueueDataToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WritePendingQueueDataToFile");
+}
+
 void add_CF_WriteHistoryQueueDataToFile_tests(void)
 {
     UtTest_Add(Test_CF_WriteHistoryQueueDataToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "Test_CF_WriteHistoryQueueDataToFile");
 }
 
+void add_CF_WriteQueueFile_tests(void)
+{
+    UtTest_Add(Test_CF_WriteQueueFileHeader, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WriteQueueFileHeader");
+    UtTest_Add(Test_CF_WriteQueueFileEntry, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WriteQueueFileEntry");
+    UtTest_Add(Test_CF_WriteQueueDumpEntries_AllStages, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WriteQueueDumpEntries_AllStages");
+    UtTest_Add(Test_CF_WriteQueueDumpEntries_Queue, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WriteQueueDumpEntries_Queue");
+    UtTest_Add(Test_CF_WriteQueueDumpEntries_History, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_WriteQueueDumpEntries_History");
+    UtTest_Add(Test_CF_ProcessQueueDump, cf_utils_tests_Setup, cf_utils_tests_Teardown, "Test_CF_ProcessQueueDump");
+}
+
 void add_CF_PrioSearch_tests(void)
 {
     UtTest_Add(Test_CF_PrioSearch_When_t_PrioIsGreaterThanContextPrioReturn_CLIST_CONT, cf_utils_tests_Setup,
@@ -1238,6 +2006,39 @@ void add_CF_InsertSortPrio_tests(void)
                cf_utils_tests_Teardown, "Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex");
 }
 
+void add_CF_RecordQueueLatency_tests(void)
+{
+    UtTest_Add(Test_CF_RecordQueueLatency, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_RecordQueueLatency");
+}
+
+void add_CF_PendingPrioSearch_tests(void)
+{
+    UtTest_Add(Test_CF_PendingPrioSearch, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_PendingPrioSearch");
+}
+
+void add_CF_InsertSortPendingFile_tests(void)
+{
+    UtTest_Add(Test_CF_InsertSortPendingFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_InsertSortPendingFile");
+}
+
+void add_CF_PendingFileSource_tests(void)
+{
+    UtTest_Add(Test_CF_PendingFileBefore, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_PendingFileBefore");
+    UtTest_Add(Test_CF_LinkPendingFileSource, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_LinkPendingFileSource");
+    UtTest_Add(Test_CF_RemovePendingFile, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_RemovePendingFile");
+    UtTest_Add(Test_CF_PendingFileNames, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_PendingFileNames");
+}
+
+void add_CF_TraversePendingFiles_tests(void)
+{
+    UtTest_Add(Test_CF_TraversePendingFiles_Impl, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_TraversePendingFiles_Impl");
+    UtTest_Add(Test_CF_TraversePendingFiles, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_TraversePendingFiles");
+}
+
 void add_CF_TraverseAllTransactions_Impl_tests(void)
 {
     UtTest_Add(Test_CF_TraverseAllTransactions_Impl_GetContainer_t_Call_args_fn_AndAdd_1_ToCounter,
@@ -1291,6 +2092,11 @@ void add_CF_WrappedLseek_tests(void)
                cf_utils_tests_Teardown, "Test_CF_WrappedLseek_Call_OS_lseek_WithGivenArgumentsAndReturnItsReturnValue");
 }
 
+void add_CF_WrappedSeek_tests(void)
+{
+    UtTest_Add(Test_CF_WrappedSeek, cf_utils_tests_Setup, cf_utils_tests_Teardown, "Test_CF_WrappedSeek");
+}
+
 /*******************************************************************************
 **
 **  cf_utils_tests UtTest_Setup
@@ -1303,18 +2109,33 @@ void UtTest_Setup(void)
 
     add_cf_utils_h_tests();
 
-    add_CF_Traverse_WriteHistoryToFile_tests();
 
     add_CF_Traverse_WriteAllTxnToFile_tests();
 
+    add_CF_Traverse_WritePendingToFile_tests();
+
     add_CF_WriteTxnQueueDataToFile_tests();
 
+    add_CF_WritePendingQueueDataToFile_tests();
+
     add_CF_WriteHistoryQueueDataToFile_tests();
 
+    add_CF_WriteQueueFile_tests();
+
     add_CF_PrioSearch_tests();
 
     add_CF_InsertSortPrio_tests();
 
+    add_CF_RecordQueueLatency_tests();
+
+    add_CF_PendingPrioSearch_tests();
+
+    add_CF_InsertSortPendingFile_tests();
+
+    add_CF_PendingFileSource_tests();
+
+    add_CF_TraversePendingFiles_tests();
+
     add_CF_TraverseAllTransactions_Impl_tests();
 
     add_CF_TraverseAllTransactions_tests();
@@ -1330,4 +2151,6 @@ void UtTest_Setup(void)
     add_CF_WrappedWrite_tests();
 
     add_CF_WrappedLseek_tests();
+
+    add_CF_WrappedSeek_tests();
 }
@@ -0,0 +1,344 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Loopback throughput benchmark of the CF engine.
+ *
+ * The engine has a single set of global state, so the two nodes of the
+ * transfer are the two channels of one engine: channel 0 sends, channel 1
+ * receives, and both use the shared memory transport.  Between engine
+ * wakeups the simulated link moves PDUs from the transmit ring of each
+ * channel to the receive ring of the other.  As both channels share the
+ * local entity ID, the files are sent to that ID.
+ *
+ * Time is simulated, advancing one wakeup period per engine cycle, so the
+ * goodput and PDU rates reflect the engine and link configuration and not
+ * the speed of the host.  CPU time is measured on the host around the
+ * whole run; it includes the stub and link overhead of the simulator, so it
+ * is meant for comparing engine changes on the same host.
+ *
+ * Each scenario sends CF_SIM_NUM_FILES files of CF_SIM_FILE_SIZE bytes
+ * (both can be overridden from the environment variables of the same name)
+ * and checks that they arrive intact.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include "cf_app.h"
+#include "cf_cfdp.h"
+#include "cf_cfdp_sbintf.h"
+
+#include "cf_sim_host.h"
+#include "cf_sim_link.h"
+
+#define CF_SIM_TX_CHAN 0
+#define CF_SIM_RX_CHAN 1
+
+#define CF_SIM_TICKS_PER_SECOND 100
+#define CF_SIM_TICK_USEC        (1000000 / CF_SIM_TICKS_PER_SECOND)
+#define CF_SIM_MAX_SECONDS      3600
+
+#define CF_SIM_NUM_FILES 8
+#define CF_SIM_FILE_SIZE 65536
+
+/* source, destination and temporary file of every transfer must fit */
+#define CF_SIM_MAX_NUM_FILES (CF_SIM_MAX_FILES / 3)
+
+/**
+ * @brief A benchmark run
+ */
+typedef struct CF_SimScenario
+{
+    const char *       name;
+    CF_CFDP_Class_t    cfdp_class;
+    CF_SimLinkConfig_t link; /**< \brief used for both directions */
+} CF_SimScenario_t;
+
+/**
+ * @brief Results of a benchmark run
+ */
+typedef struct CF_SimResult
+{
+    bool   finished;
+    uint32 files_ok;
+    uint64 file_bytes;      /**< \brief total size of the files sent */
+    uint64 good_bytes;      /**< \brief total size of the files that arrived intact */
+    uint64 file_data_bytes; /**< \brief file data sent by the sending channel, retransmissions included */
+    uint64 ticks;
+    double cpu_sec;
+} CF_SimResult_t;
+
+static const CF_SimScenario_t CF_SIM_SCENARIOS[] = {
+    {"class 2, ideal", CF_CFDP_CLASS_2, {0, 0, 0, 0, 0, 0}},
+    {"class 1, ideal", CF_CFDP_CLASS_1, {0, 0, 0, 0, 0, 0}},
+    {"class 2, 256kB/s 50ms", CF_CFDP_CLASS_2, {256000, 50, 0, 0, 0, 0}},
+    {"class 2, 1% loss", CF_CFDP_CLASS_2, {256000, 50, 10, 0, 0, 0}},
+    {"class 2, 5% loss", CF_CFDP_CLASS_2, {256000, 50, 50, 0, 0, 0}},
+    {"class 2, dup+reorder", CF_CFDP_CLASS_2, {256000, 50, 0, 20, 50, 30}},
+    {"class 1, 1% loss", CF_CFDP_CLASS_1, {256000, 50, 10, 0, 0, 0}},
+};
+
+static CF_ConfigTable_t CF_SimConfig;
+static CF_SimLink_t     CF_SimLinks[2];
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Sim_GetParam(const char *name, uint32 dflt, uint32 max)
+{
+    const char *str = getenv(name);
+    uint32      val = dflt;
+
+    if (str && *str)
+    {
+        val = strtoul(str, NULL, 0);
+    }
+    if (val == 0 || val > max)
+    {
+        UtPrintf("%s=%lu out of range, using %lu", name, (unsigned long)val, (unsigned long)dflt);
+        val = dflt;
+    }
+
+    return val;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Sim_InitConfig(void)
+{
+    CF_ChannelConfig_t *cc;
+    int                 i;
+
+    memset(&CF_SimConfig, 0, sizeof(CF_SimConfig));
+
+    CF_SimConfig.ticks_per_second             = CF_SIM_TICKS_PER_SECOND;
+    CF_SimConfig.rx_crc_calc_bytes_per_wakeup = 16384;
+    CF_SimConfig.local_eid                    = 25;
+    CF_SimConfig.outgoing_file_chunk_size     = 480;
+    strncpy(CF_SimConfig.tmp_dir, "/sim/tmp", sizeof(CF_SimConfig.tmp_dir) - 1);
+
+    for (i = 0; i < CF_NUM_CHANNELS; ++i)
+    {
+        cc = &CF_SimConfig.chan[i];
+
+        /* one wakeup can never publish or take more than the rings hold */
+        cc->max_outgoing_messages_per_wakeup = CF_SHM_RING_DEPTH;
+        cc->rx_max_messages_per_wakeup       = CF_SHM_RING_DEPTH;
+        cc->ack_timer_s                      = 3;
+        cc->nak_timer_s                      = 3;
+        cc->inactivity_timer_s               = 30;
+        cc->ack_limit                        = 4;
+        cc->nak_limit                        = 4;
+        cc->pipe_depth_input                 = 16;
+        cc->dequeue_enabled                  = 1;
+        cc->transport                        = CF_CFDP_TransportType_SHM;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_Sim_IsIdle(void)
+{
+    const CF_Channel_t *tx = &CF_AppData.engine.channels[CF_SIM_TX_CHAN];
+    const CF_Channel_t *rx = &CF_AppData.engine.channels[CF_SIM_RX_CHAN];
+
+    return (tx->qs[CF_QueueIdx_PEND] == NULL && tx->qs[CF_QueueIdx_TXA] == NULL &&
+            tx->qs[CF_QueueIdx_TXW] == NULL && rx->qs[CF_QueueIdx_RX] == NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Sim_FillFile(uint8 *data, uint32 size, uint32 seed)
+{
+    uint32 x = seed * 2654435761u + 1;
+    uint32 i;
+
+    for (i = 0; i < size; ++i)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        data[i] = x;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Sim_Run(const CF_SimScenario_t *sc, uint32 num_files, uint32 file_size, CF_SimResult_t *res)
+{
+    char         src[CF_FILENAME_MAX_LEN];
+    char         dst[CF_FILENAME_MAX_LEN];
+    uint8 *      data = malloc(file_size);
+    const uint8 *got;
+    size_t       got_size;
+    uint64       now_usec = 0;
+    clock_t      cpu_start;
+    uint32       i;
+
+    memset(res, 0, sizeof(*res));
+    UtAssert_NOT_NULL(data);
+
+    CF_SimHost_Reset();
+    CF_SimHost_SetTime(0);
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    CF_AppData.config_table = &CF_SimConfig;
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CFE_SUCCESS);
+
+    CF_SimLink_Init(&CF_SimLinks[0], &sc->link, &CF_AppData.engine.shm_rings[CF_SIM_TX_CHAN][CF_Direction_TX],
+                    &CF_AppData.engine.shm_rings[CF_SIM_RX_CHAN][CF_Direction_RX], 0x2545F491);
+    CF_SimLink_Init(&CF_SimLinks[1], &sc->link, &CF_AppData.engine.shm_rings[CF_SIM_RX_CHAN][CF_Direction_TX],
+                    &CF_AppData.engine.shm_rings[CF_SIM_TX_CHAN][CF_Direction_RX], 0x9E3779B9);
+
+    for (i = 0; i < num_files; ++i)
+    {
+        snprintf(src, sizeof(src), "/sim/src/file%03lu.bin", (unsigned long)i);
+        snprintf(dst, sizeof(dst), "/sim/dst/file%03lu.bin", (unsigned long)i);
+        CF_Sim_FillFile(data, file_size, i);
+        UtAssert_BOOL_TRUE(CF_SimHost_CreateFile(src, data, file_size));
+        UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dst, sc->cfdp_class, 1, CF_SIM_TX_CHAN, 0, CF_SimConfig.local_eid),
+                          CFE_SUCCESS);
+        res->file_bytes += file_size;
+    }
+
+    cpu_start = clock();
+    while (!res->finished && res->ticks < ((uint64)CF_SIM_MAX_SECONDS * CF_SIM_TICKS_PER_SECOND))
+    {
+        CF_SimHost_SetTime(now_usec);
+        CF_CFDP_CycleEngine();
+
+        now_usec += CF_SIM_TICK_USEC;
+        CF_SimLink_Pump(&CF_SimLinks[0], now_usec);
+        CF_SimLink_Pump(&CF_SimLinks[1], now_usec);
+
+        ++res->ticks;
+        res->finished = CF_Sim_IsIdle();
+    }
+    res->cpu_sec = (double)(clock() - cpu_start) / CLOCKS_PER_SEC;
+
+    for (i = 0; i < num_files; ++i)
+    {
+        snprintf(dst, sizeof(dst), "/sim/dst/file%03lu.bin", (unsigned long)i);
+        CF_Sim_FillFile(data, file_size, i);
+        got = CF_SimHost_GetFile(dst, &got_size);
+        if (got && got_size == file_size && memcmp(got, data, file_size) == 0)
+        {
+            ++res->files_ok;
+            res->good_bytes += file_size;
+        }
+    }
+
+    res->file_data_bytes = CF_AppData.hk.Payload.channel_hk[CF_SIM_TX_CHAN].counters.sent.file_data_bytes;
+
+    CF_CFDP_DisableEngine();
+    free(data);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Sim_Report(const CF_SimScenario_t *sc, uint32 num_files, const CF_SimResult_t *res)
+{
+    double sim_sec = (double)res->ticks / CF_SIM_TICKS_PER_SECOND;
+    double mbytes  = (double)res->file_bytes / (1024.0 * 1024.0);
+    uint32 pdus    = CF_SimLinks[0].stats.pdus + CF_SimLinks[1].stats.pdus;
+
+    UtPrintf("%-24s %lu/%lu files in %.2f s: goodput %.1f kB/s, %.0f PDU/s, %.1f ms CPU/MB, retransmit %.1f%%",
+             sc->name, (unsigned long)res->files_ok, (unsigned long)num_files, sim_sec,
+             (double)res->good_bytes / 1024.0 / sim_sec, pdus / sim_sec, res->cpu_sec * 1000.0 / mbytes,
+             100.0 * ((double)res->file_data_bytes - (double)res->file_bytes) / (double)res->file_bytes);
+    UtPrintf("%-24s link out %lu PDUs (%lu lost, %lu dup, %lu late, %lu overflow), back %lu PDUs (%lu lost)", "",
+             (unsigned long)CF_SimLinks[0].stats.pdus, (unsigned long)CF_SimLinks[0].stats.lost,
+             (unsigned long)CF_SimLinks[0].stats.duplicated, (unsigned long)CF_SimLinks[0].stats.reordered,
+             (unsigned long)CF_SimLinks[0].stats.overflow, (unsigned long)CF_SimLinks[1].stats.pdus,
+             (unsigned long)CF_SimLinks[1].stats.lost);
+}
+
+/*******************************************************************************
+**
+**  Loopback benchmark
+**
+*******************************************************************************/
+
+void CF_Sim_Setup(void)
+{
+    UT_ResetState(0);
+    CF_SimHost_Init();
+    CF_Sim_InitConfig();
+}
+
+void CF_Sim_Teardown(void)
+{
+    CF_SimHost_Reset();
+}
+
+void CF_Sim_LoopbackBenchmark(void)
+{
+    const uint32   num_files = CF_Sim_GetParam("CF_SIM_NUM_FILES", CF_SIM_NUM_FILES, CF_SIM_MAX_NUM_FILES);
+    const uint32   file_size = CF_Sim_GetParam("CF_SIM_FILE_SIZE", CF_SIM_FILE_SIZE, 0x7FFFFFFF);
+    CF_SimResult_t res;
+    int            i;
+
+    for (i = 0; i < (sizeof(CF_SIM_SCENARIOS) / sizeof(CF_SIM_SCENARIOS[0])); ++i)
+    {
+        CF_Sim_Run(&CF_SIM_SCENARIOS[i], num_files, file_size, &res);
+        CF_Sim_Report(&CF_SIM_SCENARIOS[i], num_files, &res);
+
+        UtAssert_True(res.finished, "%s finished", CF_SIM_SCENARIOS[i].name);
+
+        /* class 1 has no recovery, so only a loss free link must deliver everything */
+        if (CF_SIM_SCENARIOS[i].cfdp_class == CF_CFDP_CLASS_2 || CF_SIM_SCENARIOS[i].link.loss_permille == 0)
+        {
+            UtAssert_UINT32_EQ(res.files_ok, num_files);
+        }
+    }
+}
+
+/*
+ * Register the benchmark to be run.
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(CF_Sim_LoopbackBenchmark, CF_Sim_Setup, CF_Sim_Teardown, "CF_Sim_LoopbackBenchmark");
+}
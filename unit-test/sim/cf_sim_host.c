@@ -0,0 +1,610 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host stand-ins for the cFE and OSAL services used by the loopback simulator.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* UT includes */
+#include "utstubs.h"
+
+#include "cf_sim_host.h"
+#include "cf_extern_typedefs.h"
+
+/**
+ * @brief First OSAL ID handed out for an open file, so an ID of 0 is never valid
+ */
+#define CF_SIM_FD_BASE 0x10000
+
+/**
+ * @brief A file in the in-memory file system
+ */
+typedef struct CF_SimFile
+{
+    bool   in_use;
+    char   path[CF_FILENAME_MAX_LEN];
+    uint8 *data;
+    size_t size;  /**< \brief bytes of content */
+    size_t alloc; /**< \brief bytes allocated for data */
+} CF_SimFile_t;
+
+/**
+ * @brief An open file
+ */
+typedef struct CF_SimOpenFile
+{
+    CF_SimFile_t *file; /**< \brief NULL if this entry is free */
+    size_t        pos;
+} CF_SimOpenFile_t;
+
+static CF_SimFile_t     CF_SimFiles[CF_SIM_MAX_FILES];
+static CF_SimOpenFile_t CF_SimOpenFiles[CF_SIM_MAX_OPEN_FILES];
+static uint64           CF_SimTimeUsec;
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_SimFile_t *CF_SimHost_FindFile(const char *path)
+{
+    CF_SimFile_t *file = NULL;
+    int           i;
+
+    for (i = 0; i < CF_SIM_MAX_FILES; ++i)
+    {
+        if (CF_SimFiles[i].in_use && strcmp(CF_SimFiles[i].path, path) == 0)
+        {
+            file = &CF_SimFiles[i];
+            break;
+        }
+    }
+
+    return file;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_SimFile_t *CF_SimHost_NewFile(const char *path)
+{
+    CF_SimFile_t *file = NULL;
+    int           i;
+
+    for (i = 0; i < CF_SIM_MAX_FILES; ++i)
+    {
+        if (!CF_SimFiles[i].in_use)
+        {
+            file         = &CF_SimFiles[i];
+            file->in_use = true;
+            file->size   = 0;
+            strncpy(file->path, path, sizeof(file->path) - 1);
+            file->path[sizeof(file->path) - 1] = 0;
+            break;
+        }
+    }
+
+    return file;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_FreeFile(CF_SimFile_t *file)
+{
+    free(file->data);
+    memset(file, 0, sizeof(*file));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_SimHost_IsOpen(const CF_SimFile_t *file)
+{
+    bool is_open = false;
+    int  i;
+
+    for (i = 0; i < CF_SIM_MAX_OPEN_FILES; ++i)
+    {
+        if (CF_SimOpenFiles[i].file == file)
+        {
+            is_open = true;
+            break;
+        }
+    }
+
+    return is_open;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_SimHost_Reserve(CF_SimFile_t *file, size_t size)
+{
+    size_t alloc = file->alloc;
+    uint8 *data;
+    bool   success = true;
+
+    if (size > alloc)
+    {
+        if (alloc < 4096)
+        {
+            alloc = 4096;
+        }
+        while (alloc < size)
+        {
+            alloc *= 2;
+        }
+
+        data = realloc(file->data, alloc);
+        if (data)
+        {
+            file->data  = data;
+            file->alloc = alloc;
+        }
+        else
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_SimOpenFile_t *CF_SimHost_GetOpenFile(osal_id_t filedes)
+{
+    unsigned long     idx   = OS_ObjectIdToInteger(filedes) - CF_SIM_FD_BASE;
+    CF_SimOpenFile_t *entry = NULL;
+
+    if (idx < CF_SIM_MAX_OPEN_FILES && CF_SimOpenFiles[idx].file)
+    {
+        entry = &CF_SimOpenFiles[idx];
+    }
+
+    return entry;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_OpenCreate(), supports the create and truncate flags
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_OpenCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *   filedes = UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t *);
+    const char *  path    = UT_Hook_GetArgValueByName(Context, "path", const char *);
+    int32         flags   = UT_Hook_GetArgValueByName(Context, "flags", int32);
+    CF_SimFile_t *file    = CF_SimHost_FindFile(path);
+    int32         status  = OS_ERR_NO_FREE_IDS;
+    int           i;
+
+    *filedes = OS_OBJECT_ID_UNDEFINED;
+
+    if (!file && (flags & OS_FILE_FLAG_CREATE))
+    {
+        file = CF_SimHost_NewFile(path);
+    }
+
+    if (!file)
+    {
+        status = OS_FS_ERR_PATH_INVALID;
+    }
+    else
+    {
+        for (i = 0; i < CF_SIM_MAX_OPEN_FILES; ++i)
+        {
+            if (!CF_SimOpenFiles[i].file)
+            {
+                if (flags & OS_FILE_FLAG_TRUNCATE)
+                {
+                    file->size = 0;
+                }
+
+                CF_SimOpenFiles[i].file = file;
+                CF_SimOpenFiles[i].pos  = 0;
+                *filedes                = OS_ObjectIdFromInteger(CF_SIM_FD_BASE + i);
+                status                  = OS_SUCCESS;
+                break;
+            }
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_close()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_close(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimOpenFile_t *entry  = CF_SimHost_GetOpenFile(UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t));
+    int32             status = OS_ERR_INVALID_ID;
+
+    if (entry)
+    {
+        entry->file = NULL;
+        status      = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_read()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_read(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimOpenFile_t *entry  = CF_SimHost_GetOpenFile(UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t));
+    void *            buffer = UT_Hook_GetArgValueByName(Context, "buffer", void *);
+    size_t            nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32             status = OS_ERR_INVALID_ID;
+
+    if (entry)
+    {
+        if (entry->pos >= entry->file->size)
+        {
+            nbytes = 0;
+        }
+        else if (nbytes > (entry->file->size - entry->pos))
+        {
+            nbytes = entry->file->size - entry->pos;
+        }
+
+        memcpy(buffer, entry->file->data + entry->pos, nbytes);
+        entry->pos += nbytes;
+        status = nbytes;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_write(), writing past the end fills the gap with zeros
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_write(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimOpenFile_t *entry  = CF_SimHost_GetOpenFile(UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t));
+    const void *      buffer = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t            nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32             status = OS_ERR_INVALID_ID;
+
+    if (entry)
+    {
+        if (!CF_SimHost_Reserve(entry->file, entry->pos + nbytes))
+        {
+            status = OS_ERROR;
+        }
+        else
+        {
+            if (entry->pos > entry->file->size)
+            {
+                memset(entry->file->data + entry->file->size, 0, entry->pos - entry->file->size);
+            }
+
+            memcpy(entry->file->data + entry->pos, buffer, nbytes);
+            entry->pos += nbytes;
+            if (entry->pos > entry->file->size)
+            {
+                entry->file->size = entry->pos;
+            }
+
+            status = nbytes;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_lseek()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_lseek(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimOpenFile_t *entry  = CF_SimHost_GetOpenFile(UT_Hook_GetArgValueByName(Context, "filedes", osal_id_t));
+    int32             offset = UT_Hook_GetArgValueByName(Context, "offset", int32);
+    uint32            whence = UT_Hook_GetArgValueByName(Context, "whence", uint32);
+    int32             status = OS_ERR_INVALID_ID;
+    long              pos    = offset;
+
+    if (entry)
+    {
+        if (whence == OS_SEEK_CUR)
+        {
+            pos += entry->pos;
+        }
+        else if (whence == OS_SEEK_END)
+        {
+            pos += entry->file->size;
+        }
+
+        if (pos < 0)
+        {
+            status = OS_ERROR;
+        }
+        else
+        {
+            entry->pos = pos;
+            status     = pos;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_remove()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_remove(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimFile_t *file   = CF_SimHost_FindFile(UT_Hook_GetArgValueByName(Context, "path", const char *));
+    int32         status = OS_FS_ERR_PATH_INVALID;
+
+    if (file)
+    {
+        CF_SimHost_FreeFile(file);
+        status = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_mv(), replaces any existing destination file
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_mv(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimFile_t *file   = CF_SimHost_FindFile(UT_Hook_GetArgValueByName(Context, "src", const char *));
+    const char *  dest   = UT_Hook_GetArgValueByName(Context, "dest", const char *);
+    CF_SimFile_t *old    = CF_SimHost_FindFile(dest);
+    int32         status = OS_FS_ERR_PATH_INVALID;
+
+    if (file)
+    {
+        if (old && old != file)
+        {
+            CF_SimHost_FreeFile(old);
+        }
+
+        strncpy(file->path, dest, sizeof(file->path) - 1);
+        file->path[sizeof(file->path) - 1] = 0;
+        status                             = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for OS_FileOpenCheck()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_OS_FileOpenCheck(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_SimFile_t *file   = CF_SimHost_FindFile(UT_Hook_GetArgValueByName(Context, "Filename", const char *));
+    int32         status = OS_ERROR;
+
+    if (file && CF_SimHost_IsOpen(file))
+    {
+        status = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for CFE_MSG_Init()
+ *
+ * Nothing in the simulator looks at the message ID, so the header only
+ * carries the message size, kept in its first bytes.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_CFE_MSG_Init(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", CFE_MSG_Message_t *);
+    CFE_MSG_Size_t     Size   = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t);
+
+    memset(MsgPtr, 0, Size);
+    memcpy(MsgPtr, &Size, sizeof(Size));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for CFE_MSG_SetSize()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_CFE_MSG_SetSize(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", CFE_MSG_Message_t *);
+    CFE_MSG_Size_t     Size   = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t);
+
+    memcpy(MsgPtr, &Size, sizeof(Size));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for CFE_MSG_GetSize()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_CFE_MSG_GetSize(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", const CFE_MSG_Message_t *);
+    CFE_MSG_Size_t *         Size   = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *);
+
+    memcpy(Size, MsgPtr, sizeof(*Size));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for CFE_MSG_GetType(), all PDUs use the telemetry encapsulation
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_CFE_MSG_GetType(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Type_t *Type = UT_Hook_GetArgValueByName(Context, "Type", CFE_MSG_Type_t *);
+
+    *Type = CFE_MSG_Type_Tlm;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Handler for CFE_TIME_GetTime()
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimHost_CFE_TIME_GetTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t now;
+
+    now.Seconds    = CF_SimTimeUsec / 1000000;
+    now.Subseconds = ((CF_SimTimeUsec % 1000000) << 32) / 1000000;
+
+    UT_Stub_SetReturnValue(FuncKey, now);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_host.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_SimHost_Init(void)
+{
+    CF_SimHost_Reset();
+    CF_SimTimeUsec = 0;
+
+    UT_SetHandlerFunction(UT_KEY(OS_OpenCreate), CF_SimHost_OS_OpenCreate, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_close), CF_SimHost_OS_close, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_read), CF_SimHost_OS_read, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_write), CF_SimHost_OS_write, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_lseek), CF_SimHost_OS_lseek, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_remove), CF_SimHost_OS_remove, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_mv), CF_SimHost_OS_mv, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_FileOpenCheck), CF_SimHost_OS_FileOpenCheck, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_Init), CF_SimHost_CFE_MSG_Init, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_SetSize), CF_SimHost_CFE_MSG_SetSize, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), CF_SimHost_CFE_MSG_GetSize, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetType), CF_SimHost_CFE_MSG_GetType, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_GetTime), CF_SimHost_CFE_TIME_GetTime, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_host.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_SimHost_Reset(void)
+{
+    int i;
+
+    for (i = 0; i < CF_SIM_MAX_FILES; ++i)
+    {
+        CF_SimHost_FreeFile(&CF_SimFiles[i]);
+    }
+
+    memset(CF_SimOpenFiles, 0, sizeof(CF_SimOpenFiles));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_host.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_SimHost_SetTime(uint64 usec)
+{
+    CF_SimTimeUsec = usec;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_host.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_SimHost_CreateFile(const char *path, const void *data, size_t size)
+{
+    CF_SimFile_t *file = CF_SimHost_FindFile(path);
+    bool          success;
+
+    if (!file)
+    {
+        file = CF_SimHost_NewFile(path);
+    }
+
+    success = (file != NULL) && CF_SimHost_Reserve(file, size);
+    if (success)
+    {
+        memcpy(file->data, data, size);
+        file->size = size;
+    }
+
+    return success;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_host.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const uint8 *CF_SimHost_GetFile(const char *path, size_t *size)
+{
+    const CF_SimFile_t *file = CF_SimHost_FindFile(path);
+    const uint8 *       data = NULL;
+
+    *size = 0;
+    if (file && !CF_SimHost_IsOpen(file))
+    {
+        data  = file->data;
+        *size = file->size;
+    }
+
+    return data;
+}
@@ -0,0 +1,92 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host stand-ins for the cFE and OSAL services the CF engine needs in the
+ * loopback simulator.
+ *
+ * The simulator links the real engine against the UtAssert stubs of cFE and
+ * OSAL.  This module installs handlers on the few stubs whose behavior the
+ * engine depends on: an in-memory file system behind the OSAL file calls,
+ * message sizes behind CFE_MSG, and a simulated clock behind CFE_TIME.
+ * Everything else keeps the default stub behavior.
+ */
+
+#ifndef CF_SIM_HOST_H
+#define CF_SIM_HOST_H
+
+#include "cfe.h"
+
+/**
+ * @brief Number of files the in-memory file system can hold
+ */
+#define CF_SIM_MAX_FILES 128
+
+/**
+ * @brief Number of files that can be open at once
+ */
+#define CF_SIM_MAX_OPEN_FILES 32
+
+/************************************************************************/
+/** @brief Install the host stand-ins and start from an empty file system.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Must be called after the UtAssert stub state was reset, as that
+ *       removes the handlers again.  The clock is set back to 0.
+ */
+void CF_SimHost_Init(void);
+
+/************************************************************************/
+/** @brief Remove all files and close all open files.
+ */
+void CF_SimHost_Reset(void);
+
+/************************************************************************/
+/** @brief Set the time returned by CFE_TIME_GetTime().
+ *
+ * @param usec   Simulated time in microseconds
+ */
+void CF_SimHost_SetTime(uint64 usec);
+
+/************************************************************************/
+/** @brief Create a file with the given content, replacing any existing file.
+ *
+ * @param path   Full path of the file
+ * @param data   File content
+ * @param size   Size of the content in bytes
+ *
+ * @returns true on success
+ * @retval  false if the file system is full
+ */
+bool CF_SimHost_CreateFile(const char *path, const void *data, size_t size);
+
+/************************************************************************/
+/** @brief Get the content of a file that is not open.
+ *
+ * @param path   Full path of the file
+ * @param size   Output size of the content in bytes
+ *
+ * @returns Pointer to the file content, valid until the file is next changed
+ * @retval  NULL if the file does not exist or is still open
+ */
+const uint8 *CF_SimHost_GetFile(const char *path, size_t *size);
+
+#endif /* !CF_SIM_HOST_H */
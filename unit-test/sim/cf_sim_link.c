@@ -0,0 +1,207 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Simulated link between two CF channels.
+ */
+
+#include <string.h>
+
+#include "cf_sim_link.h"
+#include "cf_cfdp_shmintf.h"
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Draw against a chance given in 1/1000, using a xorshift generator
+ * so that a run is repeatable for the same seed.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_SimLink_Chance(CF_SimLink_t *link, uint16 permille)
+{
+    uint32 x = link->rand_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    link->rand_state = x;
+
+    return (x % 1000) < permille;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Put a copy of the message in flight, ordered after all PDUs arriving
+ * at the same time or earlier.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimLink_Enqueue(CF_SimLink_t *link, const CFE_SB_Buffer_t *bufptr, CFE_MSG_Size_t size,
+                               uint64 arrive_usec)
+{
+    uint16 slot;
+    uint16 pos;
+
+    if (link->num_free == 0)
+    {
+        ++link->stats.overflow;
+    }
+    else
+    {
+        slot = link->free_slots[--link->num_free];
+
+        link->slots[slot].arrive_usec = arrive_usec;
+        memcpy(link->slots[slot].msg.bytes, bufptr, size);
+
+        pos = link->count;
+        while (pos > 0 && link->slots[link->order[pos - 1]].arrive_usec > arrive_usec)
+        {
+            link->order[pos] = link->order[pos - 1];
+            --pos;
+        }
+
+        link->order[pos] = slot;
+        ++link->count;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_SimLink_Send(CF_SimLink_t *link, const CFE_SB_Buffer_t *bufptr, uint64 now_usec)
+{
+    CFE_MSG_Size_t size = 0;
+    uint64         arrive_usec;
+
+    CFE_MSG_GetSize(&bufptr->Msg, &size);
+    if (size > sizeof(CF_EncapBuffer_t))
+    {
+        size = sizeof(CF_EncapBuffer_t);
+    }
+
+    ++link->stats.pdus;
+    link->stats.bytes += size;
+
+    /* the PDU occupies the link for its serialization time, even if it is then lost */
+    if (link->busy_until_usec < now_usec)
+    {
+        link->busy_until_usec = now_usec;
+    }
+    if (link->config.bandwidth)
+    {
+        link->busy_until_usec += ((uint64)size * 1000000) / link->config.bandwidth;
+    }
+
+    arrive_usec = link->busy_until_usec + ((uint64)link->config.latency_ms * 1000);
+
+    if (CF_SimLink_Chance(link, link->config.loss_permille))
+    {
+        ++link->stats.lost;
+    }
+    else
+    {
+        if (CF_SimLink_Chance(link, link->config.reorder_permille))
+        {
+            ++link->stats.reordered;
+            arrive_usec += (uint64)link->config.reorder_ms * 1000;
+        }
+
+        CF_SimLink_Enqueue(link, bufptr, size, arrive_usec);
+
+        if (CF_SimLink_Chance(link, link->config.dup_permille))
+        {
+            ++link->stats.duplicated;
+            CF_SimLink_Enqueue(link, bufptr, size, arrive_usec);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_link.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_SimLink_Init(CF_SimLink_t *link, const CF_SimLinkConfig_t *config, CF_ShmRing_t *src, CF_ShmRing_t *dst,
+                     uint32 seed)
+{
+    uint16 i;
+
+    memset(link, 0, sizeof(*link));
+
+    link->config     = *config;
+    link->src        = src;
+    link->dst        = dst;
+    link->rand_state = seed;
+
+    for (i = 0; i < CF_SIM_LINK_MAX_QUEUE; ++i)
+    {
+        link->free_slots[i] = CF_SIM_LINK_MAX_QUEUE - 1 - i;
+    }
+    link->num_free = CF_SIM_LINK_MAX_QUEUE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Simulator-scope function
+ * See description in cf_sim_link.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_SimLink_Pump(CF_SimLink_t *link, uint64 now_usec)
+{
+    CFE_SB_Buffer_t *bufs[CF_SHM_RING_DEPTH];
+    CFE_SB_Buffer_t *bufptr;
+    CF_SimLinkPdu_t *pdu;
+    CFE_MSG_Size_t   size;
+    uint32           count;
+    uint32           i;
+
+    count = CF_CFDP_ShmRingPeek(link->src, bufs, CF_SHM_RING_DEPTH);
+    for (i = 0; i < count; ++i)
+    {
+        CF_SimLink_Send(link, bufs[i], now_usec);
+    }
+    CF_CFDP_ShmRingRelease(link->src, count);
+
+    while (link->count > 0 && link->slots[link->order[0]].arrive_usec <= now_usec)
+    {
+        bufptr = CF_CFDP_ShmRingReserve(link->dst);
+        if (!bufptr)
+        {
+            break; /* receiver is behind, the rest waits on the link */
+        }
+
+        pdu  = &link->slots[link->order[0]];
+        size = 0;
+        CFE_MSG_GetSize(&pdu->msg.buf.Msg, &size);
+        memcpy(bufptr, pdu->msg.bytes, size);
+        CF_CFDP_ShmRingCommit(link->dst);
+        ++link->stats.delivered;
+
+        link->free_slots[link->num_free++] = link->order[0];
+        --link->count;
+        memmove(&link->order[0], &link->order[1], link->count * sizeof(link->order[0]));
+    }
+}
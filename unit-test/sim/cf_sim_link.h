@@ -0,0 +1,125 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * One direction of the simulated link between two CF channels.
+ *
+ * The link takes the PDUs a channel has published on the transmit ring of
+ * its shared memory transport, and delivers them to the receive ring of the
+ * peer channel.  In between, each PDU is held for its serialization time at
+ * the link bandwidth plus the link latency, and may be lost, duplicated or
+ * delayed past the PDUs sent after it.
+ */
+
+#ifndef CF_SIM_LINK_H
+#define CF_SIM_LINK_H
+
+#include "cf_cfdp_types.h"
+
+/**
+ * @brief Number of PDUs a link can hold in flight, further PDUs are dropped
+ */
+#define CF_SIM_LINK_MAX_QUEUE 512
+
+/**
+ * @brief Link model parameters, for one direction
+ */
+typedef struct CF_SimLinkConfig
+{
+    uint32 bandwidth;        /**< \brief bytes per second, 0 for unlimited */
+    uint32 latency_ms;       /**< \brief propagation delay added to every PDU */
+    uint16 loss_permille;    /**< \brief chance of losing a PDU, in 1/1000 */
+    uint16 dup_permille;     /**< \brief chance of delivering a PDU twice, in 1/1000 */
+    uint16 reorder_permille; /**< \brief chance of holding a PDU back, in 1/1000 */
+    uint16 reorder_ms;       /**< \brief extra delay of a PDU that is held back */
+} CF_SimLinkConfig_t;
+
+/**
+ * @brief Link counters
+ */
+typedef struct CF_SimLinkStats
+{
+    uint32 pdus;       /**< \brief PDUs taken from the sending channel */
+    uint64 bytes;      /**< \brief size of those PDUs, including encapsulation */
+    uint32 delivered;  /**< \brief PDUs given to the receiving channel, duplicates included */
+    uint32 lost;       /**< \brief PDUs lost by the loss model */
+    uint32 duplicated; /**< \brief PDUs delivered a second time */
+    uint32 reordered;  /**< \brief PDUs held back */
+    uint32 overflow;   /**< \brief PDUs dropped as the link queue was full */
+} CF_SimLinkStats_t;
+
+/**
+ * @brief A PDU in flight
+ */
+typedef struct CF_SimLinkPdu
+{
+    uint64           arrive_usec;
+    CF_EncapBuffer_t msg;
+} CF_SimLinkPdu_t;
+
+/**
+ * @brief One direction of the link
+ */
+typedef struct CF_SimLink
+{
+    CF_SimLinkConfig_t config;
+    CF_SimLinkStats_t  stats;
+
+    CF_ShmRing_t *src; /**< \brief transmit ring of the sending channel */
+    CF_ShmRing_t *dst; /**< \brief receive ring of the receiving channel */
+
+    uint64 busy_until_usec; /**< \brief end of serialization of the last PDU */
+    uint32 rand_state;
+
+    uint16          count;                             /**< \brief PDUs in flight */
+    uint16          order[CF_SIM_LINK_MAX_QUEUE];      /**< \brief slots in flight, by arrival time */
+    uint16          num_free;                          /**< \brief entries in free_slots */
+    uint16          free_slots[CF_SIM_LINK_MAX_QUEUE]; /**< \brief stack of unused slots */
+    CF_SimLinkPdu_t slots[CF_SIM_LINK_MAX_QUEUE];
+} CF_SimLink_t;
+
+/************************************************************************/
+/** @brief Set up one direction of the link.
+ *
+ * @param link   Link to set up
+ * @param config Link model parameters, copied
+ * @param src    Transmit ring of the sending channel
+ * @param dst    Receive ring of the receiving channel
+ * @param seed   Non-zero seed of the loss, duplication and reordering draws
+ */
+void CF_SimLink_Init(CF_SimLink_t *link, const CF_SimLinkConfig_t *config, CF_ShmRing_t *src, CF_ShmRing_t *dst,
+                     uint32 seed);
+
+/************************************************************************/
+/** @brief Move PDUs across the link up to the given time.
+ *
+ * @par Description
+ *       Takes every PDU published on the source ring as sent at now_usec,
+ *       then delivers the PDUs that have arrived by now_usec to the
+ *       destination ring, in order of arrival, until it is full.  PDUs that
+ *       do not fit stay on the link until the next call.
+ *
+ * @param link     Link to run
+ * @param now_usec Current simulated time in microseconds
+ */
+void CF_SimLink_Pump(CF_SimLink_t *link, uint64 now_usec);
+
+#endif /* !CF_SIM_LINK_H */
@@ -103,11 +103,13 @@ void UT_DefaultHandler_CF_CFDP_PlaybackDir(void *UserObj, UT_EntryKey_t FuncKey,
         strncpy(ctxt->src_filename, ptr, sizeof(ctxt->src_filename));
         ptr = UT_Hook_GetArgValueByName(Context, "dst_filename", const char *);
         strncpy(ctxt->dst_filename, ptr, sizeof(ctxt->dst_filename));
-        ctxt->cfdp_class = UT_Hook_GetArgValueByName(Context, "cfdp_class", CF_CFDP_Class_t);
-        ctxt->keep       = UT_Hook_GetArgValueByName(Context, "keep", uint8);
-        ctxt->chan       = UT_Hook_GetArgValueByName(Context, "chan", uint8);
-        ctxt->priority   = UT_Hook_GetArgValueByName(Context, "priority", uint8);
-        ctxt->dest_id    = UT_Hook_GetArgValueByName(Context, "dest_id", uint16);
+        ctxt->cfdp_class  = UT_Hook_GetArgValueByName(Context, "cfdp_class", CF_CFDP_Class_t);
+        ctxt->keep        = UT_Hook_GetArgValueByName(Context, "keep", uint8);
+        ctxt->chan        = UT_Hook_GetArgValueByName(Context, "chan", uint8);
+        ctxt->priority    = UT_Hook_GetArgValueByName(Context, "priority", uint8);
+        ctxt->dest_id     = UT_Hook_GetArgValueByName(Context, "dest_id", uint16);
+        ctxt->max_active  = UT_Hook_GetArgValueByName(Context, "max_active", uint16);
+        ctxt->max_pending = UT_Hook_GetArgValueByName(Context, "max_pending", uint16);
     }
 }
 
@@ -39,6 +39,19 @@ void CF_CFDP_R1_Recv(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     UT_GenStub_Execute(CF_CFDP_R1_Recv, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R1_RecvParity()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_R1_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+{
+    UT_GenStub_AddParam(CF_CFDP_R1_RecvParity, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_R1_RecvParity, CF_Logical_PduBuffer_t *, ph);
+
+    UT_GenStub_Execute(CF_CFDP_R1_RecvParity, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_R1_Reset()
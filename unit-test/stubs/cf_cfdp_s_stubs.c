@@ -226,13 +226,14 @@ CFE_Status_t CF_CFDP_S_SendEof(CF_Transaction_t *txn)
  * Generated stub function for CF_CFDP_S_SendFileData()
  * ----------------------------------------------------
  */
-CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc)
+CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+                                    uint8 calc_crc)
 {
     UT_GenStub_SetupReturnBuffer(CF_CFDP_S_SendFileData, CFE_Status_t);
 
     UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_Transaction_t *, txn);
-    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint32, foffs);
-    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint32, bytes_to_read);
+    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_FileSize_t, foffs);
+    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_FileSize_t, bytes_to_read);
     UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint8, calc_crc);
 
     UT_GenStub_Execute(CF_CFDP_S_SendFileData, Basic, NULL);
@@ -28,6 +28,22 @@
 
 void UT_DefaultHandler_CF_CFDP_MsgOutGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_GetTransport()
+ * ----------------------------------------------------
+ */
+const CF_CFDP_Transport_t *CF_CFDP_GetTransport(uint8 type)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_GetTransport, const CF_CFDP_Transport_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_GetTransport, uint8, type);
+
+    UT_GenStub_Execute(CF_CFDP_GetTransport, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_GetTransport, const CF_CFDP_Transport_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_MsgOutGet()
@@ -45,6 +61,43 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
     return UT_GenStub_GetReturnValue(CF_CFDP_MsgOutGet, CF_Logical_PduBuffer_t *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_MsgOutPoolDrain()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_MsgOutPoolDrain(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_MsgOutPoolDrain, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_MsgOutPoolDrain, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_MsgOutPoolFill()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_MsgOutPoolFill(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_MsgOutPoolFill, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_MsgOutPoolFill, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ReceiveDecodeStart()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ReceiveDecodeStart(const CFE_SB_Buffer_t *bufptr, CF_Logical_PduBuffer_t *ph)
+{
+    UT_GenStub_AddParam(CF_CFDP_ReceiveDecodeStart, const CFE_SB_Buffer_t *, bufptr);
+    UT_GenStub_AddParam(CF_CFDP_ReceiveDecodeStart, CF_Logical_PduBuffer_t *, ph);
+
+    UT_GenStub_Execute(CF_CFDP_ReceiveDecodeStart, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_ReceiveMessage()
@@ -57,6 +110,124 @@ void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
     UT_GenStub_Execute(CF_CFDP_ReceiveMessage, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ReceivePdu()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ReceivePdu(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    UT_GenStub_AddParam(CF_CFDP_ReceivePdu, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_ReceivePdu, CFE_SB_Buffer_t *, bufptr);
+
+    UT_GenStub_Execute(CF_CFDP_ReceivePdu, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ReceiveSortedBatch()
+ * ----------------------------------------------------
+ */
+uint32 CF_CFDP_ReceiveSortedBatch(CF_Channel_t *chan, uint32 max_count)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_ReceiveSortedBatch, uint32);
+
+    UT_GenStub_AddParam(CF_CFDP_ReceiveSortedBatch, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_ReceiveSortedBatch, uint32, max_count);
+
+    UT_GenStub_Execute(CF_CFDP_ReceiveSortedBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_ReceiveSortedBatch, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_RxBatchSort()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_RxBatchSort(CF_CFDP_RxBatchEntry_t *entries, uint32 count)
+{
+    UT_GenStub_AddParam(CF_CFDP_RxBatchSort, CF_CFDP_RxBatchEntry_t *, entries);
+    UT_GenStub_AddParam(CF_CFDP_RxBatchSort, uint32, count);
+
+    UT_GenStub_Execute(CF_CFDP_RxBatchSort, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_RxBatchStage()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_RxBatchStage(CF_CFDP_RxBatchEntry_t *entry, const CFE_SB_Buffer_t *bufptr, CF_EncapBuffer_t *copy)
+{
+    UT_GenStub_AddParam(CF_CFDP_RxBatchStage, CF_CFDP_RxBatchEntry_t *, entry);
+    UT_GenStub_AddParam(CF_CFDP_RxBatchStage, const CFE_SB_Buffer_t *, bufptr);
+    UT_GenStub_AddParam(CF_CFDP_RxBatchStage, CF_EncapBuffer_t *, copy);
+
+    UT_GenStub_Execute(CF_CFDP_RxBatchStage, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SB_GetBuffer()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CF_CFDP_SB_GetBuffer(CF_Channel_t *chan, bool silent)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SB_GetBuffer, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_SB_GetBuffer, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SB_GetBuffer, bool, silent);
+
+    UT_GenStub_Execute(CF_CFDP_SB_GetBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SB_GetBuffer, CFE_SB_Buffer_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SB_ReceiveBatch()
+ * ----------------------------------------------------
+ */
+uint32 CF_CFDP_SB_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SB_ReceiveBatch, uint32);
+
+    UT_GenStub_AddParam(CF_CFDP_SB_ReceiveBatch, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SB_ReceiveBatch, CFE_SB_Buffer_t **, bufs);
+    UT_GenStub_AddParam(CF_CFDP_SB_ReceiveBatch, uint32, max_count);
+
+    UT_GenStub_Execute(CF_CFDP_SB_ReceiveBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SB_ReceiveBatch, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SB_ReleaseBuffer()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_SB_ReleaseBuffer(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    UT_GenStub_AddParam(CF_CFDP_SB_ReleaseBuffer, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SB_ReleaseBuffer, CFE_SB_Buffer_t *, bufptr);
+
+    UT_GenStub_Execute(CF_CFDP_SB_ReleaseBuffer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SB_Transmit()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_SB_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    UT_GenStub_AddParam(CF_CFDP_SB_Transmit, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SB_Transmit, CFE_SB_Buffer_t *, bufptr);
+
+    UT_GenStub_Execute(CF_CFDP_SB_Transmit, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_Send()
@@ -69,3 +240,43 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
 
     UT_GenStub_Execute(CF_CFDP_Send, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_TransportClose()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_TransportClose(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_TransportClose, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_TransportClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_TransportCycle()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_TransportCycle(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_TransportCycle, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_TransportCycle, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_TransportOpen()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_TransportOpen(CF_Channel_t *chan)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_TransportOpen, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_TransportOpen, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_TransportOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_TransportOpen, CFE_Status_t);
+}
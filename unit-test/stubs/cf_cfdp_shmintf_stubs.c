@@ -0,0 +1,167 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_cfdp_shmintf header
+ */
+
+#include "cf_cfdp_shmintf.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SHM_GetBuffer()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CF_CFDP_SHM_GetBuffer(CF_Channel_t *chan, bool silent)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SHM_GetBuffer, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_SHM_GetBuffer, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SHM_GetBuffer, bool, silent);
+
+    UT_GenStub_Execute(CF_CFDP_SHM_GetBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SHM_GetBuffer, CFE_SB_Buffer_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SHM_Open()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_SHM_Open(CF_Channel_t *chan)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SHM_Open, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_SHM_Open, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_SHM_Open, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SHM_Open, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SHM_ReceiveBatch()
+ * ----------------------------------------------------
+ */
+uint32 CF_CFDP_SHM_ReceiveBatch(CF_Channel_t *chan, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SHM_ReceiveBatch, uint32);
+
+    UT_GenStub_AddParam(CF_CFDP_SHM_ReceiveBatch, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SHM_ReceiveBatch, CFE_SB_Buffer_t **, bufs);
+    UT_GenStub_AddParam(CF_CFDP_SHM_ReceiveBatch, uint32, max_count);
+
+    UT_GenStub_Execute(CF_CFDP_SHM_ReceiveBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SHM_ReceiveBatch, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SHM_Transmit()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_SHM_Transmit(CF_Channel_t *chan, CFE_SB_Buffer_t *bufptr)
+{
+    UT_GenStub_AddParam(CF_CFDP_SHM_Transmit, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_SHM_Transmit, CFE_SB_Buffer_t *, bufptr);
+
+    UT_GenStub_Execute(CF_CFDP_SHM_Transmit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ShmGetRing()
+ * ----------------------------------------------------
+ */
+CF_ShmRing_t *CF_CFDP_ShmGetRing(uint8 chan_num, CF_Direction_t dir)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_ShmGetRing, CF_ShmRing_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_ShmGetRing, uint8, chan_num);
+    UT_GenStub_AddParam(CF_CFDP_ShmGetRing, CF_Direction_t, dir);
+
+    UT_GenStub_Execute(CF_CFDP_ShmGetRing, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_ShmGetRing, CF_ShmRing_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ShmRingCommit()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ShmRingCommit(CF_ShmRing_t *ring)
+{
+    UT_GenStub_AddParam(CF_CFDP_ShmRingCommit, CF_ShmRing_t *, ring);
+
+    UT_GenStub_Execute(CF_CFDP_ShmRingCommit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ShmRingPeek()
+ * ----------------------------------------------------
+ */
+uint32 CF_CFDP_ShmRingPeek(CF_ShmRing_t *ring, CFE_SB_Buffer_t **bufs, uint32 max_count)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_ShmRingPeek, uint32);
+
+    UT_GenStub_AddParam(CF_CFDP_ShmRingPeek, CF_ShmRing_t *, ring);
+    UT_GenStub_AddParam(CF_CFDP_ShmRingPeek, CFE_SB_Buffer_t **, bufs);
+    UT_GenStub_AddParam(CF_CFDP_ShmRingPeek, uint32, max_count);
+
+    UT_GenStub_Execute(CF_CFDP_ShmRingPeek, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_ShmRingPeek, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ShmRingRelease()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ShmRingRelease(CF_ShmRing_t *ring, uint32 count)
+{
+    UT_GenStub_AddParam(CF_CFDP_ShmRingRelease, CF_ShmRing_t *, ring);
+    UT_GenStub_AddParam(CF_CFDP_ShmRingRelease, uint32, count);
+
+    UT_GenStub_Execute(CF_CFDP_ShmRingRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ShmRingReserve()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CF_CFDP_ShmRingReserve(CF_ShmRing_t *ring)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_ShmRingReserve, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_ShmRingReserve, CF_ShmRing_t *, ring);
+
+    UT_GenStub_Execute(CF_CFDP_ShmRingReserve, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_ShmRingReserve, CFE_SB_Buffer_t *);
+}
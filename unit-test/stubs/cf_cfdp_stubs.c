@@ -32,6 +32,23 @@ void UT_DefaultHandler_CF_CFDP_PlaybackDir(void *, UT_EntryKey_t, const UT_StubC
 void UT_DefaultHandler_CF_CFDP_ResetTransaction(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_CFDP_TxFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_AddTxnTlm()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_CFDP_AddTxnTlm(CF_CListNode_t *node, void *context)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_AddTxnTlm, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_AddTxnTlm, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_CFDP_AddTxnTlm, void *, context);
+
+    UT_GenStub_Execute(CF_CFDP_AddTxnTlm, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_AddTxnTlm, CF_CListTraverse_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_AppendTlv()
@@ -226,6 +243,19 @@ CF_CListTraverse_Status_t CF_CFDP_DoTick(CF_CListNode_t *node, void *context)
     return UT_GenStub_GetReturnValue(CF_CFDP_DoTick, CF_CListTraverse_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DropPendingFile()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_DropPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    UT_GenStub_AddParam(CF_CFDP_DropPendingFile, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_DropPendingFile, CF_PendingFile_t *, pf);
+
+    UT_GenStub_Execute(CF_CFDP_DropPendingFile, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeStart()
@@ -243,6 +273,49 @@ void CF_CFDP_EncodeStart(CF_EncoderState_t *penc, void *msgbuf, CF_Logical_PduBu
     UT_GenStub_Execute(CF_CFDP_EncodeStart, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EndRelay()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EndRelay(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_CFDP_EndRelay, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_EndRelay, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_FillTxnTlmEntry()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_FillTxnTlmEntry(CF_Transaction_t *txn, CF_TxnTlm_Entry_t *entry, CFE_TIME_SysTime_t now)
+{
+    UT_GenStub_AddParam(CF_CFDP_FillTxnTlmEntry, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_FillTxnTlmEntry, CF_TxnTlm_Entry_t *, entry);
+    UT_GenStub_AddParam(CF_CFDP_FillTxnTlmEntry, CFE_TIME_SysTime_t, now);
+
+    UT_GenStub_Execute(CF_CFDP_FillTxnTlmEntry, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_FindStartablePending()
+ * ----------------------------------------------------
+ */
+CF_PendingFile_t *CF_CFDP_FindStartablePending(CF_Channel_t *chan, const CF_TxGroup_t *group)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_FindStartablePending, CF_PendingFile_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_FindStartablePending, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_FindStartablePending, const CF_TxGroup_t *, group);
+
+    UT_GenStub_Execute(CF_CFDP_FindStartablePending, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_FindStartablePending, CF_PendingFile_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_InitEngine()
@@ -279,7 +352,8 @@ void CF_CFDP_InitTxnTxFile(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_class, ui
  * ----------------------------------------------------
  */
 CFE_Status_t CF_CFDP_PlaybackDir(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
-                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id)
+                                 uint8 keep, uint8 chan, uint8 priority, uint16 dest_id, uint16 max_active,
+                                 uint16 max_pending)
 {
     UT_GenStub_SetupReturnBuffer(CF_CFDP_PlaybackDir, CFE_Status_t);
 
@@ -290,12 +364,26 @@ CFE_Status_t CF_CFDP_PlaybackDir(const char *src_filename, const char *dst_filen
     UT_GenStub_AddParam(CF_CFDP_PlaybackDir, uint8, chan);
     UT_GenStub_AddParam(CF_CFDP_PlaybackDir, uint8, priority);
     UT_GenStub_AddParam(CF_CFDP_PlaybackDir, uint16, dest_id);
+    UT_GenStub_AddParam(CF_CFDP_PlaybackDir, uint16, max_active);
+    UT_GenStub_AddParam(CF_CFDP_PlaybackDir, uint16, max_pending);
 
     UT_GenStub_Execute(CF_CFDP_PlaybackDir, Basic, UT_DefaultHandler_CF_CFDP_PlaybackDir);
 
     return UT_GenStub_GetReturnValue(CF_CFDP_PlaybackDir, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ProcessManifest()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ProcessManifest(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_ProcessManifest, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_ProcessManifest, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_ProcessPlaybackDirectory()
@@ -449,6 +537,23 @@ CFE_Status_t CF_CFDP_RecvNak(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     return UT_GenStub_GetReturnValue(CF_CFDP_RecvNak, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_RecvParity()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_RecvParity(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_RecvParity, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_RecvParity, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_RecvParity, CF_Logical_PduBuffer_t *, ph);
+
+    UT_GenStub_Execute(CF_CFDP_RecvParity, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_RecvParity, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_RecvPh()
@@ -599,6 +704,36 @@ CFE_Status_t CF_CFDP_SendNak(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     return UT_GenStub_GetReturnValue(CF_CFDP_SendNak, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SendParity()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_SendParity(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, size_t len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_SendParity, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_SendParity, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_SendParity, CF_FileSize_t, offset);
+    UT_GenStub_AddParam(CF_CFDP_SendParity, const void *, data);
+    UT_GenStub_AddParam(CF_CFDP_SendParity, size_t, len);
+
+    UT_GenStub_Execute(CF_CFDP_SendParity, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_SendParity, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_SendTxnTlm()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_SendTxnTlm(void)
+{
+
+    UT_GenStub_Execute(CF_CFDP_SendTxnTlm, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_SetTxnStatus()
@@ -612,6 +747,31 @@ void CF_CFDP_SetTxnStatus(CF_Transaction_t *txn, CF_TxnStatus_t txn_stat)
     UT_GenStub_Execute(CF_CFDP_SetTxnStatus, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_StartPendingFile()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_StartPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    UT_GenStub_AddParam(CF_CFDP_StartPendingFile, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CFDP_StartPendingFile, CF_PendingFile_t *, pf);
+
+    UT_GenStub_Execute(CF_CFDP_StartPendingFile, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_StartRelay()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_StartRelay(CF_Transaction_t *rx)
+{
+    UT_GenStub_AddParam(CF_CFDP_StartRelay, CF_Transaction_t *, rx);
+
+    UT_GenStub_Execute(CF_CFDP_StartRelay, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_TickTransactions()
@@ -646,3 +806,57 @@ CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename,
 
     return UT_GenStub_GetReturnValue(CF_CFDP_TxFile, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_TxFileMulti()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_TxFileMulti(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class,
+                                 uint8 keep, uint8 chan, uint8 priority, const CF_EntityId_t *dest_ids, uint8 num_dest)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_TxFileMulti, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, const char *, src_filename);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, const char *, dst_filename);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, CF_CFDP_Class_t, cfdp_class);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, uint8, keep);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, uint8, chan);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, uint8, priority);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, const CF_EntityId_t *, dest_ids);
+    UT_GenStub_AddParam(CF_CFDP_TxFileMulti, uint8, num_dest);
+
+    UT_GenStub_Execute(CF_CFDP_TxFileMulti, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_TxFileMulti, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_TxManifest()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_TxManifest(const char *filename, uint8 keep, uint8 chan)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_TxManifest, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_TxManifest, const char *, filename);
+    UT_GenStub_AddParam(CF_CFDP_TxManifest, uint8, keep);
+    UT_GenStub_AddParam(CF_CFDP_TxManifest, uint8, chan);
+
+    UT_GenStub_Execute(CF_CFDP_TxManifest, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_TxManifest, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_WakeRelay()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_WakeRelay(CF_Transaction_t *rx)
+{
+    UT_GenStub_AddParam(CF_CFDP_WakeRelay, CF_Transaction_t *, rx);
+
+    UT_GenStub_Execute(CF_CFDP_WakeRelay, Basic, NULL);
+}
@@ -90,6 +90,22 @@ uint32 CF_ChunkList_ComputeGaps(const CF_ChunkList_t *chunks, CF_ChunkIdx_t max_
     return UT_GenStub_GetReturnValue(CF_ChunkList_ComputeGaps, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_GetEnd()
+ * ----------------------------------------------------
+ */
+CF_ChunkOffset_t CF_ChunkList_GetEnd(const CF_ChunkList_t *chunks)
+{
+    UT_GenStub_SetupReturnBuffer(CF_ChunkList_GetEnd, CF_ChunkOffset_t);
+
+    UT_GenStub_AddParam(CF_ChunkList_GetEnd, const CF_ChunkList_t *, chunks);
+
+    UT_GenStub_Execute(CF_ChunkList_GetEnd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_ChunkList_GetEnd, CF_ChunkOffset_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ChunkList_GetFirstChunk()
@@ -119,6 +135,22 @@ void CF_ChunkList_RemoveFromFirst(CF_ChunkList_t *chunks, CF_ChunkSize_t size)
     UT_GenStub_Execute(CF_ChunkList_RemoveFromFirst, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_TotalSize()
+ * ----------------------------------------------------
+ */
+CF_ChunkSize_t CF_ChunkList_TotalSize(const CF_ChunkList_t *chunks)
+{
+    UT_GenStub_SetupReturnBuffer(CF_ChunkList_TotalSize, CF_ChunkSize_t);
+
+    UT_GenStub_AddParam(CF_ChunkList_TotalSize, const CF_ChunkList_t *, chunks);
+
+    UT_GenStub_Execute(CF_ChunkList_TotalSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_ChunkList_TotalSize, CF_ChunkSize_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_Chunks_CombineNext()
@@ -84,16 +84,30 @@ void CF_CmdCancel_Txn(CF_Transaction_t *txn, void *ignored)
     UT_GenStub_Execute(CF_CmdCancel_Txn, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CmdDrop_Pending()
+ * ----------------------------------------------------
+ */
+void CF_CmdDrop_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, void *ignored)
+{
+    UT_GenStub_AddParam(CF_CmdDrop_Pending, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_CmdDrop_Pending, CF_PendingFile_t *, pf);
+    UT_GenStub_AddParam(CF_CmdDrop_Pending, void *, ignored);
+
+    UT_GenStub_Execute(CF_CmdDrop_Pending, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CmdValidateChunkSize()
  * ----------------------------------------------------
  */
-CF_ChanAction_Status_t CF_CmdValidateChunkSize(CF_ChunkSize_t val, uint8 chan_num)
+CF_ChanAction_Status_t CF_CmdValidateChunkSize(uint32 val, uint8 chan_num)
 {
     UT_GenStub_SetupReturnBuffer(CF_CmdValidateChunkSize, CF_ChanAction_Status_t);
 
-    UT_GenStub_AddParam(CF_CmdValidateChunkSize, CF_ChunkSize_t, val);
+    UT_GenStub_AddParam(CF_CmdValidateChunkSize, uint32, val);
     UT_GenStub_AddParam(CF_CmdValidateChunkSize, uint8, chan_num);
 
     UT_GenStub_Execute(CF_CmdValidateChunkSize, Basic, NULL);
@@ -166,6 +180,22 @@ CFE_Status_t CF_DisableEngineCmd(const CF_DisableEngineCmd_t *msg)
     return UT_GenStub_GetReturnValue(CF_DisableEngineCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_DisablePerfStatsCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_DisablePerfStatsCmd(const CF_DisablePerfStatsCmd_t *msg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_DisablePerfStatsCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_DisablePerfStatsCmd, const CF_DisablePerfStatsCmd_t *, msg);
+
+    UT_GenStub_Execute(CF_DisablePerfStatsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_DisablePerfStatsCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_DoChanAction()
@@ -267,6 +297,20 @@ void CF_DoSuspRes(const CF_Transaction_Payload_t *payload, uint8 action)
     UT_GenStub_Execute(CF_DoSuspRes, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_DoSuspRes_Pending()
+ * ----------------------------------------------------
+ */
+void CF_DoSuspRes_Pending(CF_Channel_t *chan, CF_PendingFile_t *pf, CF_ChanAction_SuspResArg_t *context)
+{
+    UT_GenStub_AddParam(CF_DoSuspRes_Pending, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_DoSuspRes_Pending, CF_PendingFile_t *, pf);
+    UT_GenStub_AddParam(CF_DoSuspRes_Pending, CF_ChanAction_SuspResArg_t *, context);
+
+    UT_GenStub_Execute(CF_DoSuspRes_Pending, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_DoSuspRes_Txn()
@@ -328,6 +372,22 @@ CFE_Status_t CF_EnableEngineCmd(const CF_EnableEngineCmd_t *msg)
     return UT_GenStub_GetReturnValue(CF_EnableEngineCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_EnablePerfStatsCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_EnablePerfStatsCmd(const CF_EnablePerfStatsCmd_t *msg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_EnablePerfStatsCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_EnablePerfStatsCmd, const CF_EnablePerfStatsCmd_t *, msg);
+
+    UT_GenStub_Execute(CF_EnablePerfStatsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_EnablePerfStatsCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_FindTransactionBySequenceNumberAllChannels()
@@ -457,23 +517,6 @@ CFE_Status_t CF_PurgeQueueCmd(const CF_PurgeQueueCmd_t *msg)
     return UT_GenStub_GetReturnValue(CF_PurgeQueueCmd, CFE_Status_t);
 }
 
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_PurgeTransaction()
- * ----------------------------------------------------
- */
-CF_CListTraverse_Status_t CF_PurgeTransaction(CF_CListNode_t *node, void *ignored)
-{
-    UT_GenStub_SetupReturnBuffer(CF_PurgeTransaction, CF_CListTraverse_Status_t);
-
-    UT_GenStub_AddParam(CF_PurgeTransaction, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_PurgeTransaction, void *, ignored);
-
-    UT_GenStub_Execute(CF_PurgeTransaction, Basic, NULL);
-
-    return UT_GenStub_GetReturnValue(CF_PurgeTransaction, CF_CListTraverse_Status_t);
-}
-
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ResetCmd()
@@ -576,13 +619,14 @@ CFE_Status_t CF_ThawCmd(const CF_ThawCmd_t *msg)
  * ----------------------------------------------------
  */
 int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr, CF_TsnChanAction_fn_t fn,
-                       void *context)
+                       CF_TsnChanPendingAction_fn_t pf_fn, void *context)
 {
     UT_GenStub_SetupReturnBuffer(CF_TsnChanAction, int32);
 
     UT_GenStub_AddParam(CF_TsnChanAction, const CF_Transaction_Payload_t *, data);
     UT_GenStub_AddParam(CF_TsnChanAction, const char *, cmdstr);
     UT_GenStub_AddParam(CF_TsnChanAction, CF_TsnChanAction_fn_t, fn);
+    UT_GenStub_AddParam(CF_TsnChanAction, CF_TsnChanPendingAction_fn_t, pf_fn);
     UT_GenStub_AddParam(CF_TsnChanAction, void *, context);
 
     UT_GenStub_Execute(CF_TsnChanAction, Basic, NULL);
@@ -606,6 +650,38 @@ CFE_Status_t CF_TxFileCmd(const CF_TxFileCmd_t *msg)
     return UT_GenStub_GetReturnValue(CF_TxFileCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_TxFileMultiCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_TxFileMultiCmd(const CF_TxFileMultiCmd_t *msg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_TxFileMultiCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_TxFileMultiCmd, const CF_TxFileMultiCmd_t *, msg);
+
+    UT_GenStub_Execute(CF_TxFileMultiCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_TxFileMultiCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_TxManifestCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_TxManifestCmd(const CF_TxManifestCmd_t *msg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_TxManifestCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_TxManifestCmd, const CF_TxManifestCmd_t *, msg);
+
+    UT_GenStub_Execute(CF_TxManifestCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_TxManifestCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_WakeupCmd()
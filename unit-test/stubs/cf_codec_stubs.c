@@ -116,6 +116,25 @@ void CF_CFDP_DecodeEof(CF_DecoderState_t *state, CF_Logical_PduEof_t *pleof)
     UT_GenStub_Execute(CF_CFDP_DecodeEof, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DecodeFileDataFast()
+ * ----------------------------------------------------
+ */
+bool CF_CFDP_DecodeFileDataFast(CF_DecoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                CF_Logical_PduFileDataHeader_t *plfd)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_DecodeFileDataFast, bool);
+
+    UT_GenStub_AddParam(CF_CFDP_DecodeFileDataFast, CF_DecoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_DecodeFileDataFast, CF_Logical_PduHeader_t *, plh);
+    UT_GenStub_AddParam(CF_CFDP_DecodeFileDataFast, CF_Logical_PduFileDataHeader_t *, plfd);
+
+    UT_GenStub_Execute(CF_CFDP_DecodeFileDataFast, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_DecodeFileDataFast, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_DecodeFileDataHeader()
@@ -212,6 +231,36 @@ void CF_CFDP_DecodeNak(CF_DecoderState_t *state, CF_Logical_PduNak_t *plnak)
     UT_GenStub_Execute(CF_CFDP_DecodeNak, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DecodeParity()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_DecodeParity(CF_DecoderState_t *state, CF_Logical_PduParity_t *plpar)
+{
+    UT_GenStub_AddParam(CF_CFDP_DecodeParity, CF_DecoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_DecodeParity, CF_Logical_PduParity_t *, plpar);
+
+    UT_GenStub_Execute(CF_CFDP_DecodeParity, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DecodePduCrc()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_DecodePduCrc(CF_DecoderState_t *state, const CF_Logical_PduHeader_t *plh)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_DecodePduCrc, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_DecodePduCrc, CF_DecoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_DecodePduCrc, const CF_Logical_PduHeader_t *, plh);
+
+    UT_GenStub_Execute(CF_CFDP_DecodePduCrc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_DecodePduCrc, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_DecodeSegmentRequest()
@@ -324,6 +373,19 @@ void CF_CFDP_EncodeCrc(CF_EncoderState_t *state, uint32 *plcrc)
     UT_GenStub_Execute(CF_CFDP_EncodeCrc, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeCrc16()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeCrc16(CF_EncoderState_t *state, uint16 crc)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeCrc16, CF_EncoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_EncodeCrc16, uint16, crc);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeCrc16, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeEof()
@@ -390,6 +452,37 @@ void CF_CFDP_EncodeHeaderFinalSize(CF_EncoderState_t *state, CF_Logical_PduHeade
     UT_GenStub_Execute(CF_CFDP_EncodeHeaderFinalSize, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeHeaderFromTemplate()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_PduHeaderTemplate_t *tmpl)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, CF_EncoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, CF_Logical_PduHeader_t *, plh);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, const CF_PduHeaderTemplate_t *, tmpl);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeHeaderFromTemplate, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeHeaderTemplate()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeHeaderTemplate(CF_PduHeaderTemplate_t *tmpl, CF_EntityId_t src_eid, CF_EntityId_t dst_eid,
+                                  CF_TransactionSeq_t tsn)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, CF_PduHeaderTemplate_t *, tmpl);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, CF_EntityId_t, src_eid);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, CF_EntityId_t, dst_eid);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, CF_TransactionSeq_t, tsn);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeHeaderTemplate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeHeaderWithoutSize()
@@ -442,6 +535,19 @@ void CF_CFDP_EncodeNak(CF_EncoderState_t *state, CF_Logical_PduNak_t *plnak)
     UT_GenStub_Execute(CF_CFDP_EncodeNak, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeParity()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeParity(CF_EncoderState_t *state, CF_Logical_PduParity_t *plpar)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeParity, CF_EncoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_EncodeParity, CF_Logical_PduParity_t *, plpar);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeParity, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeSegmentRequest()
@@ -63,3 +63,36 @@ void CF_CRC_Start(CF_Crc_t *crc)
 
     UT_GenStub_Execute(CF_CRC_Start, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_StartType()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CRC_StartType(CF_Crc_t *crc, uint8 type)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_StartType, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CRC_StartType, CF_Crc_t *, crc);
+    UT_GenStub_AddParam(CF_CRC_StartType, uint8, type);
+
+    UT_GenStub_Execute(CF_CRC_StartType, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_StartType, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_ValidateType()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CRC_ValidateType(uint8 type)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_ValidateType, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CRC_ValidateType, uint8, type);
+
+    UT_GenStub_Execute(CF_CRC_ValidateType, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_ValidateType, CFE_Status_t);
+}
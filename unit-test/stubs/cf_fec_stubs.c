@@ -0,0 +1,184 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_fec header
+ */
+
+#include "cf_fec.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecDecoder_Add()
+ * ----------------------------------------------------
+ */
+void CF_FecDecoder_Add(CF_FecDecoder_t *dec, CF_FileSize_t offset, size_t len, CF_FileSize_t fsize)
+{
+    UT_GenStub_AddParam(CF_FecDecoder_Add, CF_FecDecoder_t *, dec);
+    UT_GenStub_AddParam(CF_FecDecoder_Add, CF_FileSize_t, offset);
+    UT_GenStub_AddParam(CF_FecDecoder_Add, size_t, len);
+    UT_GenStub_AddParam(CF_FecDecoder_Add, CF_FileSize_t, fsize);
+
+    UT_GenStub_Execute(CF_FecDecoder_Add, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecDecoder_GetLost()
+ * ----------------------------------------------------
+ */
+bool CF_FecDecoder_GetLost(const CF_FecDecoder_t *dec, CF_FileSize_t group_offset, CF_FileSize_t fsize, uint8 *lost)
+{
+    UT_GenStub_SetupReturnBuffer(CF_FecDecoder_GetLost, bool);
+
+    UT_GenStub_AddParam(CF_FecDecoder_GetLost, const CF_FecDecoder_t *, dec);
+    UT_GenStub_AddParam(CF_FecDecoder_GetLost, CF_FileSize_t, group_offset);
+    UT_GenStub_AddParam(CF_FecDecoder_GetLost, CF_FileSize_t, fsize);
+    UT_GenStub_AddParam(CF_FecDecoder_GetLost, uint8 *, lost);
+
+    UT_GenStub_Execute(CF_FecDecoder_GetLost, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_FecDecoder_GetLost, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecDecoder_Init()
+ * ----------------------------------------------------
+ */
+void CF_FecDecoder_Init(CF_FecDecoder_t *dec, const CF_Logical_FecParams_t *params)
+{
+    UT_GenStub_AddParam(CF_FecDecoder_Init, CF_FecDecoder_t *, dec);
+    UT_GenStub_AddParam(CF_FecDecoder_Init, const CF_Logical_FecParams_t *, params);
+
+    UT_GenStub_Execute(CF_FecDecoder_Init, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecEncoder_Add()
+ * ----------------------------------------------------
+ */
+void CF_FecEncoder_Add(CF_FecEncoder_t *enc, CF_FileSize_t offset, const uint8 *data, size_t len, CF_FileSize_t fsize)
+{
+    UT_GenStub_AddParam(CF_FecEncoder_Add, CF_FecEncoder_t *, enc);
+    UT_GenStub_AddParam(CF_FecEncoder_Add, CF_FileSize_t, offset);
+    UT_GenStub_AddParam(CF_FecEncoder_Add, const uint8 *, data);
+    UT_GenStub_AddParam(CF_FecEncoder_Add, size_t, len);
+    UT_GenStub_AddParam(CF_FecEncoder_Add, CF_FileSize_t, fsize);
+
+    UT_GenStub_Execute(CF_FecEncoder_Add, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecEncoder_Init()
+ * ----------------------------------------------------
+ */
+void CF_FecEncoder_Init(CF_FecEncoder_t *enc, const CF_Logical_FecParams_t *params)
+{
+    UT_GenStub_AddParam(CF_FecEncoder_Init, CF_FecEncoder_t *, enc);
+    UT_GenStub_AddParam(CF_FecEncoder_Init, const CF_Logical_FecParams_t *, params);
+
+    UT_GenStub_Execute(CF_FecEncoder_Init, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FecEncoder_NextGroup()
+ * ----------------------------------------------------
+ */
+void CF_FecEncoder_NextGroup(CF_FecEncoder_t *enc)
+{
+    UT_GenStub_AddParam(CF_FecEncoder_NextGroup, CF_FecEncoder_t *, enc);
+
+    UT_GenStub_Execute(CF_FecEncoder_NextGroup, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Fec_GroupEnd()
+ * ----------------------------------------------------
+ */
+CF_FileSize_t CF_Fec_GroupEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, CF_FileSize_t fsize)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Fec_GroupEnd, CF_FileSize_t);
+
+    UT_GenStub_AddParam(CF_Fec_GroupEnd, const CF_Logical_FecParams_t *, params);
+    UT_GenStub_AddParam(CF_Fec_GroupEnd, CF_FileSize_t, group_offset);
+    UT_GenStub_AddParam(CF_Fec_GroupEnd, CF_FileSize_t, fsize);
+
+    UT_GenStub_Execute(CF_Fec_GroupEnd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Fec_GroupEnd, CF_FileSize_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Fec_SegmentEnd()
+ * ----------------------------------------------------
+ */
+CF_FileSize_t CF_Fec_SegmentEnd(const CF_Logical_FecParams_t *params, CF_FileSize_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Fec_SegmentEnd, CF_FileSize_t);
+
+    UT_GenStub_AddParam(CF_Fec_SegmentEnd, const CF_Logical_FecParams_t *, params);
+    UT_GenStub_AddParam(CF_Fec_SegmentEnd, CF_FileSize_t, offset);
+
+    UT_GenStub_Execute(CF_Fec_SegmentEnd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Fec_SegmentEnd, CF_FileSize_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Fec_SegmentLength()
+ * ----------------------------------------------------
+ */
+size_t CF_Fec_SegmentLength(const CF_Logical_FecParams_t *params, CF_FileSize_t group_offset, uint8 index,
+                            CF_FileSize_t fsize)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Fec_SegmentLength, size_t);
+
+    UT_GenStub_AddParam(CF_Fec_SegmentLength, const CF_Logical_FecParams_t *, params);
+    UT_GenStub_AddParam(CF_Fec_SegmentLength, CF_FileSize_t, group_offset);
+    UT_GenStub_AddParam(CF_Fec_SegmentLength, uint8, index);
+    UT_GenStub_AddParam(CF_Fec_SegmentLength, CF_FileSize_t, fsize);
+
+    UT_GenStub_Execute(CF_Fec_SegmentLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Fec_SegmentLength, size_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Fec_Xor()
+ * ----------------------------------------------------
+ */
+void CF_Fec_Xor(uint8 *dst, const uint8 *src, size_t len)
+{
+    UT_GenStub_AddParam(CF_Fec_Xor, uint8 *, dst);
+    UT_GenStub_AddParam(CF_Fec_Xor, const uint8 *, src);
+    UT_GenStub_AddParam(CF_Fec_Xor, size_t, len);
+
+    UT_GenStub_Execute(CF_Fec_Xor, Basic, NULL);
+}
@@ -0,0 +1,84 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_history header
+ */
+
+#include "cf_history.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_HistoryRing_Add()
+ * ----------------------------------------------------
+ */
+void CF_HistoryRing_Add(CF_HistoryRing_t *ring, const CF_History_t *history)
+{
+    UT_GenStub_AddParam(CF_HistoryRing_Add, CF_HistoryRing_t *, ring);
+    UT_GenStub_AddParam(CF_HistoryRing_Add, const CF_History_t *, history);
+
+    UT_GenStub_Execute(CF_HistoryRing_Add, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_HistoryRing_Clear()
+ * ----------------------------------------------------
+ */
+void CF_HistoryRing_Clear(CF_HistoryRing_t *ring)
+{
+    UT_GenStub_AddParam(CF_HistoryRing_Clear, CF_HistoryRing_t *, ring);
+
+    UT_GenStub_Execute(CF_HistoryRing_Clear, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_HistoryRing_Get()
+ * ----------------------------------------------------
+ */
+void CF_HistoryRing_Get(const CF_HistoryRing_t *ring, uint16 index, CF_History_t *history)
+{
+    UT_GenStub_AddParam(CF_HistoryRing_Get, const CF_HistoryRing_t *, ring);
+    UT_GenStub_AddParam(CF_HistoryRing_Get, uint16, index);
+    UT_GenStub_AddParam(CF_HistoryRing_Get, CF_History_t *, history);
+
+    UT_GenStub_Execute(CF_HistoryRing_Get, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_HistoryRing_Init()
+ * ----------------------------------------------------
+ */
+void CF_HistoryRing_Init(CF_HistoryRing_t *ring, CF_HistoryRecord_t *records, uint16 num_records, char *names,
+                         uint16 names_size, CF_NameTable_t *prefixes)
+{
+    UT_GenStub_AddParam(CF_HistoryRing_Init, CF_HistoryRing_t *, ring);
+    UT_GenStub_AddParam(CF_HistoryRing_Init, CF_HistoryRecord_t *, records);
+    UT_GenStub_AddParam(CF_HistoryRing_Init, uint16, num_records);
+    UT_GenStub_AddParam(CF_HistoryRing_Init, char *, names);
+    UT_GenStub_AddParam(CF_HistoryRing_Init, uint16, names_size);
+    UT_GenStub_AddParam(CF_HistoryRing_Init, CF_NameTable_t *, prefixes);
+
+    UT_GenStub_Execute(CF_HistoryRing_Init, Basic, NULL);
+}
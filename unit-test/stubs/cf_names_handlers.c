@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  @brief Handlers for the CF Application interned path name stubs
+ */
+
+#include "cf_names.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utstubs.h"
+#include "utgenstub.h"
+
+#include "cf_test_utils.h"
+
+/*----------------------------------------------------------------
+ *
+ * Writes only the leaf to the output buffer, so tests can see which
+ * file name was used without setting up a name table.
+ *
+ *-----------------------------------------------------------------*/
+void UT_DefaultHandler_CF_NameTable_BuildPath(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *leaf     = UT_Hook_GetArgValueByName(Context, "leaf", const char *);
+    char *      buf      = UT_Hook_GetArgValueByName(Context, "buf", char *);
+    size_t      buf_size = UT_Hook_GetArgValueByName(Context, "buf_size", size_t);
+
+    snprintf(buf, buf_size, "%s", leaf);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Writes the part of the path after the last slash to the leaf buffer,
+ * and returns the status code as the handle, 0 by default.
+ *
+ *-----------------------------------------------------------------*/
+void UT_DefaultHandler_CF_NameTable_InternPath(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *    path      = UT_Hook_GetArgValueByName(Context, "path", const char *);
+    char *          leaf      = UT_Hook_GetArgValueByName(Context, "leaf", char *);
+    size_t          leaf_size = UT_Hook_GetArgValueByName(Context, "leaf_size", size_t);
+    const char *    slash     = strrchr(path, '/');
+    CF_NameHandle_t retval;
+    int32           status_code;
+
+    UT_Stub_GetInt32StatusCode(Context, &status_code);
+    retval = status_code;
+
+    snprintf(leaf, leaf_size, "%s", slash ? slash + 1 : path);
+
+    UT_Stub_SetReturnValue(FuncKey, retval);
+}
@@ -0,0 +1,141 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_names header
+ */
+
+#include "cf_names.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_CF_NameTable_BuildPath(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CF_NameTable_InternPath(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_AddRef()
+ * ----------------------------------------------------
+ */
+void CF_NameTable_AddRef(CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    UT_GenStub_AddParam(CF_NameTable_AddRef, CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_AddRef, CF_NameHandle_t, handle);
+
+    UT_GenStub_Execute(CF_NameTable_AddRef, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_BuildPath()
+ * ----------------------------------------------------
+ */
+void CF_NameTable_BuildPath(const CF_NameTable_t *tab, CF_NameHandle_t prefix, const char *leaf, char *buf,
+                            size_t buf_size)
+{
+    UT_GenStub_AddParam(CF_NameTable_BuildPath, const CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_BuildPath, CF_NameHandle_t, prefix);
+    UT_GenStub_AddParam(CF_NameTable_BuildPath, const char *, leaf);
+    UT_GenStub_AddParam(CF_NameTable_BuildPath, char *, buf);
+    UT_GenStub_AddParam(CF_NameTable_BuildPath, size_t, buf_size);
+
+    UT_GenStub_Execute(CF_NameTable_BuildPath, Basic, UT_DefaultHandler_CF_NameTable_BuildPath);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_Get()
+ * ----------------------------------------------------
+ */
+const char *CF_NameTable_Get(const CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    UT_GenStub_SetupReturnBuffer(CF_NameTable_Get, const char *);
+
+    UT_GenStub_AddParam(CF_NameTable_Get, const CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_Get, CF_NameHandle_t, handle);
+
+    UT_GenStub_Execute(CF_NameTable_Get, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_NameTable_Get, const char *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_Init()
+ * ----------------------------------------------------
+ */
+void CF_NameTable_Init(CF_NameTable_t *tab, CF_NameEntry_t *entries, uint16 num_entries)
+{
+    UT_GenStub_AddParam(CF_NameTable_Init, CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_Init, CF_NameEntry_t *, entries);
+    UT_GenStub_AddParam(CF_NameTable_Init, uint16, num_entries);
+
+    UT_GenStub_Execute(CF_NameTable_Init, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_Intern()
+ * ----------------------------------------------------
+ */
+CF_NameHandle_t CF_NameTable_Intern(CF_NameTable_t *tab, const char *str, size_t len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_NameTable_Intern, CF_NameHandle_t);
+
+    UT_GenStub_AddParam(CF_NameTable_Intern, CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_Intern, const char *, str);
+    UT_GenStub_AddParam(CF_NameTable_Intern, size_t, len);
+
+    UT_GenStub_Execute(CF_NameTable_Intern, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_NameTable_Intern, CF_NameHandle_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_InternPath()
+ * ----------------------------------------------------
+ */
+CF_NameHandle_t CF_NameTable_InternPath(CF_NameTable_t *tab, const char *path, char *leaf, size_t leaf_size)
+{
+    UT_GenStub_SetupReturnBuffer(CF_NameTable_InternPath, CF_NameHandle_t);
+
+    UT_GenStub_AddParam(CF_NameTable_InternPath, CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_InternPath, const char *, path);
+    UT_GenStub_AddParam(CF_NameTable_InternPath, char *, leaf);
+    UT_GenStub_AddParam(CF_NameTable_InternPath, size_t, leaf_size);
+
+    UT_GenStub_Execute(CF_NameTable_InternPath, Basic, UT_DefaultHandler_CF_NameTable_InternPath);
+
+    return UT_GenStub_GetReturnValue(CF_NameTable_InternPath, CF_NameHandle_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_NameTable_Release()
+ * ----------------------------------------------------
+ */
+void CF_NameTable_Release(CF_NameTable_t *tab, CF_NameHandle_t handle)
+{
+    UT_GenStub_AddParam(CF_NameTable_Release, CF_NameTable_t *, tab);
+    UT_GenStub_AddParam(CF_NameTable_Release, CF_NameHandle_t, handle);
+
+    UT_GenStub_Execute(CF_NameTable_Release, Basic, NULL);
+}
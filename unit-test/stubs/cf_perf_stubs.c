@@ -0,0 +1,89 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_perf header
+ */
+
+#include "cf_perf.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Perf_Begin()
+ * ----------------------------------------------------
+ */
+void CF_Perf_Begin(CF_PerfMark_t *mark, CF_PerfPhase_t phase)
+{
+    UT_GenStub_AddParam(CF_Perf_Begin, CF_PerfMark_t *, mark);
+    UT_GenStub_AddParam(CF_Perf_Begin, CF_PerfPhase_t, phase);
+
+    UT_GenStub_Execute(CF_Perf_Begin, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Perf_End()
+ * ----------------------------------------------------
+ */
+void CF_Perf_End(const CF_PerfMark_t *mark)
+{
+    UT_GenStub_AddParam(CF_Perf_End, const CF_PerfMark_t *, mark);
+
+    UT_GenStub_Execute(CF_Perf_End, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Perf_RecordLatency()
+ * ----------------------------------------------------
+ */
+void CF_Perf_RecordLatency(uint8 chan_num, CF_LatencyHist_t hist, uint8 priority, CFE_TIME_SysTime_t start)
+{
+    UT_GenStub_AddParam(CF_Perf_RecordLatency, uint8, chan_num);
+    UT_GenStub_AddParam(CF_Perf_RecordLatency, CF_LatencyHist_t, hist);
+    UT_GenStub_AddParam(CF_Perf_RecordLatency, uint8, priority);
+    UT_GenStub_AddParam(CF_Perf_RecordLatency, CFE_TIME_SysTime_t, start);
+
+    UT_GenStub_Execute(CF_Perf_RecordLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Perf_Reset()
+ * ----------------------------------------------------
+ */
+void CF_Perf_Reset(void)
+{
+
+    UT_GenStub_Execute(CF_Perf_Reset, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Perf_SendTlm()
+ * ----------------------------------------------------
+ */
+void CF_Perf_SendTlm(void)
+{
+
+    UT_GenStub_Execute(CF_Perf_SendTlm, Basic, NULL);
+}
@@ -40,23 +40,6 @@
 
 #include "cf_test_utils.h"
 
-/*----------------------------------------------------------------
- *
- * For compatibility with other tests, this has a mechanism to save its
- * arguments to a test-provided context capture buffer.
- *
- *-----------------------------------------------------------------*/
-void UT_DefaultHandler_CF_ResetHistory(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    CF_CFDP_ResetHistory_context_t *ctxt = UT_CF_GetContextBuffer(FuncKey, CF_CFDP_ResetHistory_context_t);
-
-    if (ctxt)
-    {
-        ctxt->chan    = UT_Hook_GetArgValueByName(Context, "chan", CF_Channel_t *);
-        ctxt->history = UT_Hook_GetArgValueByName(Context, "history", CF_History_t *);
-    }
-}
-
 /*----------------------------------------------------------------
  *
  * For compatibility with other tests, this has a mechanism to save its
@@ -28,7 +28,6 @@
 
 void UT_DefaultHandler_CF_FindTransactionBySequenceNumber(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_FindUnusedTransaction(void *, UT_EntryKey_t, const UT_StubContext_t *);
-void UT_DefaultHandler_CF_ResetHistory(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_TraverseAllTransactions(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_TraverseAllTransactions_All_Channels(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_TxnStatus_IsError(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -36,6 +35,41 @@ void UT_DefaultHandler_CF_WrappedOpenCreate(void *, UT_EntryKey_t, const UT_Stub
 void UT_DefaultHandler_CF_WriteHistoryQueueDataToFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_WriteTxnQueueDataToFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FindPendingFileBySequenceNumber()
+ * ----------------------------------------------------
+ */
+CF_PendingFile_t *CF_FindPendingFileBySequenceNumber(CF_Channel_t       *chan,
+                                                     CF_TransactionSeq_t transaction_sequence_number)
+{
+    UT_GenStub_SetupReturnBuffer(CF_FindPendingFileBySequenceNumber, CF_PendingFile_t *);
+
+    UT_GenStub_AddParam(CF_FindPendingFileBySequenceNumber, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_FindPendingFileBySequenceNumber, CF_TransactionSeq_t, transaction_sequence_number);
+
+    UT_GenStub_Execute(CF_FindPendingFileBySequenceNumber, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_FindPendingFileBySequenceNumber, CF_PendingFile_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_FindPendingFileBySequenceNumber_Impl()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_FindPendingFileBySequenceNumber_Impl(CF_CListNode_t *node, void *context)
+{
+    UT_GenStub_SetupReturnBuffer(CF_FindPendingFileBySequenceNumber_Impl, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_FindPendingFileBySequenceNumber_Impl, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_FindPendingFileBySequenceNumber_Impl, void *, context);
+
+    UT_GenStub_Execute(CF_FindPendingFileBySequenceNumber_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_FindPendingFileBySequenceNumber_Impl, CF_CListTraverse_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_FindTransactionBySequenceNumber()
@@ -101,6 +135,19 @@ void CF_FreeTransaction(CF_Transaction_t *txn)
     UT_GenStub_Execute(CF_FreeTransaction, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_InsertSortPendingFile()
+ * ----------------------------------------------------
+ */
+void CF_InsertSortPendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    UT_GenStub_AddParam(CF_InsertSortPendingFile, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_InsertSortPendingFile, CF_PendingFile_t *, pf);
+
+    UT_GenStub_Execute(CF_InsertSortPendingFile, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_InsertSortPrio()
@@ -114,6 +161,66 @@ void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
     UT_GenStub_Execute(CF_InsertSortPrio, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_LinkPendingFileSource()
+ * ----------------------------------------------------
+ */
+void CF_LinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    UT_GenStub_AddParam(CF_LinkPendingFileSource, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_LinkPendingFileSource, CF_PendingFile_t *, pf);
+
+    UT_GenStub_Execute(CF_LinkPendingFileSource, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_PendingFileBefore()
+ * ----------------------------------------------------
+ */
+bool CF_PendingFileBefore(const CF_PendingFile_t *pf1, const CF_PendingFile_t *pf2)
+{
+    UT_GenStub_SetupReturnBuffer(CF_PendingFileBefore, bool);
+
+    UT_GenStub_AddParam(CF_PendingFileBefore, const CF_PendingFile_t *, pf1);
+    UT_GenStub_AddParam(CF_PendingFileBefore, const CF_PendingFile_t *, pf2);
+
+    UT_GenStub_Execute(CF_PendingFileBefore, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_PendingFileBefore, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_PendingFileNames()
+ * ----------------------------------------------------
+ */
+void CF_PendingFileNames(const CF_PendingFile_t *pf, CF_TxnFilenames_t *fnames)
+{
+    UT_GenStub_AddParam(CF_PendingFileNames, const CF_PendingFile_t *, pf);
+    UT_GenStub_AddParam(CF_PendingFileNames, CF_TxnFilenames_t *, fnames);
+
+    UT_GenStub_Execute(CF_PendingFileNames, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_PendingPrioSearch()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_PendingPrioSearch(CF_CListNode_t *node, void *context)
+{
+    UT_GenStub_SetupReturnBuffer(CF_PendingPrioSearch, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_PendingPrioSearch, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_PendingPrioSearch, void *, context);
+
+    UT_GenStub_Execute(CF_PendingPrioSearch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_PendingPrioSearch, CF_CListTraverse_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_PrioSearch()
@@ -133,15 +240,37 @@ CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for CF_ResetHistory()
+ * Generated stub function for CF_ProcessQueueDump()
+ * ----------------------------------------------------
+ */
+void CF_ProcessQueueDump(void)
+{
+    UT_GenStub_Execute(CF_ProcessQueueDump, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RecordQueueLatency()
+ * ----------------------------------------------------
+ */
+void CF_RecordQueueLatency(const CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_RecordQueueLatency, const CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_RecordQueueLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RemovePendingFile()
  * ----------------------------------------------------
  */
-void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
+void CF_RemovePendingFile(CF_Channel_t *chan, CF_PendingFile_t *pf)
 {
-    UT_GenStub_AddParam(CF_ResetHistory, CF_Channel_t *, chan);
-    UT_GenStub_AddParam(CF_ResetHistory, CF_History_t *, history);
+    UT_GenStub_AddParam(CF_RemovePendingFile, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_RemovePendingFile, CF_PendingFile_t *, pf);
 
-    UT_GenStub_Execute(CF_ResetHistory, Basic, UT_DefaultHandler_CF_ResetHistory);
+    UT_GenStub_Execute(CF_RemovePendingFile, Basic, NULL);
 }
 
 /*
@@ -199,19 +328,54 @@ CF_CListTraverse_Status_t CF_TraverseAllTransactions_Impl(CF_CListNode_t *node,
 
 /*
  * ----------------------------------------------------
- * Generated stub function for CF_Traverse_WriteHistoryQueueEntryToFile()
+ * Generated stub function for CF_TraversePendingFiles()
  * ----------------------------------------------------
  */
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg)
+int32 CF_TraversePendingFiles(CF_Channel_t *chan, CF_TraversePendingFiles_fn_t fn, void *context)
 {
-    UT_GenStub_SetupReturnBuffer(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListTraverse_Status_t);
+    UT_GenStub_SetupReturnBuffer(CF_TraversePendingFiles, int32);
 
-    UT_GenStub_AddParam(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_Traverse_WriteHistoryQueueEntryToFile, void *, arg);
+    UT_GenStub_AddParam(CF_TraversePendingFiles, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_TraversePendingFiles, CF_TraversePendingFiles_fn_t, fn);
+    UT_GenStub_AddParam(CF_TraversePendingFiles, void *, context);
 
-    UT_GenStub_Execute(CF_Traverse_WriteHistoryQueueEntryToFile, Basic, NULL);
+    UT_GenStub_Execute(CF_TraversePendingFiles, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListTraverse_Status_t);
+    return UT_GenStub_GetReturnValue(CF_TraversePendingFiles, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_TraversePendingFiles_Impl()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_TraversePendingFiles_Impl(CF_CListNode_t *node, void *arg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_TraversePendingFiles_Impl, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_TraversePendingFiles_Impl, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_TraversePendingFiles_Impl, void *, arg);
+
+    UT_GenStub_Execute(CF_TraversePendingFiles_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_TraversePendingFiles_Impl, CF_CListTraverse_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Traverse_WritePendingQueueEntryToFile()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_Traverse_WritePendingQueueEntryToFile(CF_CListNode_t *node, void *arg)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Traverse_WritePendingQueueEntryToFile, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_Traverse_WritePendingQueueEntryToFile, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_Traverse_WritePendingQueueEntryToFile, void *, arg);
+
+    UT_GenStub_Execute(CF_Traverse_WritePendingQueueEntryToFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Traverse_WritePendingQueueEntryToFile, CF_CListTraverse_Status_t);
 }
 
 /*
@@ -279,6 +443,19 @@ CF_CFDP_ConditionCode_t CF_TxnStatus_To_ConditionCode(CF_TxnStatus_t txn_stat)
     return UT_GenStub_GetReturnValue(CF_TxnStatus_To_ConditionCode, CF_CFDP_ConditionCode_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_UnlinkPendingFileSource()
+ * ----------------------------------------------------
+ */
+void CF_UnlinkPendingFileSource(CF_Channel_t *chan, CF_PendingFile_t *pf)
+{
+    UT_GenStub_AddParam(CF_UnlinkPendingFileSource, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_UnlinkPendingFileSource, CF_PendingFile_t *, pf);
+
+    UT_GenStub_Execute(CF_UnlinkPendingFileSource, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_WrappedClose()
@@ -346,6 +523,23 @@ CFE_Status_t CF_WrappedRead(osal_id_t fd, void *buf, size_t read_size)
     return UT_GenStub_GetReturnValue(CF_WrappedRead, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_WrappedSeek()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_WrappedSeek(osal_id_t fd, CF_FileSize_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(CF_WrappedSeek, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_WrappedSeek, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WrappedSeek, CF_FileSize_t, offset);
+
+    UT_GenStub_Execute(CF_WrappedSeek, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_WrappedSeek, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_WrappedWrite()
@@ -399,6 +593,75 @@ CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF
     return UT_GenStub_GetReturnValue(CF_WriteHistoryQueueDataToFile, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_WritePendingQueueDataToFile()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_WritePendingQueueDataToFile(osal_id_t fd, CF_Channel_t *chan)
+{
+    UT_GenStub_SetupReturnBuffer(CF_WritePendingQueueDataToFile, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_WritePendingQueueDataToFile, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WritePendingQueueDataToFile, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_WritePendingQueueDataToFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_WritePendingQueueDataToFile, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_WriteQueueDumpEntries()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_WriteQueueDumpEntries(CF_QueueDump_t *dump, uint32 max_entries)
+{
+    UT_GenStub_SetupReturnBuffer(CF_WriteQueueDumpEntries, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_WriteQueueDumpEntries, CF_QueueDump_t *, dump);
+    UT_GenStub_AddParam(CF_WriteQueueDumpEntries, uint32, max_entries);
+
+    UT_GenStub_Execute(CF_WriteQueueDumpEntries, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_WriteQueueDumpEntries, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_WriteQueueFileEntry()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_WriteQueueFileEntry(osal_id_t fd, CF_QueueIdx_t queue, const CF_History_t *history)
+{
+    UT_GenStub_SetupReturnBuffer(CF_WriteQueueFileEntry, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_WriteQueueFileEntry, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WriteQueueFileEntry, CF_QueueIdx_t, queue);
+    UT_GenStub_AddParam(CF_WriteQueueFileEntry, const CF_History_t *, history);
+
+    UT_GenStub_Execute(CF_WriteQueueFileEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_WriteQueueFileEntry, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_WriteQueueFileHeader()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_WriteQueueFileHeader(osal_id_t fd, const CF_QueueDump_t *dump)
+{
+    UT_GenStub_SetupReturnBuffer(CF_WriteQueueFileHeader, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_WriteQueueFileHeader, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WriteQueueFileHeader, const CF_QueueDump_t *, dump);
+
+    UT_GenStub_Execute(CF_WriteQueueFileHeader, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_WriteQueueFileHeader, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_WriteTxnQueueDataToFile()
@@ -83,6 +83,8 @@ typedef struct
     uint8           chan;
     uint8           priority;
     CF_EntityId_t   dest_id;
+    uint16          max_active;
+    uint16          max_pending;
 } CF_CFDP_PlaybackDir_context_t;
 
 typedef struct
@@ -106,12 +108,6 @@ typedef struct
     int               keep_history;
 } CF_CFDP_ResetTransaction_context_t;
 
-typedef struct
-{
-    CF_Channel_t *chan;
-    CF_History_t *history;
-} CF_CFDP_ResetHistory_context_t;
-
 typedef struct
 {
     CF_CListNode_t *start;